@@ -57,7 +57,9 @@
 #include <qwt_plot_marker.h>
 
 #include <cfloat>
+#include <climits>
 #include <algorithm>
+#include <QtMath>
 #include <QMouseEvent>
 #include <QMetaType>
 #include <QPoint>
@@ -194,9 +196,17 @@ static int qwtVerifyRange(int size, int &i1, int &i2)
 }
 
 // 自定义多符号曲线类
+// 点符号为享元（由McQcLjGraphic按风格、颜色、大小缓存共享），曲线只持有引用；
+// 绘制时先按x范围裁剪，点数超过画布像素列数时按像素列保留最小/最大值抽稀，
+// 使绘制开销受画布宽度而非点数限制
 class MultiSymbolCurve : public QwtPlotCurve
 {
 public:
+    MultiSymbolCurve()
+        : m_bSortedX(true)
+    {
+    }
+
     ///
     /// @brief
     ///     覆盖基类设置符号函数
@@ -219,23 +229,18 @@ public:
     /// @brief
     ///     设置曲线符号数组
     ///
-    /// @param[in]  symbols  符号数组
+    /// @param[in]  symbols  符号数组（共享的符号享元）
     ///
     /// @par History:
     /// @li 4170/TangChuXian，2022年7月27日，新建函数
+    /// @li 5774/WuHongTao，2026年10月19日，改为共享符号享元
     ///
-    void setSymbols(const QVector<QwtSymbol*>& symbols)
+    void setSymbols(QVector<std::shared_ptr<QwtSymbol>> symbols)
     {
-        for (QwtSymbol* pSymbol : m_vSymbols)
-        {
-            delete pSymbol;
-        }
-        m_vSymbols.clear();
-
         m_vSymbols = std::move(symbols);
-        if (!m_vSymbols.isEmpty() && (symbol()->style() != QwtSymbol::NoSymbol))
+        if (!m_vSymbols.isEmpty() && (symbol() == Q_NULLPTR || symbol()->style() != QwtSymbol::NoSymbol))
         {
-            setSymbol(new QwtSymbol(QwtSymbol::NoSymbol));
+            QwtPlotCurve::setSymbol(new QwtSymbol(QwtSymbol::NoSymbol));
         }
         qwtUpdateLegendIconSize(this);
         legendChanged();
@@ -251,67 +256,320 @@ public:
     /// @par History:
     /// @li 4170/TangChuXian，2022年7月27日，新建函数
     ///
-    const QVector<QwtSymbol*>& symbols()
+    const QVector<std::shared_ptr<QwtSymbol>>& symbols()
     {
         return m_vSymbols;
     }
 
     ///
     /// @brief
-    ///     重写虚函数
+    ///     重写虚函数（单次绘制：裁剪、抽稀后画线，再按符号分段画点）
     ///
     /// @par History:
     /// @li 4170/TangChuXian，2022年7月27日，新建函数
+    /// @li 5774/WuHongTao，2026年10月19日，增加x范围裁剪和按像素列抽稀
     ///
     virtual void drawSeries(QPainter* painter,
         const QwtScaleMap& xMap, const QwtScaleMap& yMap,
         const QRectF& canvasRect, int from, int to) const override
     {
-        // 调用基类函数, 如果符号数组为空则返回
-        QwtPlotCurve::drawSeries(painter, xMap, yMap, canvasRect, from, to);
-        if (m_vSymbols.isEmpty())
+        const int numSamples = int(dataSize());
+        if (!painter || numSamples <= 0 || from < 0)
+        {
+            return;
+        }
+
+        if (to < 0)
+        {
+            to = numSamples - 1;
+        }
+
+        if (qwtVerifyRange(numSamples, from, to) <= 0)
+        {
+            return;
+        }
+
+        // 裁剪到可见的x范围
+        if (!CullToVisibleRange(xMap, canvasRect, from, to))
+        {
+            return;
+        }
+
+        // 点数未超过像素列数的两倍，直接绘制
+        const int iColumns = qMax(1, qCeil(canvasRect.width()));
+        if (!m_bSortedX || (to - from + 1) <= 2 * iColumns)
         {
             QwtPlotCurve::drawSeries(painter, xMap, yMap, canvasRect, from, to);
+            DrawSymbolRuns(painter, xMap, yMap, canvasRect, from, to);
             return;
         }
 
-        // 如果符号数组不为空，逐个处理符号
-        const size_t numSamples = dataSize();
-        if (!painter || numSamples <= 0 || from < 0)
+        DrawDecimated(painter, xMap, yMap, canvasRect, from, to);
+    }
+
+protected:
+    ///
+    /// @brief
+    ///     数据变化时检查点集是否按x递增（只有递增时才能二分裁剪和按列抽稀）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    virtual void dataChanged() override
+    {
+        m_bSortedX = true;
+        const int numSamples = int(dataSize());
+        for (int i = 1; i < numSamples; ++i)
+        {
+            if (sample(i).x() < sample(i - 1).x())
+            {
+                m_bSortedX = false;
+                break;
+            }
+        }
+
+        QwtPlotCurve::dataChanged();
+    }
+
+private:
+    ///
+    /// @brief
+    ///     获取点对应的符号（无符号数组时使用曲线符号）
+    ///
+    const QwtSymbol* SymbolAt(int i) const
+    {
+        if (m_vSymbols.isEmpty())
+        {
+            const QwtSymbol* pSymbol = symbol();
+            return (pSymbol != Q_NULLPTR && pSymbol->style() != QwtSymbol::NoSymbol) ? pSymbol : Q_NULLPTR;
+        }
+
+        if (i >= m_vSymbols.size() || m_vSymbols[i] == nullptr || m_vSymbols[i]->style() == QwtSymbol::NoSymbol)
+        {
+            return Q_NULLPTR;
+        }
+
+        return m_vSymbols[i].get();
+    }
+
+    ///
+    /// @brief
+    ///     按x范围裁剪绘制区间（两侧各保留一个不可见点，保证连线完整）
+    ///
+    /// @return 区间内有点返回true
+    ///
+    bool CullToVisibleRange(const QwtScaleMap& xMap, const QRectF& canvasRect, int& from, int& to) const
+    {
+        if (!m_bSortedX)
+        {
+            return true;
+        }
+
+        // 可见范围留出半个符号的余量
+        const double dMargin = 10.0;
+        double dMinX = xMap.invTransform(canvasRect.left() - dMargin);
+        double dMaxX = xMap.invTransform(canvasRect.right() + dMargin);
+        if (dMinX > dMaxX)
+        {
+            std::swap(dMinX, dMaxX);
+        }
+
+        // 二分查找第一个x>=dMinX和最后一个x<=dMaxX的点
+        int lo = from, hi = to + 1;
+        while (lo < hi)
+        {
+            int mid = lo + (hi - lo) / 2;
+            (sample(mid).x() < dMinX) ? (lo = mid + 1) : (hi = mid);
+        }
+        int iFirst = lo;
+
+        lo = iFirst;
+        hi = to + 1;
+        while (lo < hi)
         {
+            int mid = lo + (hi - lo) / 2;
+            (sample(mid).x() <= dMaxX) ? (lo = mid + 1) : (hi = mid);
+        }
+        int iLast = lo - 1;
+
+        // 连线需要可见区间外侧的相邻点
+        iFirst = qMax(from, iFirst - 1);
+        iLast = qMin(to, iLast + 1);
+        if (iFirst > iLast)
+        {
+            return false;
+        }
+
+        from = iFirst;
+        to = iLast;
+        return true;
+    }
+
+    ///
+    /// @brief
+    ///     绘制点符号，相同符号的连续点合并为一次调用
+    ///
+    void DrawSymbolRuns(QPainter* painter, const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+        const QRectF& canvasRect, int from, int to) const
+    {
+        if (m_vSymbols.isEmpty())
+        {
+            // 无符号数组时基类已画过曲线符号
             return;
         }
 
-        if (to < 0)
+        int iRunStart = from;
+        const QwtSymbol* pRunSymbol = SymbolAt(from);
+        for (int i = from + 1; i <= to + 1; ++i)
         {
-            to = numSamples - 1;
+            const QwtSymbol* pSymbol = (i <= to) ? SymbolAt(i) : Q_NULLPTR;
+            if (i <= to && pSymbol == pRunSymbol)
+            {
+                continue;
+            }
+
+            if (pRunSymbol != Q_NULLPTR)
+            {
+                drawSymbols(painter, *pRunSymbol, xMap, yMap, canvasRect, iRunStart, i - 1);
+            }
+
+            iRunStart = i;
+            pRunSymbol = pSymbol;
         }
+    }
 
-        // 逐个处理符号
-        if (qwtVerifyRange(numSamples, from, to) > 0)
+    ///
+    /// @brief
+    ///     按像素列抽稀绘制：每列连线保留首、末、最小、最大四个点，
+    ///     每种符号保留最小、最大两个点
+    ///
+    void DrawDecimated(QPainter* painter, const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+        const QRectF& canvasRect, int from, int to) const
+    {
+        // 某一列中某种符号的极值点
+        struct SymbolExtent
         {
-            for (int i = from; i <= to; i++)
+            const QwtSymbol* pSymbol;
+            QPointF ptMin;
+            QPointF ptMax;
+        };
+
+        QPolygonF polyline;
+        polyline.reserve(4 * qCeil(canvasRect.width()) + 8);
+        std::vector<SymbolExtent> vecExtents;
+
+        // 当前列的状态
+        int iColumn = INT_MIN;
+        QPointF ptFirst, ptLast, ptMin, ptMax;
+        int iMinIdx = -1, iMaxIdx = -1;
+
+        // 输出当前列中各符号的极值点
+        auto flushColumn = [&]()
+        {
+            for (const SymbolExtent& ext : vecExtents)
             {
-                // 符号数组已到末尾，退出循环
-                if (i >= m_vSymbols.size())
+                ext.pSymbol->drawSymbol(painter, ext.ptMin);
+                if (ext.ptMax != ext.ptMin)
                 {
-                    break;
+                    ext.pSymbol->drawSymbol(painter, ext.ptMax);
                 }
+            }
+            vecExtents.clear();
+        };
 
-                // 逐个画符号
-                if (m_vSymbols[i]->style() != QwtSymbol::NoSymbol)
+        // 符号画在连线之上，分两遍绘制
+        // 第一遍：连线（每列按点的先后顺序保留首、极值、末点，保持折线走向）
+        const bool bDrawLine = (style() != QwtPlotCurve::NoCurve) && (pen().style() != Qt::NoPen);
+        if (bDrawLine)
+        {
+            for (int i = from; i <= to; ++i)
+            {
+                const QPointF pt(xMap.transform(sample(i).x()), yMap.transform(sample(i).y()));
+                const int iCol = int(pt.x());
+                if (iCol != iColumn)
+                {
+                    if (iColumn != INT_MIN)
+                    {
+                        polyline << ptFirst;
+                        (iMinIdx <= iMaxIdx) ? (polyline << ptMin << ptMax) : (polyline << ptMax << ptMin);
+                        polyline << ptLast;
+                    }
+                    iColumn = iCol;
+                    ptFirst = ptMin = ptMax = pt;
+                    iMinIdx = iMaxIdx = i;
+                }
+                if (pt.y() < ptMin.y())
+                {
+                    ptMin = pt;
+                    iMinIdx = i;
+                }
+                if (pt.y() > ptMax.y())
                 {
-                    painter->save();
-                    drawSymbols(painter, *m_vSymbols[i], xMap, yMap, canvasRect, i, i);
-                    painter->restore();
+                    ptMax = pt;
+                    iMaxIdx = i;
                 }
+                ptLast = pt;
             }
+            if (iColumn != INT_MIN)
+            {
+                polyline << ptFirst;
+                (iMinIdx <= iMaxIdx) ? (polyline << ptMin << ptMax) : (polyline << ptMax << ptMin);
+                polyline << ptLast;
+            }
+
+            painter->save();
+            painter->setPen(pen());
+            painter->setRenderHint(QPainter::Antialiasing, testRenderHint(QwtPlotItem::RenderAntialiased));
+            painter->drawPolyline(polyline);
+            painter->restore();
+            polyline.clear();
         }
+
+        // 第二遍：符号（每列每种符号只画极值点）
+        painter->save();
+        iColumn = INT_MIN;
+        for (int i = from; i <= to; ++i)
+        {
+            const QwtSymbol* pSymbol = SymbolAt(i);
+            if (pSymbol == Q_NULLPTR)
+            {
+                continue;
+            }
+
+            const QPointF pt(xMap.transform(sample(i).x()), yMap.transform(sample(i).y()));
+            const int iCol = int(pt.x());
+            if (iCol != iColumn)
+            {
+                flushColumn();
+                iColumn = iCol;
+            }
+
+            auto it = std::find_if(vecExtents.begin(), vecExtents.end(), [pSymbol](const SymbolExtent& ext) { return ext.pSymbol == pSymbol; });
+            if (it == vecExtents.end())
+            {
+                vecExtents.push_back({ pSymbol, pt, pt });
+                continue;
+            }
+
+            if (pt.y() < it->ptMin.y())
+            {
+                it->ptMin = pt;
+            }
+            if (pt.y() > it->ptMax.y())
+            {
+                it->ptMax = pt;
+            }
+        }
+        flushColumn();
+        painter->restore();
     }
 
 private:
-    // 记录符号数组
-    QVector<QwtSymbol*> m_vSymbols;
+    // 记录符号数组（共享的符号享元）
+    QVector<std::shared_ptr<QwtSymbol>> m_vSymbols;
+
+    // 点集是否按x递增
+    bool m_bSortedX;
 };
 
 McQcLjGraphic::McQcLjGraphic(QWidget *parent, bool bPrintMode)
@@ -1100,12 +1358,13 @@ void McQcLjGraphic::InitBeforeShow()
 /// @param[in]  enCurveId       曲线ID
 /// @param[in]  vecPointSymbol  点符号形状数组
 ///
-/// @return 点符号数组
+/// @return 点符号数组（相同风格、颜色、大小的点共享同一个符号）
 ///
 /// @par History:
 /// @li 4170/TangChuXian，2022年7月27日，新建函数
+/// @li 5774/WuHongTao，2026年10月19日，符号改为享元缓存，图标只加载一次
 ///
-QVector<QwtSymbol*> McQcLjGraphic::ConstructSymbols(CURVE_ID enCurveId, const QVector<QwtSymbol::Style>& vecPointSymbol)
+QVector<std::shared_ptr<QwtSymbol>> McQcLjGraphic::ConstructSymbols(CURVE_ID enCurveId, const QVector<QwtSymbol::Style>& vecPointSymbol)
 {
     // 构造原型
     auto ConstructSymbolsByCurve = [this](CURVE_ID enCurveId, QwtSymbol& symbolModel)
@@ -1153,29 +1412,43 @@ QVector<QwtSymbol*> McQcLjGraphic::ConstructSymbols(CURVE_ID enCurveId, const QV
         default:
             break;
         }
+    };
+
+    // 构造符号数组
+    QVector<std::shared_ptr<QwtSymbol>> vSymbol;
+    vSymbol.reserve(vecPointSymbol.size());
+    QwtSymbol symbolModel;
+    for (QwtSymbol::Style enStyle : vecPointSymbol)
+    {
+        // 先确定颜色和大小，再查找享元
+        symbolModel.setStyle(enStyle);
+        ConstructSymbolsByCurve(enCurveId, symbolModel);
+        auto key = std::make_tuple(int(enStyle), symbolModel.brush().color().rgba(), int(symbolModel.size().width()));
+        auto it = m_mapSymbolCache.find(key);
+        if (it != m_mapSymbolCache.end())
+        {
+            vSymbol.push_back(it->second);
+            continue;
+        }
+
+        auto spSymbol = std::make_shared<QwtSymbol>(enStyle, symbolModel.brush(), symbolModel.pen(), symbolModel.size());
 
         // 如果风格为Triangle
-        if (symbolModel.style() == QwtSymbol::Triangle)
+        if (enStyle == QwtSymbol::Triangle)
         {
             // 设置图标
-            symbolModel.setStyle(QwtSymbol::Pixmap);
-            symbolModel.setPixmap(QPixmap(":/Leonis/resource/image/icon-qc-warn.png"));
+            spSymbol->setStyle(QwtSymbol::Pixmap);
+            spSymbol->setPixmap(QPixmap(":/Leonis/resource/image/icon-qc-warn.png"));
         }
-        else if (symbolModel.style() == QwtSymbol::XCross)
+        else if (enStyle == QwtSymbol::XCross)
         {
             // 设置图标
-            symbolModel.setStyle(QwtSymbol::Pixmap);
-            symbolModel.setPixmap(QPixmap(":/Leonis/resource/image/icon-qc-outctrl.png"));
+            spSymbol->setStyle(QwtSymbol::Pixmap);
+            spSymbol->setPixmap(QPixmap(":/Leonis/resource/image/icon-qc-outctrl.png"));
         }
-    };
 
-    // 构造符号数组
-    QVector<QwtSymbol*> vSymbol;
-    for (QwtSymbol::Style enStyle : vecPointSymbol)
-    {
-        QwtSymbol* pSymbolModel = new QwtSymbol(enStyle);
-        ConstructSymbolsByCurve(enCurveId, *pSymbolModel);
-        vSymbol.push_back(pSymbolModel);
+        m_mapSymbolCache.emplace(key, spSymbol);
+        vSymbol.push_back(spSymbol);
     }
 
     return vSymbol;
@@ -51,6 +51,9 @@
 #include <QMap>
 #include <QVector>
 #include <QDate>
+#include <map>
+#include <memory>
+#include <tuple>
 namespace Ui { class McQcLjGraphic; };
 
 // 前置声明
@@ -278,12 +281,13 @@ protected:
     /// @param[in]  enCurveId       曲线ID
     /// @param[in]  vecPointSymbol  点符号形状数组
     ///
-    /// @return 点符号数组
+    /// @return 点符号数组（相同风格、颜色、大小的点共享同一个符号）
     ///
     /// @par History:
     /// @li 4170/TangChuXian，2022年7月27日，新建函数
+    /// @li 5774/WuHongTao，2026年10月19日，符号改为享元缓存
     ///
-    QVector<QwtSymbol*> ConstructSymbols(CURVE_ID enCurveId, const QVector<QwtSymbol::Style>& vecPointSymbol);
+    QVector<std::shared_ptr<QwtSymbol>> ConstructSymbols(CURVE_ID enCurveId, const QVector<QwtSymbol::Style>& vecPointSymbol);
 
     ///
     /// @brief
@@ -472,6 +476,7 @@ private:
 
     // 不计算点大小
     int                                 m_iNoCalcPointSize;            // 不计算点大小
+    std::map<std::tuple<int, QRgb, int>, std::shared_ptr<QwtSymbol>> m_mapSymbolCache;   // 点符号享元（风格、颜色、大小）
 
     // 选中点信息记录
     SelPointInfo                        m_stuSelPointInfo;             // 选中点信息
@@ -0,0 +1,283 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     NotificationReplay.cpp
+/// @brief    工作页面基准测试的通知回放（按时间轴推送样本、项目更新通知）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+
+#include "NotificationReplay.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <QFile>
+#include <QStringList>
+#include <QTextStream>
+#include "SyntheticData.h"
+#include "thrift/UiControlHandler.h"
+
+NotificationReplay::NotificationReplay()
+    : m_finished(true)
+{
+}
+
+NotificationReplay::~NotificationReplay()
+{
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+///
+/// @brief 从回放文件加载
+///
+/// @param[in]  fileName  文件名
+/// @param[out] error     失败原因
+///
+/// @return true表示成功
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool NotificationReplay::Load(const QString& fileName, QString& error)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        error = QString("cannot open %1").arg(fileName);
+        return false;
+    }
+
+    m_events.clear();
+    QTextStream stream(&file);
+    int lineNo = 0;
+    while (!stream.atEnd())
+    {
+        QString line = stream.readLine().trimmed();
+        lineNo++;
+        if (line.isEmpty() || line.startsWith('#'))
+        {
+            continue;
+        }
+
+        QStringList fields = line.split(QRegExp("\\s+"), QString::SkipEmptyParts);
+        bool ok = (fields.size() == 4);
+        Event event;
+        if (ok)
+        {
+            event.offsetMs = fields[0].toLongLong(&ok);
+        }
+
+        // 通知对象
+        if (ok && fields[1] == "SAMPLE")
+        {
+            event.target = TARGET_SAMPLE;
+        }
+        else if (ok && fields[1] == "ITEM")
+        {
+            event.target = TARGET_TEST_ITEM;
+        }
+        else
+        {
+            ok = false;
+        }
+
+        // 更新类型（项目只有修改）
+        if (ok && fields[2] == "ADD" && event.target == TARGET_SAMPLE)
+        {
+            event.type = ::tf::UpdateType::UPDATE_TYPE_ADD;
+            event.count = fields[3].toInt(&ok);
+        }
+        else if (ok && (fields[2] == "MODIFY" || (fields[2] == "DELETE" && event.target == TARGET_SAMPLE)))
+        {
+            event.type = (fields[2] == "MODIFY") ? ::tf::UpdateType::UPDATE_TYPE_MODIFY : ::tf::UpdateType::UPDATE_TYPE_DELETE;
+            for (const auto& id : fields[3].split(',', QString::SkipEmptyParts))
+            {
+                event.ids.push_back(id.toLongLong(&ok));
+                if (!ok)
+                {
+                    break;
+                }
+            }
+        }
+        else
+        {
+            ok = false;
+        }
+
+        if (!ok)
+        {
+            error = QString("%1:%2: invalid event '%3'").arg(fileName).arg(lineNo).arg(line);
+            return false;
+        }
+
+        m_events.push_back(event);
+    }
+
+    std::stable_sort(m_events.begin(), m_events.end(), [](const Event& lhs, const Event& rhs) { return lhs.offsetMs < rhs.offsetMs; });
+    return true;
+}
+
+///
+/// @brief 生成合成的通知流（项目状态变化为主，夹带样本修改、批量登记和删除）
+///
+/// @param[in]  data        合成数据（取已有的id）
+/// @param[in]  count       通知条数
+/// @param[in]  intervalMs  平均间隔（毫秒）
+/// @param[in]  seed        随机种子
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void NotificationReplay::Generate(const SyntheticData& data, int count, int intervalMs, unsigned int seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::uniform_int_distribution<int> interval(0, std::max(intervalMs, 0) * 2);
+    std::uniform_int_distribution<int> itemBatch(1, 4);
+    std::uniform_int_distribution<int> addBatch(1, 10);
+
+    m_events.clear();
+    qint64 offsetMs = 0;
+    for (int i = 0; i < count; i++)
+    {
+        Event event;
+        offsetMs += interval(rng);
+        event.offsetMs = offsetMs;
+
+        int kind = percent(rng);
+        if (kind < 70)
+        {
+            event.target = TARGET_TEST_ITEM;
+            event.type = ::tf::UpdateType::UPDATE_TYPE_MODIFY;
+            event.ids = data.PickTestItemIds(itemBatch(rng), rng);
+        }
+        else if (kind < 90)
+        {
+            event.target = TARGET_SAMPLE;
+            event.type = ::tf::UpdateType::UPDATE_TYPE_MODIFY;
+            event.ids = data.PickSampleIds(1, rng);
+        }
+        else if (kind < 98)
+        {
+            event.target = TARGET_SAMPLE;
+            event.type = ::tf::UpdateType::UPDATE_TYPE_ADD;
+            event.count = addBatch(rng);
+        }
+        else
+        {
+            event.target = TARGET_SAMPLE;
+            event.type = ::tf::UpdateType::UPDATE_TYPE_DELETE;
+            event.ids = data.PickSampleIds(1, rng);
+        }
+
+        m_events.push_back(event);
+    }
+}
+
+///
+/// @brief 启动回放线程
+///
+/// @param[in]  data  合成数据（回放时同步修改）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void NotificationReplay::Start(SyntheticData& data)
+{
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+    m_finished = false;
+    m_thread = std::thread(&NotificationReplay::Run, this, &data);
+}
+
+///
+/// @brief 回放线程
+///
+/// @param[in]  pData  合成数据
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void NotificationReplay::Run(SyntheticData* pData)
+{
+    UiControlHandler handler;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& event : m_events)
+    {
+        std::this_thread::sleep_until(start + std::chrono::milliseconds(event.offsetMs));
+
+        if (event.target == TARGET_TEST_ITEM)
+        {
+            auto items = pData->ModifyTestItems(event.ids);
+            if (!items.empty())
+            {
+                handler.NotifyTestItemUpdate(event.type, items);
+            }
+            continue;
+        }
+
+        std::vector<::tf::SampleInfo> samples;
+        switch (event.type)
+        {
+            case ::tf::UpdateType::UPDATE_TYPE_ADD:
+                samples = pData->AddSamples(event.count);
+                break;
+            case ::tf::UpdateType::UPDATE_TYPE_DELETE:
+                samples = pData->DeleteSamples(event.ids);
+                break;
+            default:
+                samples = pData->ModifySamples(event.ids);
+                break;
+        }
+
+        if (!samples.empty())
+        {
+            handler.NotifySampleUpdate(event.type, samples);
+        }
+    }
+
+    m_finished = true;
+}
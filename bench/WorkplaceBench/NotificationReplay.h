@@ -0,0 +1,149 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     NotificationReplay.h
+/// @brief    工作页面基准测试的通知回放（按时间轴推送样本、项目更新通知）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <QString>
+#include "src/thrift/gen-cpp/defs_types.h"
+
+class SyntheticData;
+
+///
+/// @brief 通知回放
+///     在独立线程（相当于thrift服务线程）按时间轴修改合成数据，并经UiControlHandler推送更新通知，
+///     通知与实际运行时一样经过界面通知队列投递到工作页面的数据模型；
+///     回放文件每行一条：<偏移毫秒> <SAMPLE|ITEM> <ADD|MODIFY|DELETE> <id,id,...|新增个数>，#开头为注释
+///
+class NotificationReplay
+{
+public:
+    ///
+    /// @brief 通知对象
+    ///
+    enum TARGET
+    {
+        TARGET_SAMPLE = 0,                  ///< 样本
+        TARGET_TEST_ITEM                    ///< 项目
+    };
+
+    ///
+    /// @brief 一条通知
+    ///
+    struct Event
+    {
+        qint64                      offsetMs = 0;                                       ///< 相对回放开始的时间
+        TARGET                      target = TARGET_SAMPLE;                             ///< 通知对象
+        ::tf::UpdateType::type      type = ::tf::UpdateType::UPDATE_TYPE_MODIFY;        ///< 更新类型
+        std::vector<int64_t>        ids;                                                ///< 修改、删除的id
+        int                         count = 0;                                          ///< 新增个数
+    };
+
+    NotificationReplay();
+    ~NotificationReplay();
+
+    ///
+    /// @brief 从回放文件加载
+    ///
+    /// @param[in]  fileName  文件名
+    /// @param[out] error     失败原因
+    ///
+    /// @return true表示成功
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool Load(const QString& fileName, QString& error);
+
+    ///
+    /// @brief 生成合成的通知流（项目状态变化为主，夹带样本修改、批量登记和删除）
+    ///
+    /// @param[in]  data        合成数据（取已有的id）
+    /// @param[in]  count       通知条数
+    /// @param[in]  intervalMs  平均间隔（毫秒）
+    /// @param[in]  seed        随机种子
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Generate(const SyntheticData& data, int count, int intervalMs, unsigned int seed);
+
+    ///
+    /// @brief 通知条数
+    ///
+    size_t Size() const { return m_events.size(); };
+
+    ///
+    /// @brief 启动回放线程
+    ///
+    /// @param[in]  data  合成数据（回放时同步修改）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Start(SyntheticData& data);
+
+    ///
+    /// @brief 回放线程是否已推送完全部通知
+    ///
+    bool IsFinished() const { return m_finished.load(); };
+
+private:
+    ///
+    /// @brief 回放线程
+    ///
+    /// @param[in]  pData  合成数据
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Run(SyntheticData* pData);
+
+private:
+    std::vector<Event>          m_events;           ///< 通知（按时间升序）
+    std::thread                 m_thread;           ///< 回放线程
+    std::atomic<bool>           m_finished;         ///< 是否已推送完
+};
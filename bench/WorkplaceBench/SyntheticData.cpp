@@ -0,0 +1,529 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     SyntheticData.cpp
+/// @brief    工作页面基准测试的合成数据（样本、项目）及DCS替身应答
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+
+#include "SyntheticData.h"
+#include <algorithm>
+#include <string>
+
+namespace
+{
+    // 合成数据使用的项目（生化、免疫各取一段）
+    const int SYNTHETIC_CH_ASSAYS = 24;
+    const int SYNTHETIC_IM_ASSAYS = 16;
+    // 一架的位置数
+    const int SYNTHETIC_RACK_SIZE = 5;
+
+    ///
+    /// @brief 按id在升序数组中查找
+    ///
+    template<typename T>
+    T* FindById(std::vector<T>& data, int64_t id)
+    {
+        auto it = std::lower_bound(data.begin(), data.end(), id, [](const T& lhs, int64_t rhs) { return lhs.id < rhs; });
+        return (it != data.end() && it->id == id) ? &(*it) : nullptr;
+    }
+
+    ///
+    /// @brief 分页取数据
+    ///
+    template<typename T>
+    std::vector<T> Page(const std::vector<T>& data, const ::tf::LimitCond& limit, bool hasLimit)
+    {
+        if (!hasLimit)
+        {
+            return data;
+        }
+
+        size_t first = std::min(static_cast<size_t>(std::max<int64_t>(limit.offset, 0)), data.size());
+        size_t last = std::min(first + static_cast<size_t>(std::max<int64_t>(limit.count, 0)), data.size());
+        return std::vector<T>(data.begin() + first, data.begin() + last);
+    }
+}
+
+SyntheticData::SyntheticData()
+    : m_itemsPerSample(0)
+    , m_nextSampleId(1)
+    , m_nextTestItemId(1)
+{
+}
+
+///
+/// @brief 生成数据
+///
+/// @param[in]  sampleCount     样本数（10k~500k）
+/// @param[in]  itemsPerSample  每个样本的项目数
+/// @param[in]  seed            随机种子
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void SyntheticData::Generate(int sampleCount, int itemsPerSample, unsigned int seed)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_rng.seed(seed);
+    m_itemsPerSample = std::max(itemsPerSample, 1);
+    m_nextSampleId = 1;
+    m_nextTestItemId = 1;
+    m_samples.clear();
+    m_testItems.clear();
+    m_samples.reserve(sampleCount);
+    m_testItems.reserve(static_cast<size_t>(sampleCount) * m_itemsPerSample);
+
+    // 大部分样本已完成，尾部一小段正在测试（倒计时、状态刷新集中在这一段）
+    int testingFrom = sampleCount - std::min(sampleCount / 20, 2000);
+    for (int i = 0; i < sampleCount; i++)
+    {
+        AppendSample(i >= testingFrom);
+    }
+}
+
+///
+/// @brief 创建DCS替身（样本、项目按id升序分页应答）
+///
+/// @return 替身
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::shared_ptr<DcsControlProxy::StandIn> SyntheticData::CreateStandIn()
+{
+    auto spStandIn = std::make_shared<DcsControlProxy::StandIn>();
+    spStandIn->querySampleInfo = [this](::tf::SampleInfoQueryResp& resp, const ::tf::SampleInfoQueryCond& cond)
+    {
+        OnQuerySampleInfo(resp, cond);
+    };
+    spStandIn->queryTestItems = [this](::tf::TestItemQueryResp& resp, const ::tf::TestItemQueryCond& cond)
+    {
+        OnQueryTestItems(resp, cond);
+    };
+    // 合成数据没有计算项目
+    spStandIn->queryCalcAssayTestResult = [](::tf::CalcAssayTestResultQueryResp& resp, const ::tf::CalcAssayTestResultQueryCond&)
+    {
+        resp.__set_result(::tf::ThriftResult::THRIFT_RESULT_SUCCESS);
+    };
+
+    return spStandIn;
+}
+
+size_t SyntheticData::SampleCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_samples.size();
+}
+
+size_t SyntheticData::TestItemCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_testItems.size();
+}
+
+///
+/// @brief 随机取若干个已有的样本id（偏向尾部正在测试的样本）
+///
+/// @param[in]  count  个数
+/// @param[in]  rng    随机数发生器
+///
+/// @return id列表
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<int64_t> SyntheticData::PickSampleIds(int count, std::mt19937& rng) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<int64_t> ids;
+    if (m_samples.empty())
+    {
+        return ids;
+    }
+
+    // 实际运行时更新集中在最近登记的样本，这里九成取自最后的5%
+    size_t size = m_samples.size();
+    size_t tail = std::max<size_t>(size / 20, 1);
+    std::uniform_int_distribution<size_t> any(0, size - 1);
+    std::uniform_int_distribution<size_t> recent(size - tail, size - 1);
+    std::uniform_int_distribution<int> percent(0, 99);
+    for (int i = 0; i < count; i++)
+    {
+        size_t index = (percent(rng) < 90) ? recent(rng) : any(rng);
+        ids.push_back(m_samples[index].id);
+    }
+
+    return ids;
+}
+
+///
+/// @brief 随机取若干个已有的项目id（偏向尾部正在测试的项目）
+///
+/// @param[in]  count  个数
+/// @param[in]  rng    随机数发生器
+///
+/// @return id列表
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<int64_t> SyntheticData::PickTestItemIds(int count, std::mt19937& rng) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<int64_t> ids;
+    if (m_testItems.empty())
+    {
+        return ids;
+    }
+
+    size_t size = m_testItems.size();
+    size_t tail = std::max<size_t>(size / 20, 1);
+    std::uniform_int_distribution<size_t> any(0, size - 1);
+    std::uniform_int_distribution<size_t> recent(size - tail, size - 1);
+    std::uniform_int_distribution<int> percent(0, 99);
+    for (int i = 0; i < count; i++)
+    {
+        size_t index = (percent(rng) < 90) ? recent(rng) : any(rng);
+        ids.push_back(m_testItems[index].id);
+    }
+
+    return ids;
+}
+
+///
+/// @brief 新增样本（带项目）
+///
+/// @param[in]  count  样本个数
+///
+/// @return 新增的样本
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<::tf::SampleInfo> SyntheticData::AddSamples(int count)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<::tf::SampleInfo> added;
+    for (int i = 0; i < count; i++)
+    {
+        AppendSample(false);
+        ::tf::SampleInfo sample = m_samples.back();
+        sample.__set_testItems(TestItemsOfSample(sample.id));
+        added.push_back(sample);
+    }
+
+    return added;
+}
+
+///
+/// @brief 修改样本（状态向前推进一步），不存在的id忽略
+///
+/// @param[in]  ids  样本id
+///
+/// @return 修改后的样本
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<::tf::SampleInfo> SyntheticData::ModifySamples(const std::vector<int64_t>& ids)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<::tf::SampleInfo> modified;
+    for (auto id : ids)
+    {
+        ::tf::SampleInfo* pSample = FindSample(id);
+        if (pSample == nullptr)
+        {
+            continue;
+        }
+
+        if (pSample->status == ::tf::SampleStatus::SAMPLE_STATUS_PENDING)
+        {
+            pSample->__set_status(::tf::SampleStatus::SAMPLE_STATUS_TESTING);
+        }
+        else if (pSample->status == ::tf::SampleStatus::SAMPLE_STATUS_TESTING)
+        {
+            pSample->__set_status(::tf::SampleStatus::SAMPLE_STATUS_TESTED);
+        }
+        else
+        {
+            // 已完成的样本：审核状态切换
+            pSample->__set_audit(!pSample->audit);
+        }
+
+        modified.push_back(*pSample);
+    }
+
+    return modified;
+}
+
+///
+/// @brief 删除样本及其项目，不存在的id忽略
+///
+/// @param[in]  ids  样本id
+///
+/// @return 删除的样本
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<::tf::SampleInfo> SyntheticData::DeleteSamples(const std::vector<int64_t>& ids)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<::tf::SampleInfo> deleted;
+    for (auto id : ids)
+    {
+        ::tf::SampleInfo* pSample = FindSample(id);
+        if (pSample == nullptr)
+        {
+            continue;
+        }
+
+        deleted.push_back(*pSample);
+        m_samples.erase(m_samples.begin() + (pSample - m_samples.data()));
+        auto first = std::lower_bound(m_testItems.begin(), m_testItems.end(), id,
+            [](const ::tf::TestItem& lhs, int64_t rhs) { return lhs.sampleInfoId < rhs; });
+        auto last = std::upper_bound(first, m_testItems.end(), id,
+            [](int64_t lhs, const ::tf::TestItem& rhs) { return lhs < rhs.sampleInfoId; });
+        m_testItems.erase(first, last);
+    }
+
+    return deleted;
+}
+
+///
+/// @brief 修改项目（状态向前推进一步，完成时给出结果），不存在的id忽略
+///
+/// @param[in]  ids  项目id
+///
+/// @return 修改后的项目
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<::tf::TestItem> SyntheticData::ModifyTestItems(const std::vector<int64_t>& ids)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::uniform_real_distribution<double> conc(0.1, 300.0);
+    std::vector<::tf::TestItem> modified;
+    for (auto id : ids)
+    {
+        ::tf::TestItem* pItem = FindTestItem(id);
+        if (pItem == nullptr)
+        {
+            continue;
+        }
+
+        if (pItem->status == ::tf::TestItemStatus::TEST_ITEM_STATUS_PENDING)
+        {
+            pItem->__set_status(::tf::TestItemStatus::TEST_ITEM_STATUS_TESTING);
+            pItem->__set_samplingCompleted(true);
+        }
+        else if (pItem->status == ::tf::TestItemStatus::TEST_ITEM_STATUS_TESTING)
+        {
+            pItem->__set_status(::tf::TestItemStatus::TEST_ITEM_STATUS_TESTED);
+            pItem->__set_conc(conc(m_rng));
+        }
+        else
+        {
+            // 已完成的项目：复查结果
+            pItem->__set_retestConc(conc(m_rng));
+        }
+
+        modified.push_back(*pItem);
+    }
+
+    return modified;
+}
+
+///
+/// @brief 生成一个样本及其项目（调用者加锁）
+///
+/// @param[in]  testing  是否已在测试
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void SyntheticData::AppendSample(bool testing)
+{
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::uniform_int_distribution<int> chAssay(0, SYNTHETIC_CH_ASSAYS - 1);
+    std::uniform_int_distribution<int> imAssay(0, SYNTHETIC_IM_ASSAYS - 1);
+    std::uniform_real_distribution<double> conc(0.1, 300.0);
+
+    int64_t sampleId = m_nextSampleId++;
+    ::tf::SampleInfo sample;
+    sample.__set_id(sampleId);
+    sample.__set_seqNo(std::to_string(sampleId));
+    sample.__set_barcode("BC" + std::to_string(100000000 + sampleId));
+    sample.__set_rack(std::to_string(1000 + (sampleId - 1) / SYNTHETIC_RACK_SIZE % 9000));
+    sample.__set_pos(static_cast<int32_t>((sampleId - 1) % SYNTHETIC_RACK_SIZE + 1));
+    sample.__set_testMode(::tf::TestMode::SEQNO_MODE);
+    sample.__set_stat(percent(m_rng) < 5);
+    sample.__set_audit(!testing && percent(m_rng) < 50);
+
+    // 样本类型：大部分为病人样本，少量质控和校准
+    int type = percent(m_rng);
+    sample.__set_sampleType(type < 90 ? ::tf::SampleType::SAMPLE_TYPE_PATIENT
+        : (type < 96 ? ::tf::SampleType::SAMPLE_TYPE_QC : ::tf::SampleType::SAMPLE_TYPE_CALIBRATOR));
+    sample.__set_sampleSourceType(percent(m_rng) < 80 ? ::tf::SampleSourceType::SAMPLE_SOURCE_TYPE_XQXJ
+        : ::tf::SampleSourceType::SAMPLE_SOURCE_TYPE_NY);
+    sample.__set_status(testing ? ::tf::SampleStatus::SAMPLE_STATUS_TESTING : ::tf::SampleStatus::SAMPLE_STATUS_TESTED);
+
+    for (int i = 0; i < m_itemsPerSample; i++)
+    {
+        ::tf::TestItem item;
+        item.__set_id(m_nextTestItemId++);
+        item.__set_sampleInfoId(sampleId);
+        item.__set_assayCode((i % 3 == 2) ? (::tf::AssayCodeRange::IM_RANGE_MIN + imAssay(m_rng))
+            : (::tf::AssayCodeRange::CH_RANGE_MIN + chAssay(m_rng)));
+
+        if (testing && percent(m_rng) < 50)
+        {
+            item.__set_status(::tf::TestItemStatus::TEST_ITEM_STATUS_TESTING);
+            item.__set_samplingCompleted(true);
+            item.__set_needReactionSeconds(600);
+        }
+        else if (testing)
+        {
+            item.__set_status(::tf::TestItemStatus::TEST_ITEM_STATUS_PENDING);
+        }
+        else
+        {
+            item.__set_status(::tf::TestItemStatus::TEST_ITEM_STATUS_TESTED);
+            item.__set_samplingCompleted(true);
+            item.__set_conc(conc(m_rng));
+        }
+
+        m_testItems.push_back(item);
+    }
+
+    m_samples.push_back(sample);
+}
+
+::tf::SampleInfo* SyntheticData::FindSample(int64_t id)
+{
+    return FindById(m_samples, id);
+}
+
+::tf::TestItem* SyntheticData::FindTestItem(int64_t id)
+{
+    return FindById(m_testItems, id);
+}
+
+std::vector<::tf::TestItem> SyntheticData::TestItemsOfSample(int64_t sampleId) const
+{
+    // 项目和样本都按生成顺序分配id，项目按所属样本id也是升序
+    auto first = std::lower_bound(m_testItems.begin(), m_testItems.end(), sampleId,
+        [](const ::tf::TestItem& lhs, int64_t rhs) { return lhs.sampleInfoId < rhs; });
+    auto last = std::upper_bound(first, m_testItems.end(), sampleId,
+        [](int64_t lhs, const ::tf::TestItem& rhs) { return lhs < rhs.sampleInfoId; });
+    return std::vector<::tf::TestItem>(first, last);
+}
+
+///
+/// @brief 替身应答：样本查询（支持按id查询和按id升序分页）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void SyntheticData::OnQuerySampleInfo(::tf::SampleInfoQueryResp& resp, const ::tf::SampleInfoQueryCond& cond)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    resp.__set_result(::tf::ThriftResult::THRIFT_RESULT_SUCCESS);
+
+    std::vector<::tf::SampleInfo> samples;
+    if (cond.__isset.id)
+    {
+        ::tf::SampleInfo* pSample = FindSample(cond.id);
+        if (pSample != nullptr)
+        {
+            samples.push_back(*pSample);
+        }
+    }
+    else
+    {
+        samples = Page(m_samples, cond.limit, cond.__isset.limit);
+    }
+
+    if (cond.__isset.containTestItems && cond.containTestItems)
+    {
+        for (auto& sample : samples)
+        {
+            sample.__set_testItems(TestItemsOfSample(sample.id));
+        }
+    }
+
+    resp.__set_lstSampleInfos(samples);
+}
+
+///
+/// @brief 替身应答：项目查询（支持按id、按样本id查询和按id升序分页）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void SyntheticData::OnQueryTestItems(::tf::TestItemQueryResp& resp, const ::tf::TestItemQueryCond& cond)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    resp.__set_result(::tf::ThriftResult::THRIFT_RESULT_SUCCESS);
+
+    if (cond.__isset.id)
+    {
+        std::vector<::tf::TestItem> items;
+        ::tf::TestItem* pItem = FindTestItem(cond.id);
+        if (pItem != nullptr)
+        {
+            items.push_back(*pItem);
+        }
+        resp.__set_lstTestItems(items);
+        return;
+    }
+
+    if (cond.__isset.sampleId)
+    {
+        resp.__set_lstTestItems(TestItemsOfSample(cond.sampleId));
+        return;
+    }
+
+    resp.__set_lstTestItems(Page(m_testItems, cond.limit, cond.__isset.limit));
+}
@@ -0,0 +1,190 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     SyntheticData.h
+/// @brief    工作页面基准测试的合成数据（样本、项目）及DCS替身应答
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <mutex>
+#include <random>
+#include <vector>
+#include <memory>
+#include "src/thrift/gen-cpp/defs_types.h"
+#include "thrift/DcsControlProxy.h"
+
+///
+/// @brief 合成数据
+///     按固定种子生成样本和项目（结果可重复），作为DCS替身应答工作页面的分页查询；
+///     通知回放修改数据时同步修改这里的数据，使之后的查询与通知一致
+///
+class SyntheticData
+{
+public:
+    SyntheticData();
+
+    ///
+    /// @brief 生成数据
+    ///
+    /// @param[in]  sampleCount     样本数（10k~500k）
+    /// @param[in]  itemsPerSample  每个样本的项目数
+    /// @param[in]  seed            随机种子
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Generate(int sampleCount, int itemsPerSample, unsigned int seed);
+
+    ///
+    /// @brief 创建DCS替身（样本、项目按id升序分页应答）
+    ///
+    /// @return 替身
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::shared_ptr<DcsControlProxy::StandIn> CreateStandIn();
+
+    ///
+    /// @brief 样本数、项目数
+    ///
+    size_t SampleCount() const;
+    size_t TestItemCount() const;
+
+    ///
+    /// @brief 随机取若干个已有的样本/项目id（用于生成通知）
+    ///
+    /// @param[in]  count  个数
+    /// @param[in]  rng    随机数发生器
+    ///
+    /// @return id列表
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::vector<int64_t> PickSampleIds(int count, std::mt19937& rng) const;
+    std::vector<int64_t> PickTestItemIds(int count, std::mt19937& rng) const;
+
+    ///
+    /// @brief 新增样本（带项目）
+    ///
+    /// @param[in]  count  样本个数
+    ///
+    /// @return 新增的样本
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::vector<::tf::SampleInfo> AddSamples(int count);
+
+    ///
+    /// @brief 修改样本（状态向前推进一步），不存在的id忽略
+    ///
+    /// @param[in]  ids  样本id
+    ///
+    /// @return 修改后的样本
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::vector<::tf::SampleInfo> ModifySamples(const std::vector<int64_t>& ids);
+
+    ///
+    /// @brief 删除样本及其项目，不存在的id忽略
+    ///
+    /// @param[in]  ids  样本id
+    ///
+    /// @return 删除的样本
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::vector<::tf::SampleInfo> DeleteSamples(const std::vector<int64_t>& ids);
+
+    ///
+    /// @brief 修改项目（状态向前推进一步，完成时给出结果），不存在的id忽略
+    ///
+    /// @param[in]  ids  项目id
+    ///
+    /// @return 修改后的项目
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::vector<::tf::TestItem> ModifyTestItems(const std::vector<int64_t>& ids);
+
+private:
+    ///
+    /// @brief 生成一个样本及其项目（调用者加锁）
+    ///
+    /// @param[in]  testing  是否已在测试
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void AppendSample(bool testing);
+
+    ///
+    /// @brief 按id查找（调用者加锁），找不到返回空
+    ///
+    ::tf::SampleInfo* FindSample(int64_t id);
+    ::tf::TestItem* FindTestItem(int64_t id);
+
+    ///
+    /// @brief 样本的项目列表（调用者加锁）
+    ///
+    std::vector<::tf::TestItem> TestItemsOfSample(int64_t sampleId) const;
+
+    ///
+    /// @brief 替身应答
+    ///
+    void OnQuerySampleInfo(::tf::SampleInfoQueryResp& resp, const ::tf::SampleInfoQueryCond& cond);
+    void OnQueryTestItems(::tf::TestItemQueryResp& resp, const ::tf::TestItemQueryCond& cond);
+
+private:
+    mutable std::mutex                  m_mutex;            ///< 保护数据（回放线程和界面线程都会访问）
+    std::vector<::tf::SampleInfo>       m_samples;          ///< 样本（按id升序）
+    std::vector<::tf::TestItem>         m_testItems;        ///< 项目（按id升序）
+    int                                 m_itemsPerSample;   ///< 每个样本的项目数
+    int64_t                             m_nextSampleId;     ///< 下一个样本id
+    int64_t                             m_nextTestItemId;   ///< 下一个项目id
+    std::mt19937                        m_rng;              ///< 随机数发生器
+};
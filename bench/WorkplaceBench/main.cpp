@@ -0,0 +1,398 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     main.cpp
+/// @brief    工作页面无界面基准测试入口
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QThread>
+#include "SyntheticData.h"
+#include "NotificationReplay.h"
+#include "shared/LatencyProfiler.h"
+#include "thrift/DcsControlProxy.h"
+#include "thrift/UiNotifyQueue.h"
+#include "workplace/QSampleAssayModel.h"
+#include "workplace/QSampleAssaySelect.h"
+#include "workplace/QSampleDataBrowse.h"
+#include "workplace/QFilterSample.h"
+#include "src/common/Mlog/mlog.h"
+
+namespace
+{
+    // 一屏的行数（data()按一屏取）
+    const int BENCH_WINDOW_ROWS = 40;
+
+    ///
+    /// @brief 输出一个阶段的统计（输出后清空，各阶段互不影响）
+    ///
+    /// @param[in]  phase  阶段名称
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void PrintPhase(const char* phase)
+    {
+        std::printf("== %s ==\n%s\n", phase, LatencyProfiler::GetInstance().Report(true).c_str());
+        std::fflush(stdout);
+    }
+
+    ///
+    /// @brief 处理完排队的通知和由此产生的界面事件
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void DrainEvents()
+    {
+        do
+        {
+            QCoreApplication::processEvents(QEventLoop::AllEvents);
+        } while (!UiNotifyQueue::GetInstance().IsEmpty());
+
+        // 投递后合并处理的新增（零时定时器）和排队的槽函数
+        for (int i = 0; i < 3; i++)
+        {
+            QCoreApplication::processEvents(QEventLoop::AllEvents);
+        }
+    }
+
+    ///
+    /// @brief 按屏取数据（每屏BENCH_WINDOW_ROWS行、全部列，显示、前景、背景三种角色）
+    ///
+    /// @param[in]  model    数据模型
+    /// @param[in]  windows  屏数
+    /// @param[in]  rng      随机数发生器
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void ReadWindows(QAbstractItemModel& model, int windows, std::mt19937& rng)
+    {
+        int rowCount = model.rowCount();
+        int columnCount = model.columnCount();
+        if (rowCount <= 0 || columnCount <= 0)
+        {
+            return;
+        }
+
+        std::uniform_int_distribution<int> top(0, std::max(rowCount - BENCH_WINDOW_ROWS, 0));
+        for (int i = 0; i < windows; i++)
+        {
+            LATENCY_SCOPE("bench.dataWindow");
+            int first = top(rng);
+            int last = std::min(first + BENCH_WINDOW_ROWS, rowCount);
+            for (int row = first; row < last; row++)
+            {
+                for (int column = 0; column < columnCount; column++)
+                {
+                    QModelIndex index = model.index(row, column);
+                    model.data(index, Qt::DisplayRole);
+                    model.data(index, Qt::ForegroundRole);
+                    model.data(index, Qt::BackgroundRole);
+                }
+            }
+        }
+    }
+
+    ///
+    /// @brief 重新过滤若干次
+    ///
+    /// @param[in]  proxy   过滤模型
+    /// @param[in]  passes  次数
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void FilterPasses(QSortFilterProxyModel& proxy, int passes)
+    {
+        for (int i = 0; i < passes; i++)
+        {
+            LATENCY_SCOPE("bench.filterPass");
+            proxy.invalidate();
+            // 映射是延迟建立的，取行数时才真正过滤
+            proxy.rowCount();
+        }
+    }
+
+    ///
+    /// @brief 按前几列各升序、降序排序一次
+    ///
+    /// @param[in]  proxy    过滤模型
+    /// @param[in]  columns  排序的列数
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void SortPasses(QSortFilterProxyModel& proxy, int columns)
+    {
+        int columnCount = std::min(proxy.columnCount(), columns + 1);
+        for (int column = 1; column < columnCount; column++)
+        {
+            for (auto order : { Qt::AscendingOrder, Qt::DescendingOrder })
+            {
+                LATENCY_SCOPE("bench.sortPass");
+                proxy.sort(column, order);
+                proxy.rowCount();
+            }
+        }
+
+        // 恢复不排序
+        proxy.sort(-1);
+    }
+
+    ///
+    /// @brief 按一个样本的关键字做精确、前缀、包含三种检索
+    ///     前缀取关键字的前一半，包含取中间的一段（不短于n-gram长度）
+    ///
+    /// @param[in]  keyType  关键字类型
+    /// @param[in]  key      样本的关键字
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void SearchKey(DataPrivate::SAMPLEKEY keyType, const std::string& key)
+    {
+        if (key.empty())
+        {
+            return;
+        }
+
+        auto& dataPrivate = DataPrivate::Instance();
+        {
+            LATENCY_SCOPE("bench.searchExact");
+            dataPrivate.SearchSampleIds(keyType, DataPrivate::MATCHMODE::EXACT, key);
+        }
+        {
+            LATENCY_SCOPE("bench.searchPrefix");
+            dataPrivate.SearchSampleIds(keyType, DataPrivate::MATCHMODE::PREFIX, key.substr(0, (key.size() + 1) / 2));
+        }
+        {
+            size_t length = std::min(key.size(), std::max<size_t>(3, key.size() / 3));
+            LATENCY_SCOPE("bench.searchContains");
+            dataPrivate.SearchSampleIds(keyType, DataPrivate::MATCHMODE::CONTAINS, key.substr((key.size() - length) / 2, length));
+        }
+    }
+}
+
+///
+/// @brief
+///     工作页面无界面基准测试
+///     用合成数据（10k~500k样本）作为DCS替身，依次测量初始加载、行查找、条码/样本号检索、data()、过滤、排序，
+///     再回放更新通知测量更新的应用，各阶段按 次数/平均/P50/P90/P99/最大 输出
+///
+int main(int argc, char *argv[])
+{
+    // 无界面运行（不需要显示器）
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication a(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Headless benchmark of the workplace sample models");
+    parser.addHelpOption();
+    QCommandLineOption samplesOpt("samples", "Synthetic sample count (10000-500000).", "n", "10000");
+    QCommandLineOption itemsOpt("items", "Test items per sample.", "n", "5");
+    QCommandLineOption seedOpt("seed", "Random seed.", "n", "20261019");
+    QCommandLineOption lookupsOpt("lookups", "Random row lookups.", "n", "200000");
+    QCommandLineOption searchesOpt("searches", "Samples searched by barcode and seqNo.", "n", "2000");
+    QCommandLineOption windowsOpt("windows", "Screens read through data() per view mode.", "n", "200");
+    QCommandLineOption passesOpt("passes", "Filter passes per proxy.", "n", "5");
+    QCommandLineOption sortColumnsOpt("sort-columns", "Columns sorted per proxy.", "n", "4");
+    QCommandLineOption replayOpt("replay", "Notification replay file (default: synthetic stream).", "file");
+    QCommandLineOption updatesOpt("updates", "Synthetic notifications to replay.", "n", "2000");
+    QCommandLineOption intervalOpt("interval", "Mean interval between synthetic notifications (ms).", "ms", "5");
+    parser.addOptions({ samplesOpt, itemsOpt, seedOpt, lookupsOpt, searchesOpt, windowsOpt, passesOpt, sortColumnsOpt,
+        replayOpt, updatesOpt, intervalOpt });
+    parser.process(a);
+
+    int sampleCount = parser.value(samplesOpt).toInt();
+    int itemsPerSample = parser.value(itemsOpt).toInt();
+    unsigned int seed = parser.value(seedOpt).toUInt();
+    if (sampleCount <= 0 || itemsPerSample <= 0)
+    {
+        std::fprintf(stderr, "invalid --samples or --items\n");
+        return EXIT_FAILURE;
+    }
+
+    // 日志配置与主程序相同
+    std::string strLogFile = (QCoreApplication::applicationDirPath() + "/log.ini").toStdString();
+    if (EXIT_SUCCESS != MLogInit(strLogFile.c_str()))
+    {
+        std::printf("[warn] Failed to execute MLogInit()\n");
+    }
+
+    // 每个记录点都记录，不定期输出（按阶段输出）
+    LatencyProfiler::GetInstance().Start(0);
+    UiNotifyQueue::GetInstance();
+
+    // 合成数据作为DCS替身
+    SyntheticData data;
+    data.Generate(sampleCount, itemsPerSample, seed);
+    DcsControlProxy::SetStandIn(data.CreateStandIn());
+    std::printf("samples: %zu, test items: %zu\n", data.SampleCount(), data.TestItemCount());
+
+    // 1. 初始加载（数据模型单例首次创建时分页查询全部样本和项目）
+    {
+        LATENCY_SCOPE("bench.initialLoad");
+        QSampleAssayModel::Instance();
+    }
+    PrintPhase("initial load");
+
+    // 2. 行查找
+    std::mt19937 rng(seed);
+    {
+        int lookups = parser.value(lookupsOpt).toInt();
+        auto& dataPrivate = DataPrivate::Instance();
+        std::uniform_int_distribution<int> sampleRow(0, static_cast<int>(data.SampleCount()) - 1);
+        std::uniform_int_distribution<int> itemRow(0, static_cast<int>(data.TestItemCount()) - 1);
+        for (int i = 0; i < lookups; i++)
+        {
+            dataPrivate.GetSampleByRow(sampleRow(rng));
+            dataPrivate.GetTestItemByRow(itemRow(rng));
+        }
+    }
+    PrintPhase("row lookup");
+
+    // 3. 样本关键字检索（条码、样本号各自的精确、前缀、包含匹配）
+    {
+        auto& dataPrivate = DataPrivate::Instance();
+        auto sampleIds = data.PickSampleIds(parser.value(searchesOpt).toInt(), rng);
+        for (auto keyType : { DataPrivate::SAMPLEKEY::BARCODE, DataPrivate::SAMPLEKEY::SEQNO })
+        {
+            for (auto id : sampleIds)
+            {
+                auto spSample = dataPrivate.GetSampleInfoByDb(id);
+                if (spSample != Q_NULLPTR)
+                {
+                    SearchKey(keyType, (keyType == DataPrivate::SAMPLEKEY::BARCODE) ? spSample->barcode : spSample->seqNo);
+                }
+            }
+
+            PrintPhase((keyType == DataPrivate::SAMPLEKEY::BARCODE) ? "barcode search" : "seqNo search");
+        }
+    }
+
+    // 4. data()（三种展示方式）
+    auto& model = QSampleAssayModel::Instance();
+    int windows = parser.value(windowsOpt).toInt();
+    for (auto mode : { QSampleAssayModel::VIEWMOUDLE::ASSAYSELECT, QSampleAssayModel::VIEWMOUDLE::DATABROWSE,
+        QSampleAssayModel::VIEWMOUDLE::ASSAYBROWSE })
+    {
+        model.SetSampleModuleType(mode);
+        ReadWindows(model, windows, rng);
+    }
+    PrintPhase("data()");
+
+    // 5. 过滤（工作页面只显示病人样本；数据浏览不筛选、筛选条件全部放开；按项目展示）
+    int passes = parser.value(passesOpt).toInt();
+    QSampleFilter selectFilter;
+    QSampleFilterDataModule browseFilter;
+    model.SetSampleModuleType(QSampleAssayModel::VIEWMOUDLE::ASSAYSELECT);
+    selectFilter.setSourceModel(&model);
+    FilterPasses(selectFilter, passes);
+
+    model.SetSampleModuleType(QSampleAssayModel::VIEWMOUDLE::DATABROWSE);
+    browseFilter.setSourceModel(&model);
+    browseFilter.SetEnable(false);
+    FilterPasses(browseFilter, passes);
+    FilterConDition cond;
+    cond.Reset();
+    browseFilter.Setcond(cond);
+    browseFilter.SetEnable(true);
+    FilterPasses(browseFilter, passes);
+
+    model.SetSampleModuleType(QSampleAssayModel::VIEWMOUDLE::ASSAYBROWSE);
+    browseFilter.SetEnable(false);
+    FilterPasses(browseFilter, passes);
+    PrintPhase("filtering");
+
+    // 6. 排序
+    int sortColumns = parser.value(sortColumnsOpt).toInt();
+    model.SetSampleModuleType(QSampleAssayModel::VIEWMOUDLE::DATABROWSE);
+    SortPasses(browseFilter, sortColumns);
+    model.SetSampleModuleType(QSampleAssayModel::VIEWMOUDLE::ASSAYSELECT);
+    SortPasses(selectFilter, sortColumns);
+    PrintPhase("sorting");
+
+    // 7. 更新的应用（回放线程推送通知，界面线程经通知队列应用到模型和过滤模型）
+    NotificationReplay replay;
+    if (parser.isSet(replayOpt))
+    {
+        QString error;
+        if (!replay.Load(parser.value(replayOpt), error))
+        {
+            std::fprintf(stderr, "%s\n", error.toStdString().c_str());
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        replay.Generate(data, parser.value(updatesOpt).toInt(), parser.value(intervalOpt).toInt(), seed);
+    }
+
+    model.SetSampleModuleType(QSampleAssayModel::VIEWMOUDLE::DATABROWSE);
+    QElapsedTimer replayTimer;
+    replayTimer.start();
+    replay.Start(data);
+    while (!replay.IsFinished())
+    {
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 5);
+        QThread::msleep(1);
+    }
+    DrainEvents();
+    std::printf("replayed %zu notifications in %lld ms\n", replay.Size(), replayTimer.elapsed());
+    PrintPhase("update application");
+    std::printf("== notify queue ==\n%s\n", UiNotifyQueue::GetInstance().Report().c_str());
+
+    LatencyProfiler::GetInstance().Stop();
+    MlogUninit();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,10 @@
+@echo off
+rem 工作页面基准测试：依次以10k、50k、100k、500k样本运行，结果写入bench_<样本数>.txt
+setlocal
+set BENCH=%~dp0..\..\..\..\build_windows\bin\x64\Release\WorkplaceBench.exe
+if not "%~1"=="" set BENCH=%~1
+for %%n in (10000 50000 100000 500000) do (
+    echo running %%n samples...
+    "%BENCH%" --samples %%n > bench_%%n.txt
+)
+endlocal
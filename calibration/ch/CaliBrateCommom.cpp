@@ -44,6 +44,7 @@
 ///
 ///////////////////////////////////////////////////////////////////////////
 #include "CaliBrateCommom.h"
+#include "ChCaliDataCache.h"
 #include "curveDraw/common.h"
 #include "thrift/ch/c1005/C1005LogicControlProxy.h"
 #include "src/common/Mlog/mlog.h"
@@ -628,15 +629,14 @@ std::vector<std::shared_ptr<ch::tf::CaliCurve>> CaliBrateCommom::GetCurvesByCond
 	for (const auto& cond : CurveCond)
 	{
 		// 查询曲线数据
-		::ch::tf::CaliCurveQueryResp CurveRsp;
-		ch::c1005::LogicControlProxy::QueryCaliCurve(CurveRsp, cond);
-		if (CurveRsp.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS)
+		std::vector<ch::tf::CaliCurve> curves;
+		if (!ChCaliDataCache::GetInstance().QueryCaliCurves(cond, curves))
 		{
 			return repVec;
 		}
 
 		// 添加项目曲线
-		for (const auto& caliCurve : CurveRsp.lstCaliCurves)
+		for (const auto& caliCurve : curves)
 		{
 			auto findCurve = std::find_if(repVec.begin(), repVec.end(), [&](const auto& curve)->bool { return (curve->id == caliCurve.id); });
 			if (findCurve == repVec.end() && !caliCurve.isEditCurve)
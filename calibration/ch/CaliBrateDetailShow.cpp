@@ -44,6 +44,7 @@
 ///
 ///////////////////////////////////////////////////////////////////////////
 #include "CaliBrateDetailShow.h"
+#include "ChCaliDataCache.h"
 
 ///
 /// @brief
@@ -90,33 +91,23 @@ CaliBrateDetailShow::~CaliBrateDetailShow()
 void CaliBrateDetailShow::StartShowReagentCurve(int db)
 {
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
-    ::ch::tf::ReagentGroupQueryResp qryResp;
-    ::ch::tf::ReagentGroupQueryCond qryCond;
+    ::ch::tf::ReagentGroup reagent;
 
-    // 设置查询条件，数据库主键
-    qryCond.__set_id(db);
-
-    // 查询成功
-    if (!ch::c1005::LogicControlProxy::QueryReagentGroup(qryResp, qryCond))
+    // 按数据库主键查询（共享缓存）
+    if (!ChCaliDataCache::GetInstance().GetReagentGroup(db, reagent))
     {
         ULOG(LOG_ERROR, "Can not find the reagent group id is %d", db);
         return;
     }
 
-    // 没有查找到试剂数据，直接返回
-    if (qryResp.lstReagentGroup.size() < 1)
-    {
-        return;
-    }
-
     // 显示表头信息
-    ShowCaliBrateStatus(qryResp.lstReagentGroup[0]);
+    ShowCaliBrateStatus(reagent);
     // 项目参数
-    ShowCaliBrateParameter(CURVETYPE::PROJECTCALI, qryResp.lstReagentGroup[0]);
+    ShowCaliBrateParameter(CURVETYPE::PROJECTCALI, reagent);
     // 批参数
-    ShowCaliBrateParameter(CURVETYPE::LOTCALI, qryResp.lstReagentGroup[0]);
+    ShowCaliBrateParameter(CURVETYPE::LOTCALI, reagent);
     // 瓶参数
-    ShowCaliBrateParameter(CURVETYPE::CUURENTCALI, qryResp.lstReagentGroup[0]);
+    ShowCaliBrateParameter(CURVETYPE::CUURENTCALI, reagent);
 }
 
 ///
@@ -66,10 +66,12 @@
 
 #include "boost/shared_ptr.hpp"
 #include "CaliBrateCommom.h"
+#include "ChCaliDataCache.h"
 #include "src/common/Mlog/mlog.h"
 #include "src/common/defs.h"
 #include "src/public/ch/ChCommon.h"
 #include "manager/UserInfoManager.h"
+#include "manager/OperationLogManager.h"
 
 #include "SortHeaderView.h"
 
@@ -1136,6 +1138,8 @@ bool CaliBrateRecordDialog::saveCaliData(ch::tf::CaliDoc& data, const ch::tf::Ca
     }
     caliDoc.__set_compositions(vecComps);
 
+    // 校准文档将被写入，共享缓存中的文档失效
+    ChCaliDataCache::GetInstance().InvalidateCaliDocs();
 
     if (m_modeType != MODIFY_MODE)
     {
@@ -1203,6 +1207,7 @@ bool CaliBrateRecordDialog::deleteCaliData(const ch::tf::CaliDoc& data, const ch
 	qrnd.__set_sn(data.sn);
 
 	bool retFlag = ch::LogicControlProxy::DeleteCaliDoc(qrnd);
+	ChCaliDataCache::GetInstance().InvalidateCaliDocs();
 	//删除成功
 	if (retFlag)
 	{
@@ -3036,7 +3041,6 @@ std::string CaliBrateRecordDialog::GetModifyCaliInfoLog(const ch::tf::CaliDocGro
 
 void CaliBrateRecordDialog::AddOperateLog(const std::string & info, int type)
 {
-    ::tf::ResultLong _return;
     ::tf::OperationLog ol;
     auto spUser = UserInfoManager::GetInstance()->GetLoginUserInfo();
     if (spUser)
@@ -3048,7 +3052,7 @@ void CaliBrateRecordDialog::AddOperateLog(const std::string & info, int type)
     ol.__set_operationType(tf::OperationType::type(type));
     ol.__set_operationTime(QDateTime::currentDateTime().toString("yyyy/MM/dd hh:mm:ss").toStdString());
     ol.__set_operationRecord(info);
-    if (!DcsControlProxy::GetInstance()->AddOperationLog(_return, ol))
+    if (!COperationLogManager::GetInstance()->PostOperationLog(ol))
     {
         ULOG(LOG_ERROR, "AddOperationLog failed, info: %s.", info);
     }
@@ -0,0 +1,432 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     ChCaliDataCache.cpp
+/// @brief    生化校准数据共享缓存（校准品组、校准文档、校准曲线、试剂组，按通知失效）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#include "ChCaliDataCache.h"
+#include <algorithm>
+#include "shared/messagebus.h"
+#include "shared/msgiddef.h"
+#include "thrift/ch/ChLogicControlProxy.h"
+#include "thrift/ch/c1005/C1005LogicControlProxy.h"
+#include "src/common/common.h"
+#include "src/common/Mlog/mlog.h"
+
+// 校准曲线缓存上限（曲线条数）
+#define CALI_CURVE_CACHE_MAX_CURVES     (2000)
+
+ChCaliDataCache::ChCaliDataCache()
+    : m_generation(0)
+    , m_groupsValid(false)
+{
+    m_curves.setMaxCost(CALI_CURVE_CACHE_MAX_CURVES);
+
+    // 需在各校准页面之前注册，保证页面处理通知时缓存已失效
+    REGISTER_HANDLER(MSG_ID_CALI_GRP_INFO_UPDATE, this, OnCaliGroupUpdate);
+    REGISTER_HANDLER(MSG_ID_CH_REAGENT_SUPPLY_INFO_UPDATE, this, OnChSupplyUpdate);
+}
+
+///
+/// @brief 获取单例
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+ChCaliDataCache& ChCaliDataCache::GetInstance()
+{
+    static ChCaliDataCache instance;
+    return instance;
+}
+
+///
+/// @brief 获取所有校准品组
+///
+/// @param[out] groups  校准品组列表（与后台返回的顺序一致）
+///
+/// @return true:成功
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool ChCaliDataCache::GetCaliDocGroups(std::vector<ch::tf::CaliDocGroup>& groups)
+{
+    quint64 generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_groupsValid)
+        {
+            groups = m_groups;
+            return true;
+        }
+        generation = m_generation;
+    }
+
+    ::ch::tf::CaliDocGroupQueryResp qryResp;
+    ::ch::tf::CaliDocGroupQueryCond qryCond;
+    if (!ch::LogicControlProxy::QueryCaliDocGroup(qryResp, qryCond)
+        || qryResp.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS)
+    {
+        ULOG(LOG_ERROR, "%s(query cali doc group failed)", __FUNCTION__);
+        return false;
+    }
+
+    groups = qryResp.lstCaliDocGroup;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (generation == m_generation)
+    {
+        m_groups = std::move(qryResp.lstCaliDocGroup);
+        m_groupsValid = true;
+        for (const auto& group : m_groups)
+        {
+            m_groupById[group.id] = group;
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 根据ID获取校准品组
+///
+/// @param[in]  groupId  校准品组ID
+/// @param[out] group    校准品组
+///
+/// @return true:成功
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool ChCaliDataCache::GetCaliDocGroup(int64_t groupId, ch::tf::CaliDocGroup& group)
+{
+    quint64 generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto iter = m_groupById.find(groupId);
+        if (iter != m_groupById.end())
+        {
+            group = iter->second;
+            return true;
+        }
+        generation = m_generation;
+    }
+
+    ::ch::tf::CaliDocGroupQueryResp qryResp;
+    ::ch::tf::CaliDocGroupQueryCond qryCond;
+    qryCond.__set_id(groupId);
+    if (!ch::LogicControlProxy::QueryCaliDocGroup(qryResp, qryCond)
+        || qryResp.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS
+        || qryResp.lstCaliDocGroup.empty())
+    {
+        ULOG(LOG_ERROR, "%s(query cali doc group failed, id: %lld)", __FUNCTION__, groupId);
+        return false;
+    }
+
+    group = qryResp.lstCaliDocGroup[0];
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (generation == m_generation)
+    {
+        m_groupById[groupId] = group;
+    }
+
+    return true;
+}
+
+///
+/// @brief 根据批号和序号获取校准文档（同一组的各水平）
+///
+/// @param[in]  lot   批号
+/// @param[in]  sn    序号
+/// @param[out] docs  校准文档列表
+///
+/// @return true:成功且不为空
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool ChCaliDataCache::GetCaliDocs(const std::string& lot, const std::string& sn, std::vector<ch::tf::CaliDoc>& docs)
+{
+    auto key = std::make_pair(lot, sn);
+    quint64 generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto iter = m_docs.find(key);
+        if (iter != m_docs.end())
+        {
+            docs = iter->second;
+            return true;
+        }
+        generation = m_generation;
+    }
+
+    ::ch::tf::CaliDocQueryResp qryResp;
+    ::ch::tf::CaliDocQueryCond qryCond;
+    qryCond.__set_lot(lot);
+    qryCond.__set_sn(sn);
+    if (!ch::LogicControlProxy::QueryCaliDoc(qryResp, qryCond)
+        || qryResp.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS
+        || qryResp.lstCaliDocs.empty())
+    {
+        ULOG(LOG_ERROR, "%s(query cali doc failed, lot: %s, sn: %s)", __FUNCTION__, lot.c_str(), sn.c_str());
+        return false;
+    }
+
+    docs = qryResp.lstCaliDocs;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (generation == m_generation)
+    {
+        m_docs[key] = std::move(qryResp.lstCaliDocs);
+    }
+
+    return true;
+}
+
+///
+/// @brief 查询校准曲线（按查询条件缓存）
+///
+/// @param[in]  cond    查询条件
+/// @param[out] curves  校准曲线列表
+///
+/// @return true:成功
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool ChCaliDataCache::QueryCaliCurves(const ch::tf::CaliCurveQueryCond& cond, std::vector<ch::tf::CaliCurve>& curves)
+{
+    QString key = QString::fromStdString(ToString(cond));
+    quint64 generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto cached = m_curves.object(key);
+        if (cached != nullptr)
+        {
+            curves = *cached;
+            return true;
+        }
+        generation = m_generation;
+    }
+
+    ::ch::tf::CaliCurveQueryResp qryResp;
+    if (!ch::c1005::LogicControlProxy::QueryCaliCurve(qryResp, cond)
+        || qryResp.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS)
+    {
+        ULOG(LOG_ERROR, "%s(query cali curve failed, cond: %s)", __FUNCTION__, key.toStdString().c_str());
+        return false;
+    }
+
+    curves = qryResp.lstCaliCurves;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (generation == m_generation)
+    {
+        int cost = std::max(1, int(qryResp.lstCaliCurves.size()));
+        m_curves.insert(key, new std::vector<ch::tf::CaliCurve>(std::move(qryResp.lstCaliCurves)), cost);
+    }
+
+    return true;
+}
+
+///
+/// @brief 根据ID获取试剂组
+///
+/// @param[in]  reagentId  试剂组ID
+/// @param[out] reagent    试剂组
+///
+/// @return true:成功
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool ChCaliDataCache::GetReagentGroup(int64_t reagentId, ch::tf::ReagentGroup& reagent)
+{
+    quint64 generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto iter = m_reagents.find(reagentId);
+        if (iter != m_reagents.end())
+        {
+            reagent = iter->second;
+            return true;
+        }
+        generation = m_generation;
+    }
+
+    ::ch::tf::ReagentGroupQueryResp qryResp;
+    ::ch::tf::ReagentGroupQueryCond qryCond;
+    qryCond.__set_id(reagentId);
+    if (!ch::c1005::LogicControlProxy::QueryReagentGroup(qryResp, qryCond)
+        || qryResp.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS
+        || qryResp.lstReagentGroup.empty())
+    {
+        ULOG(LOG_ERROR, "%s(query reagent group failed, id: %lld)", __FUNCTION__, reagentId);
+        return false;
+    }
+
+    reagent = qryResp.lstReagentGroup[0];
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (generation == m_generation)
+    {
+        m_reagents[reagentId] = reagent;
+    }
+
+    return true;
+}
+
+///
+/// @brief 使校准品组和所有校准文档失效
+///
+/// @param[in]  groupId  校准品组ID
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ChCaliDataCache::InvalidateCaliDocGroup(int64_t groupId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_generation;
+    m_groupById.erase(groupId);
+    m_groupsValid = false;
+    m_groups.clear();
+    m_docs.clear();
+}
+
+///
+/// @brief 使所有校准文档失效（新增、修改、删除校准文档后调用）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ChCaliDataCache::InvalidateCaliDocs()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_generation;
+    m_docs.clear();
+}
+
+///
+/// @brief 使所有校准曲线查询结果失效（新增、修改校准曲线后调用）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ChCaliDataCache::InvalidateCurves()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_generation;
+    m_curves.clear();
+}
+
+///
+/// @brief 使试剂组失效（修改试剂组后调用）
+///
+/// @param[in]  reagentId  试剂组ID
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ChCaliDataCache::InvalidateReagentGroup(int64_t reagentId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_generation;
+    m_reagents.erase(reagentId);
+}
+
+///
+/// @brief 校准品组更新
+///
+/// @param[in]  infos  更新信息
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ChCaliDataCache::OnCaliGroupUpdate(std::vector<ch::tf::CaliGroupUpdate, std::allocator<ch::tf::CaliGroupUpdate>> infos)
+{
+    if (infos.empty())
+    {
+        return;
+    }
+
+    // 校准文档随校准品组一起修改，批号序号也可能变化，文档整体失效
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_generation;
+    for (const auto& info : infos)
+    {
+        m_groupById.erase(info.db);
+    }
+    m_groupsValid = false;
+    m_groups.clear();
+    m_docs.clear();
+}
+
+///
+/// @brief 生化试剂耗材更新（装卸载、校准完成、曲线选择都会触发）
+///
+/// @param[in]  supplyUpdates  更新信息
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ChCaliDataCache::OnChSupplyUpdate(std::vector<ch::tf::SupplyUpdate, std::allocator<ch::tf::SupplyUpdate>> supplyUpdates)
+{
+    if (supplyUpdates.empty())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_generation;
+
+    // 只清除对应位置的试剂组
+    for (auto iter = m_reagents.begin(); iter != m_reagents.end();)
+    {
+        const auto& reagent = iter->second;
+        bool hit = std::any_of(supplyUpdates.begin(), supplyUpdates.end(), [&reagent](const ch::tf::SupplyUpdate& update)
+        {
+            return update.deviceSN == reagent.deviceSN && update.posInfo.pos == reagent.posInfo.pos;
+        });
+
+        iter = hit ? m_reagents.erase(iter) : std::next(iter);
+    }
+
+    // 校准完成、曲线切换都通过试剂更新通知，曲线查询结果整体失效
+    m_curves.clear();
+}
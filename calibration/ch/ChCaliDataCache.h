@@ -0,0 +1,208 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     ChCaliDataCache.h
+/// @brief    生化校准数据共享缓存（校准品组、校准文档、校准曲线、试剂组，按通知失效）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <QObject>
+#include <QCache>
+#include "src/thrift/ch/gen-cpp/ch_types.h"
+
+///
+/// @brief 生化校准数据共享缓存
+///     校准设置、校准结果、校准历史、校准详情等页面共用，命中时不再访问后台；
+///     校准品组/校准文档在收到校准品组更新通知时失效，试剂组和校准曲线在收到
+///     生化试剂耗材更新通知时失效；界面自己写入数据后也应调用对应的Invalidate*
+///
+class ChCaliDataCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    ///
+    /// @brief 获取单例
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static ChCaliDataCache& GetInstance();
+
+    ///
+    /// @brief 获取所有校准品组
+    ///
+    /// @param[out] groups  校准品组列表（与后台返回的顺序一致）
+    ///
+    /// @return true:成功
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool GetCaliDocGroups(std::vector<ch::tf::CaliDocGroup>& groups);
+
+    ///
+    /// @brief 根据ID获取校准品组
+    ///
+    /// @param[in]  groupId  校准品组ID
+    /// @param[out] group    校准品组
+    ///
+    /// @return true:成功
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool GetCaliDocGroup(int64_t groupId, ch::tf::CaliDocGroup& group);
+
+    ///
+    /// @brief 根据批号和序号获取校准文档（同一组的各水平）
+    ///
+    /// @param[in]  lot   批号
+    /// @param[in]  sn    序号
+    /// @param[out] docs  校准文档列表
+    ///
+    /// @return true:成功且不为空
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool GetCaliDocs(const std::string& lot, const std::string& sn, std::vector<ch::tf::CaliDoc>& docs);
+
+    ///
+    /// @brief 查询校准曲线（按查询条件缓存）
+    ///
+    /// @param[in]  cond    查询条件
+    /// @param[out] curves  校准曲线列表
+    ///
+    /// @return true:成功
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool QueryCaliCurves(const ch::tf::CaliCurveQueryCond& cond, std::vector<ch::tf::CaliCurve>& curves);
+
+    ///
+    /// @brief 根据ID获取试剂组
+    ///
+    /// @param[in]  reagentId  试剂组ID
+    /// @param[out] reagent    试剂组
+    ///
+    /// @return true:成功
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool GetReagentGroup(int64_t reagentId, ch::tf::ReagentGroup& reagent);
+
+    ///
+    /// @brief 使校准品组和所有校准文档失效
+    ///
+    /// @param[in]  groupId  校准品组ID
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void InvalidateCaliDocGroup(int64_t groupId);
+
+    ///
+    /// @brief 使所有校准文档失效（新增、修改、删除校准文档后调用）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void InvalidateCaliDocs();
+
+    ///
+    /// @brief 使所有校准曲线查询结果失效（新增、修改校准曲线后调用）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void InvalidateCurves();
+
+    ///
+    /// @brief 使试剂组失效（修改试剂组后调用）
+    ///
+    /// @param[in]  reagentId  试剂组ID
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void InvalidateReagentGroup(int64_t reagentId);
+
+protected Q_SLOTS:
+    ///
+    /// @brief 校准品组更新
+    ///
+    /// @param[in]  infos  更新信息
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnCaliGroupUpdate(std::vector<ch::tf::CaliGroupUpdate, std::allocator<ch::tf::CaliGroupUpdate>> infos);
+
+    ///
+    /// @brief 生化试剂耗材更新（装卸载、校准完成、曲线选择都会触发）
+    ///
+    /// @param[in]  supplyUpdates  更新信息
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnChSupplyUpdate(std::vector<ch::tf::SupplyUpdate, std::allocator<ch::tf::SupplyUpdate>> supplyUpdates);
+
+private:
+    ChCaliDataCache();
+
+private:
+    std::mutex                                              m_mutex;            ///< 保护以下缓存
+    quint64                                                 m_generation;       ///< 失效计数（查询期间发生失效时不回填）
+    bool                                                    m_groupsValid;      ///< 校准品组列表是否有效
+    std::vector<ch::tf::CaliDocGroup>                       m_groups;           ///< 校准品组列表
+    std::map<int64_t, ch::tf::CaliDocGroup>                 m_groupById;        ///< 校准品组ID到校准品组
+    std::map<std::pair<std::string, std::string>, std::vector<ch::tf::CaliDoc>> m_docs; ///< (批号,序号)到校准文档
+    QCache<QString, std::vector<ch::tf::CaliCurve>>         m_curves;           ///< 查询条件到校准曲线（代价单位为曲线条数）
+    std::map<int64_t, ch::tf::ReagentGroup>                 m_reagents;         ///< 试剂组ID到试剂组
+};
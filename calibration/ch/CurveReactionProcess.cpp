@@ -44,6 +44,7 @@
 ///
 ///////////////////////////////////////////////////////////////////////////
 #include "CurveReactionProcess.h"
+#include "ChCaliDataCache.h"
 
 ///
 /// @brief
@@ -90,27 +91,14 @@ CurveReactionProcess::~CurveReactionProcess()
 void CurveReactionProcess::StartShowAssayCaliBrateAction(int db)
 {
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
-    ::ch::tf::ReagentGroupQueryResp qryResp;
-    ::ch::tf::ReagentGroupQueryCond qryCond;
 
-    // 设置查询条件，数据库主键
-    qryCond.__set_id(db);
-
-    // 查询成功
-    if (!ch::c1005::LogicControlProxy::QueryReagentGroup(qryResp, qryCond))
+    // 需要显示的试剂组（按数据库主键从共享缓存查询）
+    ch::tf::ReagentGroup showGroup;
+    if (!ChCaliDataCache::GetInstance().GetReagentGroup(db, showGroup))
     {
         ULOG(LOG_ERROR, "Can not find the reagent group id is %d", db);
         return;
     }
-
-    // 没有查找到试剂数据，直接返回
-    if (qryResp.lstReagentGroup.size() < 1)
-    {
-        return;
-    }
-
-    // 需要显示的试剂组
-    ch::tf::ReagentGroup showGroup = qryResp.lstReagentGroup[0];
     // 获取当前曲线
     ::ch::tf::CaliCurveQueryResp _return;
     ::ch::tf::CaliCurveQueryCond ccqc;
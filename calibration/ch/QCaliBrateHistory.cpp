@@ -64,6 +64,7 @@
 #include <qwt_scale_widget.h>
 
 #include "CaliBrateCommom.h"
+#include "ChCaliDataCache.h"
 #include "SortHeaderView.h"
 #include "Serialize.h"
 #include "printcom.hpp"
@@ -1149,8 +1150,6 @@ void QCaliBrateHistory::OnSelectCurveShow(QModelIndex index)
     if (ui->moduleB->isVisible() && ui->moduleB->isChecked() && m_strDevs.size() > 1)
         devIndex = 1;
 
-    // 曲线结果
-    ::ch::tf::CaliCurveQueryResp ResultQueryCaliCurves;
     tf::LimitCond limtidCon;
     limtidCon.__set_offset(0);
     limtidCon.__set_count(MAXHISTORY);
@@ -1166,20 +1165,19 @@ void QCaliBrateHistory::OnSelectCurveShow(QModelIndex index)
     ConditionCurveQuery.__set_isEditCurve(false);
     ConditionCurveQuery.orderByConds.push_back(orderCnd);
 
-    // 查询曲线数据
-    ch::c1005::LogicControlProxy::QueryCaliCurve(ResultQueryCaliCurves, ConditionCurveQuery);
-
-    if (ResultQueryCaliCurves.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS)// || ResultQueryCaliCurves.lstCaliCurves.empty())
+    // 查询曲线数据（切换项目、模块时命中共享缓存）
+    std::vector<ch::tf::CaliCurve> caliCurves;
+    if (!ChCaliDataCache::GetInstance().QueryCaliCurves(ConditionCurveQuery, caliCurves))
     {
         ULOG(LOG_INFO, "QueryCaliCurve failed");
         return;
     }
 
     // 切换项目后确认是否能够点击打印、导出
-    SetPrintAndExportEnabled(!ResultQueryCaliCurves.lstCaliCurves.empty());
+    SetPrintAndExportEnabled(!caliCurves.empty());
 
     // 准备曲线数据
-    CreateQwtPlotCurveData(ResultQueryCaliCurves.lstCaliCurves);
+    CreateQwtPlotCurveData(caliCurves);
 }
 
 void QCaliBrateHistory::OnAssayUpdated()
@@ -46,6 +46,7 @@
 #include "QCaliBrateResult.h"
 #include "ui_QCaliBrateResult.h"
 #include "CaliBrateCommom.h"
+#include "ChCaliDataCache.h"
 #include "src/common/common.h"
 #include "src/common/Mlog/mlog.h"
 #include "src/public/DictionaryKeyName.h"
@@ -356,6 +357,7 @@ void QCaliBrateResult::OnUpdateWorkCurve()
 		ULOG(LOG_ERROR, "QueryReagentGroup() failed");
 		return;
 	}
+    ChCaliDataCache::GetInstance().InvalidateReagentGroup(m_reagent.id);
 
     // 更新历史曲线
     m_reagent.__set_caliCurveId(curve->id);
@@ -519,19 +521,18 @@ void QCaliBrateResult::Init()
 ///
 std::shared_ptr<ch::tf::CaliCurve> QCaliBrateResult::GetCurrentCurve(ch::tf::ReagentGroup& reagent)
 {
-	::ch::tf::CaliCurveQueryResp CurveRsp;
 	::ch::tf::CaliCurveQueryCond CurveQuery;
 	CurveQuery.__set_id(reagent.caliCurveId);
 	CurveQuery.__set_checkDependecy(true);
 
 	// 查询曲线数据
-	ch::c1005::LogicControlProxy::QueryCaliCurve(CurveRsp, CurveQuery);
-	if (CurveRsp.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS || CurveRsp.lstCaliCurves.empty() || CurveRsp.lstCaliCurves[0].isEditCurve)
+	std::vector<ch::tf::CaliCurve> curves;
+	if (!ChCaliDataCache::GetInstance().QueryCaliCurves(CurveQuery, curves) || curves.empty() || curves[0].isEditCurve)
 	{
 		return nullptr;
 	}
 
-	return make_shared<ch::tf::CaliCurve>(CurveRsp.lstCaliCurves[0]);
+	return make_shared<ch::tf::CaliCurve>(curves[0]);
 }
 
 ///
@@ -623,16 +624,6 @@ std::vector<std::shared_ptr<ch::tf::CaliCurve>> QCaliBrateResult::GetHistoryCurv
 void QCaliBrateResult::SetHistoryCurve(std::vector<std::shared_ptr<ch::tf::CaliCurve>>& caliCurves)
 {
 	QStringList curveList;
-    ch::tf::SuppliesInfoQueryResp qryResp;
-    ch::tf::SuppliesInfoQueryCond qryCond;
-    qryCond.__set_pos(m_reagent.posInfo.pos);
-    qryCond.__set_area(m_reagent.posInfo.area);
-    qryCond.__set_suppliesCode(m_reagent.assayCode);
-    qryCond.__set_deviceSN({ m_reagent.deviceSN });
-
-    // 查询曲线数据
-    ch::c1005::LogicControlProxy::QuerySuppliesInfo(qryResp, qryCond);
-
     int count = 0;
     int curCurveIdNo = -1;
 	for(const auto& historyCurve : caliCurves)
@@ -49,6 +49,7 @@
 #include "shared/CommonInformationManager.h"
 #include "shared/tipdlg.h"
 #include "CaliBrateCommom.h"
+#include "ChCaliDataCache.h"
 #include "src/common/Mlog/mlog.h"
 
 QCaliResultEditDialog::QCaliResultEditDialog(QWidget *parent)
@@ -200,6 +201,7 @@ void QCaliResultEditDialog::OnSaveCurveParameter()
     {
         ULOG(LOG_INFO, "QueryCaliCurve failed");
     }
+    ChCaliDataCache::GetInstance().InvalidateCurves();
 
     close();
 }
@@ -66,6 +66,8 @@
 #include "shared/FileExporter.h"
 #include "shared/uicommon.h"
 #include "manager/UserInfoManager.h"
+#include "manager/OperationLogManager.h"
+#include "ChCaliDataCache.h"
 #include "Serialize.h"
 #include "printcom.hpp"
 
@@ -387,12 +389,9 @@ void QCalibrateSet::RefreshPage(/*std::vector<std::shared_ptr<const tf::DeviceIn
     m_CaliBrateGroup->removeRows(0, m_CaliBrateGroup->rowCount());
 
     //ResetCaliBrateGroup();
-    ::ch::tf::CaliDocGroupQueryResp ResultDocGroup;
-    ::ch::tf::CaliDocGroupQueryCond queryDocGroupCondition;
-
-    if (!ch::LogicControlProxy::QueryCaliDocGroup(ResultDocGroup, queryDocGroupCondition)
-        || ResultDocGroup.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS
-        || ResultDocGroup.lstCaliDocGroup.empty())
+    std::vector<ch::tf::CaliDocGroup> caliDocGroups;
+    if (!ChCaliDataCache::GetInstance().GetCaliDocGroups(caliDocGroups)
+        || caliDocGroups.empty())
     {
         SetPrintAndExportEnabled(false);
         return;
@@ -405,7 +404,7 @@ void QCalibrateSet::RefreshPage(/*std::vector<std::shared_ptr<const tf::DeviceIn
 
     int row = 0;
     // 依次显示校准品组的信息
-    for (const auto& docGroup : ResultDocGroup.lstCaliDocGroup)
+    for (const auto& docGroup : caliDocGroups)
     {
         
 		if (!SetTableRowData(row, docGroup))
@@ -452,20 +451,13 @@ bool QCalibrateSet::ShowDocInfo(int64_t groupDb, ch::tf::CaliDocKeyInfo& docKeyI
     // 找不到数据就去数据库中获取，否则就从缓存中获取
     if (m_caliDocIndex.find(groupDb) == m_caliDocIndex.end())
     {
-        ::ch::tf::CaliDocQueryResp ResultDocs;
-        ::ch::tf::CaliDocQueryCond QueryCondition;
-        //QueryCondition.__set_level(docKeyInfo.level);
-        QueryCondition.__set_lot(docKeyInfo.lot);
-        QueryCondition.__set_sn(docKeyInfo.sn);
-
-        if (!ch::LogicControlProxy::QueryCaliDoc(ResultDocs, QueryCondition)
-            || ResultDocs.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS
-            || ResultDocs.lstCaliDocs.empty())
+        std::vector<ch::tf::CaliDoc> caliDocs;
+        if (!ChCaliDataCache::GetInstance().GetCaliDocs(docKeyInfo.lot, docKeyInfo.sn, caliDocs))
         {
             return false;
         }
 
-        m_caliDocIndex[groupDb] = ResultDocs.lstCaliDocs;
+        m_caliDocIndex[groupDb] = std::move(caliDocs);
     }
 
     bool bFound = false;
@@ -869,7 +861,6 @@ void QCalibrateSet::OnDeleteCaliBrateGroup()
             + tr("，校准品组批号：") + QString::fromStdString(group.lot) \
             + tr("，校准品组编号：") + QString::fromStdString(group.sn);
 
-        ::tf::ResultLong _return;
         ::tf::OperationLog ol;
         auto spUser = UserInfoManager::GetInstance()->GetLoginUserInfo();
         if (spUser)
@@ -881,7 +872,7 @@ void QCalibrateSet::OnDeleteCaliBrateGroup()
         ol.__set_operationType(tf::OperationType::DEL);
         ol.__set_operationTime(QDateTime::currentDateTime().toString("yyyy/MM/dd hh:mm:ss").toStdString());
         ol.__set_operationRecord(record.toStdString());
-        if (!DcsControlProxy::GetInstance()->AddOperationLog(_return, ol))
+        if (!COperationLogManager::GetInstance()->PostOperationLog(ol))
         {
             ULOG(LOG_ERROR, "AddOperationLog failed, lot:%s, sn:%s.", group.lot, group.sn);
         }
@@ -937,21 +928,23 @@ bool QCalibrateSet::isAimCaliDocGroup(const std::string &projectName, const ch::
 
     for (const ch::tf::CaliDocKeyInfo& docKeyInfo : docGroup.caliDocKeyInfos) {
 
-        ::ch::tf::CaliDocQueryResp ResultDocs;
-        ::ch::tf::CaliDocQueryCond QueryCondition;
-        QueryCondition.__set_level(docKeyInfo.level);
-        QueryCondition.__set_lot(docKeyInfo.lot);
-        QueryCondition.__set_sn(docKeyInfo.sn);
-
-        if (!ch::LogicControlProxy::QueryCaliDoc(ResultDocs, QueryCondition)
-            || ResultDocs.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS
-            || ResultDocs.lstCaliDocs.empty())
+        // 同一批号序号的各水平文档一次取回并缓存，这里按水平筛选
+        std::vector<ch::tf::CaliDoc> caliDocs;
+        if (!ChCaliDataCache::GetInstance().GetCaliDocs(docKeyInfo.lot, docKeyInfo.sn, caliDocs))
         {
             continue;
         }
 
+        auto iterDoc = std::find_if(caliDocs.begin(), caliDocs.end(), [&docKeyInfo](const ch::tf::CaliDoc& doc)
+        {
+            return doc.level == docKeyInfo.level;
+        });
+        if (iterDoc == caliDocs.end())
+        {
+            continue;
+        }
 
-        for (const auto& compostion : ResultDocs.lstCaliDocs[0].compositions) {
+        for (const auto& compostion : iterDoc->compositions) {
             if (compostion.assayCode == spAssayInfo->assayCode)	return true;
         }
 
@@ -1386,6 +1379,9 @@ bool QCalibrateSet::SetTableRowData(int row, const ch::tf::CaliDocGroup & docGro
 
 bool QCalibrateSet::ClearCacheByGroupId(int64_t groupId)
 {
+    // 共享缓存中的校准品组和文档同时失效
+    ChCaliDataCache::GetInstance().InvalidateCaliDocGroup(groupId);
+
     // 删除保存的校准品组信息
     if (m_CaliGroupSave.find(groupId) != m_CaliGroupSave.end())
     {
@@ -1407,20 +1403,7 @@ bool QCalibrateSet::ClearCacheByGroupId(int64_t groupId)
 
 bool QCalibrateSet::GetSingleCaliGroupFromDb(int64_t groupId, ch::tf::CaliDocGroup& docGroup)
 {
-    ::ch::tf::CaliDocGroupQueryResp ResultDocGroup;
-    ::ch::tf::CaliDocGroupQueryCond queryDocGroupCondition;
-    queryDocGroupCondition.__set_id(groupId);
-
-    if (!ch::LogicControlProxy::QueryCaliDocGroup(ResultDocGroup, queryDocGroupCondition)
-        || ResultDocGroup.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS
-        || ResultDocGroup.lstCaliDocGroup.empty())
-    {
-        return false;
-    }
-
-    docGroup = ResultDocGroup.lstCaliDocGroup[0];
-
-    return true;
+    return ChCaliDataCache::GetInstance().GetCaliDocGroup(groupId, docGroup);
 }
 
 bool QCalibrateSet::ExportCalibratorInfo(QStringList& strExportTextList)
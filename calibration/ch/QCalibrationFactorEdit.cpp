@@ -55,6 +55,7 @@
 #include "src/common/Mlog/mlog.h"
 #include "thrift/ch/c1005/C1005LogicControlProxy.h"
 #include "CaliBrateCommom.h"
+#include "ChCaliDataCache.h"
 
 
 QCalibrationFactorEdit::QCalibrationFactorEdit(QWidget *parent)
@@ -460,6 +461,7 @@ bool QCalibrationFactorEdit::addNewCurve(const double& value_K, const double& va
 
 	::tf::ResultLong _return;
 	ch::c1005::LogicControlProxy::AddCaliCurve(_return, newCurve);
+	ChCaliDataCache::GetInstance().InvalidateCurves();
 	if (_return.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS)
 	{
 		ULOG(LOG_ERROR, "%s():AddCaliCurve() Failed!", __FUNCTION__);
@@ -551,6 +553,7 @@ void QCalibrationFactorEdit::saveCalibrationFactor()
 	// 设置曲线来源为编辑
 	newGroupInfo.__set_caliCurveSource(tf::CurveSource::CURVE_SOURCE_EDIT);
     // 修改数据
+    ChCaliDataCache::GetInstance().InvalidateReagentGroup(newGroupInfo.id);
     if (!ch::c1005::LogicControlProxy::ModifyReagentGroup(newGroupInfo))
     {
         std::shared_ptr<TipDlg> pTipDlg(new TipDlg(tr("编辑校准结果"), tr("校准曲线添加失败")));
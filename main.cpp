@@ -71,11 +71,18 @@
 #include "src/common/Compress/QMiniZip.h"
 #include "manager/SystemConfigManager.h"
 #include "manager/SystemInitInfoManager.h"
+#include "manager/LogPackageManager.h"
+#include "manager/OperationLogManager.h"
+#include "calibration/ch/ChCaliDataCache.h"
+#include "shared/LatencyProfiler.h"
+#include "shared/UiWatchdog.h"
 #include "shared/CommonInformationManager.h"
 #include "shared/uicommon.h"
 #include "uidcsadapter/uidcsadapter.h"
 #include "utility/maintaindatamng.h"
 #include "thrift/UiService.h"
+#include "thrift/ProxyCallMetrics.h"
+#include "thrift/UiNotifyQueue.h"
 #include "thrift/DcsControlProxy.h"
 #include "thrift/ch/ChLogicControlProxy.h"
 #include "thrift/ch/c1005/C1005LogicControlProxy.h"
@@ -87,6 +94,7 @@
 #include "mainwindow/mainwidget.h"
 #include "mainwindow/LeonisSplashScreen.h"
 #include "mainwindow/GlobalEventFilter.h"
+#include "mainwindow/LeonisApplication.h"
 #include "manager/WarnSetManager.h"
 #include "manager/DictionaryQueryManager.h"
 #include "printcom.hpp"
@@ -126,6 +134,9 @@ MainWidget* pMainWidget = nullptr;
 ///
 LONG WINAPI VenusUnhandledExceptionFilter(struct _EXCEPTION_POINTERS* lpExceptionInfo)
 {
+    // 未写入数据库的操作日志写入溢出文件，下次启动时写入
+    COperationLogManager::GetInstance()->SpillPending();
+
     // 合成dump文件名
     SYSTEMTIME st;
     ::GetLocalTime(&st);
@@ -305,9 +316,12 @@ bool LeonisInitManagers(QApplication* a)
         return false;
     }
 
+    // 界面通知入站队列须在界面线程创建
+    UiNotifyQueue::GetInstance().SetCapacity(spSCM->GetUiNotifyQueueCapacity());
+
     // 开启UI层的thrift服务
     std::shared_ptr<UiService> spUS = UiService::GetInstance();
-    if (!spUS->Start(spSCM->GetUiReportPort()))
+    if (!spUS->Start(spSCM->GetUiReportPort(), spSCM->GetUiReportIoThreads(), spSCM->GetUiReportWorkerThreads()))
     {
         ULOG(LOG_ERROR, "Failed to execute Start()");
         return false;
@@ -339,6 +353,22 @@ bool LeonisInitManagers(QApplication* a)
     // 初始化代理对象的端口号
     InitProxyPorts(spSCM->GetDcsControlPort());
 
+    // 启动参数带-profile时开启耗时统计，每分钟输出一次到日志
+    if (spSCM->IsProfileMode())
+    {
+        LatencyProfiler::GetInstance().Start(60);
+    }
+
+    // 代理调用统计：默认采样，-profile时每次调用都统计；每10分钟覆盖写入日志目录
+    if (spSCM->IsProfileMode())
+    {
+        ProxyCallMetrics::GetInstance().SetMode(ProxyCallMetrics::MODE_FULL);
+    }
+    ProxyCallMetrics::GetInstance().Start(GetCurrentDir() + "/logs/proxy_metrics.txt", 600);
+
+    // 启动操作日志的后台写线程（先写上次未写完的日志）
+    COperationLogManager::GetInstance()->StartWriter(GetCurrentDir() + "/../data/backup/operation_log_pending.json");
+
     QString strLan = QString::fromStdString(DictionaryQueryManager::GetCurrentLanuageType() + ".qm");
 
     // 加载翻译文件
@@ -370,6 +400,9 @@ bool LeonisInitManagers(QApplication* a)
         return false;
     }
 
+    // 创建生化校准数据缓存（须先于各校准页面注册更新通知）
+    ChCaliDataCache::GetInstance();
+
     // 临时测试代码，用于质控申请信息查询性能测试，性能优化完成后删除-tcx
 //     QList<QC_APPLY_INFO> stuQcApplyInfo;
 //     if (!gUiAdapterPtr()->QueryDefaultQcTblInfo("", stuQcApplyInfo))
@@ -417,6 +450,15 @@ void LeonisUninitManagers()
     int iRect = printcom::printcom_uninit();
     ULOG(LOG_INFO, "printcom_uninit return:%d", iRect);
 
+    // 停止操作日志的后台写线程，未写完的日志写入溢出文件
+    COperationLogManager::GetInstance()->StopWriter(3000);
+
+    // 停止界面响应看门狗，输出最后一次耗时统计
+    UiWatchdog::GetInstance().Stop();
+    LatencyProfiler::GetInstance().Stop();
+    ProxyCallMetrics::GetInstance().Stop();
+    ULOG(LOG_INFO, "UiNotifyQueue:\n%s", UiNotifyQueue::GetInstance().Report().c_str());
+
     //记录关机事件
     if (!DcsControlProxy::GetInstance()->RecordExitEvent())
     {
@@ -434,13 +476,38 @@ void LeonisUninitManagers()
     spUS->Stop();
 }
 
+///
+/// @brief  上位机日志的备份目录
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+string GetLogBackupDir()
+{
+	return GetCurrentDir() + "/../data/backup/upper_logs";
+}
+
+///
+/// @brief  上位机日志的待打包目录（不能放在备份目录中，避免被DeleteOldestFile删除）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+string GetLogStageDir()
+{
+	return GetCurrentDir() + "/../data/backup/upper_logs_pending";
+}
+
 ///
 /// @brief  备份上位机的日志
+///     优先只把日志目录改名到待打包目录，压缩由LogPackageManager在后台完成；
+///     改名失败时按原方式同步打包
 ///
 /// @return true表示成功
 ///
 /// @par History:
 /// @li 3558/ZhouGuangMing，2024年7月19日，新建函数
+/// @li 5774/WuHongTao，2026年10月19日，改为后台打包
 ///
 bool BackupLogs()
 {
@@ -453,8 +520,14 @@ bool BackupLogs()
 		return true;
 	}
 
+	// 移到待打包目录后立即返回，不阻塞启动
+	if (LogPackageManager::GetInstance()->StageLogs(srcDirPath, GetLogStageDir()))
+	{
+		return true;
+	}
+
 	// 检查目标目录是否存在
-	string dstDirPath = GetCurrentDir() + "/../data/backup/upper_logs";
+	string dstDirPath = GetLogBackupDir();
 	if (!boost::filesystem::exists(dstDirPath))
 	{
 		// 创建完整目录
@@ -511,7 +584,7 @@ bool BackupLogs()
 ///
 int main(int argc, char *argv[])
 {
-    QApplication a(argc, argv);
+    LeonisApplication a(argc, argv);
 
 	// 检查是否存在互斥运行的app
 	vector<string> appNames{"configTool.exe", std::string(APP_NAME) + ".exe"};
@@ -554,6 +627,8 @@ int main(int argc, char *argv[])
     // 创建一个智能指针，退出作用域时会调用其自定义的删除器
     std::shared_ptr<void> spLog((void*)0, [](void* p)
     {
+        // 停止后台日志打包，未打包完的日志留到下次启动继续，不阻塞退出
+        LogPackageManager::GetInstance()->Stop();
         MlogUninit();
     });
 
@@ -561,6 +636,9 @@ int main(int argc, char *argv[])
 	ULOG(LOG_INFO, "# Ver: %s          #", GenerateBuildVersion());
 	ULOG(LOG_INFO, "########################################");
 
+	// 后台打包待打包的日志（包括上次退出时未打包完的）
+	LogPackageManager::GetInstance()->StartPackage(GetLogStageDir(), GetLogBackupDir());
+
 	// 加载rcc文件
 	QString rccFile = qApp->applicationDirPath() + "/leonis.rcc";
 	if (!QResource::registerResource(rccFile))
@@ -600,6 +678,9 @@ int main(int argc, char *argv[])
 	GlobalEventFilter gEventFilter(&mainWidget);
 	a.installEventFilter(&gEventFilter);
 
+    // 启动界面响应看门狗，卡顿dump写入日志目录
+    UiWatchdog::GetInstance().Start(GetCurrentDir() + "/logs/stall");
+
     // 系统加载完毕，关闭启动动画
     LoginWidget loginWidget;
     loginWidget.showFullScreen();
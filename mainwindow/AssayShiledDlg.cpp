@@ -147,7 +147,8 @@ void AssayShiledDlg::LoadDataToDlg()
     m_imTableViewMode->removeRows(0, m_imTableViewMode->rowCount());
 
 	// 按项目添加行
-	const auto& assayMap = CommonInformationManager::GetInstance()->GetAssayInfo();
+	auto spAssaySnapshot = CommonInformationManager::GetInstance()->GetAssaySnapshot();
+	const auto& assayMap = spAssaySnapshot->codeMap;
 	for (const auto& item : assayMap)
 	{
 		// 生化
@@ -370,7 +371,7 @@ bool AssayShiledDlg::SaveShiledByColumn(QColorHeaderModel* model, int column)
 	return true;
 }
 
-void AssayShiledDlg::AddAssayToView(QColorHeaderModel* model,std::shared_ptr<tf::GeneralAssayInfo> gai, int deviceClassify)
+void AssayShiledDlg::AddAssayToView(QColorHeaderModel* model,std::shared_ptr<const tf::GeneralAssayInfo> gai, int deviceClassify)
 {
 	int row = model->rowCount();
 
@@ -118,7 +118,7 @@ private:
 	/// @par History:
 	/// @li 7951/LuoXin，2023年3月15日，新建函数
 	///
-	void AddAssayToView(QColorHeaderModel* model, std::shared_ptr<tf::GeneralAssayInfo> gai, int deviceClassify);
+	void AddAssayToView(QColorHeaderModel* model, std::shared_ptr<const tf::GeneralAssayInfo> gai, int deviceClassify);
 
 	///
 	/// @brief	保存被屏蔽的项目
@@ -46,11 +46,14 @@
 
 #include <QTimer>
 #include <QEvent>
+#include <QKeyEvent>
 #include "GlobalEventFilter.h"
 #include "mainwidget.h"
 #include "shared/messagebus.h"
 #include "shared/msgiddef.h"
 #include "manager/DictionaryQueryManager.h"
+#include "manager/UserInfoManager.h"
+#include "utility/ProxyMetricsDlg.h"
 #include "src/public/ConfigDefine.h"
 #include "src/common/Mlog/mlog.h"
 #include "src/common/common.h"
@@ -78,6 +81,17 @@ GlobalEventFilter::~GlobalEventFilter()
 
 bool GlobalEventFilter::eventFilter(QObject *watched, QEvent *event)
 {
+	// 代理调用统计诊断弹窗快捷键
+	if (event->type() == QEvent::KeyPress)
+	{
+		QKeyEvent* keyEvent = static_cast<QKeyEvent*>(event);
+		if (keyEvent->key() == Qt::Key_D && keyEvent->modifiers() == (Qt::ControlModifier | Qt::AltModifier))
+		{
+			ShowProxyMetricsDlg();
+			return true;
+		}
+	}
+
 	// 键盘按下、鼠标按下
 	if (event->type() == QEvent::KeyPress || event->type() == QEvent::MouseButtonPress)
 	{
@@ -133,3 +147,17 @@ void GlobalEventFilter::slotUpdateMonitorPageTime()
 		m_timer->start();
 	}
 }
+
+void GlobalEventFilter::ShowProxyMetricsDlg()
+{
+	if (m_bMetricsDlgShown || !UserInfoManager::GetInstance()->IsPermissionShow(PSM_ENGDEBUG_NODEDEBUG))
+	{
+		return;
+	}
+
+	ULOG(LOG_INFO, "%s()", __FUNCTION__);
+	m_bMetricsDlgShown = true;
+	ProxyMetricsDlg dlg(m_mainWindow);
+	dlg.exec();
+	m_bMetricsDlgShown = false;
+}
@@ -92,9 +92,19 @@ protected Q_SLOTS:
 	///
 	void slotUpdateMonitorPageTime();
 
+private:
+	///
+	/// @brief  显示代理调用统计诊断弹窗（Ctrl+Alt+D，需工程师节点调试权限）
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void ShowProxyMetricsDlg();
+
 private:
 	QTimer*							m_timer = nullptr;			// 监控页面定时呼出定时器
 	bool							m_bIsShow = false;			// 监控页面是否定时呼出
 	MainWidget*						m_mainWindow = nullptr;		// 主窗口
+	bool							m_bMetricsDlgShown = false;	// 代理调用统计弹窗是否已显示
 };
 
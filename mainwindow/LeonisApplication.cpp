@@ -0,0 +1,76 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     LeonisApplication.cpp
+/// @brief    应用程序对象（界面线程事件分发计时）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#include "LeonisApplication.h"
+#include <QEvent>
+#include "shared/UiWatchdog.h"
+
+LeonisApplication::LeonisApplication(int& argc, char** argv)
+	: QApplication(argc, argv)
+{
+}
+
+///
+/// @brief 分发事件
+///
+/// @param[in]  receiver  接收对象
+/// @param[in]  event     事件
+///
+/// @return 事件是否被处理
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool LeonisApplication::notify(QObject* receiver, QEvent* event)
+{
+	// 队列调用和定时器事件以接收对象的类名作为调用点（非界面线程或看门狗未启动时不计时）
+	if (event->type() == QEvent::MetaCall || event->type() == QEvent::Timer)
+	{
+		UiCallSite site(receiver->metaObject()->className());
+		return QApplication::notify(receiver, event);
+	}
+
+	return QApplication::notify(receiver, event);
+}
@@ -864,6 +864,8 @@ void MainWidget::RegsterMsgHandlerBeforeShow()
 	REGISTER_HANDLER(MSG_ID_LOGIN_SUCCESSED, this, UpdateLoginUser);
     // 注册设备状态改变处理槽函数
     REGISTER_HANDLER(MSG_ID_DEVS_STATUS_CHANGED, this, OnDevStateChange);
+    // 设备状态标签按帧率合并后只刷新有变化的设备
+    connect(&DeviceStateCache::GetInstance(), &DeviceStateCache::signalDeviceStateChanged, this, &MainWidget::OnDevStateDiff);
     // 注册设备当前状态倒计时改变
     REGISTER_HANDLER(MSG_ID_DEV_COUNT_DOWN_UPDATE, this, OnDevStateTimeChange);
 	// 注册时间格式改变槽函数
@@ -927,54 +929,44 @@ void MainWidget::OnDevStateChange(tf::DeviceInfo deviceInfo)
 	{
 		m_menuWidget->SetExitBtnEnable(false);
 	}
+}
 
-    if (!deviceInfo.__isset.deviceSN)
-    {
-        ULOG(LOG_ERROR, "Input Params Invalid!"); 
-        return;
-    }
-
-    // 找到对应的设备标签
-    const auto& CIM = CommonInformationManager::GetInstance();
-    auto spDeviceInfo = CIM->GetDeviceInfo(deviceInfo.deviceSN);
-    if (spDeviceInfo == nullptr)
-    {
-        ULOG(LOG_ERROR, "Get Device Info Failed By Sn:%s", deviceInfo.deviceSN);
-        return;
-    }
-
+///
+/// @brief
+///     更新设备状态标签（按帧率合并，只处理状态有变化的设备）
+///
+/// @param[in]  diff  设备状态变化
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，从OnDevStateChange中拆分
+///
+void MainWidget::OnDevStateDiff(const DeviceStateDiff& diff)
+{
     if (DictionaryQueryManager::GetInstance()->GetPipeLine())
     {
         // 联机轨道特殊处理
-        if (spDeviceInfo->deviceType == ::tf::DeviceType::DEVICE_TYPE_TRACK)
+        if (diff.deviceType == ::tf::DeviceType::DEVICE_TYPE_TRACK)
         {
-            // 联机板显示轨道各个子模块状态
-            track::bcyime::TrackOtherInfo tdoi;
-            if (!DecodeJson(tdoi, spDeviceInfo->otherInfo))
-            {
-                ULOG(LOG_ERROR, "Decode track other info failed!");
-                return;
-            }
-
-            for (auto& item : tdoi.node_infos)
+            // 联机板显示轨道各个子模块状态（只更新有变化的子模块）
+            for (auto& item : diff.changedNodes)
             {
                 for (auto lab : ui->device_status_widget->findChildren<DeviceStatusWidget*>())
                 {
-                    if (lab->GetDeviceSns(spDeviceInfo->deviceType).contains(QString::number(item.second.nodeid)))
+                    if (lab->GetDeviceSns(diff.deviceType).contains(QString::number(item.second.nodeId)))
                     {
                         lab->UpdateStatus(item.second.status, true);
                     }
                 }
             }
         }
-        else 
+        else if (diff.fields & DSF_STATUS)
         {
             for (auto lab : ui->device_status_widget->findChildren<DeviceStatusWidget*>())
             {
-                if (lab->GetDeviceSns(spDeviceInfo->deviceType).contains(QString::fromStdString(spDeviceInfo->deviceSN)))
+                if (lab->GetDeviceSns(diff.deviceType).contains(QString::fromStdString(diff.deviceSN)))
                 {
                     // 联机B设备显示到第二个
-                    lab->UpdateStatus(spDeviceInfo->status, spDeviceInfo->name != "B");
+                    lab->UpdateStatus(diff.status, diff.name != "B");
                 }
             }
         }
@@ -982,15 +974,14 @@ void MainWidget::OnDevStateChange(tf::DeviceInfo deviceInfo)
     else
     {
         // 单机不处理轨道
-        if (spDeviceInfo->deviceType == ::tf::DeviceType::DEVICE_TYPE_TRACK)
+        if (diff.deviceType == ::tf::DeviceType::DEVICE_TYPE_TRACK || !(diff.fields & DSF_STATUS))
         {
             return;
         }
 
         //单机版只有一个设备状态标签，ISE显示在第二个
         auto lab = ui->device_status_widget->findChild<DeviceStatusWidget*>();
-        lab->UpdateStatus(spDeviceInfo->status, spDeviceInfo->deviceType != ::tf::DeviceType::DEVICE_TYPE_ISE1005);
-        //lab->UpdateMasked(spDeviceInfo->masked, spDeviceInfo->deviceType != ::tf::DeviceType::DEVICE_TYPE_ISE1005);
+        lab->UpdateStatus(diff.status, diff.deviceType != ::tf::DeviceType::DEVICE_TYPE_ISE1005);
     }
 }
 
@@ -46,6 +46,7 @@
 #pragma once
 
 #include "src/thrift/gen-cpp/defs_types.h"
+#include "shared/DeviceStateCache.h"
 #include <QWidget>
 #include <QVector>
 
@@ -358,6 +359,17 @@ protected Q_SLOTS:
     ///
     void OnDevStateChange(tf::DeviceInfo deviceInfo);
 
+    ///
+    /// @brief
+    ///     更新设备状态标签（按帧率合并，只处理状态有变化的设备）
+    ///
+    /// @param[in]  diff  设备状态变化
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，从OnDevStateChange中拆分
+    ///
+    void OnDevStateDiff(const DeviceStateDiff& diff);
+
     ///
     /// @brief
     ///     更新设备当前状态的倒计时
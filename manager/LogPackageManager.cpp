@@ -0,0 +1,480 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     LogPackageManager.cpp
+/// @brief    上位机日志的后台打包（多线程压缩、增量打包、大小上限）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#include "LogPackageManager.h"
+#include <algorithm>
+#include <deque>
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QtConcurrent/QtConcurrent>
+#include <zip.h>
+#include <zlib.h>
+#include "src/common/FileUtil.h"
+#include "src/common/Mlog/mlog.h"
+
+// 压缩线程数上限
+#define LOG_PACKAGE_MAX_THREADS         (4)
+// 每个压缩线程同时在途的文件数
+#define LOG_PACKAGE_FILES_PER_THREAD    (2)
+// 同时在途的原始数据字节数上限（控制内存占用，至少允许一个文件）
+#define LOG_PACKAGE_INFLIGHT_BYTES      (qint64(64) * 1024 * 1024)
+// 分块读取、压缩文件的块大小
+#define LOG_PACKAGE_CHUNK_BYTES         (64 * 1024)
+// 单个zip文件的大小上限（字节），超出后较老的日志不再打包
+#define LOG_PACKAGE_MAX_BYTES           (qint64(512) * 1024 * 1024)
+// zip文件名前缀
+#define LOG_PACKAGE_PREFIX              "leonis_logs_"
+
+std::shared_ptr<LogPackageManager>          LogPackageManager::s_instance = nullptr;
+std::recursive_mutex                        LogPackageManager::s_mtx;
+
+LogPackageManager::LogPackageManager()
+    : m_running(false)
+    , m_stop(false)
+    , m_doneFiles(0)
+    , m_totalFiles(0)
+{
+    // 留一个核给界面和业务线程
+    m_pool.setMaxThreadCount(qBound(1, QThread::idealThreadCount() - 1, LOG_PACKAGE_MAX_THREADS));
+}
+
+LogPackageManager::~LogPackageManager()
+{
+    Stop();
+}
+
+///
+/// @brief  获得单例对象
+///
+/// @return 日志打包管理器单例对象
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::shared_ptr<LogPackageManager> LogPackageManager::GetInstance()
+{
+    if (nullptr == s_instance)
+    {
+        std::unique_lock<std::recursive_mutex> autoLock(s_mtx);
+        if (nullptr == s_instance)
+        {
+            s_instance.reset(new LogPackageManager);
+        }
+    }
+
+    return s_instance;
+}
+
+///
+/// @brief  把日志目录移到待打包目录（只改名，不压缩）
+///     在MLOG初始化之前调用，错误先记下，开始打包时再用ULOG写入日志
+///
+/// @param[in]  srcDir    日志目录
+/// @param[in]  stageDir  待打包目录的根目录
+///
+/// @return true表示成功
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool LogPackageManager::StageLogs(const std::string& srcDir, const std::string& stageDir)
+{
+    QString stageRoot = QString::fromStdString(stageDir);
+    if (!QDir().mkpath(stageRoot))
+    {
+        m_stageErrors.push_back("Failed to create stage dir: " + stageDir);
+        return false;
+    }
+
+    // 以时间命名，打包时按名称顺序处理
+    auto formatTime = QDateTime::currentDateTime().toString("yyyy-MM-dd-HH-mm-ss");
+    QString target = stageRoot + "/" + LOG_PACKAGE_PREFIX + formatTime;
+    if (!QDir().rename(QString::fromStdString(srcDir), target))
+    {
+        m_stageErrors.push_back("Failed to move logs to " + target.toStdString());
+        return false;
+    }
+
+    return true;
+}
+
+///
+/// @brief  在后台打包所有待打包目录
+///
+/// @param[in]  stageDir  待打包目录的根目录
+/// @param[in]  dstDir    zip文件存放目录
+///
+/// @return true表示已开始
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool LogPackageManager::StartPackage(const std::string& stageDir, const std::string& dstDir)
+{
+    if (m_running)
+    {
+        return false;
+    }
+
+    // 上一次的线程已经结束，回收后再启动
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+    ULOG(LOG_INFO, "%s(%s -> %s)", __FUNCTION__, stageDir, dstDir);
+    for (const auto& err : m_stageErrors)
+    {
+        ULOG(LOG_ERROR, "%s", err);
+    }
+    m_stageErrors.clear();
+
+    m_stop = false;
+    m_running = true;
+    m_thread = std::thread(&LogPackageManager::PackageAll, this, stageDir, dstDir);
+    return true;
+}
+
+///
+/// @brief  停止打包（等待当前文件处理完，未完成的目录下次继续）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void LogPackageManager::Stop()
+{
+    m_stop = true;
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+///
+/// @brief  后台线程：依次打包所有待打包目录
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void LogPackageManager::PackageAll(std::string stageDir, std::string dstDir)
+{
+    QDir stageRoot(QString::fromStdString(stageDir));
+    QStringList dirNames = stageRoot.entryList(QDir::Dirs | QDir::NoDotAndDotDot, QDir::Name);
+
+    // 统计文件总数用于进度显示
+    m_doneFiles = 0;
+    m_totalFiles = 0;
+    for (const auto& dirName : dirNames)
+    {
+        QDirIterator it(stageRoot.filePath(dirName), QDir::Files | QDir::Hidden, QDirIterator::Subdirectories);
+        while (it.hasNext())
+        {
+            it.next();
+            ++m_totalFiles;
+        }
+    }
+
+    bool success = QDir().mkpath(QString::fromStdString(dstDir));
+    for (const auto& dirName : dirNames)
+    {
+        if (m_stop || !success)
+        {
+            success = false;
+            break;
+        }
+
+        std::string zipPath = dstDir + "/" + dirName.toStdString() + ".zip";
+        if (!PackageDir(stageRoot.filePath(dirName).toStdString(), zipPath))
+        {
+            success = false;
+            continue;
+        }
+
+        try
+        {
+            // 如果目标文件夹中的文件数超限，那么尝试删除最老的文件
+            FileUtil::DeleteOldestFile(dstDir);
+        }
+        catch (std::exception& ex)
+        {
+            ULOG(LOG_WARN, "Failed to execute DeleteOldestFile(): %s", ex.what());
+        }
+    }
+
+    ULOG(LOG_INFO, "%s(finished, files: %d/%d, success: %d)", __FUNCTION__, m_doneFiles, m_totalFiles, success);
+    m_running = false;
+    emit finished(success);
+}
+
+///
+/// @brief  打包一个目录
+///
+/// @param[in]  dir      待打包目录
+/// @param[in]  zipPath  zip文件路径
+///
+/// @return true表示打包完成（被停止时返回false）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool LogPackageManager::PackageDir(const std::string& dir, const std::string& zipPath)
+{
+    QDir srcDir(QString::fromStdString(dir));
+
+    // 新的日志优先，超出大小上限时舍弃较老的日志
+    QFileInfoList files;
+    QDirIterator it(srcDir.absolutePath(), QDir::Files | QDir::Hidden, QDirIterator::Subdirectories);
+    while (it.hasNext())
+    {
+        it.next();
+        files.push_back(it.fileInfo());
+    }
+
+    std::sort(files.begin(), files.end(), [](const QFileInfo& a, const QFileInfo& b)
+    {
+        return a.lastModified() > b.lastModified();
+    });
+
+    // 先写临时文件，完成后再改名，中途退出不会留下不完整的zip
+    QString tmpPath = QString::fromStdString(zipPath) + ".tmp";
+    QFile::remove(tmpPath);
+    zipFile zf = zipOpen(tmpPath.toLocal8Bit().constData(), APPEND_STATUS_CREATE);
+    if (!zf)
+    {
+        ULOG(LOG_ERROR, "Failed to create zip file: %s", tmpPath.toStdString());
+        return false;
+    }
+
+    const int window = m_pool.maxThreadCount() * LOG_PACKAGE_FILES_PER_THREAD;
+    std::deque<std::pair<QFuture<DeflatedFile>, qint64>> pending;
+    qint64 pendingBytes = 0;
+    int next = 0;
+    bool capped = false;
+    int failed = 0;
+    int skipped = 0;
+    qint64 written = 0;
+
+    // 在途的文件数和字节数都有上限，按顺序取回压缩结果并写入zip
+    auto submit = [&]()
+    {
+        while (!capped && !m_stop && int(pending.size()) < window && next < files.size())
+        {
+            const QFileInfo& info = files[next];
+            if (!pending.empty() && pendingBytes + info.size() > LOG_PACKAGE_INFLIGHT_BYTES)
+            {
+                break;
+            }
+
+            ++next;
+            QString name = srcDir.relativeFilePath(info.absoluteFilePath());
+            pendingBytes += info.size();
+            pending.emplace_back(QtConcurrent::run(&m_pool, &LogPackageManager::DeflateFile, info.absoluteFilePath(), name), info.size());
+        }
+    };
+
+    submit();
+    while (!pending.empty())
+    {
+        DeflatedFile file = pending.front().first.result();
+        pendingBytes -= pending.front().second;
+        pending.pop_front();
+
+        // 已要求停止时只等待在途的文件结束
+        if (m_stop)
+        {
+            continue;
+        }
+
+        ++m_doneFiles;
+        if (file.oversize || (file.ok && written + qint64(file.data.size()) > LOG_PACKAGE_MAX_BYTES))
+        {
+            capped = true;
+            ++skipped;
+        }
+        else if (!file.ok)
+        {
+            ++failed;
+        }
+        else
+        {
+            zip_fileinfo zi = {};
+            zi.tmz_date.tm_year = file.date[0];
+            zi.tmz_date.tm_mon = file.date[1] - 1;
+            zi.tmz_date.tm_mday = file.date[2];
+            zi.tmz_date.tm_hour = file.date[3];
+            zi.tmz_date.tm_min = file.date[4];
+            zi.tmz_date.tm_sec = file.date[5];
+
+            // 写入已压缩好的原始数据
+            if (ZIP_OK != zipOpenNewFileInZip2(zf, file.name.c_str(), &zi, NULL, 0, NULL, 0, NULL, Z_DEFLATED, Z_DEFAULT_COMPRESSION, 1)
+                || ZIP_OK != zipWriteInFileInZip(zf, file.data.data(), unsigned(file.data.size()))
+                || ZIP_OK != zipCloseFileInZipRaw(zf, file.rawSize, file.crc))
+            {
+                ULOG(LOG_ERROR, "Failed to write %s to zip", file.name);
+                ++failed;
+            }
+            else
+            {
+                written += qint64(file.data.size());
+            }
+        }
+
+        emit progress(m_doneFiles, m_totalFiles);
+        submit();
+    }
+
+    zipClose(zf, NULL);
+    if (m_stop)
+    {
+        ULOG(LOG_INFO, "%s(stopped, %s will be packaged next time)", __FUNCTION__, dir);
+        QFile::remove(tmpPath);
+        return false;
+    }
+
+    // 超出上限未打包的文件也计入进度
+    if (capped)
+    {
+        skipped += files.size() - next;
+        m_doneFiles += files.size() - next;
+        emit progress(m_doneFiles, m_totalFiles);
+    }
+
+    QFile::remove(QString::fromStdString(zipPath));
+    if (!QFile::rename(tmpPath, QString::fromStdString(zipPath)))
+    {
+        ULOG(LOG_ERROR, "Failed to rename %s", tmpPath.toStdString());
+        return false;
+    }
+
+    ULOG(LOG_INFO, "%s(%s, files: %d, failed: %d, skipped: %d, bytes: %lld)", __FUNCTION__, zipPath, files.size(), failed, skipped, written);
+    srcDir.removeRecursively();
+    return true;
+}
+
+///
+/// @brief  读取并压缩一个文件（在线程池中执行）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+LogPackageManager::DeflatedFile LogPackageManager::DeflateFile(const QString& path, const QString& name)
+{
+    DeflatedFile out;
+    out.name = name.toLocal8Bit().toStdString();
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return out;
+    }
+
+    QDateTime modified = QFileInfo(path).lastModified();
+    out.date[0] = modified.date().year();
+    out.date[1] = modified.date().month();
+    out.date[2] = modified.date().day();
+    out.date[3] = modified.time().hour();
+    out.date[4] = modified.time().minute();
+    out.date[5] = modified.time().second();
+
+    // zip中存放不带头的deflate数据
+    z_stream strm = {};
+    if (Z_OK != deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY))
+    {
+        return out;
+    }
+
+    // 分块读取并压缩，内存中只保留压缩后的数据
+    std::vector<char> inBuf(LOG_PACKAGE_CHUNK_BYTES);
+    std::vector<char> outBuf(LOG_PACKAGE_CHUNK_BYTES);
+    uLong crc = crc32(0L, Z_NULL, 0);
+    uLong rawSize = 0;
+    int ret = Z_OK;
+    int flush = Z_NO_FLUSH;
+    while (flush != Z_FINISH)
+    {
+        qint64 len = file.read(inBuf.data(), qint64(inBuf.size()));
+        if (len < 0)
+        {
+            deflateEnd(&strm);
+            return out;
+        }
+
+        crc = crc32(crc, reinterpret_cast<const Bytef*>(inBuf.data()), uInt(len));
+        rawSize += uLong(len);
+        flush = file.atEnd() ? Z_FINISH : Z_NO_FLUSH;
+        strm.next_in = reinterpret_cast<Bytef*>(inBuf.data());
+        strm.avail_in = uInt(len);
+        do
+        {
+            strm.next_out = reinterpret_cast<Bytef*>(outBuf.data());
+            strm.avail_out = uInt(outBuf.size());
+            ret = deflate(&strm, flush);
+            out.data.append(outBuf.data(), outBuf.size() - strm.avail_out);
+        } while (strm.avail_out == 0);
+
+        // 单个文件已超出zip大小上限，不会被打包，不再继续压缩
+        if (qint64(out.data.size()) > LOG_PACKAGE_MAX_BYTES)
+        {
+            deflateEnd(&strm);
+            out.data.clear();
+            out.oversize = true;
+            return out;
+        }
+    }
+
+    deflateEnd(&strm);
+    if (ret != Z_STREAM_END)
+    {
+        return out;
+    }
+
+    out.crc = crc;
+    out.rawSize = rawSize;
+    out.ok = true;
+    return out;
+}
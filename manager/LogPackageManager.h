@@ -0,0 +1,187 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     LogPackageManager.h
+/// @brief    上位机日志的后台打包（多线程压缩、增量打包、大小上限）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <QObject>
+#include <QThreadPool>
+#include <boost/noncopyable.hpp>
+
+///
+/// @brief   上位机日志打包管理器
+///     启动时只把日志目录改名到待打包目录（不阻塞启动），
+///     之后在后台线程中逐个打包待打包目录：各文件在线程池中并行压缩，
+///     按顺序以原始数据写入zip；每个待打包目录只包含上次打包之后产生的日志，
+///     退出时未打包完的目录保留到下次启动继续打包
+///
+class LogPackageManager : public QObject, public boost::noncopyable
+{
+    Q_OBJECT
+
+public:
+    ///
+    /// @brief  获得单例对象
+    ///
+    /// @return 日志打包管理器单例对象
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static std::shared_ptr<LogPackageManager> GetInstance();
+    ~LogPackageManager();
+
+    ///
+    /// @brief  把日志目录移到待打包目录（只改名，不压缩）
+    ///
+    /// @param[in]  srcDir    日志目录
+    /// @param[in]  stageDir  待打包目录的根目录
+    ///
+    /// @return true表示成功
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool StageLogs(const std::string& srcDir, const std::string& stageDir);
+
+    ///
+    /// @brief  在后台打包所有待打包目录
+    ///
+    /// @param[in]  stageDir  待打包目录的根目录
+    /// @param[in]  dstDir    zip文件存放目录
+    ///
+    /// @return true表示已开始
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool StartPackage(const std::string& stageDir, const std::string& dstDir);
+
+    ///
+    /// @brief  停止打包（等待当前文件处理完，未完成的目录下次继续）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Stop();
+
+    ///
+    /// @brief  是否正在打包
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool IsRunning() const { return m_running; }
+
+signals:
+    ///
+    /// @brief  打包进度
+    ///
+    /// @param[in]  done   已处理的文件数
+    /// @param[in]  total  文件总数
+    ///
+    void progress(int done, int total);
+
+    ///
+    /// @brief  打包结束
+    ///
+    /// @param[in]  success  是否全部打包成功
+    ///
+    void finished(bool success);
+
+private:
+    LogPackageManager();
+
+    ///
+    /// @brief  压缩后的文件
+    ///
+    struct DeflatedFile
+    {
+        std::string     name;               ///< zip中的文件名
+        std::string     data;               ///< 压缩后的数据（raw deflate）
+        unsigned long   crc = 0;            ///< 原始数据的crc32
+        unsigned long   rawSize = 0;        ///< 原始数据大小
+        int             date[6] = {};       ///< 修改时间（年月日时分秒）
+        bool            ok = false;         ///< 是否压缩成功
+        bool            oversize = false;   ///< 压缩后超出zip大小上限（已中止压缩）
+    };
+
+    ///
+    /// @brief  后台线程：依次打包所有待打包目录
+    ///
+    void PackageAll(std::string stageDir, std::string dstDir);
+
+    ///
+    /// @brief  打包一个目录
+    ///
+    /// @param[in]  dir      待打包目录
+    /// @param[in]  zipPath  zip文件路径
+    ///
+    /// @return true表示打包完成（被停止时返回false）
+    ///
+    bool PackageDir(const std::string& dir, const std::string& zipPath);
+
+    ///
+    /// @brief  读取并压缩一个文件（在线程池中执行）
+    ///
+    static DeflatedFile DeflateFile(const QString& path, const QString& name);
+
+private:
+    static std::shared_ptr<LogPackageManager>   s_instance;     ///< 单例对象
+    static std::recursive_mutex                 s_mtx;          ///< 保护单例对象的互斥量
+
+    QThreadPool                     m_pool;                     ///< 压缩线程池
+    std::thread                     m_thread;                   ///< 打包线程
+    std::atomic<bool>               m_running;                  ///< 是否正在打包
+    std::atomic<bool>               m_stop;                     ///< 是否要求停止
+    int                             m_doneFiles;                ///< 已处理的文件数（打包线程使用）
+    int                             m_totalFiles;               ///< 文件总数（打包线程使用）
+    std::vector<std::string>        m_stageErrors;              ///< MLOG初始化之前的错误，开始打包时写入日志
+};
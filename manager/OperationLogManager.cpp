@@ -50,6 +50,78 @@
 #include "src/common/Mlog/mlog.h"
 #include "src/common/TimeUtil.h"
 #include "shared/uicommon.h"
+#include <chrono>
+#include <algorithm>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QJsonObject>
+#include <QJsonDocument>
+
+#define OPT_LOG_QUEUE_MAX				(5000)				// 内存队列的最大条数，超过后写入溢出文件
+#define OPT_LOG_BATCH_SIZE				(64)				// 每批写入的条数
+#define OPT_LOG_RETRY_TIMES				(3)					// 写入失败的重试次数
+#define OPT_LOG_RETRY_INTERVAL			(500)				// 重试间隔（毫秒）
+
+///
+/// @brief 操作日志编码为一行json（溢出文件格式）
+///
+/// @param[in]  log  操作日志
+///
+/// @return 一行json（不含换行）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+static QByteArray EncodeOptLog(const tf::OperationLog& log)
+{
+	QJsonObject obj;
+	obj["user"] = QString::fromStdString(log.user);
+	obj["deviceSN"] = QString::fromStdString(log.deviceSN);
+	obj["deviceClassify"] = log.__isset.deviceClassify ? (int)log.deviceClassify : -1;
+	obj["operationType"] = (int)log.operationType;
+	obj["operationTime"] = QString::fromStdString(log.operationTime);
+	obj["operationRecord"] = QString::fromStdString(log.operationRecord);
+	return QJsonDocument(obj).toJson(QJsonDocument::Compact);
+}
+
+///
+/// @brief 从一行json解码操作日志
+///
+/// @param[in]  line  一行json
+/// @param[out] log   操作日志
+///
+/// @return true:解码成功
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+static bool DecodeOptLog(const QByteArray& line, tf::OperationLog& log)
+{
+	QJsonDocument doc = QJsonDocument::fromJson(line.trimmed());
+	if (!doc.isObject())
+	{
+		return false;
+	}
+
+	QJsonObject obj = doc.object();
+	log.__set_user(obj["user"].toString().toStdString());
+	if (!obj["deviceSN"].toString().isEmpty())
+	{
+		log.__set_deviceSN(obj["deviceSN"].toString().toStdString());
+	}
+
+	if (obj["deviceClassify"].toInt(-1) >= 0)
+	{
+		log.__set_deviceClassify((::tf::AssayClassify::type)obj["deviceClassify"].toInt());
+	}
+
+	log.__set_operationType((::tf::OperationType::type)obj["operationType"].toInt());
+	log.__set_operationTime(obj["operationTime"].toString().toStdString());
+	log.__set_operationRecord(obj["operationRecord"].toString().toStdString());
+	return true;
+}
 
 ///
 /// @brief 初始化单例对象
@@ -73,6 +145,11 @@ std::mutex COperationLogManager::m_mutxMgrMutx;
 ///
 COperationLogManager::COperationLogManager(QObject *parent/* = Q_NULLPTR*/)
 	: QObject(parent)
+	, m_inFlight(0)
+	, m_spilling(false)
+	, m_spillReadPos(0)
+	, m_stop(false)
+	, m_stopDeadline(0)
 {
 
 }
@@ -113,7 +190,11 @@ std::string COperationLogManager::GetDeviceSn() const
 ///
 COperationLogManager::~COperationLogManager()
 {
-
+	// 未正常停止时不再等待写库，剩余日志写入溢出文件
+	if (m_writer.joinable())
+	{
+		StopWriter(0);
+	}
 }
 
 ///
@@ -226,15 +307,8 @@ bool COperationLogManager::AddQCOperationLog(::tf::OperationType::type eOptType,
 	}
 	log.__set_operationRecord(strRecord.toStdString());
 
-	// 调用接口添加操作日志
-	tf::ResultLong ret;
-	DcsControlProxy::GetInstance()->AddOperationLog(ret, log);
-	if (ret.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS)
-	{
-		ULOG(LOG_ERROR, "Add qc document operator log failed.");
-		return false;
-	}
-	return true;
+	// 提交操作日志（后台写入）
+	return PostOperationLog(log);
 }
 
 ///
@@ -301,15 +375,8 @@ bool COperationLogManager::AddCaliOperationLog(::tf::OperationType::type eOptTyp
 	}
 	log.__set_operationRecord(strRecord.toStdString());
 
-	// 调用接口添加操作日志
-	tf::ResultLong ret;
-	DcsControlProxy::GetInstance()->AddOperationLog(ret, log);
-	if (ret.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS)
-	{
-		ULOG(LOG_ERROR, "Add calibrate document operator log failed.");
-		return false;
-	}
-	return true;
+	// 提交操作日志（后台写入）
+	return PostOperationLog(log);
 }
 
 ///
@@ -378,15 +445,8 @@ bool COperationLogManager::AddRangeParamOperationLog(::tf::OperationType::type e
 	}
 	log.__set_operationRecord(strRecord.toStdString());
 
-	// 调用接口添加操作日志
-	tf::ResultLong ret;
-	DcsControlProxy::GetInstance()->AddOperationLog(ret, log);
-	if (ret.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS)
-	{
-		ULOG(LOG_ERROR, "Add range parame operator log failed.");
-		return false;
-	}
-	return true;
+	// 提交操作日志（后台写入）
+	return PostOperationLog(log);
 }
 
 ///
@@ -462,15 +522,8 @@ bool COperationLogManager::AddTestItemOperationLog(::tf::OperationType::type eOp
 	}
 	log.__set_operationRecord(strRecord.toStdString());
 
-	// 调用接口添加操作日志
-	tf::ResultLong ret;
-	DcsControlProxy::GetInstance()->AddOperationLog(ret, log);
-	if (ret.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS)
-	{
-		ULOG(LOG_ERROR, "Add test item operator log failed.");
-		return false;
-	}
-	return true;
+	// 提交操作日志（后台写入）
+	return PostOperationLog(log);
 }
 
 bool COperationLogManager::AddGeneralAssayInfoLog(std::shared_ptr<tf::GeneralAssayInfo> spAssayInfoBefore, std::shared_ptr<tf::GeneralAssayInfo> spAssayInfoAfter)
@@ -525,15 +578,8 @@ bool COperationLogManager::AddGeneralAssayInfoLog(std::shared_ptr<tf::GeneralAss
 	}
 	log.__set_operationRecord(strRecord.toStdString());
 
-	// 调用接口添加操作日志
-	tf::ResultLong ret;
-	DcsControlProxy::GetInstance()->AddOperationLog(ret, log);
-	if (ret.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS)
-	{
-		ULOG(LOG_ERROR, "Add assay info operator log failed.");
-		return false;
-	}
-	return true;
+	// 提交操作日志（后台写入）
+	return PostOperationLog(log);
 }
 
 ///
@@ -718,3 +764,331 @@ std::string COperationLogManager::GetSdChangeOptLogstr(const ::tf::QcDoc& newOcD
 	}
 	return strOptLog.toStdString();
 }
+
+///
+/// @brief 提交操作日志（入队后立即返回，由后台写线程按顺序写入数据库）
+///
+/// @param[in]  log  操作日志
+///
+/// @return true:已提交
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool COperationLogManager::PostOperationLog(const tf::OperationLog& log)
+{
+	{
+		std::unique_lock<std::mutex> lock(m_queueMtx);
+
+		// 队列已满或溢出文件中还有未写入的日志时，追加到溢出文件，保证顺序
+		bool isSpilled = false;
+		if (!m_spillPath.empty() && (m_spilling || m_queue.size() >= OPT_LOG_QUEUE_MAX))
+		{
+			QFile file(QString::fromStdString(m_spillPath));
+			if (file.open(QIODevice::WriteOnly | QIODevice::Append))
+			{
+				isSpilled = (file.write(EncodeOptLog(log) + "\n") > 0);
+				file.close();
+			}
+
+			if (isSpilled)
+			{
+				m_spilling = true;
+			}
+			else
+			{
+				ULOG(LOG_ERROR, "Write operation log spill file failed.");
+			}
+		}
+
+		if (!isSpilled)
+		{
+			m_queue.push_back(log);
+		}
+	}
+
+	m_queueCond.notify_one();
+	return true;
+}
+
+///
+/// @brief 启动后台写线程（需在业务逻辑服务连接后调用）
+///
+/// @param[in]  spillPath  溢出文件路径（存在时先写其中的日志）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void COperationLogManager::StartWriter(const std::string& spillPath)
+{
+	ULOG(LOG_INFO, "%s(%s)", __FUNCTION__, spillPath);
+
+	std::unique_lock<std::mutex> lock(m_queueMtx);
+	if (m_writer.joinable())
+	{
+		return;
+	}
+
+	m_spillPath = spillPath;
+	m_spillReadPos = 0;
+	QDir().mkpath(QFileInfo(QString::fromStdString(m_spillPath)).absolutePath());
+	m_stop = false;
+	m_spilling = QFile::exists(QString::fromStdString(m_spillPath));
+
+	// 上次未写完的日志在前，启动后已提交的日志追加到溢出文件之后
+	if (m_spilling && !m_queue.empty())
+	{
+		QFile file(QString::fromStdString(m_spillPath));
+		if (file.open(QIODevice::WriteOnly | QIODevice::Append))
+		{
+			for (const auto& log : m_queue)
+			{
+				file.write(EncodeOptLog(log) + "\n");
+			}
+
+			file.close();
+			m_queue.clear();
+		}
+	}
+
+	m_writer = std::thread(&COperationLogManager::WriterThread, this);
+}
+
+///
+/// @brief 停止后台写线程（在超时时间内尽量写完，剩余的写入溢出文件）
+///
+/// @param[in]  timeoutMs  等待写完的最长时间（毫秒）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void COperationLogManager::StopWriter(int timeoutMs)
+{
+	ULOG(LOG_INFO, "%s(%d)", __FUNCTION__, timeoutMs);
+
+	{
+		std::unique_lock<std::mutex> lock(m_queueMtx);
+		m_stop = true;
+		m_stopDeadline = QDateTime::currentMSecsSinceEpoch() + timeoutMs;
+	}
+
+	m_queueCond.notify_all();
+	if (m_writer.joinable())
+	{
+		m_writer.join();
+	}
+
+	std::unique_lock<std::mutex> lock(m_queueMtx);
+	SpillQueueLocked();
+}
+
+///
+/// @brief 把队列中未写入的日志写入溢出文件（程序异常时调用，不阻塞等待锁）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void COperationLogManager::SpillPending()
+{
+	std::unique_lock<std::mutex> lock(m_queueMtx, std::try_to_lock);
+	if (!lock.owns_lock())
+	{
+		return;
+	}
+
+	SpillQueueLocked();
+}
+
+///
+/// @brief 后台写线程
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void COperationLogManager::WriterThread()
+{
+	ULOG(LOG_INFO, "%s() start", __FUNCTION__);
+
+	auto isTimeout = [this]() { return m_stop && QDateTime::currentMSecsSinceEpoch() >= m_stopDeadline; };
+	while (true)
+	{
+		// 取一批日志（先不出队，写入后再出队，停止时未写入的留给溢出文件）
+		size_t count = 0;
+		{
+			std::unique_lock<std::mutex> lock(m_queueMtx);
+			m_queueCond.wait(lock, [this]() { return m_stop || !m_queue.empty() || m_spilling; });
+			if (m_queue.empty() && m_spilling)
+			{
+				LoadSpillLocked();
+			}
+
+			if (m_queue.empty() ? m_stop : isTimeout())
+			{
+				break;
+			}
+
+			if (m_queue.empty())
+			{
+				continue;
+			}
+
+			count = std::min<size_t>(m_queue.size(), OPT_LOG_BATCH_SIZE);
+			m_inFlight = 0;
+		}
+
+		// 按顺序写入
+		size_t done = 0;
+		for (size_t i = 0; i < count; i++)
+		{
+			// 逐条登记为已交给DCS，溢出时跳过；队列中未登记的部分已被溢出时结束本批
+			tf::OperationLog log;
+			{
+				std::unique_lock<std::mutex> lock(m_queueMtx);
+				if (i >= m_queue.size())
+				{
+					break;
+				}
+
+				log = m_queue[i];
+				m_inFlight = i + 1;
+			}
+
+			bool isOk = false;
+			for (int i = 0; i < OPT_LOG_RETRY_TIMES && !isOk; i++)
+			{
+				if (i > 0)
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(OPT_LOG_RETRY_INTERVAL));
+				}
+
+				tf::ResultLong ret;
+				isOk = DcsControlProxy::GetInstance()->AddOperationLog(ret, log);
+				if (!isOk && isTimeout())
+				{
+					break;
+				}
+			}
+
+			// 超时未写入的留给溢出文件
+			if (!isOk && isTimeout())
+			{
+				std::unique_lock<std::mutex> lock(m_queueMtx);
+				m_inFlight = i;
+				break;
+			}
+
+			if (!isOk)
+			{
+				ULOG(LOG_ERROR, "Add operation log failed, record:%s.", log.operationRecord);
+			}
+
+			++done;
+			if (isTimeout())
+			{
+				break;
+			}
+		}
+
+		std::unique_lock<std::mutex> lock(m_queueMtx);
+		m_queue.erase(m_queue.begin(), m_queue.begin() + std::min(done, m_queue.size()));
+		m_inFlight = 0;
+	}
+
+	ULOG(LOG_INFO, "%s() exit", __FUNCTION__);
+}
+
+///
+/// @brief 从溢出文件中读取下一批日志到队列（调用者持有队列锁）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void COperationLogManager::LoadSpillLocked()
+{
+	QFile file(QString::fromStdString(m_spillPath));
+	if (!file.open(QIODevice::ReadOnly) || !file.seek(m_spillReadPos))
+	{
+		ULOG(LOG_ERROR, "Open operation log spill file failed.");
+		m_spilling = false;
+		m_spillReadPos = 0;
+		return;
+	}
+
+	while (m_queue.size() < OPT_LOG_QUEUE_MAX && !file.atEnd())
+	{
+		tf::OperationLog log;
+		if (DecodeOptLog(file.readLine(), log))
+		{
+			m_queue.push_back(std::move(log));
+		}
+	}
+
+	m_spillReadPos = file.pos();
+	bool isEnd = file.atEnd();
+	file.close();
+
+	// 溢出文件已读完
+	if (isEnd)
+	{
+		QFile::remove(QString::fromStdString(m_spillPath));
+		m_spilling = false;
+		m_spillReadPos = 0;
+	}
+}
+
+///
+/// @brief 把队列和溢出文件中未读的日志按顺序重写到溢出文件（调用者持有队列锁）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void COperationLogManager::SpillQueueLocked()
+{
+	// 已交给DCS的日志不再溢出，避免重复写入
+	auto itPending = m_queue.begin() + std::min(m_inFlight, m_queue.size());
+
+	// 没有待写入的日志且溢出文件没有已读部分时无需重写
+	if (m_spillPath.empty() || (itPending == m_queue.end() && (!m_spilling || m_spillReadPos == 0)))
+	{
+		return;
+	}
+
+	// 队列中的日志在溢出文件未读部分之前
+	QByteArray data;
+	for (auto it = itPending; it != m_queue.end(); ++it)
+	{
+		data += EncodeOptLog(*it) + "\n";
+	}
+
+	QString spillPath = QString::fromStdString(m_spillPath);
+	if (m_spilling)
+	{
+		QFile oldFile(spillPath);
+		if (oldFile.open(QIODevice::ReadOnly) && oldFile.seek(m_spillReadPos))
+		{
+			data += oldFile.readAll();
+		}
+	}
+
+	// 先写临时文件再替换，避免写一半时异常丢失日志
+	QFile tmpFile(spillPath + ".tmp");
+	if (!tmpFile.open(QIODevice::WriteOnly | QIODevice::Truncate) || tmpFile.write(data) != data.size())
+	{
+		ULOG(LOG_ERROR, "Write operation log spill file failed.");
+		return;
+	}
+
+	tmpFile.close();
+	QFile::remove(spillPath);
+	if (!QFile::rename(spillPath + ".tmp", spillPath))
+	{
+		ULOG(LOG_ERROR, "Rename operation log spill file failed.");
+		return;
+	}
+
+	// 已交给DCS的日志留在队首，由写线程写完后出队
+	ULOG(LOG_INFO, "Spill %d operation logs.", (int)(m_queue.end() - itPending));
+	m_queue.erase(itPending, m_queue.end());
+	m_spilling = true;
+	m_spillReadPos = 0;
+}
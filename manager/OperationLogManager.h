@@ -47,12 +47,19 @@
 #include <boost/noncopyable.hpp>
 #include <memory>
 #include <mutex>
+#include <deque>
+#include <string>
+#include <thread>
+#include <condition_variable>
 #include <QObject>
 #include "src/thrift/gen-cpp/defs_types.h"
 #include "src/thrift/im/gen-cpp/im_types.h"
 
 ///
 /// @brief 操作日志管理类单例对象
+///     操作日志由后台写线程按提交顺序写入数据库，调用者只入队，不等待写库；
+///     队列满时后续日志按顺序写入溢出文件，退出时未写完的日志也写入溢出文件，
+///     下次启动时先写溢出文件中的日志
 ///
 class COperationLogManager : public QObject, public boost::noncopyable
 {
@@ -162,6 +169,46 @@ public:
 	///
 	bool AddGeneralAssayInfoLog(std::shared_ptr<tf::GeneralAssayInfo> spAssayInfoBefore, std::shared_ptr<tf::GeneralAssayInfo> spAssayInfoAfter);
 
+	///
+	/// @brief 提交操作日志（入队后立即返回，由后台写线程按顺序写入数据库）
+	///
+	/// @param[in]  log  操作日志
+	///
+	/// @return true:已提交
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	bool PostOperationLog(const tf::OperationLog& log);
+
+	///
+	/// @brief 启动后台写线程（需在业务逻辑服务连接后调用）
+	///
+	/// @param[in]  spillPath  溢出文件路径（存在时先写其中的日志）
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void StartWriter(const std::string& spillPath);
+
+	///
+	/// @brief 停止后台写线程（在超时时间内尽量写完，剩余的写入溢出文件）
+	///
+	/// @param[in]  timeoutMs  等待写完的最长时间（毫秒）
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void StopWriter(int timeoutMs);
+
+	///
+	/// @brief 把队列中未写入的日志写入溢出文件（程序异常时调用，不阻塞等待锁）
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void SpillPending();
+
 private:
 	///
 	/// @brief 
@@ -184,7 +231,42 @@ private:
 	/// @li 1556/Chenjianlin，2023年12月14日，新建函数
 	///
 	std::string GetDeviceSn() const;	
-	
+
+	///
+	/// @brief 后台写线程
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void WriterThread();
+
+	///
+	/// @brief 从溢出文件中读取下一批日志到队列（调用者持有队列锁）
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void LoadSpillLocked();
+
+	///
+	/// @brief 把队列和溢出文件中未读的日志按顺序重写到溢出文件（调用者持有队列锁）
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void SpillQueueLocked();
+
+	std::thread								m_writer;					///< 后台写线程
+	std::mutex								m_queueMtx;					///< 队列互斥量
+	std::condition_variable					m_queueCond;				///< 队列条件变量
+	std::deque<tf::OperationLog>			m_queue;					///< 待写入的日志
+	size_t									m_inFlight;					///< 队首已交给DCS写入的日志数（溢出时跳过）
+	std::string								m_spillPath;				///< 溢出文件路径
+	bool									m_spilling;					///< 溢出文件中是否有未写入的日志
+	int64_t									m_spillReadPos;				///< 溢出文件的读取位置
+	bool									m_stop;						///< 是否要求停止
+	int64_t									m_stopDeadline;				///< 停止时写完日志的截止时间（毫秒）
+
 	// 当前类的单例对象
 	static std::shared_ptr<COperationLogManager> s_instance;
 	static std::mutex m_mutxMgrMutx;
@@ -163,6 +163,48 @@ unsigned short SystemConfigManager::GetDcsControlPort() const
     return m_usDcsControl;
 }
 
+///
+/// @brief
+///     获得UI的thrift服务IO线程数
+///
+/// @return 线程数，0表示按CPU核数自动计算
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+int SystemConfigManager::GetUiReportIoThreads() const
+{
+    return m_iUiReportIoThreads;
+}
+
+///
+/// @brief
+///     获得UI的thrift服务工作线程数
+///
+/// @return 线程数，0表示按CPU核数自动计算
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+int SystemConfigManager::GetUiReportWorkerThreads() const
+{
+    return m_iUiReportWorkerThreads;
+}
+
+///
+/// @brief
+///     获得界面通知入站队列每类消息的积压上限
+///
+/// @return 积压上限
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+int SystemConfigManager::GetUiNotifyQueueCapacity() const
+{
+    return m_iUiNotifyQueueCapacity;
+}
+
 ///
 /// @brief 是否全屏显示
 ///
@@ -188,6 +230,17 @@ bool SystemConfigManager::IsDebugMode() const
 	return qApp->arguments().contains("-debug");
 }
 
+///
+/// @brief 是否开启性能统计（启动参数-profile）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool SystemConfigManager::IsProfileMode() const
+{
+	return qApp->arguments().contains("-profile");
+}
+
 ///
 /// @brief  判断软件是否注册
 ///
@@ -267,6 +320,9 @@ void SystemConfigManager::SetNeedRegister(bool val)
 SystemConfigManager::SystemConfigManager()
     : m_usUiReportPort(UI_REPORT_PORT)
     , m_usDcsControl(DCS_CONTROL_PORT)
+    , m_iUiReportIoThreads(0)
+    , m_iUiReportWorkerThreads(0)
+    , m_iUiNotifyQueueCapacity(512)
     , m_bNeedRegister{true}
 {
 }
@@ -288,6 +344,10 @@ bool SystemConfigManager::LoadThriftConfig(const boost::property_tree::ptree& pt
     m_usUiReportPort = pt.get<unsigned short>("config.thrift.UiReport.port");
     // DCS的thrift服务端口
     m_usDcsControl = pt.get<unsigned short>("config.thrift.DcsControl.port");
+    // UI的thrift服务线程数和界面通知积压上限（可选，未配置时使用默认值）
+    m_iUiReportIoThreads = pt.get<int>("config.thrift.UiReport.ioThreads", 0);
+    m_iUiReportWorkerThreads = pt.get<int>("config.thrift.UiReport.workerThreads", 0);
+    m_iUiNotifyQueueCapacity = pt.get<int>("config.thrift.UiReport.queueCapacity", 512);
 
     return true;
 }
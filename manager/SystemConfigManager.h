@@ -105,6 +105,39 @@ public:
     ///
     unsigned short GetDcsControlPort() const;
 
+    ///
+    /// @brief
+    ///     获得UI的thrift服务IO线程数
+    ///
+    /// @return 线程数，0表示按CPU核数自动计算
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    int GetUiReportIoThreads() const;
+
+    ///
+    /// @brief
+    ///     获得UI的thrift服务工作线程数
+    ///
+    /// @return 线程数，0表示按CPU核数自动计算
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    int GetUiReportWorkerThreads() const;
+
+    ///
+    /// @brief
+    ///     获得界面通知入站队列每类消息的积压上限
+    ///
+    /// @return 积压上限
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    int GetUiNotifyQueueCapacity() const;
+
 	///
 	/// @brief 是否全屏显示
 	///
@@ -124,6 +157,14 @@ public:
 	///
 	bool IsDebugMode() const;
 
+	///
+	/// @brief 是否开启性能统计（启动参数-profile）
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	bool IsProfileMode() const;
+
     ///
     /// @brief  判断软件是否注册
     ///
@@ -189,6 +230,9 @@ private:
 
     unsigned short                  m_usUiReportPort;           ///< UI的thrift上报端口
     unsigned short                  m_usDcsControl;             ///< DCS的thrift服务端口
+    int                             m_iUiReportIoThreads;       ///< UI的thrift服务IO线程数（0表示自动）
+    int                             m_iUiReportWorkerThreads;   ///< UI的thrift服务工作线程数（0表示自动）
+    int                             m_iUiNotifyQueueCapacity;   ///< 界面通知入站队列每类消息的积压上限
     
     bool                            m_bNeedRegister;            //< （为公司内部增加的判断）软件是否需要注册，true表示需要，false表示不需要
 };
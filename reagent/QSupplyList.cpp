@@ -122,7 +122,7 @@ QSupplyList::QSupplyList(QWidget *parent)
     : QWidget(parent),
     m_supplyMode(nullptr),
     m_regIseDialog(nullptr),
-    m_needUpdate(false),
+    m_updatePolicy("QSupplyList", 0),
     m_bInit(false),
 	m_sampleDetectDlg(Q_NULLPTR),
     m_isePerfusionDlg(new QIsePerfusionDlg(this)),
@@ -130,6 +130,7 @@ QSupplyList::QSupplyList(QWidget *parent)
 {
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
     ui->setupUi(this);
+    m_updatePolicy.WatchPage(this);
     m_sortedHistory = { -1, Qt::AscendingOrder };
     Init();
 }
@@ -631,10 +632,11 @@ void QSupplyList::UpdateConsumeTable()
     // 未显示则不更新
     if (!isVisible())
     {
-        m_needUpdate = true;
+        m_updatePolicy.DeferReset();
         return;
     }
 
+    m_updatePolicy.CountApplied();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
     // 禁能排序
     ui->tableView->setSortingEnabled(false);
@@ -1546,10 +1548,10 @@ void QSupplyList::SetTblItemState(QStandardItem* pItem, TblItemState enState)
 void QSupplyList::showEvent(QShowEvent *event)
 {
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
-    if (m_needUpdate)
+    if (m_updatePolicy.NeedReset())
     {
+        m_updatePolicy.OnReset();
         RefreshSupplyList(m_deivceVec);
-        m_needUpdate = false;
     }
 
     // 初始化时列宽自适应
@@ -1747,7 +1749,7 @@ void QSupplyList::OnUpdateSupplyInfo(std::vector<ch::tf::SupplyUpdate, std::allo
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
     if (!isVisible())
     {
-        m_needUpdate = true;
+        m_updatePolicy.DeferReset();
         return;
     }
 
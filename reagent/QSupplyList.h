@@ -55,6 +55,7 @@
 #include "src/thrift/ch/gen-cpp/ch_types.h"
 #include "src/thrift/ise/gen-cpp/ise_types.h"
 #include "PrintExportDefine.h"
+#include "shared/PageUpdatePolicy.h"
 
 class QRecordISESupply;
 class QStandardItemModel;
@@ -528,7 +529,7 @@ private:
     QStandardItemModel*             m_supplyMode;               ///< 耗材的模式
 	Devices							m_deivceVec;
 	QRecordISESupply*				m_regIseDialog;				///< 登记ISE的对话框
-    bool                            m_needUpdate;               ///< 需要更新与否
+    PageUpdatePolicy                m_updatePolicy;             ///< 页面可见性更新策略（耗材表只能整表刷新，隐藏期间的更新合并为显示时的一次刷新）
     bool                            m_bInit;                    //   是否已经初始化
 	QSampleDetectDlg*				m_sampleDetectDlg;			///< 余量探测弹窗
     std::pair<int, Qt::SortOrder>   m_sortedHistory;            ///< 记录排序
@@ -114,6 +114,7 @@ enum ReagentColumnIndex {
 
 #define     USER_SORT_ROLE                  (Qt::UserRole + 21)      // 排序值
 #define     USER_EMPTY_ROW_FLAG_ROLE        (Qt::UserRole + 22)      // 空行标志
+#define     PAGE_HIDDEN_MAX_PENDING         (300)                    // 页面隐藏时最多记录的更新数（超过则显示时整体刷新）
 
 #define     SetItemSortData(item, sortData) {item->setData(sortData, USER_SORT_ROLE);}
 
@@ -161,9 +162,14 @@ ReagentShowList::ReagentShowList(QWidget *parent /*= Q_NULLPTR*/)
     m_needUpdate(true),
     m_bInit(false),
     m_iSortOrder(SortHeaderView::NoOrder),
-    m_iSortColIdx(-1)
+    m_iSortColIdx(-1),
+    m_updatePolicy("ReagentShowList", PAGE_HIDDEN_MAX_PENDING),
+    m_pendingChSupply(m_updatePolicy),
+    m_pendingImRgnt(m_updatePolicy),
+    m_pendingImDlt(m_updatePolicy)
 {
     ui->setupUi(this);
+    m_updatePolicy.WatchPage(this);
     m_selectCondition = nullptr;
     m_commAssayMgr = CommonInformationManager::GetInstance();
 
@@ -1416,12 +1422,25 @@ void ReagentShowList::SetTblItemState(QStandardItem* pItem, TblItemState enState
 ///
 void ReagentShowList::showEvent(QShowEvent *event)
 {
-    if (m_needUpdate)
+    // 需要整体刷新时隐藏期间的增量更新不再需要
+    if (m_needUpdate || m_updatePolicy.NeedReset())
     {
+        m_pendingChSupply.Clear();
+        m_pendingImRgnt.Clear();
+        m_pendingImDlt.Clear();
+        if (m_updatePolicy.NeedReset())
+        {
+            m_updatePolicy.OnReset();
+        }
+
         OnRefreshReagentList();
         //QTimer::singleShot(0, this, SLOT(UpdateTblDisplayByCfg()));
         m_needUpdate = false;
     }
+    else
+    {
+        ReplayPendingUpdates();
+    }
 
     // 第一次显示
     if (!m_bInit)
@@ -2129,12 +2148,24 @@ void ReagentShowList::UpdateReagentInformation(const std::vector<ch::tf::SupplyU
 	ULOG(LOG_INFO, u8"试剂列表收到刷新消息 %s(%s)", __FUNCTION__, ToString(supplyUpdates));
 
     // 对应的模块为空
-    if (m_reagentModel == nullptr || !isVisible())
+    if (m_reagentModel == nullptr)
     {
         m_needUpdate = true;
         return;
     }
 
+    // 未显示则记录更新的位置，显示时一次回放
+    if (!isVisible())
+    {
+        for (const auto& supplyUpdate : supplyUpdates)
+        {
+            m_pendingChSupply.Defer(ChSupplyKey(supplyUpdate.deviceSN, supplyUpdate.posInfo.area, supplyUpdate.posInfo.pos), supplyUpdate);
+        }
+        return;
+    }
+
+    m_updatePolicy.CountApplied();
+
     // 记录更新内容
     std::map<std::string, std::set<int>> mapDevSnUpdatePos;
     for (const auto& supplyUpdate : supplyUpdates)
@@ -3740,13 +3771,15 @@ void ReagentShowList::onRegisterClicked()
 
 void ReagentShowList::UpdateImReagentChanged(const im::tf::ReagentInfoTable& stuRgntInfo, im::tf::ChangeType::type changeType)
 {
-    // 未显示则不更新
+    // 未显示则记录，显示时一次回放
     if (!isVisible())
     {
-        m_needUpdate = true;
+        m_pendingImRgnt.Defer(stuRgntInfo.id, ImRgntChange(stuRgntInfo, changeType));
         return;
     }
 
+    m_updatePolicy.CountApplied();
+
     ULOG(LOG_INFO, "%s(%d)", __FUNCTION__, int(changeType));
     // 更新内容时锁定排序
     TblSortLockGuard tblSortLock(ui->tableView);
@@ -3761,37 +3794,11 @@ void ReagentShowList::UpdateImReagentChanged(const im::tf::ReagentInfoTable& stu
     // 如果是清空记录
     //if (changeType != im::tf::ChangeType::Delete)
     {
-        // 更新试剂信息，构造查询条件和查询结果,查询所有试剂信息
-        ::im::tf::ReagentInfoTableQueryResp qryResp;
-        ::im::tf::ReagTableUIQueryCond qryCond;
-
-        // 构造查询条件
-        if (stuRgntInfo.__isset.assayCode && (stuRgntInfo.assayCode > 0))
-        {
-            std::vector<std::string> vecDevSns;
-            vecDevSns.push_back(stuRgntInfo.deviceSN);
-            qryCond.__set_deviceSNs(vecDevSns);
-            qryCond.__set_assayCode(stuRgntInfo.assayCode);
-        }
-        else
+        if (!ReloadImReagentGroup(stuRgntInfo))
         {
-            qryCond.__set_reagentId(stuRgntInfo.id);
-        }
-
-        // 执行查询
-        bool bRet = ::im::LogicControlProxy::QueryReagentInfoForUI(qryResp, qryCond);
-        if (!bRet || qryResp.result != ::tf::ThriftResult::THRIFT_RESULT_SUCCESS)
-        {
-            ULOG(LOG_ERROR, "QueryReagentInfoForUI failed.");
             UpdateBtnEnabled();
             return;
         }
-
-        // 后台设计缺陷无法监听试剂使用状态改变，暂由UI特殊处理：UI收到试剂更新通知时，更新该设备所有同项目试剂
-        for (const auto& stuRgntIf : qryResp.lstReagentInfos)
-        {
-            UpdateSingleRegntInfo(stuRgntIf);
-        }
     }
 
     // 如果之前有选中行
@@ -3804,6 +3811,52 @@ void ReagentShowList::UpdateImReagentChanged(const im::tf::ReagentInfoTable& stu
     UpdateBtnEnabled();
 }
 
+///
+/// @brief 重新查询并显示与试剂同设备同项目的全部试剂（无项目时按试剂ID查询）
+///
+/// @param[in]  stuRgntInfo  试剂信息
+///
+/// @return 查询成功返回true
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool ReagentShowList::ReloadImReagentGroup(const im::tf::ReagentInfoTable& stuRgntInfo)
+{
+    // 更新试剂信息，构造查询条件和查询结果,查询所有试剂信息
+    ::im::tf::ReagentInfoTableQueryResp qryResp;
+    ::im::tf::ReagTableUIQueryCond qryCond;
+
+    // 构造查询条件
+    if (stuRgntInfo.__isset.assayCode && (stuRgntInfo.assayCode > 0))
+    {
+        std::vector<std::string> vecDevSns;
+        vecDevSns.push_back(stuRgntInfo.deviceSN);
+        qryCond.__set_deviceSNs(vecDevSns);
+        qryCond.__set_assayCode(stuRgntInfo.assayCode);
+    }
+    else
+    {
+        qryCond.__set_reagentId(stuRgntInfo.id);
+    }
+
+    // 执行查询
+    bool bRet = ::im::LogicControlProxy::QueryReagentInfoForUI(qryResp, qryCond);
+    if (!bRet || qryResp.result != ::tf::ThriftResult::THRIFT_RESULT_SUCCESS)
+    {
+        ULOG(LOG_ERROR, "QueryReagentInfoForUI failed.");
+        return false;
+    }
+
+    // 后台设计缺陷无法监听试剂使用状态改变，暂由UI特殊处理：UI收到试剂更新通知时，更新该设备所有同项目试剂
+    for (const auto& stuRgntIf : qryResp.lstReagentInfos)
+    {
+        UpdateSingleRegntInfo(stuRgntIf);
+    }
+
+    return true;
+}
+
 ///
 /// @brief
 ///     免疫稀释液信息更新
@@ -3816,13 +3869,15 @@ void ReagentShowList::UpdateImReagentChanged(const im::tf::ReagentInfoTable& stu
 ///
 void ReagentShowList::UpdateImDltChanged(const im::tf::DiluentInfoTable& stuDltInfo, im::tf::ChangeType::type changeType)
 {
-    // 未显示则不更新
+    // 未显示则记录，显示时一次回放
     if (!isVisible())
     {
-        m_needUpdate = true;
+        m_pendingImDlt.Defer(stuDltInfo.id, ImDltChange(stuDltInfo, changeType));
         return;
     }
 
+    m_updatePolicy.CountApplied();
+
     ULOG(LOG_INFO, __FUNCTION__);
     // 更新内容时锁定排序
     TblSortLockGuard tblSortLock(ui->tableView);
@@ -3861,6 +3916,117 @@ void ReagentShowList::UpdateImDltChanged(const im::tf::DiluentInfoTable& stuDltI
     UpdateBtnEnabled();
 }
 
+///
+/// @brief 页面显示时一次回放隐藏期间合并的耗材/试剂更新
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ReagentShowList::ReplayPendingUpdates()
+{
+    std::map<ChSupplyKey, ch::tf::SupplyUpdate> chChanges;
+    std::map<int64_t, ImRgntChange> imRgntChanges;
+    std::map<int64_t, ImDltChange> imDltChanges;
+    bool bChOk = m_pendingChSupply.Take(chChanges);
+    bool bImRgntOk = m_pendingImRgnt.Take(imRgntChanges);
+    bool bImDltOk = m_pendingImDlt.Take(imDltChanges);
+
+    // 超过阈值，整体刷新
+    if (!bChOk || !bImRgntOk || !bImDltOk)
+    {
+        m_updatePolicy.OnReset();
+        OnRefreshReagentList();
+        return;
+    }
+
+    if (chChanges.empty() && imRgntChanges.empty() && imDltChanges.empty())
+    {
+        return;
+    }
+
+    ULOG(LOG_INFO, "%s(ch:%d, imRgnt:%d, imDlt:%d)", __FUNCTION__, int(chChanges.size()), int(imRgntChanges.size()), int(imDltChanges.size()));
+
+    // 生化耗材一次更新
+    if (!chChanges.empty())
+    {
+        std::vector<ch::tf::SupplyUpdate> supplyUpdates;
+        supplyUpdates.reserve(chChanges.size());
+        for (const auto& change : chChanges)
+        {
+            supplyUpdates.push_back(change.second);
+        }
+
+        UpdateReagentInformation(supplyUpdates);
+    }
+
+    if (imRgntChanges.empty() && imDltChanges.empty())
+    {
+        return;
+    }
+
+    m_updatePolicy.CountApplied();
+
+    // 更新内容时锁定排序
+    TblSortLockGuard tblSortLock(ui->tableView);
+
+    // 记录当前选中行
+    QModelIndexList curSelectedRows = ui->tableView->selectionModel()->selectedRows();
+
+    // 免疫试剂：先移除全部变更的试剂，再按查询条件（设备+项目，无项目时按试剂ID）分组，每组只查询一次
+    std::map<std::pair<std::string, int64_t>, const im::tf::ReagentInfoTable*> rgntQueries;
+    for (const auto& change : imRgntChanges)
+    {
+        const auto& stuRgntInfo = change.second.first;
+        ShowBlankLine(stuRgntInfo);
+
+        bool byAssay = (stuRgntInfo.__isset.assayCode && (stuRgntInfo.assayCode > 0));
+        auto queryKey = byAssay ? std::make_pair(stuRgntInfo.deviceSN, int64_t(stuRgntInfo.assayCode))
+            : std::make_pair(std::string(), stuRgntInfo.id);
+        rgntQueries.emplace(queryKey, &stuRgntInfo);
+    }
+
+    for (const auto& query : rgntQueries)
+    {
+        ReloadImReagentGroup(*query.second);
+    }
+
+    // 免疫稀释液：按设备查询，所有变更的设备合并为一次查询
+    std::set<std::string> dltDevSns;
+    for (const auto& change : imDltChanges)
+    {
+        const auto& stuDltInfo = change.second.first;
+        ShowBlankLine(stuDltInfo);
+
+        if (stuDltInfo.__isset.deviceSN)
+        {
+            dltDevSns.insert(stuDltInfo.deviceSN);
+        }
+        else
+        {
+            std::vector<std::string> deviceSnListCh;
+            std::vector<std::string> deviceSnListIm;
+            GetClassfiedDeviceSn(deviceSnListCh, deviceSnListIm);
+            dltDevSns.insert(deviceSnListIm.begin(), deviceSnListIm.end());
+        }
+    }
+
+    if (!dltDevSns.empty())
+    {
+        UpdateImDltInfo(std::vector<std::string>(dltDevSns.begin(), dltDevSns.end()));
+    }
+
+    ULOG(LOG_INFO, "%s(imRgnt queries:%d, imDlt devices:%d)", __FUNCTION__, int(rgntQueries.size()), int(dltDevSns.size()));
+
+    // 如果之前有选中行
+    SelectByModelIndex(curSelectedRows);
+
+    // 列宽自适应
+    ResizeTblColToContentAfterInit(ui->tableView);
+
+    // 更新按钮状态
+    UpdateBtnEnabled();
+}
+
 ///
 /// @brief
 ///     清空试剂信息
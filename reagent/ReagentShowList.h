@@ -44,6 +44,7 @@
 ///
 ///////////////////////////////////////////////////////////////////////////
 #pragma once
+#include <tuple>
 #include <QWidget>
 #include <qabstractitemmodel>
 #include <boost/any.hpp>
@@ -53,6 +54,7 @@
 #include "src/public/ConfigDefine.h"
 #include "PrintExportDefine.h"
 #include "shared/CommonInformationManager.h"
+#include "shared/PageUpdatePolicy.h"
 
 class QReagentScanDialog;
 class QSelectConditionDialog;
@@ -755,6 +757,26 @@ protected Q_SLOTS:
     ///
     void UpdateImDltChanged(const im::tf::DiluentInfoTable& stuDltInfo, im::tf::ChangeType::type changeType);
 
+    ///
+    /// @brief 重新查询并显示与试剂同设备同项目的全部试剂（无项目时按试剂ID查询）
+    ///
+    /// @param[in]  stuRgntInfo  试剂信息
+    ///
+    /// @return 查询成功返回true
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool ReloadImReagentGroup(const im::tf::ReagentInfoTable& stuRgntInfo);
+
+    ///
+    /// @brief 页面显示时一次回放隐藏期间合并的耗材/试剂更新
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void ReplayPendingUpdates();
+
     ///
     /// @brief
     ///     清空试剂信息
@@ -1210,4 +1232,13 @@ private:
     std::map<QString, ReagRowInfor> m_rowInforMap;///< Model+Pos+Name, Dev> 
 
     DisplaySet                      m_stuDisplayCfg;            // 显示设置
+
+    // 页面隐藏期间的更新（同一位置/试剂只保留最后一次）
+    using ChSupplyKey = std::tuple<std::string, int, int>;      // 设备序列号、区域、位置
+    using ImRgntChange = std::pair<im::tf::ReagentInfoTable, im::tf::ChangeType::type>;
+    using ImDltChange = std::pair<im::tf::DiluentInfoTable, im::tf::ChangeType::type>;
+    PageUpdatePolicy                                m_updatePolicy;         // 页面可见性更新策略
+    PendingChangeSet<ChSupplyKey, ch::tf::SupplyUpdate> m_pendingChSupply;  // 生化耗材更新
+    PendingChangeSet<int64_t, ImRgntChange>         m_pendingImRgnt;        // 免疫试剂更新
+    PendingChangeSet<int64_t, ImDltChange>          m_pendingImDlt;         // 免疫稀释液更新
 };
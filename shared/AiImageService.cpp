@@ -0,0 +1,368 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     AiImageService.cpp
+/// @brief    AI识别图片的异步解码和缩略图缓存
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#include "AiImageService.h"
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QImageReader>
+#include <QtConcurrent/QtConcurrent>
+#include "thrift/DcsControlProxy.h"
+#include "src/common/Mlog/mlog.h"
+
+// 解码线程数
+#define AI_IMAGE_DECODE_THREADS         (2)
+// 内存缓存上限（KB）
+#define AI_IMAGE_MEMORY_LIMIT_KB        (64 * 1024)
+// 磁盘缓存上限（字节）
+#define AI_IMAGE_DISK_LIMIT_BYTES       (qint64(200) * 1024 * 1024)
+// 每写入多少个文件检查一次磁盘缓存
+#define AI_IMAGE_DISK_PRUNE_INTERVAL    (32)
+
+AiImageService::AiImageService()
+    : m_diskWrites(0)
+{
+    m_pool.setMaxThreadCount(AI_IMAGE_DECODE_THREADS);
+    m_memoryCache.setMaxCost(AI_IMAGE_MEMORY_LIMIT_KB);
+
+    m_diskDir = QCoreApplication::applicationDirPath() + "/cache/ai_thumbnail";
+    if (!QDir().mkpath(m_diskDir))
+    {
+        ULOG(LOG_WARN, "%s(can not create thumbnail dir %s)", __FUNCTION__, m_diskDir.toStdString());
+        m_diskDir.clear();
+    }
+}
+
+AiImageService::~AiImageService()
+{
+    m_pool.clear();
+    m_pool.waitForDone();
+}
+
+///
+/// @brief 获取单例
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+AiImageService& AiImageService::GetInstance()
+{
+    static AiImageService s_service;
+    return s_service;
+}
+
+///
+/// @brief 缓存键（路径+修改时间+尺寸，图片被覆盖后自动失效）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+QString AiImageService::CacheKey(const QString& path, const QSize& size)
+{
+    QFileInfo info(path);
+    if (path.isEmpty() || !info.exists())
+    {
+        return QString();
+    }
+
+    return QString("%1|%2|%3|%4x%5").arg(info.absoluteFilePath())
+        .arg(info.lastModified().toMSecsSinceEpoch())
+        .arg(info.size())
+        .arg(size.width()).arg(size.height());
+}
+
+///
+/// @brief 从内存缓存中获取缩略图（不解码，不阻塞）
+///
+/// @param[in]  path   图片路径
+/// @param[in]  size   显示尺寸
+/// @param[out] image  缩略图
+///
+/// @return true:命中缓存
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool AiImageService::TryGetImage(const QString& path, const QSize& size, QImage& image)
+{
+    QString key = CacheKey(path, size);
+    if (key.isEmpty())
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    QImage* pImage = m_memoryCache.object(key);
+    if (pImage == nullptr)
+    {
+        return false;
+    }
+
+    image = *pImage;
+    return true;
+}
+
+///
+/// @brief 异步获取缩略图，完成后发送imageReady
+///
+/// @param[in]  path   图片路径
+/// @param[in]  size   显示尺寸
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void AiImageService::RequestImage(const QString& path, const QSize& size)
+{
+    QString key = CacheKey(path, size);
+    if (key.isEmpty())
+    {
+        emit imageReady(path, size, QImage());
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        QImage* pImage = m_memoryCache.object(key);
+        if (pImage != nullptr)
+        {
+            QImage image = *pImage;
+            emit imageReady(path, size, image);
+            return;
+        }
+
+        // 同一张图已在解码（请求或预取），完成时都会发送imageReady
+        if (m_pending.contains(key))
+        {
+            return;
+        }
+        m_pending.insert(key);
+    }
+
+    QtConcurrent::run(&m_pool, [this, path, size, key]()
+    {
+        QImage image = LoadImage(path, size, key);
+        InsertMemoryCache(key, image);
+        emit imageReady(path, size, image);
+    });
+}
+
+///
+/// @brief 预取AI识别结果的图片（在工作线程中查询图片路径并解码到缓存，完成后同样发送imageReady）
+///
+/// @param[in]  aiRecognizeIds  AI识别结果ID
+/// @param[in]  size            显示尺寸
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void AiImageService::PrefetchRecognizeResults(const std::vector<qint64>& aiRecognizeIds, const QSize& size)
+{
+    for (qint64 id : aiRecognizeIds)
+    {
+        if (id <= 0)
+        {
+            continue;
+        }
+
+        QtConcurrent::run(&m_pool, [this, id, size]()
+        {
+            QString path;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                path = m_recognizePaths.value(id);
+            }
+
+            // 查询图片路径
+            if (path.isEmpty())
+            {
+                ::tf::AiRecognizeResultQueryCond qryCond;
+                qryCond.__set_id(id);
+                ::tf::AiRecognizeResultQueryResp qryResp;
+                if (!DcsControlProxy::GetInstance()->QueryAiRecognizeResult(qryResp, qryCond)
+                    || qryResp.result != ::tf::ThriftResult::THRIFT_RESULT_SUCCESS
+                    || qryResp.lstAiRecognizeResult.empty()
+                    || !qryResp.lstAiRecognizeResult[0].__isset.picPath)
+                {
+                    return;
+                }
+
+                path = QString::fromStdString(qryResp.lstAiRecognizeResult[0].picPath);
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_recognizePaths.insert(id, path);
+            }
+
+            QString key = CacheKey(path, size);
+            if (key.isEmpty())
+            {
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_memoryCache.contains(key) || m_pending.contains(key))
+                {
+                    return;
+                }
+                m_pending.insert(key);
+            }
+
+            // 预取期间界面可能已请求同一张图（RequestImage等待的正是这个信号）
+            QImage image = LoadImage(path, size, key);
+            InsertMemoryCache(key, image);
+            emit imageReady(path, size, image);
+        });
+    }
+}
+
+///
+/// @brief 工作线程中加载缩略图：先查磁盘缓存，再按目标尺寸解码并写入磁盘缓存
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+QImage AiImageService::LoadImage(const QString& path, const QSize& size, const QString& key)
+{
+    QString diskFile;
+    if (!m_diskDir.isEmpty())
+    {
+        diskFile = m_diskDir + "/" + QString::fromLatin1(QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Sha1).toHex()) + ".png";
+        QImage image;
+        if (QFile::exists(diskFile) && image.load(diskFile))
+        {
+            // 刷新访问时间，清理时按最久未用淘汰
+            QFile touched(diskFile);
+            if (touched.open(QIODevice::ReadWrite))
+            {
+                touched.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+            }
+            return image;
+        }
+    }
+
+    // 按目标尺寸直接解码，不生成原图
+    QImageReader reader(path);
+    reader.setAutoTransform(true);
+    QSize srcSize = reader.size();
+    if (srcSize.isValid() && size.isValid())
+    {
+        reader.setScaledSize(srcSize.scaled(size, Qt::KeepAspectRatio));
+    }
+
+    QImage image = reader.read();
+    if (image.isNull())
+    {
+        ULOG(LOG_WARN, "%s(decode %s failed: %s)", __FUNCTION__, path.toStdString(), reader.errorString().toStdString());
+        return image;
+    }
+
+    // 读取器不支持缩放解码时再缩放一次
+    if (size.isValid() && (image.width() > size.width() || image.height() > size.height()))
+    {
+        image = image.scaled(size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    }
+
+    if (!diskFile.isEmpty() && image.save(diskFile, "PNG"))
+    {
+        bool prune = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            prune = (++m_diskWrites >= AI_IMAGE_DISK_PRUNE_INTERVAL);
+            if (prune)
+            {
+                m_diskWrites = 0;
+            }
+        }
+
+        if (prune)
+        {
+            PruneDiskCache();
+        }
+    }
+
+    return image;
+}
+
+///
+/// @brief 放入内存缓存
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void AiImageService::InsertMemoryCache(const QString& key, const QImage& image)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending.remove(key);
+    if (image.isNull())
+    {
+        return;
+    }
+
+    int costKb = qMax(1, image.byteCount() / 1024);
+    m_memoryCache.insert(key, new QImage(image), costKb);
+}
+
+///
+/// @brief 磁盘缓存超出上限时删除最久未用的文件
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void AiImageService::PruneDiskCache()
+{
+    QDir dir(m_diskDir);
+    // 按修改时间从新到旧
+    QFileInfoList files = dir.entryInfoList(QStringList() << "*.png", QDir::Files, QDir::Time);
+    qint64 total = 0;
+    for (const QFileInfo& info : files)
+    {
+        total += info.size();
+        if (total > AI_IMAGE_DISK_LIMIT_BYTES)
+        {
+            QFile::remove(info.absoluteFilePath());
+        }
+    }
+}
@@ -0,0 +1,154 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     AiImageService.h
+/// @brief    AI识别图片的异步解码和缩略图缓存
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <mutex>
+#include <vector>
+#include <QObject>
+#include <QCache>
+#include <QHash>
+#include <QSet>
+#include <QImage>
+#include <QThreadPool>
+
+///
+/// @brief AI识别图片服务
+///     在工作线程池中按目标尺寸直接解码（QImageReader::setScaledSize），
+///     缩略图按“路径+修改时间+尺寸”缓存在内存和磁盘中，两级缓存都有容量上限
+///
+class AiImageService : public QObject
+{
+    Q_OBJECT
+
+public:
+    ///
+    /// @brief 获取单例
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static AiImageService& GetInstance();
+    ~AiImageService();
+
+    ///
+    /// @brief 从内存缓存中获取缩略图（不解码，不阻塞）
+    ///
+    /// @param[in]  path   图片路径
+    /// @param[in]  size   显示尺寸
+    /// @param[out] image  缩略图
+    ///
+    /// @return true:命中缓存
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool TryGetImage(const QString& path, const QSize& size, QImage& image);
+
+    ///
+    /// @brief 异步获取缩略图，完成后发送imageReady
+    ///
+    /// @param[in]  path   图片路径
+    /// @param[in]  size   显示尺寸
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void RequestImage(const QString& path, const QSize& size);
+
+    ///
+    /// @brief 预取AI识别结果的图片（在工作线程中查询图片路径并解码到缓存，完成后同样发送imageReady）
+    ///
+    /// @param[in]  aiRecognizeIds  AI识别结果ID
+    /// @param[in]  size            显示尺寸
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void PrefetchRecognizeResults(const std::vector<qint64>& aiRecognizeIds, const QSize& size);
+
+signals:
+    ///
+    /// @brief 缩略图已就绪（请求和预取完成时都会发送，解码失败时图片为空）
+    ///
+    /// @param[in]  path   图片路径
+    /// @param[in]  size   显示尺寸
+    /// @param[in]  image  缩略图
+    ///
+    void imageReady(const QString& path, const QSize& size, const QImage& image);
+
+private:
+    AiImageService();
+
+    ///
+    /// @brief 缓存键（路径+修改时间+尺寸，图片被覆盖后自动失效）
+    ///
+    /// @return 文件不存在时返回空
+    ///
+    static QString CacheKey(const QString& path, const QSize& size);
+
+    ///
+    /// @brief 工作线程中加载缩略图：先查磁盘缓存，再按目标尺寸解码并写入磁盘缓存
+    ///
+    QImage LoadImage(const QString& path, const QSize& size, const QString& key);
+
+    ///
+    /// @brief 放入内存缓存
+    ///
+    void InsertMemoryCache(const QString& key, const QImage& image);
+
+    ///
+    /// @brief 磁盘缓存超出上限时删除最久未用的文件
+    ///
+    void PruneDiskCache();
+
+private:
+    QThreadPool                     m_pool;                 ///< 解码线程池
+    std::mutex                      m_mutex;                ///< 保护以下缓存
+    QCache<QString, QImage>         m_memoryCache;          ///< 内存缓存（代价单位KB）
+    QSet<QString>                   m_pending;              ///< 正在解码的缓存键
+    QHash<qint64, QString>          m_recognizePaths;       ///< AI识别结果ID到图片路径
+    QString                         m_diskDir;              ///< 磁盘缓存目录
+    int                             m_diskWrites;           ///< 上次清理后写入磁盘的次数
+};
@@ -1394,6 +1394,10 @@ CommonInformationManager::CommonInformationManager()
     // 默认单项目显示五行
     m_singleAssayRowAmount = UI_DEFAULT_ASSAYSELECTTB_SINGLEROW;
 
+    // 快照始终不为空，读者无需判空
+    m_spAssaySnapshot = std::make_shared<const AssayInfoSnapshot>();
+    m_spDeviceSnapshot = std::make_shared<const DeviceInfoSnapshot>();
+
     // 注册项目参数更新事件处理函数
     REGISTER_HANDLER(MSG_ID_PROFILE_PARAM_UPDATE, this, UpdateProfileInfo);
     REGISTER_HANDLER(MSG_ID_DCS_REPORT_STATUS_CHANGED, this, UpdateDeviceStatus);
@@ -1717,6 +1721,7 @@ void CommonInformationManager::ReloadGeneralAssayInfo(int assayCode /*= -1*/)
     if (qryResp.lstAssayInfos.empty())
     {
         ULOG(LOG_ERROR, "Empty qryResp.lstAssayInfos.");
+        PublishAssaySnapshot();
         return;
     }
 
@@ -1755,6 +1760,8 @@ void CommonInformationManager::ReloadGeneralAssayInfo(int assayCode /*= -1*/)
         // 初始化项目状态
         QSystemMonitor::GetInstance().InitStatusMap(spAssayInfo);
     }
+
+    PublishAssaySnapshot();
 }
 
 void CommonInformationManager::ReloadAssayInfoCh(int assayCode /*= -1*/)
@@ -1959,6 +1966,7 @@ void CommonInformationManager::ReloadGeneralProfile()
         || (qryResp.result != ::tf::ThriftResult::THRIFT_RESULT_SUCCESS))
     {
         ULOG(LOG_ERROR, "QueryProfileInfo() failed");
+        PublishAssaySnapshot();
         return;
     }
 
@@ -1967,6 +1975,8 @@ void CommonInformationManager::ReloadGeneralProfile()
     {
         m_mapProfileAssay.emplace((int32_t)profile.id, std::make_shared<tf::ProfileInfo>(profile));
     }
+
+    PublishAssaySnapshot();
 }
 
 void CommonInformationManager::ReloadSupplyAttributeCh()
@@ -2116,6 +2126,8 @@ void CommonInformationManager::UpdateDeviceBuff(const std::vector<tf::DeviceInfo
         it++;
 
     } while (true);
+
+    PublishDeviceSnapshot();
 }
 
 void CommonInformationManager::InitChDeviceInfo()
@@ -2125,6 +2137,7 @@ void CommonInformationManager::InitChDeviceInfo()
 	m_reagentLoaderMap.clear();
 	m_chCabinetSuppliesInfoMap.clear();
 	m_chReagentDiskInfoMap.clear();
+	m_reagentState.Clear();
 	m_chWasteCntMap.clear();
 
 	for (const auto& device : m_mapDevices)
@@ -2172,6 +2185,7 @@ void CommonInformationManager::InitChDeviceInfo()
 						return group.posInfo.pos == si.pos && group.posInfo.area == ch::tf::SuppliesArea::SUPPLIES_AREA_REAGENT_DISK1
 							&& group.suppliesCode == si.suppliesCode; });
 
+					m_reagentState.UpdatePosition(device.first, si.pos, vecReagentGroups, si);
 					m_chReagentDiskInfoMap[device.first].insert({ si.pos, std::move(ChReagentInfo(vecReagentGroups, si)) });
 				}
 				// 仓外
@@ -2349,6 +2363,7 @@ bool CommonInformationManager::UpdateDevicePoweronSchedul(const std::map<std::st
     }
 
     // 更新CommonAssay设备列表信息缓存中的计划
+    std::unique_lock<std::mutex> buffLock(m_devMapMtx);
     for (const auto& it : mapDevice2Pos)
     {
 
@@ -2358,6 +2373,8 @@ bool CommonInformationManager::UpdateDevicePoweronSchedul(const std::map<std::st
             devIt->second->__set_powerOnSchedule(it.second);
         }
     }
+
+    PublishDeviceSnapshot();
     return true;
 }
 
@@ -2584,38 +2601,8 @@ std::map<std::pair<int, int>, ise::tf::SuppliesInfo> CommonInformationManager::G
 
 bool CommonInformationManager::CheckReagentRemainCount(const std::map<int, int>& assayAndTimes)
 {
-    // 遍历各设备上的试剂组信息，统计所有设备上的试剂可以测试数
-    std::map<int, int> reagentAndRemainCount;
-    for (const auto& iter: m_chReagentDiskInfoMap)
-    {
-        for (const auto& chriIter : iter.second)
-        {
-            for (const auto& rg : chriIter.second.reagentInfos)
-            {
-                if (reagentAndRemainCount.find(rg.assayCode) == reagentAndRemainCount.end())
-                {
-                    reagentAndRemainCount[rg.assayCode] = rg.remainCount > 0 ? rg.remainCount : 0;
-                }
-                else
-                {
-                    reagentAndRemainCount[rg.assayCode] += rg.remainCount > 0 ? rg.remainCount : 0;
-                }
-            }
-        }
-    }
-
-    // 遍历项目，检查当前试剂的可用测试数是否满足项目的测试数
-    for (const auto& iter : assayAndTimes)
-    {
-        const auto& reagentIter = reagentAndRemainCount.find(iter.first);
-        if (reagentIter == reagentAndRemainCount.end()
-            || reagentIter->second < iter.second)
-        {
-            return false;
-        }
-    }
-
-    return true;
+    // 各设备的试剂剩余测试数已随试剂&耗材更新增量汇总，只需逐项目比较
+    return m_reagentState.CheckRemainCount(assayAndTimes);
 }
 
 bool CommonInformationManager::updateReferenceRanges(int code, int sampleSourceType
@@ -2711,10 +2698,11 @@ std::vector<std::shared_ptr<const tf::DeviceInfo>> CommonInformationManager::Get
 {
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
-    std::unique_lock<std::mutex> buffLock(m_devMapMtx);
+    // 与GetDeviceInfo/GetDeviceMaps同源，返回快照中的只读拷贝
+    auto spSnapshot = GetDeviceSnapshot();
 
     std::vector<std::shared_ptr<const tf::DeviceInfo>> devicelist;
-    for (const auto& device : m_mapDevices)
+    for (const auto& device : spSnapshot->devices)
     {
         if (Contains(deviceTypes, device.second->deviceType))
         {
@@ -2934,6 +2922,7 @@ void CommonInformationManager::UpdateDeviceStatus(tf::DeviceInfo deviceInfo)
 				{
 					iter->second->otherInfo = deviceInfo.otherInfo;
 				}
+				PublishDeviceSnapshot(deviceInfo.deviceSN);
 
 				// 发送设备状态信息到UI消息总线
 				POST_MESSAGE(MSG_ID_DEVS_STATUS_CHANGED, *(iter->second));
@@ -2958,6 +2947,7 @@ void CommonInformationManager::UpdateDeviceStatus(tf::DeviceInfo deviceInfo)
 				{
 					iter->second->iomStatus = deviceInfo.iomStatus;
 				}
+				PublishDeviceSnapshot(deviceInfo.deviceSN);
 
 				// 发送设备状态信息到UI消息总线
 				POST_MESSAGE(MSG_ID_DEVS_STATUS_CHANGED, *(iter->second));
@@ -2978,6 +2968,7 @@ void CommonInformationManager::UpdateDeviceCanAppendTest(QString devSN, std::set
     if (iter != m_mapDevices.end())
     {
         iter->second->faats = faats;
+        PublishDeviceSnapshot(strDevSn);
     }
 
     POST_MESSAGE(MSG_ID_UPDATE_ASSAY_TEST_BTN);
@@ -3010,6 +3001,7 @@ bool CommonInformationManager::UpdateCalcAssayInfo(int calcAssayCode /*= -1*/)
         m_calcAssayInfoMaps.erase(calcAssayCode);
 		// 删除之前的项目位置信息
 		m_mapAssayCodeMaps.erase(calcAssayCode);
+        PublishAssaySnapshot();
         return true;
     }
 
@@ -3044,6 +3036,7 @@ bool CommonInformationManager::UpdateCalcAssayInfo(int calcAssayCode /*= -1*/)
 		m_defaultPostionMap[calcAssayInfo.assayCode] = findCalcShowPostion(calcAssayInfo);
     }
 
+    PublishAssaySnapshot();
     POST_MESSAGE(MSG_ID_ASSAY_CODE_MANAGER_UPDATE);
     return true;
 }
@@ -3182,6 +3175,7 @@ void CommonInformationManager::OnUpdateChReagentSupply(std::vector<ch::tf::Suppl
 				{
 					iter->second.erase(pos);
 				}
+				m_reagentState.RemovePosition(devSn, pos);
 			}
 			else
 			{
@@ -3217,6 +3211,7 @@ void CommonInformationManager::OnUpdateChReagentSupply(std::vector<ch::tf::Suppl
 					}
 				}
 
+				m_reagentState.UpdatePosition(devSn, pos, vecReagentGroups, si);
 				iter->second[pos] = std::move(ChReagentInfo(vecReagentGroups, si));
 			}
 		}
@@ -3690,18 +3685,10 @@ QString CommonInformationManager::GetTipsContent(const bool isAiEnable)
 ///
 QString CommonInformationManager::GetAssayNameByCodeEx(int iAssayCode)
 {
-    // 判断是否计算项目
-    if (iAssayCode >= tf::AssayCodeRange::CALC_RANGE_MIN && \
-        iAssayCode <= tf::AssayCodeRange::CALC_RANGE_MAX)
-    {
-        std::shared_ptr<::tf::CalcAssayInfo> calcItem = GetCalcAssayInfo(iAssayCode);
-        std::string strCalc = (calcItem == nullptr) ? "" : calcItem->name;
-        return QString::fromStdString(strCalc);
-    }
-    else
-    {
-        return QString::fromStdString(GetAssayNameByCode(iAssayCode));
-    }
+    // 计算项目和普通项目均在显示记录表中
+    auto spSnapshot = GetAssaySnapshot();
+    const AssayDisplayRecord* pRecord = spSnapshot->GetRecord(iAssayCode);
+    return (pRecord == nullptr) ? QString() : pRecord->name;
 }
 
 QString CommonInformationManager::GetResultStatusLHIbyCode(int assayCode, int statusCode)
@@ -4235,15 +4222,159 @@ std::shared_ptr<ise::tf::SpecialAssayInfo> CommonInformationManager::GetIseSpeci
 /// @par History:
 /// @li 7951/LuoXin，2023年1月11日，新建函数
 ///
-std::map<std::string, std::shared_ptr<const tf::DeviceInfo>> CommonInformationManager::GetDeviceMaps()
+ConstDeviceMaps CommonInformationManager::GetDeviceMaps()
 {
-    std::map<std::string, std::shared_ptr<const tf::DeviceInfo>> tmpMaps;
-	for (auto device : m_mapDevices)
-	{
-		tmpMaps[device.first] = std::make_shared<const tf::DeviceInfo>(*(device.second));
-	}
+    // 快照中的设备信息已是深拷贝且不再修改，只需拷贝指针
+    return GetDeviceSnapshot()->devices;
+}
+
+///
+/// @brief
+///     用当前的项目/组合项目缓存重建快照并发布
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void CommonInformationManager::PublishAssaySnapshot()
+{
+    auto spSnapshot = std::make_shared<AssayInfoSnapshot>();
+
+    // 缓存中的项目信息会被原地修改，快照持有深拷贝；编号表和名称表指向同一份拷贝
+    std::unordered_map<const tf::GeneralAssayInfo*, std::shared_ptr<const tf::GeneralAssayInfo>> copies;
+    copies.reserve(m_mapAssayCodeMaps.size());
+    auto funcCopy = [&copies](const std::shared_ptr<tf::GeneralAssayInfo>& spAssay)
+    {
+        auto it = copies.find(spAssay.get());
+        if (it == copies.end())
+        {
+            it = copies.emplace(spAssay.get(), std::make_shared<const tf::GeneralAssayInfo>(*spAssay)).first;
+        }
+        return it->second;
+    };
+
+    spSnapshot->codeIndex.reserve(m_mapAssayCodeMaps.size());
+    for (const auto& item : m_mapAssayCodeMaps)
+    {
+        if (item.second == nullptr)
+        {
+            continue;
+        }
+
+        auto spCopy = funcCopy(item.second);
+        spSnapshot->codeMap.emplace_hint(spSnapshot->codeMap.end(), item.first, spCopy);
+        spSnapshot->codeIndex.emplace(item.first, spCopy);
+    }
+
+    spSnapshot->nameIndex.reserve(m_mapAssayNameMaps.size());
+    for (const auto& item : m_mapAssayNameMaps)
+    {
+        if (item.second != nullptr)
+        {
+            spSnapshot->nameIndex.emplace(item.first, funcCopy(item.second));
+        }
+    }
 
-	return tmpMaps;
+    for (const auto& item : m_mapProfileAssay)
+    {
+        if (item.second != nullptr)
+        {
+            spSnapshot->profileMap.emplace_hint(spSnapshot->profileMap.end(), item.first, std::make_shared<const tf::ProfileInfo>(*item.second));
+        }
+    }
+
+    // 计算项目编号段远大于普通项目，显示记录表按编号散列，不按最大编号分配
+    spSnapshot->records.reserve(m_mapAssayCodeMaps.size() + m_calcAssayInfoMaps.size());
+
+    const QStringList noUnitAssays({ "H", "L", "I" });
+    for (const auto& item : m_mapAssayCodeMaps)
+    {
+        if (item.second == nullptr)
+        {
+            continue;
+        }
+
+        AssayDisplayRecord& record = spSnapshot->records[item.first];
+        record.classify = item.second->assayClassify;
+        record.precision = item.second->decimalPlace;
+        record.name = QString::fromStdString(item.second->assayName);
+        record.showUnit = !noUnitAssays.contains(record.name);
+
+        // 当前单位及其相对主单位的倍率（与GetUnitChangeRate一致）
+        double mainRat = -1;
+        double curRat = -1;
+        bool curIsMain = false;
+        for (const tf::AssayUnit& unit : item.second->units)
+        {
+            if (unit.isCurrent && curRat < 0)
+            {
+                record.factor = unit.factor;
+                record.unit = QString::fromStdString(unit.name);
+                curIsMain = unit.isMain;
+                curRat = unit.factor;
+            }
+            if (unit.isMain)
+            {
+                mainRat = unit.factor;
+            }
+        }
+        if (!curIsMain && mainRat > 0 && curRat > 0)
+        {
+            record.unitChangeRate = curRat / mainRat;
+        }
+    }
+
+    for (const auto& item : m_calcAssayInfoMaps)
+    {
+        if (item.second == nullptr)
+        {
+            continue;
+        }
+
+        AssayDisplayRecord& record = spSnapshot->records[item.first];
+        record.isCalc = true;
+        record.precision = item.second->decimalDigit;
+        record.name = QString::fromStdString(item.second->name);
+        record.unit = QString::fromStdString(item.second->resultUnit);
+        record.showUnit = !noUnitAssays.contains(record.name);
+    }
+
+    // 原子替换，正在使用旧快照的读者不受影响
+    std::atomic_store(&m_spAssaySnapshot, std::shared_ptr<const AssayInfoSnapshot>(spSnapshot));
+}
+
+///
+/// @brief
+///     重建设备信息快照并发布（调用者须持有m_devMapMtx）
+///
+/// @param[in]  deviceSn  发生变化的设备sn，为空表示全部重建
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void CommonInformationManager::PublishDeviceSnapshot(const std::string& deviceSn)
+{
+    auto spOld = GetDeviceSnapshot();
+    auto spSnapshot = std::make_shared<DeviceInfoSnapshot>();
+
+    // 单个设备变化时复用其他设备的只读信息，只深拷贝变化的设备
+    auto itDev = deviceSn.empty() ? m_mapDevices.end() : m_mapDevices.find(deviceSn);
+    if (itDev != m_mapDevices.end() && spOld->devices.size() == m_mapDevices.size())
+    {
+        spSnapshot->devices = spOld->devices;
+        spSnapshot->devices[deviceSn] = std::make_shared<const tf::DeviceInfo>(*(itDev->second));
+    }
+    else
+    {
+        for (const auto& device : m_mapDevices)
+        {
+            if (device.second != nullptr)
+            {
+                spSnapshot->devices[device.first] = std::make_shared<const tf::DeviceInfo>(*(device.second));
+            }
+        }
+    }
+
+    std::atomic_store(&m_spDeviceSnapshot, std::shared_ptr<const DeviceInfoSnapshot>(spSnapshot));
 }
 
 bool CommonInformationManager::ModifyDeviceInfo(const tf::DeviceInfo& dev)
@@ -4306,6 +4437,7 @@ bool CommonInformationManager::ModifyDeviceInfo(const tf::DeviceInfo& dev)
 				POST_MESSAGE(MSG_ID_DEVICE_OTHER_INFO_UPDATE, QString::fromStdString(iter->first));
             }
 
+            PublishDeviceSnapshot(dev.deviceSN);
             return true;
         }
     }
@@ -4640,6 +4772,7 @@ bool CommonInformationManager::SetAssayInfo(std::shared_ptr<tf::GeneralAssayInfo
     // 更新项目名映射
     m_mapAssayNameMaps[spAI->assayName] = spAI;
 
+    PublishAssaySnapshot();
     return true;
 }
 
@@ -4871,6 +5004,8 @@ void CommonInformationManager::UpdateGnrAssayInfo(std::shared_ptr<::tf::GeneralA
         // 自增
         it++;
     }
+
+    PublishAssaySnapshot();
 }
 
 void CommonInformationManager::GetSamePositiongAssayInfo(int pageIdx, int positionIdx, std::vector<std::shared_ptr<tf::GeneralAssayInfo>>& outAssays)
@@ -5107,6 +5242,7 @@ bool CommonInformationManager::DeleteProfileInfo(const std::string& profileName)
         }
     }
 
+    PublishAssaySnapshot();
     return true;
 }
 
@@ -5126,6 +5262,7 @@ bool CommonInformationManager::AddProfileInfo(const tf::ProfileInfo& profileInfo
     nProf->__set_id(ret.value);
     m_mapProfileAssay.insert(std::pair<int64_t, std::shared_ptr<tf::ProfileInfo>>(ret.value, nProf));
 
+    PublishAssaySnapshot();
     return true;
 }
 
@@ -5143,6 +5280,7 @@ bool CommonInformationManager::ModifyProfileInfo(const tf::ProfileInfo& profileI
         it->second = std::make_shared<tf::ProfileInfo>(profileInfo);
     }
 
+    PublishAssaySnapshot();
     return true;
 }
 
@@ -5588,34 +5726,10 @@ void CommonInformationManager::GetAssayProfiles(::tf::AssayClassify::type typeIn
 ///
 QString CommonInformationManager::GetCurrentUnit(int assayCode)
 {
-	// 非计算项目
-	if (!IsCalcAssay(assayCode))
-	{
-		std::shared_ptr<tf::GeneralAssayInfo> spAssayInfo = GetAssayInfo(assayCode);
-		if (nullptr == spAssayInfo)
-		{
-			return "";
-		}
-
-		for (const tf::AssayUnit& unit : spAssayInfo->units)
-		{
-			if (unit.isCurrent)
-			{
-				return QString::fromStdString(unit.name);
-			}
-		}
-	}
-	// 计算项目
-	else
-	{
-		std::shared_ptr<tf::CalcAssayInfo> spCalcAssayInfo = GetCalcAssayInfo(assayCode);
-		if (spCalcAssayInfo)
-		{
-			return QString::fromStdString(spCalcAssayInfo->resultUnit);
-		}
-	}
-
-	return "";
+	// 计算项目为结果单位，非计算项目为当前单位
+	auto spSnapshot = GetAssaySnapshot();
+	const AssayDisplayRecord* pRecord = spSnapshot->GetRecord(assayCode);
+	return (pRecord == nullptr) ? QString() : pRecord->unit;
 }
 
 ///
@@ -5647,35 +5761,10 @@ QString CommonInformationManager::GetAssayMainUnit(const int& assayCode)
 
 double CommonInformationManager::GetUnitChangeRate(int assayCode)
 {
-    std::shared_ptr<tf::GeneralAssayInfo> spAssayInfo = GetAssayInfo(assayCode);
-    if (nullptr == spAssayInfo)
-    {
-        return 1;
-    }
-    double mainRat = -1;
-    double curRat = -1;
-    for (const ::tf::AssayUnit& ut : spAssayInfo->units)
-    {
-        if (ut.isCurrent && ut.isMain)
-        {
-            return 1;
-        }
-
-        if (ut.isMain)
-        {
-            mainRat = ut.factor;
-        }
-        else if (ut.isCurrent)
-        {
-            curRat = ut.factor;
-        }
-    }
-    if (mainRat > 0 && curRat > 0)
-    {
-        return (curRat / mainRat);
-    }
-
-    return 1;
+    // 倍率在显示记录表构造时计算
+    auto spSnapshot = GetAssaySnapshot();
+    const AssayDisplayRecord* pRecord = spSnapshot->GetRecord(assayCode);
+    return (pRecord == nullptr || pRecord->isCalc) ? 1 : pRecord->unitChangeRate;
 }
 
 tf::RackType::type CommonInformationManager::GetRackTypeFromRack(int rack)
@@ -50,6 +50,7 @@
 #include <set>
 #include <vector>
 #include <memory>
+#include <unordered_map>
 #include <boost/optional.hpp>
 #include <QObject>
 #include <QMap>
@@ -57,6 +58,7 @@
 #include <QVariant>
 
 #include "shared/uidef.h"
+#include "shared/ReagentStateEngine.h"
 #include "src/public/ConfigDefine.h"
 #include "src/thrift/ch/gen-cpp/ch_constants.h"
 #include "src/thrift/ise/gen-cpp/ise_constants.h"
@@ -74,6 +76,64 @@ typedef std::map<int64_t, std::shared_ptr<tf::ProfileInfo>> AssayProfileMap;
 typedef std::map<int, std::shared_ptr<::tf::CalcAssayInfo>> CalcAssayInfoMap;
 // 设备
 typedef std::map<std::string, std::shared_ptr<tf::DeviceInfo>> DeviceMaps;
+// 设备（只读）
+typedef std::map<std::string, std::shared_ptr<const tf::DeviceInfo>> ConstDeviceMaps;
+// 按编号排序项目（只读）
+typedef std::map<int, std::shared_ptr<const tf::GeneralAssayInfo>> ConstAssayIndexCodeMaps;
+// 组合项目信息地图（只读）
+typedef std::map<int64_t, std::shared_ptr<const tf::ProfileInfo>> ConstAssayProfileMap;
+
+///
+/// @brief
+///     项目显示记录（结果格式化所需的项目属性，按项目编号索引）
+///
+struct AssayDisplayRecord
+{
+    bool                            isCalc = false;             ///< 是否计算项目
+    bool                            showUnit = true;            ///< 是否显示单位（H、L、I等指数项目不显示）
+    int                             precision = UI_RESULT_PRECISION;    ///< 小数位数
+    double                          factor = 1.0;               ///< 当前单位倍率
+    double                          unitChangeRate = 1.0;       ///< 当前单位相对主单位的倍率
+    tf::AssayClassify::type         classify = tf::AssayClassify::ASSAY_CLASSIFY_OTHER; ///< 项目类型
+    QString                         name;                       ///< 项目名称
+    QString                         unit;                       ///< 当前单位名称
+};
+
+///
+/// @brief
+///     通用项目/组合项目的只读快照（项目信息为深拷贝，不受缓存原地修改影响）
+///     缓存更新后整体重建并原子替换，发布后不再修改；读者持有智能指针即可无锁访问
+///
+struct AssayInfoSnapshot
+{
+    ConstAssayIndexCodeMaps         codeMap;                    ///< 项目编号映射（有序，用于遍历）
+    ConstAssayProfileMap            profileMap;                 ///< 组合项目映射
+    std::unordered_map<int, std::shared_ptr<const tf::GeneralAssayInfo>> codeIndex;         ///< 项目编号索引
+    std::unordered_map<std::string, std::shared_ptr<const tf::GeneralAssayInfo>> nameIndex; ///< 项目名称索引
+    std::unordered_map<int, AssayDisplayRecord> records;        ///< 项目显示记录（项目编号--记录，含计算项目）
+
+    ///
+    /// @brief 根据项目编号获取显示记录
+    ///
+    /// @param[in]  assayCode  项目编号
+    ///
+    /// @return 显示记录，不存在返回nullptr（生命周期与快照一致）
+    ///
+    inline const AssayDisplayRecord* GetRecord(int assayCode) const
+    {
+        auto it = records.find(assayCode);
+        return (it == records.end()) ? nullptr : &it->second;
+    }
+};
+
+///
+/// @brief
+///     设备信息的只读快照（设备信息为深拷贝，不受原地修改影响）
+///
+struct DeviceInfoSnapshot
+{
+    ConstDeviceMaps                 devices;                    ///< 设备sn--设备信息
+};
 
 // ------------------------------ 生化 -------------------
 // 按编号排序项目(所有机型)
@@ -488,6 +548,28 @@ public:
     ///
     inline AssayIndexCodeMaps GetAssayInfo() { return m_mapAssayCodeMaps; };
 
+    ///
+    /// @brief
+    ///     获取项目信息快照（无锁、无拷贝，遍历时应优先使用）
+    ///
+    /// @return 项目信息快照（不为空）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    inline std::shared_ptr<const AssayInfoSnapshot> GetAssaySnapshot() const { return std::atomic_load(&m_spAssaySnapshot); }
+
+    ///
+    /// @brief
+    ///     获取设备信息快照（无锁、无拷贝）
+    ///
+    /// @return 设备信息快照（不为空）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    inline std::shared_ptr<const DeviceInfoSnapshot> GetDeviceSnapshot() const { return std::atomic_load(&m_spDeviceSnapshot); }
+
     ///
     /// @brief
     ///     获取项目名称
@@ -501,8 +583,9 @@ public:
     ///
     inline std::string GetAssayNameByCode(int iAssayCode)
     {
-        auto it = m_mapAssayCodeMaps.find(iAssayCode);
-        return (it != m_mapAssayCodeMaps.end() ? it->second->assayName : "");
+        auto spSnapshot = GetAssaySnapshot();
+        auto it = spSnapshot->codeIndex.find(iAssayCode);
+        return (it != spSnapshot->codeIndex.end() ? it->second->assayName : "");
 	};
 
 	std::set<int> GetDifferentMap(const std::map<int, std::set<int>>& firstSet, const std::map<int, std::set<int>>& secondSet);
@@ -603,8 +686,9 @@ public:
     ///
     inline int GetPrecisionNum(const std::string& assayName)
     {
-        auto it = m_mapAssayNameMaps.find(assayName);
-        return (it == m_mapAssayNameMaps.end() ? UI_RESULT_PRECISION : (it->second->__isset.decimalPlace ? it->second->decimalPlace : UI_RESULT_PRECISION));
+        auto spSnapshot = GetAssaySnapshot();
+        auto it = spSnapshot->nameIndex.find(assayName);
+        return (it == spSnapshot->nameIndex.end() ? UI_RESULT_PRECISION : (it->second->__isset.decimalPlace ? it->second->decimalPlace : UI_RESULT_PRECISION));
     }
 
     ///
@@ -797,7 +881,7 @@ public:
     /// @par History:
     /// @li 7951/LuoXin，2023年1月11日，新建函数
     ///
-    std::map<std::string, std::shared_ptr<const tf::DeviceInfo>> GetDeviceMaps();
+    ConstDeviceMaps GetDeviceMaps();
     
     ///
     /// @brief  修改设备的信息
@@ -855,8 +939,9 @@ public:
     ///
     inline std::shared_ptr<const tf::DeviceInfo> GetDeviceInfo(const std::string& deviceSn)
     {
-        auto it = m_mapDevices.find(deviceSn);
-        return it != m_mapDevices.end() ? it->second : nullptr;
+        auto spSnapshot = GetDeviceSnapshot();
+        auto it = spSnapshot->devices.find(deviceSn);
+        return it != spSnapshot->devices.end() ? it->second : nullptr;
     }
 
 
@@ -2037,6 +2122,16 @@ public:
     ///
     bool CheckReagentRemainCount(const std::map<int, int>& assayAndTimes);
 
+    ///
+    /// @brief  获取生化试剂盘余量状态（随试剂&耗材更新增量维护）
+    ///
+    /// @return 余量状态引擎
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    inline const ReagentStateEngine& GetReagentState() const { return m_reagentState; }
+
 	///
 	/// @brief  获取指定设备序列号的废液量
 	///
@@ -2358,6 +2453,27 @@ private:
     ///
     void UpdateDeviceBuff(const std::vector<tf::DeviceInfo>& vecDev);
 
+    ///
+    /// @brief
+    ///     用当前的项目/组合项目缓存重建快照并发布
+    ///     （项目、计算项目或组合项目缓存修改后须调用）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void PublishAssaySnapshot();
+
+    ///
+    /// @brief
+    ///     重建设备信息快照并发布（调用者须持有m_devMapMtx）
+    ///
+    /// @param[in]  deviceSn  发生变化的设备sn，为空表示全部重建
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void PublishDeviceSnapshot(const std::string& deviceSn = "");
+
 	///
 	/// @brief  初始化生化设备信息(包括试剂、耗材信息，加载器信息等)
 	///
@@ -2388,6 +2504,8 @@ private:
     AssayProfileMap					m_mapProfileAssay;			///< 组合项目的映射表
     std::mutex						m_devMapMtx;				///< 设备信息表的互斥量
     DeviceMaps                      m_mapDevices;               ///< 设备信息映射表(设备sn--设备信息)
+    std::shared_ptr<const AssayInfoSnapshot> m_spAssaySnapshot; ///< 项目信息快照（原子读写）
+    std::shared_ptr<const DeviceInfoSnapshot> m_spDeviceSnapshot;///< 设备信息快照（原子读写）
     SupplyAttributeMap				m_supplyAttributeMap;		///< 耗材的属性地图
     ISESupplyAttributeMap			m_iseSupplyAttributeMap;	///< 耗材的属性地图(ise)
     ImSupplyAttributeMap			m_ImSupplyAttributeMap;	    ///< 耗材的属性地图(im)
@@ -2402,6 +2520,7 @@ private:
 	ChReagentLoaderMaps				m_reagentLoaderMap;			///< 在线试剂加载器信息
 
 	ChReagentDiskInfoMaps			m_chReagentDiskInfoMap;		///< 生化试剂盘信息 (设备序列号, (位置，试剂信息))
+	ReagentStateEngine				m_reagentState;				///< 生化试剂盘余量汇总（与m_chReagentDiskInfoMap同步更新）
 	ChCabinetSuppliesInfoMaps		m_chCabinetSuppliesInfoMap;	///< 生化仓外耗材信息 (设备序列号, (位置，耗材信息))
 	IseCabinetSuppliesInfoMaps		m_iseCabinetSuppliesInfoMap;///< ise仓外耗材信息 (设备序列号, (模块号，位置)，耗材信息))
 	std::map<std::string, int64_t>	m_chWasteCntMap;			///< 缓存生化废液桶量(设备序列号，缓存废液桶量)
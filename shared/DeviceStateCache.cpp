@@ -0,0 +1,214 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     DeviceStateCache.cpp
+/// @brief    设备状态缓存（按帧率合并后只投递变化的字段）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+
+#include "DeviceStateCache.h"
+#include "shared/messagebus.h"
+#include "shared/msgiddef.h"
+#include "src/common/common.h"
+#include "src/common/Mlog/mlog.h"
+#include "src/public/track/TrackConfigDefine.h"
+#include "src/public/track/TrackConfigSerialize.h"
+
+// 投递间隔（毫秒），即每秒最多刷新10次
+#define DEVICE_STATE_FRAME_MS               (100)
+
+DeviceStateCache::DeviceStateCache()
+    : m_received(0)
+    , m_emitted(0)
+{
+    m_frameTimer.setSingleShot(true);
+    m_frameTimer.setInterval(DEVICE_STATE_FRAME_MS);
+    connect(&m_frameTimer, &QTimer::timeout, this, &DeviceStateCache::OnFrame);
+
+    // 注册设备状态改变处理槽函数
+    REGISTER_HANDLER(MSG_ID_DEVS_STATUS_CHANGED, this, OnDevStateChange);
+}
+
+///
+/// @brief 获取单例（须在界面线程调用）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+DeviceStateCache& DeviceStateCache::GetInstance()
+{
+    static DeviceStateCache instance;
+    return instance;
+}
+
+///
+/// @brief 设备状态消息，更新最新状态
+///
+/// @param[in]  deviceInfo  设备信息
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void DeviceStateCache::OnDevStateChange(tf::DeviceInfo deviceInfo)
+{
+    ++m_received;
+
+    DeviceState& state = m_latest[deviceInfo.deviceSN];
+    state.groupName = deviceInfo.groupName;
+    state.name = deviceInfo.name;
+    state.deviceType = deviceInfo.deviceType;
+    if (deviceInfo.__isset.status)
+    {
+        state.status = deviceInfo.status;
+    }
+    if (deviceInfo.__isset.iomStatus)
+    {
+        state.iomStatus = deviceInfo.iomStatus;
+    }
+
+    // 轨道子模块状态在otherInfo内，内容变化时才重新解析
+    if (deviceInfo.deviceType == ::tf::DeviceType::DEVICE_TYPE_TRACK
+        && deviceInfo.__isset.otherInfo && deviceInfo.otherInfo != state.otherInfo)
+    {
+        std::map<int, TrackNodeState> nodes;
+        if (DecodeTrackNodes(deviceInfo.otherInfo, nodes))
+        {
+            state.otherInfo = deviceInfo.otherInfo;
+            state.nodes.swap(nodes);
+        }
+    }
+
+    m_dirty.insert(deviceInfo.deviceSN);
+    if (!m_frameTimer.isActive())
+    {
+        m_frameTimer.start();
+    }
+}
+
+///
+/// @brief 帧定时器，投递有变化的设备
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void DeviceStateCache::OnFrame()
+{
+    std::set<std::string> dirty;
+    dirty.swap(m_dirty);
+
+    for (const std::string& devSN : dirty)
+    {
+        const DeviceState& latest = m_latest[devSN];
+        auto itDelivered = m_delivered.find(devSN);
+        bool first = (itDelivered == m_delivered.end());
+
+        DeviceStateDiff diff;
+        diff.deviceSN = devSN;
+        diff.groupName = latest.groupName;
+        diff.name = latest.name;
+        diff.deviceType = latest.deviceType;
+        diff.status = latest.status;
+        diff.iomStatus = latest.iomStatus;
+
+        if (first || itDelivered->second.status != latest.status)
+        {
+            diff.fields |= DSF_STATUS;
+        }
+        if (first || itDelivered->second.iomStatus != latest.iomStatus)
+        {
+            diff.fields |= DSF_IOM_STATUS;
+        }
+        for (const auto& node : latest.nodes)
+        {
+            if (first || itDelivered->second.nodes.count(node.first) == 0
+                || !(itDelivered->second.nodes.at(node.first) == node.second))
+            {
+                diff.changedNodes.insert(node);
+            }
+        }
+        if (!diff.changedNodes.empty())
+        {
+            diff.fields |= DSF_TRACK_NODE;
+        }
+
+        m_delivered[devSN] = latest;
+        if (diff.fields == 0)
+        {
+            continue;
+        }
+
+        ++m_emitted;
+        emit signalDeviceStateChanged(diff);
+    }
+
+    ULOG(LOG_INFO, "%s(devices: %u, received: %lld, emitted: %lld)", __FUNCTION__,
+        unsigned(dirty.size()), (long long)m_received, (long long)m_emitted);
+}
+
+///
+/// @brief 解析轨道子模块状态
+///
+/// @param[in]  otherInfo  轨道附加信息
+/// @param[out] nodes      子模块状态
+///
+/// @return true表示解析成功
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool DeviceStateCache::DecodeTrackNodes(const std::string& otherInfo, std::map<int, TrackNodeState>& nodes)
+{
+    track::bcyime::TrackOtherInfo tdoi;
+    if (!DecodeJson(tdoi, otherInfo))
+    {
+        ULOG(LOG_ERROR, "Decode track other info failed!");
+        return false;
+    }
+
+    for (const auto& item : tdoi.node_infos)
+    {
+        TrackNodeState& node = nodes[item.first];
+        node.nodeId = item.second.nodeid;
+        node.status = item.second.status;
+    }
+
+    return true;
+}
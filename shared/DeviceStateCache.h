@@ -0,0 +1,172 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     DeviceStateCache.h
+/// @brief    设备状态缓存（按帧率合并后只投递变化的字段）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <QObject>
+#include <QTimer>
+#include "src/thrift/gen-cpp/defs_types.h"
+
+// 设备状态中变化的字段
+enum DeviceStateField
+{
+    DSF_STATUS          = 0x01,         ///< 设备状态
+    DSF_IOM_STATUS      = 0x02,         ///< 进样器状态
+    DSF_TRACK_NODE      = 0x04,         ///< 轨道子模块状态
+};
+
+// 轨道子模块状态
+struct TrackNodeState
+{
+    int                             nodeId = 0;         ///< 节点号
+    int                             status = 0;         ///< 状态
+
+    bool operator==(const TrackNodeState& other) const
+    {
+        return nodeId == other.nodeId && status == other.status;
+    }
+};
+
+// 一台设备在一帧内的状态变化
+struct DeviceStateDiff
+{
+    std::string                     deviceSN;           ///< 设备序列号
+    std::string                     groupName;          ///< 设备组名（2000速）
+    std::string                     name;               ///< 设备名称
+    int                             deviceType = 0;     ///< 设备类型
+    int                             fields = 0;         ///< 变化的字段（DeviceStateField按位或）
+    int                             status = 0;         ///< 最新设备状态
+    int                             iomStatus = 0;      ///< 最新进样器状态
+    std::map<int, TrackNodeState>   changedNodes;       ///< 变化的轨道子模块（otherInfo中的键值 -> 状态）
+};
+
+///
+/// @brief 设备状态缓存
+///
+/// 设备状态消息到达时只更新每台设备的最新状态，
+/// 按固定帧率（100ms）与上一帧投递的状态比较，只投递有变化的设备和字段；
+/// 一帧内的多次变化只投递最后的状态（概览界面只显示当前状态）
+///
+class DeviceStateCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    ///
+    /// @brief 获取单例（须在界面线程调用）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static DeviceStateCache& GetInstance();
+
+Q_SIGNALS:
+    ///
+    /// @brief 设备状态有变化
+    ///
+    /// @param[in]  diff  变化的字段和最新状态
+    ///
+    void signalDeviceStateChanged(const DeviceStateDiff& diff);
+
+protected Q_SLOTS:
+    ///
+    /// @brief 设备状态消息，更新最新状态
+    ///
+    /// @param[in]  deviceInfo  设备信息
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnDevStateChange(tf::DeviceInfo deviceInfo);
+
+    ///
+    /// @brief 帧定时器，投递有变化的设备
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnFrame();
+
+private:
+    DeviceStateCache();
+
+    // 一台设备的状态
+    struct DeviceState
+    {
+        std::string                     groupName;          ///< 设备组名
+        std::string                     name;               ///< 设备名称
+        int                             deviceType = 0;     ///< 设备类型
+        int                             status = 0;         ///< 设备状态
+        int                             iomStatus = 0;      ///< 进样器状态
+        std::string                     otherInfo;          ///< 轨道附加信息（未变化时不重复解析）
+        std::map<int, TrackNodeState>   nodes;              ///< 轨道子模块状态
+    };
+
+    ///
+    /// @brief 解析轨道子模块状态
+    ///
+    /// @param[in]  otherInfo  轨道附加信息
+    /// @param[out] nodes      子模块状态
+    ///
+    /// @return true表示解析成功
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static bool DecodeTrackNodes(const std::string& otherInfo, std::map<int, TrackNodeState>& nodes);
+
+private:
+    std::map<std::string, DeviceState>  m_latest;           ///< 设备序列号 -> 最新状态
+    std::map<std::string, DeviceState>  m_delivered;        ///< 设备序列号 -> 上一帧投递的状态
+    std::set<std::string>               m_dirty;            ///< 本帧内有消息到达的设备
+    QTimer                              m_frameTimer;       ///< 帧定时器（有消息到达时才启动）
+    int64_t                             m_received;         ///< 收到的状态消息数
+    int64_t                             m_emitted;          ///< 投递的变化数
+};
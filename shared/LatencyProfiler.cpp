@@ -0,0 +1,211 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     LatencyProfiler.cpp
+/// @brief    耗时统计（按名称记录调用耗时，定期输出分位数到日志）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#include "LatencyProfiler.h"
+#include <algorithm>
+#include <QString>
+#include "src/common/Mlog/mlog.h"
+
+// 每个名称保留的样本数
+#define LATENCY_MAX_SAMPLES             (4096)
+
+LatencyProfiler::LatencyProfiler()
+    : m_enabled(false)
+{
+    connect(&m_reportTimer, &QTimer::timeout, this, &LatencyProfiler::OnReportTimer);
+}
+
+///
+/// @brief 获取单例
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+LatencyProfiler& LatencyProfiler::GetInstance()
+{
+    static LatencyProfiler instance;
+    return instance;
+}
+
+///
+/// @brief 开启统计
+///
+/// @param[in]  reportIntervalSec  定期输出的间隔（秒），0表示不定期输出
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void LatencyProfiler::Start(int reportIntervalSec)
+{
+    ULOG(LOG_INFO, "%s(interval: %d)", __FUNCTION__, reportIntervalSec);
+    m_enabled.store(true, std::memory_order_relaxed);
+
+    if (reportIntervalSec > 0)
+    {
+        m_reportTimer.start(reportIntervalSec * 1000);
+    }
+}
+
+///
+/// @brief 停止统计并输出最后一次报告
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void LatencyProfiler::Stop()
+{
+    if (!m_enabled.exchange(false))
+    {
+        return;
+    }
+
+    m_reportTimer.stop();
+    OnReportTimer();
+}
+
+///
+/// @brief 记录一次耗时
+///
+/// @param[in]  name  统计名称（须为字符串常量，只保存指针）
+/// @param[in]  ns    耗时（纳秒）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void LatencyProfiler::Record(const char* name, qint64 ns)
+{
+    if (name == nullptr || !IsEnabled())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Stat& stat = m_stats[name];
+    ++stat.count;
+    stat.totalNs += ns;
+    stat.maxNs = std::max(stat.maxNs, ns);
+
+    if (stat.samples.size() < LATENCY_MAX_SAMPLES)
+    {
+        stat.samples.push_back(ns);
+    }
+    else
+    {
+        stat.samples[stat.next] = ns;
+        stat.next = (stat.next + 1) % LATENCY_MAX_SAMPLES;
+    }
+}
+
+///
+/// @brief 生成统计报告
+///
+/// @param[in]  reset  生成后是否清空统计
+///
+/// @return 报告文本（每个名称一行）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::string LatencyProfiler::Report(bool reset)
+{
+    std::map<const char*, Stat, NameLess> stats;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (reset)
+        {
+            stats.swap(m_stats);
+        }
+        else
+        {
+            stats = m_stats;
+        }
+    }
+
+    // 取分位数（样本已排序）
+    auto percentile = [](const std::vector<qint64>& sorted, int p)->qint64
+    {
+        if (sorted.empty())
+        {
+            return 0;
+        }
+
+        size_t index = std::min(sorted.size() - 1, sorted.size() * p / 100);
+        return sorted[index];
+    };
+
+    QString report = QString("%1 %2 %3 %4 %5 %6 %7 (us)\n")
+        .arg("name", -32).arg("count", 10).arg("mean", 10).arg("p50", 10).arg("p90", 10).arg("p99", 10).arg("max", 10);
+    for (auto& item : stats)
+    {
+        Stat& stat = item.second;
+        if (stat.count == 0)
+        {
+            continue;
+        }
+
+        std::sort(stat.samples.begin(), stat.samples.end());
+        report += QString("%1 %2 %3 %4 %5 %6 %7\n")
+            .arg(item.first, -32)
+            .arg(stat.count, 10)
+            .arg(double(stat.totalNs) / stat.count / 1000.0, 10, 'f', 1)
+            .arg(percentile(stat.samples, 50) / 1000.0, 10, 'f', 1)
+            .arg(percentile(stat.samples, 90) / 1000.0, 10, 'f', 1)
+            .arg(percentile(stat.samples, 99) / 1000.0, 10, 'f', 1)
+            .arg(stat.maxNs / 1000.0, 10, 'f', 1);
+    }
+
+    return report.toStdString();
+}
+
+///
+/// @brief 定期输出报告
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void LatencyProfiler::OnReportTimer()
+{
+    ULOG(LOG_INFO, "%s()\n%s", __FUNCTION__, Report(false).c_str());
+}
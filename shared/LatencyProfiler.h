@@ -0,0 +1,208 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     LatencyProfiler.h
+/// @brief    耗时统计（按名称记录调用耗时，定期输出分位数到日志）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+
+///
+/// @brief 耗时统计
+///     以启动参数-profile开启，未开启时记录点只判断一个原子标志；
+///     每个名称保留最近的若干个样本，定期按 次数/平均/P50/P90/P99/最大 输出到日志，
+///     用于在整机之外发现工作页面等热点路径的性能回退
+///
+class LatencyProfiler : public QObject
+{
+    Q_OBJECT
+
+public:
+    ///
+    /// @brief 获取单例
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static LatencyProfiler& GetInstance();
+
+    ///
+    /// @brief 开启统计
+    ///
+    /// @param[in]  reportIntervalSec  定期输出的间隔（秒），0表示不定期输出
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Start(int reportIntervalSec);
+
+    ///
+    /// @brief 停止统计并输出最后一次报告
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Stop();
+
+    ///
+    /// @brief 是否已开启
+    ///
+    bool IsEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    ///
+    /// @brief 记录一次耗时
+    ///
+    /// @param[in]  name  统计名称（须为字符串常量，只保存指针）
+    /// @param[in]  ns    耗时（纳秒）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Record(const char* name, qint64 ns);
+
+    ///
+    /// @brief 生成统计报告
+    ///
+    /// @param[in]  reset  生成后是否清空统计
+    ///
+    /// @return 报告文本（每个名称一行）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::string Report(bool reset);
+
+protected Q_SLOTS:
+    ///
+    /// @brief 定期输出报告
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnReportTimer();
+
+private:
+    LatencyProfiler();
+
+    ///
+    /// @brief 单个名称的统计
+    ///
+    struct Stat
+    {
+        quint64                 count = 0;          ///< 调用次数
+        qint64                  totalNs = 0;        ///< 总耗时
+        qint64                  maxNs = 0;          ///< 最大耗时
+        std::vector<qint64>     samples;            ///< 最近的样本（环形覆盖）
+        size_t                  next = 0;           ///< 下一个写入位置
+    };
+
+    ///
+    /// @brief 按字符串内容比较名称
+    ///
+    struct NameLess
+    {
+        bool operator()(const char* lhs, const char* rhs) const { return std::strcmp(lhs, rhs) < 0; }
+    };
+
+private:
+    std::atomic<bool>                           m_enabled;          ///< 是否开启
+    std::mutex                                  m_mutex;            ///< 保护m_stats
+    std::map<const char*, Stat, NameLess>       m_stats;            ///< 名称到统计
+    QTimer                                      m_reportTimer;      ///< 定期输出定时器
+};
+
+///
+/// @brief 耗时记录点（作用域结束时记录）
+///     tick非空且sampleEvery大于1时，每sampleEvery次只记录一次，用于data()等高频调用；
+///     tick由调用点各自持有（见LATENCY_SCOPE_SAMPLED），不同记录点的抽样互不影响
+///
+class LatencyScope
+{
+public:
+    explicit LatencyScope(const char* name, quint32* tick = nullptr, quint32 sampleEvery = 1)
+        : m_name(nullptr)
+    {
+        if (!LatencyProfiler::GetInstance().IsEnabled())
+        {
+            return;
+        }
+
+        if (tick != nullptr && sampleEvery > 1 && (++(*tick) % sampleEvery) != 0)
+        {
+            return;
+        }
+
+        m_name = name;
+        m_timer.start();
+    }
+
+    ~LatencyScope()
+    {
+        if (m_name != nullptr)
+        {
+            LatencyProfiler::GetInstance().Record(m_name, m_timer.nsecsElapsed());
+        }
+    }
+
+private:
+    Q_DISABLE_COPY(LatencyScope)
+
+    const char*         m_name;             ///< 统计名称，为空时不记录
+    QElapsedTimer       m_timer;            ///< 计时
+};
+
+/// 记录当前作用域的耗时
+#define LATENCY_SCOPE(name) \
+    LatencyScope latencyScope(name)
+
+/// 按调用点抽样记录当前作用域的耗时（每个调用点、每个线程各自计数）
+#define LATENCY_SCOPE_SAMPLED(name, every) \
+    static thread_local quint32 s_latencyTick = 0; \
+    LatencyScope latencyScope(name, &s_latencyTick, every)
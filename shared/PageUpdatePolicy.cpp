@@ -0,0 +1,191 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     PageUpdatePolicy.cpp
+/// @brief    页面不可见时的更新合并策略
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+
+#include "PageUpdatePolicy.h"
+#include <mutex>
+#include <algorithm>
+#include <QEvent>
+#include <QWidget>
+#include "src/common/Mlog/mlog.h"
+
+namespace
+{
+    // 已创建的策略（用于统计输出）
+    std::mutex                          s_policyMutex;
+    std::vector<PageUpdatePolicy*>      s_policies;
+}
+
+PageUpdatePolicy::PageUpdatePolicy(const QString& name, int resetThreshold, QObject* parent)
+    : QObject(parent)
+    , m_name(name)
+    , m_resetThreshold(resetThreshold)
+    , m_needReset(false)
+    , m_lastVisible(true)
+{
+    std::lock_guard<std::mutex> lock(s_policyMutex);
+    s_policies.push_back(this);
+}
+
+PageUpdatePolicy::~PageUpdatePolicy()
+{
+    std::lock_guard<std::mutex> lock(s_policyMutex);
+    s_policies.erase(std::remove(s_policies.begin(), s_policies.end(), this), s_policies.end());
+}
+
+void PageUpdatePolicy::WatchPage(QWidget* page)
+{
+    if (page == Q_NULLPTR)
+    {
+        return;
+    }
+
+    page->installEventFilter(this);
+    m_pages.push_back(page);
+    m_lastVisible = IsPageVisible();
+}
+
+bool PageUpdatePolicy::IsPageVisible() const
+{
+    if (m_pages.empty())
+    {
+        return true;
+    }
+
+    for (const auto& page : m_pages)
+    {
+        if (!page.isNull() && page->isVisible())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void PageUpdatePolicy::DeferReset()
+{
+    m_metrics.deferred++;
+    if (m_needReset)
+    {
+        m_metrics.skipped++;
+        return;
+    }
+
+    m_needReset = true;
+}
+
+bool PageUpdatePolicy::OnDeferred(bool merged, size_t pendingSize)
+{
+    m_metrics.deferred++;
+    if (merged)
+    {
+        m_metrics.merged++;
+    }
+
+    // 待处理变更过多，显示时直接整体重置
+    if (pendingSize > size_t(m_resetThreshold))
+    {
+        ULOG(LOG_INFO, "%s(%s pending:%d exceed threshold, reset on show)", __FUNCTION__, m_name.toStdString(), int(pendingSize));
+        m_needReset = true;
+        return false;
+    }
+
+    return true;
+}
+
+void PageUpdatePolicy::OnReplayed(size_t count)
+{
+    m_metrics.replayed += count;
+}
+
+void PageUpdatePolicy::OnReset()
+{
+    m_metrics.resets++;
+    m_needReset = false;
+}
+
+QString PageUpdatePolicy::Summary() const
+{
+    return QString("%1: applied=%2, deferred=%3, merged=%4, skipped=%5, replayed=%6, resets=%7")
+        .arg(m_name)
+        .arg(m_metrics.applied)
+        .arg(m_metrics.deferred)
+        .arg(m_metrics.merged)
+        .arg(m_metrics.skipped)
+        .arg(m_metrics.replayed)
+        .arg(m_metrics.resets);
+}
+
+QStringList PageUpdatePolicy::AllSummaries()
+{
+    std::lock_guard<std::mutex> lock(s_policyMutex);
+    QStringList summaries;
+    for (auto policy : s_policies)
+    {
+        summaries.push_back(policy->Summary());
+    }
+
+    return summaries;
+}
+
+bool PageUpdatePolicy::eventFilter(QObject* obj, QEvent* event)
+{
+    if (event->type() == QEvent::Show || event->type() == QEvent::Hide)
+    {
+        bool visible = IsPageVisible();
+        // 由全部隐藏变为显示
+        if (visible && !m_lastVisible)
+        {
+            m_lastVisible = visible;
+            ULOG(LOG_INFO, "%s(%s)", __FUNCTION__, Summary().toStdString());
+            emit pageShown();
+        }
+
+        m_lastVisible = visible;
+    }
+
+    return QObject::eventFilter(obj, event);
+}
@@ -0,0 +1,262 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     PageUpdatePolicy.h
+/// @brief    页面不可见时的更新合并策略
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <map>
+#include <cstdint>
+#include <vector>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QStringList>
+
+class QWidget;
+
+// 更新统计信息
+struct PageUpdateMetrics
+{
+    int64_t         applied = 0;            ///< 页面可见时直接应用的更新数
+    int64_t         deferred = 0;           ///< 页面隐藏时被延后的更新数
+    int64_t         merged = 0;             ///< 延后时与已有待处理变更合并的更新数
+    int64_t         skipped = 0;            ///< 已需要整体重置而被直接丢弃的更新数
+    int64_t         replayed = 0;           ///< 页面显示时按批回放的变更数
+    int64_t         resets = 0;             ///< 页面显示时改为整体重置的次数
+};
+
+///
+/// @brief 页面可见性相关的更新策略
+///
+/// 页面（一个或多个）全部隐藏时，更新只记录到待处理集合中，
+/// 页面显示时一次回放；待处理变更超过阈值后改为整体重置
+///
+class PageUpdatePolicy : public QObject
+{
+    Q_OBJECT
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    /// @param[in]  name            策略名称（用于统计输出）
+    /// @param[in]  resetThreshold  待处理变更超过该数目时改为整体重置
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    PageUpdatePolicy(const QString& name, int resetThreshold, QObject* parent = Q_NULLPTR);
+    ~PageUpdatePolicy();
+
+    ///
+    /// @brief 监视页面的显示和隐藏
+    ///
+    /// @param[in]  page  页面
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void WatchPage(QWidget* page);
+
+    ///
+    /// @brief 是否有被监视的页面可见（未监视任何页面时视为可见）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool IsPageVisible() const;
+
+    ///
+    /// @brief 记录直接应用的更新
+    ///
+    void CountApplied(int count = 1) { m_metrics.applied += count; };
+
+    ///
+    /// @brief 标记页面显示时需要整体重置（之后的延后更新全部丢弃）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void DeferReset();
+
+    ///
+    /// @brief 页面显示时是否需要整体重置
+    ///
+    bool NeedReset() const { return m_needReset; };
+
+    ///
+    /// @brief 记录一次延后的更新
+    ///
+    /// @param[in]  merged       是否与已有待处理变更合并
+    /// @param[in]  pendingSize  当前待处理变更数目
+    ///
+    /// @return 需要整体重置时返回false（调用者应丢弃待处理变更）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool OnDeferred(bool merged, size_t pendingSize);
+
+    ///
+    /// @brief 记录一次丢弃的更新（已需要整体重置）
+    ///
+    void OnSkipped() { m_metrics.deferred++; m_metrics.skipped++; };
+
+    ///
+    /// @brief 记录按批回放
+    ///
+    /// @param[in]  count  回放的变更数目
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnReplayed(size_t count);
+
+    ///
+    /// @brief 记录整体重置（清除重置标志）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnReset();
+
+    ///
+    /// @brief 获取统计信息
+    ///
+    const PageUpdateMetrics& GetMetrics() const { return m_metrics; };
+
+    ///
+    /// @brief 统计信息的文本描述
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    QString Summary() const;
+
+    ///
+    /// @brief 所有策略的统计信息
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static QStringList AllSummaries();
+
+signals:
+    ///
+    /// @brief 被监视的页面由全部隐藏变为显示
+    ///
+    void pageShown();
+
+protected:
+    bool eventFilter(QObject* obj, QEvent* event) override;
+
+private:
+    QString                         m_name;                     ///< 策略名称
+    int                             m_resetThreshold;           ///< 整体重置阈值
+    bool                            m_needReset;                ///< 显示时需要整体重置
+    bool                            m_lastVisible;              ///< 上次的可见状态
+    std::vector<QPointer<QWidget>>  m_pages;                    ///< 被监视的页面
+    PageUpdateMetrics               m_metrics;                  ///< 统计信息
+};
+
+///
+/// @brief 待处理变更集合（同一键只保留最新的变更）
+///
+template<typename Key, typename Value>
+class PendingChangeSet
+{
+public:
+    explicit PendingChangeSet(PageUpdatePolicy& policy) : m_policy(policy) {};
+
+    ///
+    /// @brief 延后一条变更
+    ///
+    /// @param[in]  key    变更的键
+    /// @param[in]  value  变更内容
+    ///
+    void Defer(const Key& key, const Value& value)
+    {
+        if (m_policy.NeedReset())
+        {
+            m_policy.OnSkipped();
+            return;
+        }
+
+        bool merged = (m_changes.find(key) != m_changes.end());
+        m_changes[key] = value;
+        if (!m_policy.OnDeferred(merged, m_changes.size()))
+        {
+            m_changes.clear();
+        }
+    }
+
+    ///
+    /// @brief 取出全部待处理变更
+    ///
+    /// @param[out]  changes  待处理变更
+    ///
+    /// @return 需要整体重置时返回false
+    ///
+    bool Take(std::map<Key, Value>& changes)
+    {
+        changes.swap(m_changes);
+        m_changes.clear();
+        if (m_policy.NeedReset())
+        {
+            changes.clear();
+            return false;
+        }
+
+        m_policy.OnReplayed(changes.size());
+        return true;
+    }
+
+    bool Empty() const { return m_changes.empty(); };
+    void Clear() { m_changes.clear(); };
+
+private:
+    PageUpdatePolicy&               m_policy;                   ///< 所属策略
+    std::map<Key, Value>            m_changes;                  ///< 待处理变更
+};
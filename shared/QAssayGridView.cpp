@@ -0,0 +1,596 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     QAssayGridView.cpp
+/// @brief    项目选择网格（单控件自绘）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#include "QAssayGridView.h"
+#include <QPainter>
+#include <QPaintEvent>
+#include <QMouseEvent>
+#include <QHelpEvent>
+#include <QToolTip>
+#include <QFontMetrics>
+#include <QFontInfo>
+#include <QApplication>
+
+// 卡片内边距（与原按钮布局一致）
+#define CELL_MARGIN_LEFT        (6)
+#define CELL_MARGIN_TOP         (21)
+#define CELL_MARGIN_RIGHT       (6)
+#define CELL_MARGIN_BOTTOM      (5)
+// 状态栏高度、图标槽宽度和间距
+#define CELL_STATUS_HEIGHT      (18)
+#define CELL_ICON_SLOT          (20)
+#define CELL_ICON_SPACING       (4)
+#define CELL_DILUTION_WIDTH     (65)
+// 卡片圆角
+#define CELL_RADIUS             (6)
+
+///
+/// @brief 获取单例
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+const AssayCellStyle& AssayCellStyle::GetInstance()
+{
+    static AssayCellStyle s_style;
+    return s_style;
+}
+
+AssayCellStyle::AssayCellStyle()
+    : m_namePixelSize(0)
+{
+    // 探针首次polish时由样式表设置属性并回调Resolve()
+    m_probe = new AssayCellStyleProbe(this);
+    // 单例析构时QApplication已不存在，探针在退出事件循环时释放
+    QObject::connect(qApp, &QCoreApplication::aboutToQuit, m_probe.data(), &QObject::deleteLater);
+    m_probe->ensurePolished();
+}
+
+///
+/// @brief 从样式探针获取绘制资源（探针被样式表设置属性后调用）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void AssayCellStyle::Resolve()
+{
+    if (m_probe.isNull())
+    {
+        return;
+    }
+
+    const AssayCellStyleProbe& probe = *m_probe;
+    m_borderPens[CELL_NORMAL] = QPen(probe.m_normalBorder, 1);
+    m_borderPens[CELL_WAIT] = QPen(probe.m_waitBorder, 1);
+    m_borderPens[CELL_OK] = QPen(probe.m_okBorder, 1);
+    m_borderPens[CELL_RECHECK] = QPen(probe.m_recheckBorder, 1);
+    m_borderPens[CELL_DISABLE] = QPen(probe.m_disableBorder, 1);
+
+    m_backgrounds[CELL_NORMAL] = QBrush(probe.m_normalBackground);
+    m_backgrounds[CELL_WAIT] = QBrush(probe.m_waitBackground);
+    m_backgrounds[CELL_OK] = QBrush(probe.m_okBackground);
+    m_backgrounds[CELL_RECHECK] = QBrush(probe.m_recheckBackground);
+    m_backgrounds[CELL_DISABLE] = QBrush(probe.m_disableBackground);
+
+    m_disableTextColor = probe.m_disableTextColor;
+    m_dilutionColor = probe.m_dilutionColor;
+    m_namePixelSize = probe.m_namePixelSize;
+
+    m_maskIcons[ICON_NORMAL] = probe.m_maskIcon;
+    m_maskIcons[ICON_HOVER] = probe.m_maskHoverIcon;
+    m_maskIcons[ICON_DISABLE] = probe.m_maskDisableIcon;
+    m_reagentIcons[ICON_NORMAL] = probe.m_reagentIcon;
+    m_reagentIcons[ICON_HOVER] = probe.m_reagentHoverIcon;
+    m_reagentIcons[ICON_DISABLE] = probe.m_reagentDisableIcon;
+    m_caliIcons[ICON_NORMAL] = probe.m_caliIcon;
+    m_caliIcons[ICON_HOVER] = probe.m_caliHoverIcon;
+    m_caliIcons[ICON_DISABLE] = probe.m_caliDisableIcon;
+    m_incIcons[ICON_NORMAL] = probe.m_incIcon;
+    m_incIcons[ICON_HOVER] = probe.m_incHoverIcon;
+    m_incIcons[ICON_DISABLE] = probe.m_incDisableIcon;
+    m_decIcons[ICON_NORMAL] = probe.m_decIcon;
+    m_decIcons[ICON_HOVER] = probe.m_decHoverIcon;
+    m_decIcons[ICON_DISABLE] = probe.m_decDisableIcon;
+}
+
+AssayCellStyleProbe::AssayCellStyleProbe(AssayCellStyle* owner)
+    : QWidget(Q_NULLPTR)
+    , m_owner(owner)
+{
+    // 样式表未设置时按调色板绘制（无图标）
+    setAttribute(Qt::WA_DontShowOnScreen);
+    m_normalBorder = palette().color(QPalette::Mid);
+    m_waitBorder = palette().color(QPalette::Highlight);
+    m_okBorder = m_normalBorder;
+    m_recheckBorder = m_normalBorder;
+    m_disableBorder = palette().color(QPalette::Disabled, QPalette::Mid);
+    m_normalBackground = Qt::transparent;
+    m_waitBackground = Qt::transparent;
+    m_okBackground = Qt::transparent;
+    m_recheckBackground = Qt::transparent;
+    m_disableBackground = palette().color(QPalette::Base);
+    m_disableTextColor = palette().color(QPalette::Disabled, QPalette::Text);
+    m_dilutionColor = palette().color(QPalette::Text);
+    m_namePixelSize = QFontInfo(font()).pixelSize();
+}
+
+///
+/// @brief 被样式表设置属性后（首次polish、样式表更换）通知卡片样式重新获取
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool AssayCellStyleProbe::event(QEvent* event)
+{
+    bool result = QWidget::event(event);
+    if (event->type() == QEvent::Polish || event->type() == QEvent::StyleChange)
+    {
+        m_owner->Resolve();
+    }
+
+    return result;
+}
+
+///
+/// @brief 根据卡片数据获取背景状态
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+AssayCellStyle::CellState AssayCellStyle::GetCellState(const AssayButtonData& data)
+{
+    // 优先级与原按钮一致：禁用 > 完成 > 复查 > 待测
+    if (data.bIsForbidden)
+    {
+        return CELL_DISABLE;
+    }
+    else if (data.bIsAnalyzed)
+    {
+        return CELL_OK;
+    }
+    else if (data.bIsRecheck)
+    {
+        return CELL_RECHECK;
+    }
+    else if (data.bIsRequest)
+    {
+        return CELL_WAIT;
+    }
+
+    return CELL_NORMAL;
+}
+
+///
+/// @brief 项目名的显示区域
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+QRect AssayCellStyle::NameRect(const QRect& rect)
+{
+    return rect.adjusted(CELL_MARGIN_LEFT, CELL_MARGIN_TOP, -CELL_MARGIN_RIGHT, -(CELL_MARGIN_BOTTOM + CELL_STATUS_HEIGHT));
+}
+
+///
+/// @brief 项目名的字体
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+QFont AssayCellStyle::NameFont(const QFont& font) const
+{
+    QFont nameFont(font);
+    if (m_namePixelSize > 0)
+    {
+        nameFont.setPixelSize(m_namePixelSize);
+    }
+    return nameFont;
+}
+
+///
+/// @brief 项目名是否超出卡片的显示宽度
+///
+/// @param[in]  rect  卡片区域
+/// @param[in]  name  项目名
+/// @param[in]  font  控件字体
+///
+/// @return true:超出
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool AssayCellStyle::IsNameOverflow(const QRect& rect, const QString& name, const QFont& font) const
+{
+    if (name.isEmpty())
+    {
+        return false;
+    }
+
+    return QFontMetrics(NameFont(font)).width(name) > NameRect(rect).width();
+}
+
+///
+/// @brief 绘制一个项目卡片
+///
+/// @param[in]  painter    画笔
+/// @param[in]  rect       卡片区域
+/// @param[in]  data       卡片数据
+/// @param[in]  font       控件字体
+/// @param[in]  textColor  控件文字颜色
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void AssayCellStyle::Paint(QPainter& painter, const QRect& rect, const AssayButtonData& data,
+    const QFont& font, const QColor& textColor) const
+{
+    const CellState state = GetCellState(data);
+    const bool useHv = (data.bIsRecheck || data.bIsRequest || data.bIsAnalyzed);
+    const IconState iconState = data.bIsForbidden ? ICON_DISABLE : (useHv ? ICON_HOVER : ICON_NORMAL);
+
+    painter.save();
+
+    // 背景和边框
+    painter.setRenderHint(QPainter::Antialiasing, true);
+    painter.setPen(m_borderPens[state]);
+    painter.setBrush(m_backgrounds[state]);
+    painter.drawRoundedRect(QRectF(rect).adjusted(0.5, 0.5, -0.5, -0.5), CELL_RADIUS, CELL_RADIUS);
+    painter.setRenderHint(QPainter::Antialiasing, false);
+
+    // 项目名（超出宽度时左对齐，由提示显示全名）
+    if (!data.strAssayName.isEmpty())
+    {
+        QRect nameRect = NameRect(rect);
+        QFont nameFont = NameFont(font);
+        painter.setFont(nameFont);
+        painter.setPen(data.bIsForbidden ? m_disableTextColor : textColor);
+        bool overflow = QFontMetrics(nameFont).width(data.strAssayName) > nameRect.width();
+        painter.setClipRect(nameRect, Qt::IntersectClip);
+        painter.drawText(nameRect, (overflow ? (Qt::AlignLeft | Qt::AlignVCenter) : Qt::AlignCenter), data.strAssayName);
+        painter.setClipping(false);
+    }
+
+    // 状态栏：遮蔽、试剂异常、校准异常图标，之后是稀释信息
+    QRect statusRect(rect.left() + CELL_MARGIN_LEFT, rect.bottom() - CELL_MARGIN_BOTTOM - CELL_STATUS_HEIGHT + 1,
+        rect.width() - CELL_MARGIN_LEFT - CELL_MARGIN_RIGHT, CELL_STATUS_HEIGHT);
+    int x = statusRect.left();
+    auto drawIcon = [&](const QPixmap& icon)
+    {
+        QRect slot(x, statusRect.top(), CELL_ICON_SLOT, statusRect.height());
+        QRect iconRect(QPoint(0, 0), icon.size());
+        iconRect.moveCenter(slot.center());
+        painter.drawPixmap(iconRect, icon);
+        x += CELL_ICON_SLOT + CELL_ICON_SPACING;
+    };
+
+    if (data.bIsMask)
+    {
+        drawIcon(m_maskIcons[iconState]);
+    }
+    if (data.bIsRegentAbn)
+    {
+        drawIcon(m_reagentIcons[iconState]);
+    }
+    if (data.bIsCaliAbn)
+    {
+        drawIcon(m_caliIcons[iconState]);
+    }
+
+    // 增减量图标不区分禁用
+    const IconState sizeIconState = useHv ? ICON_HOVER : ICON_NORMAL;
+    QRect dilutionRect(x, statusRect.top(), qMax(CELL_DILUTION_WIDTH, statusRect.right() - x + 1), statusRect.height());
+    if (data.enSampleSize == DEC_SIZE || data.enSampleSize == INC_SIZE)
+    {
+        const QPixmap& icon = (data.enSampleSize == DEC_SIZE) ? m_decIcons[sizeIconState] : m_incIcons[sizeIconState];
+        QRect iconRect(QPoint(0, 0), icon.size());
+        iconRect.moveCenter(dilutionRect.center());
+        iconRect.moveLeft(dilutionRect.left());
+        painter.drawPixmap(iconRect, icon);
+    }
+    else if ((data.enSampleSize == USER_SIZE || data.enSampleSize == MANUAL_SIZE) && data.iDilution != 1)
+    {
+        QFont dilutionFont = NameFont(font);
+        painter.setFont(dilutionFont);
+        painter.setPen(m_dilutionColor);
+        painter.drawText(dilutionRect, Qt::AlignLeft | Qt::AlignVCenter, QString::number(data.iDilution));
+    }
+
+    painter.restore();
+}
+
+QAssayGridView::QAssayGridView(QWidget* parent, int row, int column)
+    : QWidget(parent)
+    , m_row(0)
+    , m_column(0)
+    , m_spacing(18)
+{
+    SetGrid(row, column);
+}
+
+QAssayGridView::~QAssayGridView()
+{
+}
+
+///
+/// @brief 设置网格的行列数（清空所有单元格数据）
+///
+/// @param[in]  row     行数
+/// @param[in]  column  列数
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QAssayGridView::SetGrid(int row, int column)
+{
+    m_row = qMax(0, row);
+    m_column = qMax(0, column);
+    m_cells.assign(m_row * m_column, AssayButtonData());
+    updateGeometry();
+    update();
+}
+
+///
+/// @brief 设置单元格间距
+///
+/// @param[in]  spacing  间距
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QAssayGridView::SetSpacing(int spacing)
+{
+    m_spacing = qMax(0, spacing);
+    updateGeometry();
+    update();
+}
+
+///
+/// @brief 设置单元格数据，数据无变化时不重绘
+///
+/// @param[in]  index  单元格位置（row*column + currentIndex）
+/// @param[in]  data   单元格数据
+///
+/// @return true:设置成功
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool QAssayGridView::SetCellData(int index, const AssayButtonData& data)
+{
+    if (index < 0 || index >= GetCellCount())
+    {
+        return false;
+    }
+
+    // 只重绘显示内容变化的单元格（比较运算不含禁用标志，单独判断）
+    bool changed = (m_cells[index] != data) || (m_cells[index].bIsForbidden != data.bIsForbidden);
+    m_cells[index] = data;
+    if (changed)
+    {
+        update(CellRect(index));
+    }
+
+    return true;
+}
+
+///
+/// @brief 获取单元格数据
+///
+/// @param[in]  index  单元格位置
+///
+/// @return 单元格数据，位置无效时返回空
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+const AssayButtonData* QAssayGridView::GetCellData(int index) const
+{
+    if (index < 0 || index >= GetCellCount())
+    {
+        return nullptr;
+    }
+
+    return &m_cells[index];
+}
+
+///
+/// @brief 清空所有单元格数据
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QAssayGridView::ClearCells()
+{
+    AssayButtonData initData;
+    for (int index = 0; index < GetCellCount(); index++)
+    {
+        SetCellData(index, initData);
+    }
+}
+
+///
+/// @brief 单元格的区域
+///
+/// @param[in]  index  单元格位置
+///
+/// @return 单元格区域，位置无效时返回空区域
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+QRect QAssayGridView::CellRect(int index) const
+{
+    if (index < 0 || index >= GetCellCount() || m_column <= 0 || m_row <= 0)
+    {
+        return QRect();
+    }
+
+    // 与网格布局一致：间距之外的空间均分，余数分给前面的单元格
+    const QRect area = contentsRect();
+    const int freeWidth = qMax(0, area.width() - (m_column - 1) * m_spacing);
+    const int freeHeight = qMax(0, area.height() - (m_row - 1) * m_spacing);
+    const int row = index / m_column;
+    const int column = index % m_column;
+
+    auto span = [](int total, int count, int i, int& start, int& length)
+    {
+        int base = total / count;
+        int extra = total % count;
+        start = i * base + qMin(i, extra);
+        length = base + (i < extra ? 1 : 0);
+    };
+
+    int left = 0, width = 0, top = 0, height = 0;
+    span(freeWidth, m_column, column, left, width);
+    span(freeHeight, m_row, row, top, height);
+
+    return QRect(area.left() + left + column * m_spacing, area.top() + top + row * m_spacing, width, height);
+}
+
+///
+/// @brief 命中测试
+///
+/// @param[in]  pos  控件坐标
+///
+/// @return 单元格位置，未命中返回-1
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+int QAssayGridView::CellAt(const QPoint& pos) const
+{
+    if (m_column <= 0 || m_row <= 0)
+    {
+        return -1;
+    }
+
+    // 先按平均尺寸估算行列，再用实际区域校验（落在间距上不算命中）
+    const QRect area = contentsRect();
+    const double pitchX = double(area.width() + m_spacing) / m_column;
+    const double pitchY = double(area.height() + m_spacing) / m_row;
+    if (pitchX <= 0 || pitchY <= 0)
+    {
+        return -1;
+    }
+
+    int column = qBound(0, int((pos.x() - area.left()) / pitchX), m_column - 1);
+    int row = qBound(0, int((pos.y() - area.top()) / pitchY), m_row - 1);
+    int index = row * m_column + column;
+    return CellRect(index).contains(pos) ? index : -1;
+}
+
+QSize QAssayGridView::minimumSizeHint() const
+{
+    const QMargins margins = contentsMargins();
+    int height = m_row * AssayCellStyle::MinimumCellHeight() + qMax(0, m_row - 1) * m_spacing;
+    return QSize(margins.left() + margins.right(), height + margins.top() + margins.bottom());
+}
+
+///
+/// @brief 重绘：只绘制与脏区相交的单元格
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QAssayGridView::paintEvent(QPaintEvent* event)
+{
+    QPainter painter(this);
+    const AssayCellStyle& cellStyle = AssayCellStyle::GetInstance();
+    const QFont& curFont = font();
+    const QColor textColor = palette().color(QPalette::WindowText);
+
+    for (int index = 0; index < GetCellCount(); index++)
+    {
+        QRect cellRect = CellRect(index);
+        if (!event->region().intersects(cellRect))
+        {
+            continue;
+        }
+
+        cellStyle.Paint(painter, cellRect, m_cells[index], curFont, textColor);
+    }
+}
+
+void QAssayGridView::mousePressEvent(QMouseEvent* event)
+{
+    if (event->button() == Qt::LeftButton)
+    {
+        int index = CellAt(event->pos());
+        if (index >= 0)
+        {
+            emit select(index, m_cells[index].assayCode);
+        }
+    }
+
+    QWidget::mousePressEvent(event);
+}
+
+///
+/// @brief 项目名超出卡片宽度时显示提示
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool QAssayGridView::event(QEvent* event)
+{
+    if (event->type() == QEvent::ToolTip)
+    {
+        QHelpEvent* helpEvent = static_cast<QHelpEvent*>(event);
+        int index = CellAt(helpEvent->pos());
+        if (index >= 0 && AssayCellStyle::GetInstance().IsNameOverflow(CellRect(index), m_cells[index].strAssayName, font()))
+        {
+            QToolTip::showText(helpEvent->globalPos(), m_cells[index].strAssayName, this, CellRect(index));
+        }
+        else
+        {
+            QToolTip::hideText();
+            event->ignore();
+        }
+
+        return true;
+    }
+
+    return QWidget::event(event);
+}
@@ -0,0 +1,377 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     QAssayGridView.h
+/// @brief    项目选择网格（单控件自绘）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <vector>
+#include <QWidget>
+#include <QPixmap>
+#include <QPointer>
+#include <QBrush>
+#include <QPen>
+#include "QAssaySelectButton.h"
+
+class QPainter;
+class AssayCellStyleProbe;
+
+///
+/// @brief 项目卡片的绘制资源（各状态的画刷、画笔和图标只构造一次，所有卡片共享）
+///     颜色、字号和图标取自当前样式表中AssayCellStyleProbe的qproperty-设置，样式表更换时重新获取
+///
+class AssayCellStyle
+{
+    friend class AssayCellStyleProbe;
+
+public:
+    // 卡片背景状态
+    enum CellState
+    {
+        CELL_NORMAL = 0,        // 普通
+        CELL_WAIT,              // 待测
+        CELL_OK,                // 已完成
+        CELL_RECHECK,           // 复查
+        CELL_DISABLE,           // 禁用
+        CELL_STATE_COUNT
+    };
+
+    // 图标的状态
+    enum IconState
+    {
+        ICON_NORMAL = 0,        // 普通
+        ICON_HOVER,             // 高亮背景上
+        ICON_DISABLE,           // 禁用
+        ICON_STATE_COUNT
+    };
+
+    ///
+    /// @brief 获取单例
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static const AssayCellStyle& GetInstance();
+
+    ///
+    /// @brief 绘制一个项目卡片
+    ///
+    /// @param[in]  painter    画笔
+    /// @param[in]  rect       卡片区域
+    /// @param[in]  data       卡片数据
+    /// @param[in]  font       控件字体
+    /// @param[in]  textColor  控件文字颜色
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Paint(QPainter& painter, const QRect& rect, const AssayButtonData& data,
+        const QFont& font, const QColor& textColor) const;
+
+    ///
+    /// @brief 项目名是否超出卡片的显示宽度
+    ///
+    /// @param[in]  rect  卡片区域
+    /// @param[in]  name  项目名
+    /// @param[in]  font  控件字体
+    ///
+    /// @return true:超出
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool IsNameOverflow(const QRect& rect, const QString& name, const QFont& font) const;
+
+    ///
+    /// @brief 卡片的最小高度
+    ///
+    static int MinimumCellHeight() { return 65; }
+
+private:
+    AssayCellStyle();
+
+    ///
+    /// @brief 从样式探针获取绘制资源（探针被样式表设置属性后调用）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Resolve();
+
+    ///
+    /// @brief 根据卡片数据获取背景状态
+    ///
+    static CellState GetCellState(const AssayButtonData& data);
+
+    ///
+    /// @brief 项目名的显示区域
+    ///
+    static QRect NameRect(const QRect& rect);
+
+    ///
+    /// @brief 项目名的字体
+    ///
+    QFont NameFont(const QFont& font) const;
+
+private:
+    QPointer<AssayCellStyleProbe>   m_probe;                                ///< 样式探针（不显示）
+    int                             m_namePixelSize;                        ///< 项目名字号（像素）
+    QPen                            m_borderPens[CELL_STATE_COUNT];         ///< 各状态的边框
+    QBrush                          m_backgrounds[CELL_STATE_COUNT];        ///< 各状态的背景
+    QColor                          m_disableTextColor;                     ///< 禁用时项目名颜色
+    QColor                          m_dilutionColor;                        ///< 稀释倍数颜色
+    QPixmap                         m_maskIcons[ICON_STATE_COUNT];          ///< 项目遮蔽图标
+    QPixmap                         m_reagentIcons[ICON_STATE_COUNT];       ///< 试剂异常图标
+    QPixmap                         m_caliIcons[ICON_STATE_COUNT];          ///< 校准异常图标
+    QPixmap                         m_incIcons[ICON_STATE_COUNT];           ///< 增量图标
+    QPixmap                         m_decIcons[ICON_STATE_COUNT];           ///< 减量图标
+};
+
+///
+/// @brief 项目卡片的样式探针
+///     不显示，只用于让样式表（deviceView.qss中的AssayCellStyleProbe）通过qproperty-设置卡片的颜色、字号和图标，
+///     每次被样式表设置后通知AssayCellStyle重新获取
+///
+class AssayCellStyleProbe : public QWidget
+{
+    Q_OBJECT
+
+    // 各状态的边框颜色
+    Q_PROPERTY(QColor normalBorder MEMBER m_normalBorder)
+    Q_PROPERTY(QColor waitBorder MEMBER m_waitBorder)
+    Q_PROPERTY(QColor okBorder MEMBER m_okBorder)
+    Q_PROPERTY(QColor recheckBorder MEMBER m_recheckBorder)
+    Q_PROPERTY(QColor disableBorder MEMBER m_disableBorder)
+    // 各状态的背景颜色
+    Q_PROPERTY(QColor normalBackground MEMBER m_normalBackground)
+    Q_PROPERTY(QColor waitBackground MEMBER m_waitBackground)
+    Q_PROPERTY(QColor okBackground MEMBER m_okBackground)
+    Q_PROPERTY(QColor recheckBackground MEMBER m_recheckBackground)
+    Q_PROPERTY(QColor disableBackground MEMBER m_disableBackground)
+    // 禁用时项目名颜色、稀释倍数颜色、项目名字号
+    Q_PROPERTY(QColor disableTextColor MEMBER m_disableTextColor)
+    Q_PROPERTY(QColor dilutionColor MEMBER m_dilutionColor)
+    Q_PROPERTY(int namePixelSize MEMBER m_namePixelSize)
+    // 状态栏图标（普通、高亮背景上、禁用）
+    Q_PROPERTY(QPixmap maskIcon MEMBER m_maskIcon)
+    Q_PROPERTY(QPixmap maskHoverIcon MEMBER m_maskHoverIcon)
+    Q_PROPERTY(QPixmap maskDisableIcon MEMBER m_maskDisableIcon)
+    Q_PROPERTY(QPixmap reagentIcon MEMBER m_reagentIcon)
+    Q_PROPERTY(QPixmap reagentHoverIcon MEMBER m_reagentHoverIcon)
+    Q_PROPERTY(QPixmap reagentDisableIcon MEMBER m_reagentDisableIcon)
+    Q_PROPERTY(QPixmap caliIcon MEMBER m_caliIcon)
+    Q_PROPERTY(QPixmap caliHoverIcon MEMBER m_caliHoverIcon)
+    Q_PROPERTY(QPixmap caliDisableIcon MEMBER m_caliDisableIcon)
+    Q_PROPERTY(QPixmap incIcon MEMBER m_incIcon)
+    Q_PROPERTY(QPixmap incHoverIcon MEMBER m_incHoverIcon)
+    Q_PROPERTY(QPixmap incDisableIcon MEMBER m_incDisableIcon)
+    Q_PROPERTY(QPixmap decIcon MEMBER m_decIcon)
+    Q_PROPERTY(QPixmap decHoverIcon MEMBER m_decHoverIcon)
+    Q_PROPERTY(QPixmap decDisableIcon MEMBER m_decDisableIcon)
+
+public:
+    explicit AssayCellStyleProbe(AssayCellStyle* owner);
+
+protected:
+    ///
+    /// @brief 被样式表设置属性后（首次polish、样式表更换）通知卡片样式重新获取
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool event(QEvent* event) override;
+
+private:
+    friend class AssayCellStyle;
+
+    AssayCellStyle*         m_owner;                ///< 所属卡片样式
+    QColor                  m_normalBorder;         ///< 普通边框
+    QColor                  m_waitBorder;           ///< 待测边框
+    QColor                  m_okBorder;             ///< 已完成边框
+    QColor                  m_recheckBorder;        ///< 复查边框
+    QColor                  m_disableBorder;        ///< 禁用边框
+    QColor                  m_normalBackground;     ///< 普通背景
+    QColor                  m_waitBackground;       ///< 待测背景
+    QColor                  m_okBackground;         ///< 已完成背景
+    QColor                  m_recheckBackground;    ///< 复查背景
+    QColor                  m_disableBackground;    ///< 禁用背景
+    QColor                  m_disableTextColor;     ///< 禁用时项目名颜色
+    QColor                  m_dilutionColor;        ///< 稀释倍数颜色
+    int                     m_namePixelSize;        ///< 项目名字号（像素）
+    QPixmap                 m_maskIcon;             ///< 遮蔽
+    QPixmap                 m_maskHoverIcon;        ///< 遮蔽（高亮背景上）
+    QPixmap                 m_maskDisableIcon;      ///< 遮蔽（禁用）
+    QPixmap                 m_reagentIcon;          ///< 试剂异常
+    QPixmap                 m_reagentHoverIcon;     ///< 试剂异常（高亮背景上）
+    QPixmap                 m_reagentDisableIcon;   ///< 试剂异常（禁用）
+    QPixmap                 m_caliIcon;             ///< 校准异常
+    QPixmap                 m_caliHoverIcon;        ///< 校准异常（高亮背景上）
+    QPixmap                 m_caliDisableIcon;      ///< 校准异常（禁用）
+    QPixmap                 m_incIcon;              ///< 增量
+    QPixmap                 m_incHoverIcon;         ///< 增量（高亮背景上）
+    QPixmap                 m_incDisableIcon;       ///< 增量（禁用）
+    QPixmap                 m_decIcon;              ///< 减量
+    QPixmap                 m_decHoverIcon;         ///< 减量（高亮背景上）
+    QPixmap                 m_decDisableIcon;       ///< 减量（禁用）
+};
+
+///
+/// @brief 项目选择网格：一个控件自绘所有卡片，按单元格命中测试，只重绘变化的单元格
+///
+class QAssayGridView : public QWidget
+{
+    Q_OBJECT
+
+public:
+    QAssayGridView(QWidget* parent = Q_NULLPTR, int row = 5, int column = 7);
+    ~QAssayGridView();
+
+    ///
+    /// @brief 设置网格的行列数（清空所有单元格数据）
+    ///
+    /// @param[in]  row     行数
+    /// @param[in]  column  列数
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void SetGrid(int row, int column);
+
+    ///
+    /// @brief 获取行数和列数
+    ///
+    std::pair<int, int> GetGrid() const { return std::make_pair(m_row, m_column); }
+
+    ///
+    /// @brief 单元格数目
+    ///
+    int GetCellCount() const { return static_cast<int>(m_cells.size()); }
+
+    ///
+    /// @brief 设置单元格间距
+    ///
+    /// @param[in]  spacing  间距
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void SetSpacing(int spacing);
+
+    ///
+    /// @brief 设置单元格数据，数据无变化时不重绘
+    ///
+    /// @param[in]  index  单元格位置（row*column + currentIndex）
+    /// @param[in]  data   单元格数据
+    ///
+    /// @return true:设置成功
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool SetCellData(int index, const AssayButtonData& data);
+
+    ///
+    /// @brief 获取单元格数据
+    ///
+    /// @param[in]  index  单元格位置
+    ///
+    /// @return 单元格数据，位置无效时返回空
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    const AssayButtonData* GetCellData(int index) const;
+
+    ///
+    /// @brief 清空所有单元格数据
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void ClearCells();
+
+    ///
+    /// @brief 单元格的区域
+    ///
+    /// @param[in]  index  单元格位置
+    ///
+    /// @return 单元格区域，位置无效时返回空区域
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    QRect CellRect(int index) const;
+
+    ///
+    /// @brief 命中测试
+    ///
+    /// @param[in]  pos  控件坐标
+    ///
+    /// @return 单元格位置，未命中返回-1
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    int CellAt(const QPoint& pos) const;
+
+    QSize minimumSizeHint() const override;
+
+signals:
+    ///
+    /// @brief 单元格被选中
+    ///
+    /// @param[in]  postion    单元格位置
+    /// @param[in]  assayCode  项目编号
+    ///
+    void select(int postion, int assayCode);
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    void mousePressEvent(QMouseEvent* event) override;
+    bool event(QEvent* event) override;
+
+private:
+    int                             m_row;                  ///< 行数
+    int                             m_column;               ///< 列数
+    int                             m_spacing;              ///< 单元格间距
+    std::vector<AssayButtonData>    m_cells;                ///< 单元格数据
+};
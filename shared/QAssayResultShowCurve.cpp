@@ -44,8 +44,10 @@
 ///
 ///////////////////////////////////////////////////////////////////////////
 #include "QAssayResultShowCurve.h"
+#include <qnumeric.h>
 #include "calibration/ch/CaliBrateCommom.h"
 #include "curveDraw/common.h"
+#include "shared/ResultDetailCache.h"
 #include "src/common/Mlog/mlog.h"
 
 
@@ -73,13 +75,55 @@ void QAssayResultShowCurve::ShowAssayResultReactionProcess(ch::tf::AssayTestResu
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	ui.reaction_curve->clearCurve();
 
-	// 获取曲线
-	std::vector<std::shared_ptr<curveSingleDataStore>> CurveList;
-	if (!CaliBrateCommom::GetScatterFromResult(result, CurveList) || CurveList.empty())
+	// 获取曲线（测光点已在结果缓存中解析过，不再逐点查找吸光度）
+	auto spCurve = ResultDetailCache::GetInstance().GetChReactionCurve(result);
+	if (spCurve == nullptr)
 	{
 		return;
 	}
 
+	// 缺少吸光度的点按0显示
+	auto absorb = [](float value)->qreal { return qIsNaN(value) ? 0.0 : qreal(value); };
+	auto makeCurve = [&](CURVECOLOR color)->std::shared_ptr<curveSingleDataStore>
+	{
+		auto curve = std::make_shared<curveSingleDataStore>();
+		curve->IsPointerConnect = false;
+		curve->colorType = color;
+		curve->dataContent.reserve(int(spCurve->pointSN.size()));
+		return curve;
+	};
+
+	// 依次是主波长，次波长，主-次波长
+	std::vector<std::shared_ptr<curveSingleDataStore>> CurveList;
+	CurveList.push_back(makeCurve(ZERO));
+	if (spCurve->HasSecondary())
+	{
+		CurveList.push_back(makeCurve(ONE));
+		CurveList.push_back(makeCurve(TWO));
+	}
+
+	RealDataStruct tempdata;
+	tempdata.type = CIRCLE;
+	for (size_t i = 0; i < spCurve->pointSN.size(); i++)
+	{
+		tempdata.xData = spCurve->pointSN[i];
+		tempdata.yData = absorb(spCurve->primary[i]);
+		tempdata.color = ZERO;
+		CurveList[0]->dataContent.append(tempdata);
+		if (!spCurve->HasSecondary())
+		{
+			continue;
+		}
+
+		tempdata.yData = absorb(spCurve->secondary[i]);
+		tempdata.color = ONE;
+		CurveList[1]->dataContent.append(tempdata);
+
+		tempdata.yData = absorb(spCurve->primary[i]) - absorb(spCurve->secondary[i]);
+		tempdata.color = TWO;
+		CurveList[2]->dataContent.append(tempdata);
+	}
+
 	// 依次显示曲线
 	for (auto curve : CurveList)
 	{
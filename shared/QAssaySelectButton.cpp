@@ -44,50 +44,16 @@
 ///
 ///////////////////////////////////////////////////////////////////////////
 #include "QAssaySelectButton.h"
-#include "ui_QAssaySelectButton.h"
 #include "shared/QAssayTabWidgets.h"
+#include "shared/QAssayGridView.h"
 #include <QMouseEvent>
-#include <QFontMetrics>
-
-const QVariant qvForbidden(QStringLiteral("disable"));
-const QVariant qvForbiddenText(QStringLiteral("assay_name_dis"));
-const QVariant qvNone(QStringLiteral("none"));
-const QVariant qvNormal(QStringLiteral("normal"));
-const QVariant qvAssayName(QStringLiteral("assay_name"));
-
-const QVariant qvOk(QStringLiteral("ok"));
-const QVariant qvReCheck(QStringLiteral("recheck"));
-const QVariant qvWait(QStringLiteral("wait"));
-
-const QVariant item_mask(QStringLiteral("item_mask"));
-const QVariant reagentdis(QStringLiteral("reagentdis"));
-const QVariant caldis(QStringLiteral("caldis"));
-const QVariant dulitionDec(QStringLiteral("dec"));
-const QVariant dulitionInc(QStringLiteral("inc"));
-const QVariant textFormat(QStringLiteral("assay_name"));
-const QVariant dillute(QStringLiteral("dillute"));
-
-const QVariant item_mask_hv(QStringLiteral("item_mask_hv"));
-const QVariant reagentdis_hv(QStringLiteral("reagentdis_hv"));
-const QVariant caldis_hv(QStringLiteral("caldis_hv"));
-const QVariant dulitionDec_hv(QStringLiteral("dec_hv"));
-const QVariant dulitionInc_hv(QStringLiteral("inc_hv"));
-const QVariant textFormat_hv(QStringLiteral("assay_name_hv"));
-const QVariant dillute_hv(QStringLiteral("dillute_hv"));
-
-const QVariant item_mask_dis(QStringLiteral("item_mask_dis"));
-const QVariant reagentdis_dis(QStringLiteral("reagentdis_dis"));
-const QVariant caldis_dis(QStringLiteral("caldis_dis"));
-
-const QVariant qvEmpty(QStringLiteral(""));
+#include <QPainter>
 
 QAssaySelectButton::QAssaySelectButton(QWidget *parent, int indexPos)
     : QWidget(parent)
     , m_indexPos(indexPos)
 {
-    ui = new Ui::QAssaySelectButton();
-    ui->setupUi(this);
-    setAttribute(Qt::WA_StyledBackground);
+    setMinimumHeight(AssayCellStyle::MinimumCellHeight());
 }
 
 QAssaySelectButton::~QAssaySelectButton()
@@ -104,24 +70,15 @@ QAssaySelectButton::~QAssaySelectButton()
 ///
 void QAssaySelectButton::SetButtonAttribute(const AssayButtonData& attribute)
 {
-	/*
-    auto assayStatus = QSystemMonitor::GetInstance().GetAssayStatus(attribute.assayCode);
-    if (assayStatus && (attribute.assayType == ASSAYTYPE1_WORKPAGE))
-    {
-        attribute.bIsMask = assayStatus->maskAssay;
-        attribute.bIsRegentAbn = assayStatus->abnormalReagent;
-        attribute.bIsCaliAbn = assayStatus->abnormalCalibrate;
-    }*/
-
-    if (attribute == m_attribute)
+    // 比较运算不含禁用标志，单独判断
+    if (attribute == m_attribute && attribute.bIsForbidden == m_attribute.bIsForbidden)
     {
         return;
     }
 
     UpdateButtonStatus(attribute);
     m_attribute = attribute;
-    style()->unpolish(this);
-    style()->polish(this);
+    update();
 }
 
 ///
@@ -138,9 +95,7 @@ void QAssaySelectButton::SetButtonAttribute(bool isUse, bool isProfile)
     m_attribute.bIsUse = isUse;
     m_attribute.bIsProfile = isProfile;
     UpdateButtonStatus(m_attribute);
-
-    style()->unpolish(this);
-    style()->polish(this);
+    update();
 }
 
 ///
@@ -151,7 +106,6 @@ void QAssaySelectButton::SetButtonAttribute(bool isUse, bool isProfile)
 ///
 void QAssaySelectButton::ClearStatus()
 {
-    ClearButtonStatus();
     m_attribute.assayCode = -1;
     m_attribute.bIsAnalyzed = false;
     m_attribute.bIsRecheck = false;
@@ -160,6 +114,9 @@ void QAssaySelectButton::ClearStatus()
     m_attribute.bIsRegentAbn = false;
     m_attribute.bIsCaliAbn = false;
     m_attribute.bIsForbidden = false;
+    m_attribute.enSampleSize = STD_SIZE;
+    m_attribute.iDilution = 1;
+    update();
 }
 
 ///
@@ -174,9 +131,7 @@ void QAssaySelectButton::ClearSelected()
     if (m_attribute.bIsRequest)
     {
         m_attribute.bIsRequest = false;
-        setProperty("state_bks", qvNormal);
-        style()->unpolish(this);
-        style()->polish(this);
+        update();
     }
 }
 
@@ -188,7 +143,7 @@ int  QAssaySelectButton::ClearContent()
     m_attribute.bIsRequest = false;
     m_attribute.strAssayName.clear();
 
-    ui->assayName_label->setText(m_attribute.strAssayName);
+    setToolTip(QString());
     this->update();
 
     return origAssayCode;
@@ -198,7 +153,7 @@ void QAssaySelectButton::ResetText(const QString& strText)
 {
     m_attribute.strAssayName = strText;
 
-    ui->assayName_label->setText(m_attribute.strAssayName);
+    UpdateButtonStatus(m_attribute);
     this->update();
 }
 
@@ -210,167 +165,19 @@ void QAssaySelectButton::ResetText(const QString& strText)
 /// @par History:
 /// @li 5774/WuHongTao，2022年5月7日，新建函数
 /// @li 8276/huchunli, 2022年10月9日，减少QVariant的频繁构造
+/// @li 5774/WuHongTao，2026年10月19日，改为自绘，只更新提示并重绘
 ///
 void QAssaySelectButton::UpdateButtonStatus(const AssayButtonData& attribute)
 {
-    // 清除状态，然后更新
-    ClearButtonStatus();
-    // 禁用
-    if (attribute.bIsForbidden)
-    {
-        setProperty("state_bks", qvForbidden);	
-    }
-    // 申请
-    else if (attribute.bIsAnalyzed)
-    {
-        setProperty("state_bks", qvOk);
-    }
-    // 复查
-    else if (attribute.bIsRecheck)
-    {
-        setProperty("state_bks", qvReCheck);
-    }
-    // 待测
-    else if (attribute.bIsRequest)
-    {
-        setProperty("state_bks", qvWait);
-    }
-
-	// modify bug(3081)
-	bool use_hv = (attribute.bIsRecheck || attribute.bIsRequest || attribute.bIsAnalyzed);
-	if (attribute.bIsForbidden)
-	{
-		ui->assayName_label->setProperty("state_texts", qvForbiddenText);
-	}
-	else
-	{
-		ui->assayName_label->setProperty("state_texts", use_hv ? textFormat_hv : textFormat);
-	}
-
-    ui->assayName_label->style()->unpolish(ui->assayName_label);
-    ui->assayName_label->style()->polish(ui->assayName_label);
-
-    // 项目遮蔽
-    if (attribute.bIsMask)
-    {
-		if (attribute.bIsForbidden)
-		{
-			ui->item_mask->setProperty("states", item_mask_dis);
-		}
-		else
-		{
-			ui->item_mask->setProperty("states", use_hv ? item_mask_hv : item_mask);
-		}
-    }
-
-    if (m_attribute.bIsMask != attribute.bIsMask || m_attribute.bIsForbidden != attribute.bIsForbidden)
-    {
-        ui->item_mask->style()->unpolish(ui->item_mask);
-        ui->item_mask->style()->polish(ui->item_mask);
-    }
-
-    // 试剂异常
-    if (attribute.bIsRegentAbn)
-    {
-		if (attribute.bIsForbidden)
-		{
-			ui->reagentdis->setProperty("states", reagentdis_dis);
-		}
-		else
-		{
-			ui->reagentdis->setProperty("states", use_hv ? reagentdis_hv : reagentdis);
-		}
-    }
-
-    if (m_attribute.bIsRegentAbn != attribute.bIsRegentAbn || m_attribute.bIsForbidden != attribute.bIsForbidden)
-    {
-        ui->reagentdis->style()->unpolish(ui->reagentdis);
-        ui->reagentdis->style()->polish(ui->reagentdis);
-    }
-
-    // 校准异常
-    if (attribute.bIsCaliAbn)
-    {
-		if (attribute.bIsForbidden)
-		{
-			ui->caldis->setProperty("states", caldis_dis);
-		}
-		else
-		{
-			ui->caldis->setProperty("states", use_hv ? caldis_hv : caldis);
-		}
-    }
-
-    if (m_attribute.bIsCaliAbn != attribute.bIsCaliAbn || m_attribute.bIsForbidden != attribute.bIsForbidden)
-    {
-        ui->caldis->style()->unpolish(ui->caldis);
-        ui->caldis->style()->polish(ui->caldis);
-    }
-
-    // 减量
-    if (attribute.enSampleSize == DEC_SIZE)
-    {
-        ui->dillute_label->setProperty("states", use_hv ? dulitionDec_hv : dulitionDec);
-    }
-    // 增量
-    else if (attribute.enSampleSize == INC_SIZE)
-    {
-        ui->dillute_label->setProperty("states", use_hv ? dulitionInc_hv : dulitionInc);
-    }
-    // 自动稀释和手动稀释
-    else if (attribute.enSampleSize == USER_SIZE
-        || attribute.enSampleSize == MANUAL_SIZE)
+    // 状态的显示在paintEvent中根据属性绘制，这里只处理名字过长的提示
+    if (AssayCellStyle::GetInstance().IsNameOverflow(rect(), attribute.strAssayName, font()))
     {
-        ui->dillute_label->setProperty("state_texts", use_hv ? textFormat_hv : textFormat);
-        if (attribute.iDilution != 1)
-        {
-            ui->dillute_label->setText(QString::number(attribute.iDilution));
-        }
+        this->setToolTip(attribute.strAssayName);
     }
     else
     {
-        ui->dillute_label->setProperty("states", qvEmpty);
+        this->setToolTip(QString());
     }
-    ui->dillute_label->style()->unpolish(ui->dillute_label);
-    ui->dillute_label->style()->polish(ui->dillute_label);
-	// modify for bug2185 by wuht
-	int width = ui->assayName_label->fontMetrics().width(attribute.strAssayName);
-	if (width > ui->assayName_label->width())
-	{
-		ui->assayName_label->setAlignment(Qt::AlignLeft | Qt::AlignVCenter);
-	}
-	else
-	{
-		ui->assayName_label->setAlignment(Qt::AlignCenter);
-	}
-
-	// 设置名称
-	ui->assayName_label->setText(attribute.strAssayName);
-
-    // 如果名字过长，添加提示
-    QFontMetrics fm(ui->assayName_label->fontMetrics());
-    if (fm.width(attribute.strAssayName) > ui->assayName_label->width())
-    {
-        this->setToolTip(attribute.strAssayName);
-    }
-}
-
-///
-/// @brief 清除项目按钮的状态
-///
-/// @par History:
-/// @li 5774/WuHongTao，2022年5月7日，新建函数
-///
-void QAssaySelectButton::ClearButtonStatus()
-{
-    setProperty("state_bks", qvNormal);
-    setProperty("state_texts", qvAssayName);
-
-    ui->item_mask->setProperty("states", qvNone);
-    ui->reagentdis->setProperty("states", qvNone);
-    ui->caldis->setProperty("states", qvNone);
-    ui->dillute_label->setProperty("states", qvNone);
-    ui->dillute_label->setText(QStringLiteral(""));
 }
 
 ///
@@ -401,6 +208,35 @@ void QAssaySelectButton::mousePressEvent(QMouseEvent *event)
     QWidget::mousePressEvent(event);
 }
 
+///
+/// @brief 重写绘制事件（使用共享的绘制资源自绘，不再依赖样式表重新polish）
+///
+/// @param[in]  event  绘制事件
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QAssaySelectButton::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event);
+    QPainter painter(this);
+    AssayCellStyle::GetInstance().Paint(painter, rect(), m_attribute, font(), palette().color(QPalette::WindowText));
+}
+
+///
+/// @brief 重写尺寸变化事件（重新判断名字是否需要提示）
+///
+/// @param[in]  event  尺寸变化事件
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QAssaySelectButton::resizeEvent(QResizeEvent *event)
+{
+    QWidget::resizeEvent(event);
+    UpdateButtonStatus(m_attribute);
+}
+
 AssayButtonData::AssayButtonData()
 {
     bIsProfile = false;
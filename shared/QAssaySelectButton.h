@@ -48,9 +48,8 @@
 #include <QWidget>
 
 class QMouseEvent;
-namespace Ui {
-    class QAssaySelectButton;
-};
+class QPaintEvent;
+class QResizeEvent;
 
 
 // 样本量
@@ -246,29 +245,41 @@ protected:
     ///
     /// @par History:
     /// @li 5774/WuHongTao，2022年5月7日，新建函数
+    /// @li 5774/WuHongTao，2026年10月19日，改为自绘，只更新提示并重绘
     ///
     void UpdateButtonStatus(const AssayButtonData& attribute);
 
     ///
-    /// @brief 清除项目按钮的状态
+    /// @brief 重写鼠标按下事件
+    ///
+    /// @param[in]  event  鼠标事件
     ///
     /// @par History:
-    /// @li 5774/WuHongTao，2022年5月7日，新建函数
+    /// @li 5774/WuHongTao，2022年5月11日，新建函数
     ///
-    void ClearButtonStatus();
+    void mousePressEvent(QMouseEvent *event);
 
     ///
-    /// @brief 重写鼠标按下事件
+    /// @brief 重写绘制事件（使用共享的绘制资源自绘，不再依赖样式表重新polish）
     ///
-    /// @param[in]  event  鼠标事件
+    /// @param[in]  event  绘制事件
     ///
     /// @par History:
-    /// @li 5774/WuHongTao，2022年5月11日，新建函数
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
     ///
-    void mousePressEvent(QMouseEvent *event);
+    void paintEvent(QPaintEvent *event);
+
+    ///
+    /// @brief 重写尺寸变化事件（重新判断名字是否需要提示）
+    ///
+    /// @param[in]  event  尺寸变化事件
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void resizeEvent(QResizeEvent *event);
 
 private:
-    Ui::QAssaySelectButton*			ui;							///< 界面ui
     AssayButtonData					m_attribute;				///< 按钮属性
     int								m_indexPos;					///< 位置信息
 };
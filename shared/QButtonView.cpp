@@ -48,7 +48,8 @@
 #include "ui_QAssayCardPage.h"
 #include <QRadioButton>
 #include <QGroupBox>
-#include <QGridLayout>
+#include <QVBoxLayout>
+#include "QAssayGridView.h"
 #include "QSampleAssayModel.h"
 #include "shared/ReagentCommon.h"
 #include "shared/messagebus.h"
@@ -144,6 +145,7 @@ QButtonBasicView::QButtonBasicView(QWidget* parent, const int row /*= 5*/, const
 	: QWidget(parent)
 {
 	m_model = Q_NULLPTR;
+	m_gridView = Q_NULLPTR;
 	m_row = row;
 	m_column = column;
 
@@ -154,17 +156,19 @@ QButtonBasicView::QButtonBasicView(QWidget* parent, const int row /*= 5*/, const
 		return;
 	}
 
-	m_layout = new QGridLayout(this);
+	m_layout = new QVBoxLayout(this);
 	if (m_layout == Q_NULLPTR)
 	{
 		ULOG(LOG_WARN, "the layout can not be Inital");
 		return;
 	}
 
+	// 所有项目卡片由一个网格控件绘制
+	m_gridView = new QAssayGridView(this, m_row, m_column);
 	// 设置间隔属性
-	m_layout->setSpacing(18);
-	// 生成模板对象
-	GenTemplateOfView(m_row, m_column);
+	m_gridView->SetSpacing(18);
+	m_layout->addWidget(m_gridView);
+	connect(m_gridView, &QAssayGridView::select, this, &QButtonBasicView::dataSelected);
 }
 
 ///
@@ -180,18 +184,18 @@ QButtonBasicView::QButtonBasicView(QWidget* parent, const int row /*= 5*/, const
 bool QButtonBasicView::setModel(QButtonModel* model)
 {
 	m_model = model;
-	if (m_model == Q_NULLPTR)
+	if (m_model == Q_NULLPTR || m_gridView == Q_NULLPTR)
 	{
 		return false;
 	}
 
 	// 刷新数据的消息
 	connect(m_model, SIGNAL(dataChanged(int)), this, SLOT(OnUpdateButtonStatus(int)));
-	int total = m_buttonElements.size();
+	int total = m_gridView->GetCellCount();
 	// 刷新所有数据
-	const auto allData = m_model->GetAllData();
+	const auto& allData = m_model->GetAllData();
 	int index = 0;
-	for (auto data : allData)
+	for (const auto& data : allData)
 	{
 		// 数据比按钮数目多
 		if (index >= total)
@@ -199,8 +203,8 @@ bool QButtonBasicView::setModel(QButtonModel* model)
 			break;
 		}
 
-		// 更新按钮状态
-		m_buttonElements[index]->SetButtonAttribute(data);
+		// 更新按钮状态（只重绘有变化的单元格）
+		m_gridView->SetCellData(index, data);
 		index++;
 	}
 
@@ -217,6 +221,7 @@ bool QButtonBasicView::setModel(QButtonModel* model)
 ///
 /// @par History:
 /// @li 5774/WuHongTao，2023年12月11日，新建函数
+/// @li 5774/WuHongTao，2026年10月19日，改为调整网格控件的行列
 ///
 bool QButtonBasicView::AdjustView(const int row, const int column)
 {
@@ -226,77 +231,15 @@ bool QButtonBasicView::AdjustView(const int row, const int column)
 		return false;
 	}
 
-	if (Q_NULLPTR == m_layout)
+	if (Q_NULLPTR == m_gridView)
 	{
 		return false;
 	}
 
 	m_row = row;
 	m_column = column;
-	// 依次清空每一个按钮信息
-	for (auto& assayButton : m_buttonElements)
-	{
-		// 从布局之中清除
-		disconnect(assayButton, SIGNAL(select(int, int)), this, SIGNAL(dataSelected(int, int)));
-		m_layout->removeWidget(assayButton);
-		// 清空属性
-		assayButton->SetButtonAttribute();
-	}
-
-	int total = m_buttonElements.size();
-	int need = row * column;
-
-	if (total > need)
-	{
-		auto start = m_buttonElements.begin() + need;
-		std::vector<QAssaySelectButton*> leftButton;
-		// 获取需要删除的按钮列表
-		leftButton.insert(leftButton.end(), start, m_buttonElements.end());
-		// 删除vector中的指针索引
-		m_buttonElements.erase(start, m_buttonElements.end());
-		// 依次删除button
-		for (auto& button : leftButton)
-		{
-			button->deleteLater();
-		}
-	}
-	else if(total < need)
-	{
-		int index = total;
-		while (index < need)
-		{
-			auto element = new QAssaySelectButton(this, -1);
-			m_buttonElements.push_back(element);
-			index++;
-		}
-	}
-
-	// 依次删除按钮属性和值，重新布局
-	int realNumber = m_buttonElements.size();
-	int i = 0;
-	while (i < row)
-	{
-		int j = 0;
-		while (j < column)
-		{
-			// 根据需要找到对应的button
-			auto index = i * column + j;
-			if (index >= realNumber)
-			{
-				break;
-			}
-
-			auto element = m_buttonElements[index];
-			connect(element, SIGNAL(select(int, int)), this, SIGNAL(dataSelected(int, int)));
-			// 设置位置信息
-			element->SetPrivatePosIndex(index);
-			m_layout->addWidget(element, i, j);
-			j++;
-		}
-
-		i++;
-	}
-
+	// 重新设定行列（同时清空属性）
+	m_gridView->SetGrid(row, column);
 	return true;
 }
 
@@ -310,13 +253,12 @@ bool QButtonBasicView::AdjustView(const int row, const int column)
 ///
 void QButtonBasicView::OnUpdateButtonStatus(int index)
 {
-	int total = m_buttonElements.size();
-	if (index >= total)
+	if (Q_NULLPTR == m_model || Q_NULLPTR == m_gridView)
 	{
 		return;
 	}
 
-	if (Q_NULLPTR == m_model)
+	if (index >= m_gridView->GetCellCount())
 	{
 		return;
 	}
@@ -327,46 +269,7 @@ void QButtonBasicView::OnUpdateButtonStatus(int index)
 		return;
 	}
 
-	m_buttonElements[index]->SetButtonAttribute(data.value());
-}
-
-///
-/// @brief 根据参数生成按钮的view
-///
-/// @param[in]  row		行
-/// @param[in]  column  列
-///
-/// @return true:生成成功，反之：失败
-///
-/// @par History:
-/// @li 5774/WuHongTao，2023年12月11日，新建函数
-///
-bool QButtonBasicView::GenTemplateOfView(const int row /*= 5*/, const int column /*= 7*/)
-{
-	if (row <= 0 || column <= 0)
-	{
-		ULOG(LOG_WARN, "%s The view can not be inital the row: %d - column: %d", __FUNCTION__, row, column);
-		return false;
-	}
-
-	int count = 0;
-	int i = 0;
-	while (i < row)
-	{
-		int j = 0;
-		while (j < column)
-		{
-			auto element = new QAssaySelectButton(this, count++);
-			connect(element, SIGNAL(select(int, int)), this, SIGNAL(dataSelected(int, int)));
-			m_buttonElements.push_back(element);
-			m_layout->addWidget(element, i, j);
-			j++;
-		}
-
-		i++;
-	}
-
-	return true;
+	m_gridView->SetCellData(index, data.value());
 }
 
 QButtonViewPage::QButtonViewPage(QWidget* parent)
@@ -1300,18 +1203,16 @@ void QAssayCardPage::GenButtonCombinInfo(const std::vector<tf::ProfileAssayPageI
 		return;
 	}
 
-	auto ProfileAssayMaps = assayMgr->GetCommonProfileMap();
-	if (!ProfileAssayMaps.has_value())
-	{
-		return;
-	}
+	// 组合项目只读快照（无需拷贝）
+	auto spAssaySnapshot = assayMgr->GetAssaySnapshot();
+	const auto& ProfileAssayMaps = spAssaySnapshot->profileMap;
 
 	// 生化的序列关系
 	for (const auto& item : rawAssayInfo)
 	{
 		AssayButtonData assayBtnData;
-		auto iter = ProfileAssayMaps.value().find(item.id);
-		if (iter == ProfileAssayMaps.value().end())
+		auto iter = ProfileAssayMaps.find(item.id);
+		if (iter == ProfileAssayMaps.end())
 		{
 			continue;
 		}
@@ -1810,24 +1711,12 @@ bool QAssaySelectProcess::SetProfileCardInfo(int profileId, int postion)
 		return false;
 	}
 
-	auto ProfileAssayMaps = CommonInformationManager::GetInstance()->GetCommonProfileMap();
-	if (!ProfileAssayMaps.has_value())
-	{
-		return false;
-	}
-
-	auto iter = ProfileAssayMaps.value().find(profileId - UI_PROFILESTART);
-	if (iter == ProfileAssayMaps.value().end())
+	auto assayProfile = CommonInformationManager::GetInstance()->GetCommonProfile(profileId - UI_PROFILESTART);
+	if (Q_NULLPTR == assayProfile)
 	{
 		return false;
 	}
 
-	if (Q_NULLPTR == iter->second)
-	{
-		return false;
-	}
-	auto assayProfile = iter->second;
-
 	// 若项目之前没有被加入，则加入
 	auto iterAssay = m_currentButtons.find(profileId);
 	if (iterAssay == m_currentButtons.end())
@@ -3336,18 +3225,16 @@ void QAssayComBinSelectProcess::GenButtonCombinInfo(const std::vector<tf::Profil
 		return;
 	}
 
-	auto ProfileAssayMaps = assayMgr->GetCommonProfileMap();
-	if (!ProfileAssayMaps.has_value())
-	{
-		return;
-	}
+	// 组合项目只读快照（无需拷贝）
+	auto spAssaySnapshot = assayMgr->GetAssaySnapshot();
+	const auto& ProfileAssayMaps = spAssaySnapshot->profileMap;
 
 	// 生化的序列关系
 	for (const auto& item : rawAssayInfo)
 	{
 		AssayButtonData assayBtnData;
-		auto iter = ProfileAssayMaps.value().find(item.id);
-		if (iter == ProfileAssayMaps.value().end())
+		auto iter = ProfileAssayMaps.find(item.id);
+		if (iter == ProfileAssayMaps.end())
 		{
 			continue;
 		}
@@ -52,7 +52,8 @@
 #include "shared/CommonInformationManager.h"
 
 class QPushButton;
-class QGridLayout;
+class QVBoxLayout;
+class QAssayGridView;
 class QAssayCardPage;
 
 namespace Ui 
@@ -636,24 +637,10 @@ protected slots:
 	void OnUpdateButtonStatus(int index);
 
 private:
-	///
-	/// @brief 根据参数生成按钮的view
-	///
-	/// @param[in]  row		行
-	/// @param[in]  column  列
-	///
-	/// @return true:生成成功，反之：失败
-	///
-	/// @par History:
-	/// @li 5774/WuHongTao，2023年12月11日，新建函数
-	///
-	bool GenTemplateOfView(const int row = 5, const int column = 7);
-
-private:
-	std::vector<QAssaySelectButton*> m_buttonElements;			/// view对应的元素集合
+	QAssayGridView*					m_gridView;					///< 项目卡片网格（单控件自绘）
 	int								m_row;						///< 行数
 	int								m_column;					///< 列数
-	QGridLayout*					m_layout;
+	QVBoxLayout*					m_layout;
 	QButtonModel*					m_model;					///< 当前数据模
 };
 
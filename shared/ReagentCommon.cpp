@@ -1510,51 +1510,14 @@ int GetSupplyResidual(const ch::tf::SuppliesInfo& supplyInfo)
 
 int GetAvailableSupplyTimes(int supplyCode, const std::string& deviceSn)
 {
-	auto lstSupplies = CommonInformationManager::GetInstance()->GetChDiskReagentSupplies(deviceSn);
-	std::vector<ch::tf::SuppliesInfo> vecSupplies;
-	for (const auto &si : lstSupplies)
-	{
-		auto supply = si.second.supplyInfo;
-
-		// 要求液位探测成功、在用和备用
-		if (supply.liquidStatus == ::tf::LiquidStatus::LIQUID_STATUS_DETECT_FAIL || supply.suppliesCode != supplyCode
-			|| supply.usageStatus == tf::UsageStatus::USAGE_STATUS_CAN_NOT_USE)
-		{
-			continue;
-		}
-
-		vecSupplies.push_back(supply);
-	}
-
-	// 累加次数得到总次数
-	return std::accumulate(vecSupplies.begin(), vecSupplies.end(), 0, [=](int first, auto& member) {
-        return(first + GetSupplyResidual(member)); });
+	// 由余量状态引擎增量汇总（液位探测成功、在用和备用的耗材）
+	return CommonInformationManager::GetInstance()->GetReagentState().GetAvailableSupplyTimes(supplyCode, deviceSn);
 }
 
 int GetAvailableReagentTimes(int assayCode, const std::string& deviceSn)
 {
-	auto lstSupplies = CommonInformationManager::GetInstance()->GetChDiskReagentSupplies(deviceSn);
-	int useTimes = 0;
-	for (const auto& supply : lstSupplies)
-	{
-		// 耗材跳过
-		if (supply.second.reagentInfos.empty())
-		{
-			continue;
-		}
-
-		for (const auto& rgt : supply.second.reagentInfos)
-		{
-			// 要求试剂必须被校准过、液位探测成功的、可用
-			if (rgt.__isset.caliCurveId && rgt.caliCurveId != -1 && rgt.liquidStatus != ::tf::LiquidStatus::LIQUID_STATUS_DETECT_FAIL
-				&& rgt.assayCode == assayCode && rgt.usageStatus != tf::UsageStatus::USAGE_STATUS_CAN_NOT_USE)
-			{
-				useTimes += rgt.remainCount;
-			}
-		}
-	}
-
-	return useTimes;
+	// 由余量状态引擎增量汇总（已校准、液位探测成功、可用的试剂）
+	return CommonInformationManager::GetInstance()->GetReagentState().GetAvailableReagentTimes(assayCode, deviceSn);
 }
 
 ///
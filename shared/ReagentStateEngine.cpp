@@ -0,0 +1,226 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     ReagentStateEngine.cpp
+/// @brief    生化试剂/耗材余量状态引擎（增量汇总可用测试数）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+
+#include "ReagentStateEngine.h"
+#include "shared/ReagentCommon.h"
+
+void ReagentStateEngine::Clear()
+{
+    m_positions.clear();
+    m_assayRemain.clear();
+    m_devAssayAvailable.clear();
+    m_devSupplyAvailable.clear();
+}
+
+void ReagentStateEngine::RemoveDevice(const std::string& devSn)
+{
+    auto iterDev = m_positions.find(devSn);
+    if (iterDev == m_positions.end())
+    {
+        return;
+    }
+
+    for (const auto& item : iterDev->second)
+    {
+        Apply(devSn, item.second, -1);
+    }
+
+    m_positions.erase(iterDev);
+    m_devAssayAvailable.erase(devSn);
+    m_devSupplyAvailable.erase(devSn);
+}
+
+void ReagentStateEngine::UpdatePosition(const std::string& devSn, int pos, const std::vector<::ch::tf::ReagentGroup>& reagents, const ::ch::tf::SuppliesInfo& supply)
+{
+    auto& devPositions = m_positions[devSn];
+
+    // 先扣除旧的贡献
+    auto iterPos = devPositions.find(pos);
+    if (iterPos != devPositions.end())
+    {
+        Apply(devSn, iterPos->second, -1);
+    }
+
+    PositionContribution contribution = MakeContribution(reagents, supply);
+    Apply(devSn, contribution, 1);
+    devPositions[pos] = std::move(contribution);
+}
+
+void ReagentStateEngine::RemovePosition(const std::string& devSn, int pos)
+{
+    auto iterDev = m_positions.find(devSn);
+    if (iterDev == m_positions.end())
+    {
+        return;
+    }
+
+    auto iterPos = iterDev->second.find(pos);
+    if (iterPos == iterDev->second.end())
+    {
+        return;
+    }
+
+    Apply(devSn, iterPos->second, -1);
+    iterDev->second.erase(iterPos);
+}
+
+int ReagentStateEngine::GetAssayRemainCount(int assayCode) const
+{
+    auto iter = m_assayRemain.find(assayCode);
+    return iter == m_assayRemain.end() ? 0 : iter->second;
+}
+
+int ReagentStateEngine::GetAvailableReagentTimes(int assayCode, const std::string& devSn) const
+{
+    auto iterDev = m_devAssayAvailable.find(devSn);
+    if (iterDev == m_devAssayAvailable.end())
+    {
+        return 0;
+    }
+
+    auto iter = iterDev->second.find(assayCode);
+    return iter == iterDev->second.end() ? 0 : iter->second;
+}
+
+int ReagentStateEngine::GetAvailableSupplyTimes(int supplyCode, const std::string& devSn) const
+{
+    auto iterDev = m_devSupplyAvailable.find(devSn);
+    if (iterDev == m_devSupplyAvailable.end())
+    {
+        return 0;
+    }
+
+    auto iter = iterDev->second.find(supplyCode);
+    return iter == iterDev->second.end() ? 0 : iter->second;
+}
+
+bool ReagentStateEngine::CheckRemainCount(const std::map<int, int>& assayAndTimes) const
+{
+    // 遍历项目，检查当前试剂的剩余测试数是否满足项目的测试数
+    for (const auto& iter : assayAndTimes)
+    {
+        auto iterRemain = m_assayRemain.find(iter.first);
+        if (iterRemain == m_assayRemain.end() || iterRemain->second < iter.second)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void ReagentStateEngine::Apply(const std::string& devSn, const PositionContribution& contribution, int sign)
+{
+    for (const auto& item : contribution.remain)
+    {
+        Accumulate(m_assayRemain, item.first, sign * item.second);
+    }
+
+    if (!contribution.available.empty())
+    {
+        auto& devAvailable = m_devAssayAvailable[devSn];
+        for (const auto& item : contribution.available)
+        {
+            Accumulate(devAvailable, item.first, sign * item.second);
+        }
+    }
+
+    if (contribution.supplyCode >= 0)
+    {
+        Accumulate(m_devSupplyAvailable[devSn], contribution.supplyCode, sign * contribution.supplyResidual);
+    }
+}
+
+ReagentStateEngine::PositionContribution ReagentStateEngine::MakeContribution(const std::vector<::ch::tf::ReagentGroup>& reagents, const ::ch::tf::SuppliesInfo& supply)
+{
+    PositionContribution contribution;
+    contribution.remain.reserve(reagents.size());
+
+    for (const auto& rgt : reagents)
+    {
+        // 剩余测试数（负数按0统计）
+        contribution.remain.emplace_back(rgt.assayCode, rgt.remainCount > 0 ? rgt.remainCount : 0);
+
+        // 要求试剂必须被校准过、液位探测成功的、可用
+        if (rgt.__isset.caliCurveId && rgt.caliCurveId != -1 && rgt.liquidStatus != ::tf::LiquidStatus::LIQUID_STATUS_DETECT_FAIL
+            && rgt.usageStatus != tf::UsageStatus::USAGE_STATUS_CAN_NOT_USE)
+        {
+            contribution.available.emplace_back(rgt.assayCode, rgt.remainCount);
+        }
+    }
+
+    // 要求耗材液位探测成功、在用和备用
+    if (supply.liquidStatus != ::tf::LiquidStatus::LIQUID_STATUS_DETECT_FAIL
+        && supply.usageStatus != tf::UsageStatus::USAGE_STATUS_CAN_NOT_USE)
+    {
+        contribution.supplyCode = supply.suppliesCode;
+        contribution.supplyResidual = GetSupplyResidual(supply);
+    }
+
+    return contribution;
+}
+
+template<typename Key>
+void ReagentStateEngine::Accumulate(std::map<Key, int>& totals, const Key& key, int delta)
+{
+    if (delta == 0)
+    {
+        return;
+    }
+
+    auto iter = totals.find(key);
+    if (iter == totals.end())
+    {
+        totals.emplace(key, delta);
+        return;
+    }
+
+    iter->second += delta;
+    if (iter->second == 0)
+    {
+        totals.erase(iter);
+    }
+}
@@ -0,0 +1,188 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     ReagentStateEngine.h
+/// @brief    生化试剂/耗材余量状态引擎（增量汇总可用测试数）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include "src/thrift/ch/gen-cpp/ch_types.h"
+
+///
+/// @brief
+///     生化试剂盘余量状态引擎
+///     按（设备，位置）记录每个位置对各项目/耗材的贡献，位置更新时只减去旧贡献、加上新贡献，
+///     使项目剩余测试数、设备可用测试数的查询与试剂盘规模无关
+///
+class ReagentStateEngine
+{
+public:
+    ReagentStateEngine() = default;
+
+    ///
+    /// @brief 清空所有状态
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Clear();
+
+    ///
+    /// @brief 移除设备的所有位置
+    ///
+    /// @param[in]  devSn  设备序列号
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void RemoveDevice(const std::string& devSn);
+
+    ///
+    /// @brief 更新试剂盘位置（位置已有内容时先减去旧贡献）
+    ///
+    /// @param[in]  devSn       设备序列号
+    /// @param[in]  pos         位置
+    /// @param[in]  reagents    该位置的试剂组
+    /// @param[in]  supply      该位置的耗材信息
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void UpdatePosition(const std::string& devSn, int pos, const std::vector<::ch::tf::ReagentGroup>& reagents, const ::ch::tf::SuppliesInfo& supply);
+
+    ///
+    /// @brief 移除试剂盘位置（卸载）
+    ///
+    /// @param[in]  devSn  设备序列号
+    /// @param[in]  pos    位置
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void RemovePosition(const std::string& devSn, int pos);
+
+    ///
+    /// @brief 获取所有设备上项目的剩余测试数（不区分是否校准、是否可用）
+    ///
+    /// @param[in]  assayCode  项目编号
+    ///
+    /// @return 剩余测试数
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    int GetAssayRemainCount(int assayCode) const;
+
+    ///
+    /// @brief 获取设备上项目的可用测试数（已校准、液位探测成功、可用的试剂）
+    ///
+    /// @param[in]  assayCode  项目编号
+    /// @param[in]  devSn      设备序列号
+    ///
+    /// @return 可用测试数
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    int GetAvailableReagentTimes(int assayCode, const std::string& devSn) const;
+
+    ///
+    /// @brief 获取设备上仓内耗材的可用余量（液位探测成功、可用的耗材）
+    ///
+    /// @param[in]  supplyCode  耗材编号
+    /// @param[in]  devSn       设备序列号
+    ///
+    /// @return 可用余量
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    int GetAvailableSupplyTimes(int supplyCode, const std::string& devSn) const;
+
+    ///
+    /// @brief 检查所有设备上的试剂剩余测试数是否满足项目的测试次数
+    ///
+    /// @param[in]  assayAndTimes  项目编号--测试次数
+    ///
+    /// @return 全部满足返回true
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool CheckRemainCount(const std::map<int, int>& assayAndTimes) const;
+
+private:
+    // 一个试剂盘位置对汇总表的贡献
+    struct PositionContribution
+    {
+        std::vector<std::pair<int, int>> remain;        ///< 项目编号--剩余测试数
+        std::vector<std::pair<int, int>> available;     ///< 项目编号--可用测试数
+        int                 supplyCode = -1;            ///< 可用耗材编号（无则为-1）
+        int                 supplyResidual = 0;         ///< 可用耗材余量
+    };
+
+    ///
+    /// @brief 将位置贡献累加到汇总表（sign为1累加，为-1扣除）
+    ///
+    void Apply(const std::string& devSn, const PositionContribution& contribution, int sign);
+
+    ///
+    /// @brief 构造位置贡献
+    ///
+    static PositionContribution MakeContribution(const std::vector<::ch::tf::ReagentGroup>& reagents, const ::ch::tf::SuppliesInfo& supply);
+
+    ///
+    /// @brief 按键累加，结果为0时删除键，保持汇总表紧凑
+    ///
+    template<typename Key>
+    static void Accumulate(std::map<Key, int>& totals, const Key& key, int delta);
+
+private:
+    std::map<std::string, std::map<int, PositionContribution>> m_positions;    ///< 设备--（位置--贡献）
+    std::map<int, int>                                  m_assayRemain;          ///< 项目编号--所有设备剩余测试数
+    std::map<std::string, std::map<int, int>>           m_devAssayAvailable;    ///< 设备--（项目编号--可用测试数）
+    std::map<std::string, std::map<int, int>>           m_devSupplyAvailable;   ///< 设备--（耗材编号--可用余量）
+};
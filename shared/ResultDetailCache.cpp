@@ -0,0 +1,520 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     ResultDetailCache.cpp
+/// @brief    生化结果详情缓存（结果和反应曲线点的紧凑存储，相邻行异步预取）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#include "ResultDetailCache.h"
+#include <limits>
+#include <QtConcurrent/QtConcurrent>
+#include "shared/CommonInformationManager.h"
+#include "shared/messagebus.h"
+#include "shared/msgiddef.h"
+#include "thrift/ch/c1005/C1005LogicControlProxy.h"
+#include "src/common/Mlog/mlog.h"
+
+// 预取线程数
+#define RESULT_PREFETCH_THREADS         (2)
+// 缓存上限（测光点数）
+#define RESULT_CACHE_MAX_POINTS         (200 * 1024)
+// 项目到结果列表的上限
+#define RESULT_CACHE_MAX_TESTITEMS      (20000)
+// 失效记录的上限
+#define RESULT_CACHE_MAX_STAMPS         (20000)
+
+ResultDetailCache::ResultDetailCache()
+    : m_generation(0)
+    , m_stampFloor(0)
+{
+    m_pool.setMaxThreadCount(RESULT_PREFETCH_THREADS);
+    m_results.setMaxCost(RESULT_CACHE_MAX_POINTS);
+
+    REGISTER_HANDLER(MSG_ID_SAMPLE_TEST_ITEM_UPDATE, this, OnTestItemUpdate);
+}
+
+ResultDetailCache::~ResultDetailCache()
+{
+    m_pool.clear();
+    m_pool.waitForDone();
+}
+
+///
+/// @brief 获取单例
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+ResultDetailCache& ResultDetailCache::GetInstance()
+{
+    static ResultDetailCache instance;
+    return instance;
+}
+
+///
+/// @brief 根据结果ID获取生化结果（未命中时同步查询并缓存）
+///
+/// @param[in]  resultId  结果ID
+///
+/// @return 结果，查询失败返回空
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::shared_ptr<const ch::tf::AssayTestResult> ResultDetailCache::GetChResult(int64_t resultId)
+{
+    if (resultId <= 0)
+    {
+        return nullptr;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto entry = m_results.object(resultId);
+        if (entry != nullptr)
+        {
+            return entry->result;
+        }
+    }
+
+    ch::tf::AssayTestResultQueryResp qryResp;
+    ch::tf::AssayTestResultQueryCond qryCond;
+    qryCond.__set_id(resultId);
+    if (!ch::c1005::LogicControlProxy::QueryAssayTestResult(qryResp, qryCond)
+        || qryResp.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS
+        || qryResp.lstAssayTestResult.empty())
+    {
+        ULOG(LOG_ERROR, "%s(query assay test result failed, id: %lld)", __FUNCTION__, resultId);
+        return nullptr;
+    }
+
+    auto spResult = std::make_shared<const ch::tf::AssayTestResult>(std::move(qryResp.lstAssayTestResult[0]));
+    std::lock_guard<std::mutex> lock(m_mutex);
+    InsertLocked(spResult, nullptr);
+    return spResult;
+}
+
+///
+/// @brief 根据项目获取其所有生化结果（未命中时同步查询并缓存）
+///
+/// @param[in]  testItemId  项目ID
+/// @param[in]  assayCode   项目编号
+/// @param[out] results     结果列表（与后台返回的顺序一致）
+///
+/// @return true:成功
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool ResultDetailCache::GetChResultsByTestItem(int64_t testItemId, int assayCode, std::vector<ch::tf::AssayTestResult>& results)
+{
+    results.clear();
+    quint64 generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        generation = m_generation;
+        auto iter = m_testItemResults.find(testItemId);
+        if (iter != m_testItemResults.end())
+        {
+            // 任意一个结果被淘汰都需要重新查询
+            bool complete = true;
+            for (auto resultId : iter.value())
+            {
+                auto entry = m_results.object(resultId);
+                if (entry == nullptr)
+                {
+                    complete = false;
+                    break;
+                }
+
+                results.push_back(*entry->result);
+            }
+
+            if (complete)
+            {
+                return true;
+            }
+
+            results.clear();
+            m_testItemResults.erase(iter);
+        }
+    }
+
+    if (!QueryChResults(testItemId, assayCode, results))
+    {
+        return false;
+    }
+
+    InsertTestItemResults(testItemId, results, generation);
+    return true;
+}
+
+///
+/// @brief 获取结果的反应曲线（每个结果只解析一次）
+///
+/// @param[in]  result  生化结果
+///
+/// @return 反应曲线，没有主波长时返回空
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::shared_ptr<const ChReactionCurve> ResultDetailCache::GetChReactionCurve(const ch::tf::AssayTestResult& result)
+{
+    if (result.id > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto entry = m_results.object(result.id);
+        if (entry != nullptr && entry->curve != nullptr)
+        {
+            return entry->curve;
+        }
+    }
+
+    auto curve = BuildCurve(result);
+    if (curve == nullptr || result.id <= 0)
+    {
+        return curve;
+    }
+
+    // 测光点只有结果完成时才会写入，同一ID的曲线不会再变化
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto entry = m_results.object(result.id);
+    if (entry != nullptr)
+    {
+        entry->curve = curve;
+    }
+
+    return curve;
+}
+
+///
+/// @brief 异步预取项目的结果（只处理生化项目，已缓存或正在预取的跳过）
+///
+/// @param[in]  testItems  项目列表
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ResultDetailCache::PrefetchTestItems(const std::vector<std::shared_ptr<tf::TestItem>>& testItems)
+{
+    auto spCommMgr = CommonInformationManager::GetInstance();
+    for (const auto& testItem : testItems)
+    {
+        if (testItem == nullptr || testItem->id <= 0)
+        {
+            continue;
+        }
+
+        // 没有结果的项目不需要预取
+        if (!testItem->__isset.firstTestResultKey || testItem->firstTestResultKey.assayTestResultId <= 0)
+        {
+            continue;
+        }
+
+        // 只处理生化项目（在界面线程中判断，避免工作线程访问项目配置）
+        auto spAssayInfo = spCommMgr->GetAssayInfo(testItem->assayCode);
+        if (spAssayInfo == nullptr || spAssayInfo->assayClassify != tf::AssayClassify::ASSAY_CLASSIFY_CHEMISTRY)
+        {
+            continue;
+        }
+
+        int64_t testItemId = testItem->id;
+        int assayCode = testItem->assayCode;
+        quint64 generation = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_testItemResults.contains(testItemId) || m_pending.contains(testItemId))
+            {
+                continue;
+            }
+
+            m_pending.insert(testItemId);
+            generation = m_generation;
+        }
+
+        QtConcurrent::run(&m_pool, [this, testItemId, assayCode, generation]()
+        {
+            std::vector<ch::tf::AssayTestResult> results;
+            if (QueryChResults(testItemId, assayCode, results))
+            {
+                // 在工作线程中把曲线也解析好，界面打开时直接绘制
+                InsertTestItemResults(testItemId, results, generation);
+                for (const auto& result : results)
+                {
+                    GetChReactionCurve(result);
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending.remove(testItemId);
+        });
+    }
+}
+
+///
+/// @brief 使结果失效（结果被编辑后调用）
+///
+/// @param[in]  resultId  结果ID
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ResultDetailCache::InvalidateResult(int64_t resultId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    StampInvalidatedLocked(m_resultStamps, resultId);
+    m_results.remove(resultId);
+}
+
+///
+/// @brief 使项目及其结果失效
+///
+/// @param[in]  testItemId  项目ID
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ResultDetailCache::InvalidateTestItem(int64_t testItemId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    StampInvalidatedLocked(m_itemStamps, testItemId);
+    auto iter = m_testItemResults.find(testItemId);
+    if (iter == m_testItemResults.end())
+    {
+        return;
+    }
+
+    for (auto resultId : iter.value())
+    {
+        m_results.remove(resultId);
+    }
+
+    m_testItemResults.erase(iter);
+}
+
+///
+/// @brief 项目信息更新（复查、删除、修改结果后都会更新项目）
+///
+/// @param[in]  enUpdateType  更新类型
+/// @param[in]  vSIs          项目列表
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ResultDetailCache::OnTestItemUpdate(tf::UpdateType::type enUpdateType, std::vector<tf::TestItem, std::allocator<tf::TestItem>> vSIs)
+{
+    // 新增的项目还没有结果
+    if (enUpdateType == tf::UpdateType::UPDATE_TYPE_ADD)
+    {
+        return;
+    }
+
+    for (const auto& testItem : vSIs)
+    {
+        InvalidateTestItem(testItem.id);
+
+        // 按ID缓存的初测、复查结果也一并失效
+        if (testItem.__isset.firstTestResultKey)
+        {
+            InvalidateResult(testItem.firstTestResultKey.assayTestResultId);
+        }
+
+        if (testItem.__isset.lastTestResultKey)
+        {
+            InvalidateResult(testItem.lastTestResultKey.assayTestResultId);
+        }
+    }
+}
+
+///
+/// @brief 按项目查询生化结果
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool ResultDetailCache::QueryChResults(int64_t testItemId, int assayCode, std::vector<ch::tf::AssayTestResult>& results)
+{
+    ch::tf::AssayTestResultQueryCond queryAssaycond;
+    ch::tf::AssayTestResultQueryResp assayTestResult;
+    queryAssaycond.__set_testItemId(testItemId);
+    queryAssaycond.__set_assayCode(assayCode);
+    if (!ch::c1005::LogicControlProxy::QueryAssayTestResult(assayTestResult, queryAssaycond)
+        || assayTestResult.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS)
+    {
+        ULOG(LOG_ERROR, "Failed to query ch testresult, by id:%lld, assayCode:%d.", testItemId, assayCode);
+        return false;
+    }
+
+    results = std::move(assayTestResult.lstAssayTestResult);
+    return true;
+}
+
+///
+/// @brief 解析反应曲线
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::shared_ptr<const ChReactionCurve> ResultDetailCache::BuildCurve(const ch::tf::AssayTestResult& result)
+{
+    if (result.primarySubWaves.empty())
+    {
+        return nullptr;
+    }
+
+    const float invalid = std::numeric_limits<float>::quiet_NaN();
+    int primaryWave = result.primarySubWaves[0];
+    bool hasSecond = (result.primarySubWaves.size() >= 2);
+    int secondWave = hasSecond ? result.primarySubWaves[1] : -1;
+
+    auto curve = std::make_shared<ChReactionCurve>();
+    curve->pointSN.reserve(result.detectPoints.size());
+    curve->primary.reserve(result.detectPoints.size());
+    if (hasSecond)
+    {
+        curve->secondary.reserve(result.detectPoints.size());
+    }
+
+    for (const auto& detectPoint : result.detectPoints)
+    {
+        curve->pointSN.push_back(float(detectPoint.pointSN));
+        auto iter = detectPoint.ods.find(primaryWave);
+        curve->primary.push_back(iter != detectPoint.ods.end() ? float(iter->second) : invalid);
+        if (hasSecond)
+        {
+            iter = detectPoint.ods.find(secondWave);
+            curve->secondary.push_back(iter != detectPoint.ods.end() ? float(iter->second) : invalid);
+        }
+    }
+
+    return curve;
+}
+
+///
+/// @brief 放入缓存（调用者持有m_mutex）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ResultDetailCache::InsertLocked(const std::shared_ptr<const ch::tf::AssayTestResult>& spResult, const std::shared_ptr<const ChReactionCurve>& curve)
+{
+    if (spResult == nullptr || spResult->id <= 0)
+    {
+        return;
+    }
+
+    auto entry = new Entry();
+    entry->result = spResult;
+    entry->curve = curve;
+    m_results.insert(spResult->id, entry, int(spResult->detectPoints.size()) + 1);
+}
+
+///
+/// @brief 放入项目的全部结果（查询开始后该项目或其结果被失效时丢弃，避免把失效前的旧结果放回）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ResultDetailCache::InsertTestItemResults(int64_t testItemId, const std::vector<ch::tf::AssayTestResult>& results, quint64 generation)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // 只比较本项目和本项目的结果，其他项目的失效不影响预取
+    auto invalidatedAfter = [generation](const QHash<qint64, quint64>& stamps, qint64 id)
+    {
+        auto iter = stamps.constFind(id);
+        return iter != stamps.cend() && iter.value() > generation;
+    };
+
+    if (generation < m_stampFloor || invalidatedAfter(m_itemStamps, testItemId))
+    {
+        return;
+    }
+
+    for (const auto& result : results)
+    {
+        if (invalidatedAfter(m_resultStamps, result.id))
+        {
+            return;
+        }
+    }
+
+    // 结果被淘汰后项目列表会残留，超过上限时整体清理
+    if (m_testItemResults.size() >= RESULT_CACHE_MAX_TESTITEMS)
+    {
+        m_testItemResults.clear();
+    }
+
+    QVector<qint64> resultIds;
+    resultIds.reserve(int(results.size()));
+    for (const auto& result : results)
+    {
+        auto entry = m_results.object(result.id);
+        InsertLocked(std::make_shared<const ch::tf::AssayTestResult>(result), entry != nullptr ? entry->curve : nullptr);
+        resultIds.push_back(result.id);
+    }
+
+    m_testItemResults[testItemId] = resultIds;
+}
+
+///
+/// @brief 记录失效时的计数（调用者持有m_mutex），记录过多时整体清理并抬高下限
+///
+/// @param[in]  stamps  失效记录
+/// @param[in]  id      项目ID或结果ID
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ResultDetailCache::StampInvalidatedLocked(QHash<qint64, quint64>& stamps, qint64 id)
+{
+    ++m_generation;
+    if (m_itemStamps.size() + m_resultStamps.size() >= RESULT_CACHE_MAX_STAMPS)
+    {
+        // 清理前开始的查询无法再判断，统一丢弃
+        m_itemStamps.clear();
+        m_resultStamps.clear();
+        m_stampFloor = m_generation;
+    }
+
+    stamps[id] = m_generation;
+}
@@ -0,0 +1,227 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     ResultDetailCache.h
+/// @brief    生化结果详情缓存（结果和反应曲线点的紧凑存储，相邻行异步预取）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <QObject>
+#include <QCache>
+#include <QHash>
+#include <QSet>
+#include <QVector>
+#include <QThreadPool>
+#include "src/thrift/gen-cpp/defs_types.h"
+#include "src/thrift/ch/gen-cpp/ch_types.h"
+
+///
+/// @brief 生化反应曲线（紧凑存储，可直接用于绘图）
+///     每个测光点一项，缺少对应波长吸光度的点记为NaN
+///
+struct ChReactionCurve
+{
+    std::vector<float>      pointSN;            ///< 测光点编号
+    std::vector<float>      primary;            ///< 主波长吸光度
+    std::vector<float>      secondary;          ///< 次波长吸光度（单波长时为空）
+
+    ///
+    /// @brief 是否有次波长
+    ///
+    bool HasSecondary() const { return !secondary.empty(); }
+
+    ///
+    /// @brief 估算占用的内存（字节）
+    ///
+    int Bytes() const { return int((pointSN.size() + primary.size() + secondary.size()) * sizeof(float)); }
+};
+
+///
+/// @brief 生化结果详情缓存
+///     结果详情、反应曲线对话框按结果ID和项目ID取结果，命中时不再访问后台；
+///     反应曲线点在首次使用时解析为ChReactionCurve，之后直接绘制；
+///     结果详情翻页时在线程池中预取相邻行的结果，项目更新时失效
+///
+class ResultDetailCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    ///
+    /// @brief 获取单例
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static ResultDetailCache& GetInstance();
+    ~ResultDetailCache();
+
+    ///
+    /// @brief 根据结果ID获取生化结果（未命中时同步查询并缓存）
+    ///
+    /// @param[in]  resultId  结果ID
+    ///
+    /// @return 结果，查询失败返回空
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::shared_ptr<const ch::tf::AssayTestResult> GetChResult(int64_t resultId);
+
+    ///
+    /// @brief 根据项目获取其所有生化结果（未命中时同步查询并缓存）
+    ///
+    /// @param[in]  testItemId  项目ID
+    /// @param[in]  assayCode   项目编号
+    /// @param[out] results     结果列表（与后台返回的顺序一致）
+    ///
+    /// @return true:成功
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool GetChResultsByTestItem(int64_t testItemId, int assayCode, std::vector<ch::tf::AssayTestResult>& results);
+
+    ///
+    /// @brief 获取结果的反应曲线（每个结果只解析一次）
+    ///
+    /// @param[in]  result  生化结果
+    ///
+    /// @return 反应曲线，没有主波长时返回空
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::shared_ptr<const ChReactionCurve> GetChReactionCurve(const ch::tf::AssayTestResult& result);
+
+    ///
+    /// @brief 异步预取项目的结果（只处理生化项目，已缓存或正在预取的跳过）
+    ///
+    /// @param[in]  testItems  项目列表
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void PrefetchTestItems(const std::vector<std::shared_ptr<tf::TestItem>>& testItems);
+
+    ///
+    /// @brief 使结果失效（结果被编辑后调用）
+    ///
+    /// @param[in]  resultId  结果ID
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void InvalidateResult(int64_t resultId);
+
+    ///
+    /// @brief 使项目及其结果失效
+    ///
+    /// @param[in]  testItemId  项目ID
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void InvalidateTestItem(int64_t testItemId);
+
+protected Q_SLOTS:
+    ///
+    /// @brief 项目信息更新（复查、删除、修改结果后都会更新项目）
+    ///
+    /// @param[in]  enUpdateType  更新类型
+    /// @param[in]  vSIs          项目列表
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnTestItemUpdate(tf::UpdateType::type enUpdateType, std::vector<tf::TestItem, std::allocator<tf::TestItem>> vSIs);
+
+private:
+    ResultDetailCache();
+
+    ///
+    /// @brief 缓存项
+    ///
+    struct Entry
+    {
+        std::shared_ptr<const ch::tf::AssayTestResult>  result;     ///< 结果
+        std::shared_ptr<const ChReactionCurve>          curve;      ///< 反应曲线（首次使用时解析）
+    };
+
+    ///
+    /// @brief 按项目查询生化结果
+    ///
+    static bool QueryChResults(int64_t testItemId, int assayCode, std::vector<ch::tf::AssayTestResult>& results);
+
+    ///
+    /// @brief 解析反应曲线
+    ///
+    static std::shared_ptr<const ChReactionCurve> BuildCurve(const ch::tf::AssayTestResult& result);
+
+    ///
+    /// @brief 放入缓存（调用者持有m_mutex）
+    ///
+    void InsertLocked(const std::shared_ptr<const ch::tf::AssayTestResult>& spResult, const std::shared_ptr<const ChReactionCurve>& curve);
+
+    ///
+    /// @brief 放入项目的全部结果（查询开始后该项目或其结果被失效时丢弃，避免把失效前的旧结果放回）
+    ///
+    void InsertTestItemResults(int64_t testItemId, const std::vector<ch::tf::AssayTestResult>& results, quint64 generation);
+
+    ///
+    /// @brief 记录失效时的计数（调用者持有m_mutex），记录过多时整体清理并抬高下限
+    ///
+    void StampInvalidatedLocked(QHash<qint64, quint64>& stamps, qint64 id);
+
+private:
+    QThreadPool                         m_pool;             ///< 预取线程池
+    std::mutex                          m_mutex;            ///< 保护以下缓存
+    QCache<qint64, Entry>               m_results;          ///< 结果ID到缓存项（代价单位为测光点数）
+    QHash<qint64, QVector<qint64>>      m_testItemResults;  ///< 项目ID到结果ID列表
+    QSet<qint64>                        m_pending;          ///< 正在预取的项目ID
+    quint64                             m_generation;       ///< 失效计数
+    QHash<qint64, quint64>              m_itemStamps;       ///< 项目ID到最近一次失效时的计数
+    QHash<qint64, quint64>              m_resultStamps;     ///< 结果ID到最近一次失效时的计数
+    quint64                             m_stampFloor;       ///< 失效记录清理时的计数（更早开始的查询一律丢弃）
+};
@@ -0,0 +1,527 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     StatisticsRollupStore.cpp
+/// @brief    统计页面的按时间分桶汇总缓存
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#include "StatisticsRollupStore.h"
+#include <algorithm>
+#include <sstream>
+#include <tuple>
+#include <set>
+#include <QDateTime>
+#include "shared/messagebus.h"
+#include "shared/msgiddef.h"
+#include "shared/uidef.h"
+#include "thrift/DcsControlProxy.h"
+#include "src/common/Mlog/mlog.h"
+
+// 每类统计最多缓存的查询条件数，超出后清空该类缓存
+#define ROLLUP_MAX_SIGNATURES       (32)
+
+namespace
+{
+    ///
+    /// @brief 时间段的起止时间字符串（与统计页面的格式一致）
+    ///
+    std::string StartTimeString(const QDate& date)
+    {
+        return date.toString("yyyy/MM/dd").toStdString() + " 00:00:00";
+    }
+
+    std::string EndTimeString(const QDate& date)
+    {
+        return date.toString("yyyy/MM/dd").toStdString() + " 23:59:59";
+    }
+
+    ///
+    /// @brief 界面格式时间字符串的日期，格式不正确时返回无效日期
+    ///
+    QDate DateOfTime(const std::string& time)
+    {
+        return QDateTime::fromString(QString::fromStdString(time), UI_DATE_TIME_FORMAT).date();
+    }
+
+    ///
+    /// @brief 将条件列表排序后拼接，作为查询条件签名的一部分
+    ///
+    template<typename T>
+    std::string JoinSorted(std::vector<T> values)
+    {
+        std::sort(values.begin(), values.end());
+        std::ostringstream oss;
+        for (const auto& value : values)
+        {
+            oss << value << ",";
+        }
+        return oss.str();
+    }
+
+    ///
+    /// @brief 按键合并可加的统计行
+    ///
+    template<typename Row, typename KeyFunc, typename AddFunc>
+    std::vector<Row> MergeRows(const std::vector<Row>& rows, KeyFunc keyOf, AddFunc add)
+    {
+        std::vector<Row> merged;
+        std::map<decltype(keyOf(rows.front())), size_t> index;
+        for (const Row& row : rows)
+        {
+            auto key = keyOf(row);
+            auto it = index.find(key);
+            if (it == index.end())
+            {
+                index.emplace(key, merged.size());
+                merged.push_back(row);
+                continue;
+            }
+
+            add(merged[it->second], row);
+        }
+
+        return merged;
+    }
+}
+
+StatisticsRollupStore::StatisticsRollupStore()
+{
+    REGISTER_HANDLER(MSG_ID_SAMPLE_INFO_UPDATE, this, OnSampleUpdate);
+    REGISTER_HANDLER(MSG_ID_IM_CALI_END, this, OnImCaliEnd);
+}
+
+///
+/// @brief 获取单例
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+StatisticsRollupStore& StatisticsRollupStore::GetInstance()
+{
+    static StatisticsRollupStore s_store;
+    return s_store;
+}
+
+///
+/// @brief 清空所有缓存
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void StatisticsRollupStore::Clear()
+{
+    m_sampleTab.clear();
+    m_samplePie.clear();
+    m_caliTab.clear();
+}
+
+///
+/// @brief 查询条件数超出上限时清空该类缓存，返回查询条件对应的缓存
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+template<typename Row>
+StatisticsRollupStore::BucketMap<Row>& StatisticsRollupStore::BucketsOf(RollupTable<Row>& table, const std::string& signature)
+{
+    if (table.size() >= ROLLUP_MAX_SIGNATURES && table.find(signature) == table.end())
+    {
+        table.clear();
+    }
+
+    return table[signature];
+}
+
+///
+/// @brief 按时间段收集可加的结果，已结束日期中未缓存的连续时间段合并为一次fetch查询
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+template<typename Row, typename FetchFunc>
+bool StatisticsRollupStore::CollectAdditive(RollupTable<Row>& table, const std::string& signature,
+    const QDate& startDate, const QDate& endDate, FetchFunc fetch, std::vector<Row>& rows)
+{
+    BucketMap<Row>& buckets = BucketsOf(table, signature);
+    const QDate today = QDate::currentDate();
+    const QDate closedEnd = std::min(endDate, today.addDays(-1));
+    int hitCount = 0;
+    int queryCount = 0;
+
+    // 已结束的日期：命中缓存的时间段直接使用，其余连续的日期合并为一次查询后缓存
+    QDate date = startDate;
+    while (date.isValid() && date <= closedEnd)
+    {
+        auto it = buckets.find(date);
+        if (it != buckets.end() && it->second.first <= closedEnd)
+        {
+            rows.insert(rows.end(), it->second.second.begin(), it->second.second.end());
+            date = it->second.first.addDays(1);
+            hitCount++;
+            continue;
+        }
+
+        QDate runEnd = closedEnd;
+        auto itNext = buckets.upper_bound(date);
+        if (itNext != buckets.end() && itNext->first <= closedEnd)
+        {
+            runEnd = itNext->first.addDays(-1);
+        }
+
+        std::vector<Row> runRows;
+        queryCount++;
+        if (!fetch(date, runEnd, runRows))
+        {
+            return false;
+        }
+
+        rows.insert(rows.end(), runRows.begin(), runRows.end());
+        buckets[date] = std::make_pair(runEnd, std::move(runRows));
+        date = runEnd.addDays(1);
+    }
+
+    // 当天及以后的数据还在变化，每次精确查询
+    if (endDate >= today)
+    {
+        std::vector<Row> openRows;
+        queryCount++;
+        if (!fetch(std::max(startDate, today), endDate, openRows))
+        {
+            return false;
+        }
+
+        rows.insert(rows.end(), openRows.begin(), openRows.end());
+    }
+
+    ULOG(LOG_INFO, "%s(cached ranges: %d, queried ranges: %d)", __FUNCTION__, hitCount, queryCount);
+    return true;
+}
+
+///
+/// @brief 整个时间段精确查询一次（用于不可加的结果），已结束的时间段按起止日期缓存
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+template<typename Row, typename FetchFunc>
+bool StatisticsRollupStore::CollectExact(RollupTable<Row>& table, const std::string& signature,
+    const QDate& startDate, const QDate& endDate, FetchFunc fetch, std::vector<Row>& rows)
+{
+    // 截止日期不同的时间段分别缓存（不能由其他时间段的结果推算）
+    std::string rangeSignature = signature + "|" + startDate.toString("yyyyMMdd").toStdString()
+        + "-" + endDate.toString("yyyyMMdd").toStdString();
+    auto itTable = table.find(rangeSignature);
+    if (itTable != table.end())
+    {
+        auto it = itTable->second.find(startDate);
+        if (it != itTable->second.end() && it->second.first == endDate)
+        {
+            rows.insert(rows.end(), it->second.second.begin(), it->second.second.end());
+            return true;
+        }
+    }
+
+    std::vector<Row> rangeRows;
+    if (!fetch(startDate, endDate, rangeRows))
+    {
+        return false;
+    }
+
+    rows.insert(rows.end(), rangeRows.begin(), rangeRows.end());
+
+    // 当天及以后的数据还在变化，不缓存
+    if (endDate < QDate::currentDate())
+    {
+        BucketsOf(table, rangeSignature)[startDate] = std::make_pair(endDate, std::move(rangeRows));
+    }
+
+    return true;
+}
+
+///
+/// @brief 删除各查询条件下包含指定日期的时间段
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+template<typename Row>
+void StatisticsRollupStore::InvalidateDate(RollupTable<Row>& table, const QDate& date)
+{
+    for (auto& item : table)
+    {
+        // 不同起止的时间段可能重叠，逐个检查起始日期不晚于该日期的时间段
+        BucketMap<Row>& buckets = item.second;
+        auto itEnd = buckets.upper_bound(date);
+        for (auto it = buckets.begin(); it != itEnd;)
+        {
+            it = (it->second.first >= date) ? buckets.erase(it) : std::next(it);
+        }
+    }
+}
+
+///
+/// @brief 查询样本量统计表（按模块、试剂批号、项目汇总）
+///
+/// @param[out] rows       统计结果
+/// @param[in]  queryCond  查询条件（起止时间由startDate、endDate决定）
+/// @param[in]  startDate  起始日期
+/// @param[in]  endDate    截止日期（包含）
+///
+/// @return true:查询成功
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool StatisticsRollupStore::QuerySampleStatisTab(std::vector<::tf::SampleStatisTabData>& rows, const ::tf::SampleStatisTabDataQueryCond& queryCond,
+    const QDate& startDate, const QDate& endDate)
+{
+    std::string signature = JoinSorted(queryCond.vecDeviceSN) + "|" + JoinSorted(queryCond.vecReagentLot);
+    auto fetch = [&queryCond](const QDate& start, const QDate& end, std::vector<::tf::SampleStatisTabData>& bucketRows)
+    {
+        ::tf::SampleStatisTabDataQueryCond cond = queryCond;
+        cond.__set_startTime(StartTimeString(start));
+        cond.__set_endTime(EndTimeString(end));
+        ::tf::SampleStatisTabQueryResp ret;
+        if (!DcsControlProxy::GetInstance()->QuerySampleStatisTab(ret, cond))
+        {
+            ULOG(LOG_ERROR, "QuerySampleStatisTab Failed");
+            return false;
+        }
+
+        bucketRows = std::move(ret.lstSampleStatisTabDatas);
+        return true;
+    };
+
+    // 样本数按样本去重，各时间段不可加，整个时间段精确查询
+    rows.clear();
+    return CollectExact(m_sampleTab, signature, startDate, endDate, fetch, rows);
+}
+
+///
+/// @brief 查询样本量饼状图
+///
+/// @param[out] pieData    统计结果
+/// @param[in]  queryCond  查询条件（起止时间由startDate、endDate决定）
+/// @param[in]  startDate  起始日期
+/// @param[in]  endDate    截止日期（包含）
+///
+/// @return true:查询成功且有数据
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool StatisticsRollupStore::QuerySampleStatisPie(::tf::SampleStatisPieData& pieData, const ::tf::SampleStatisPieQueryCond& queryCond,
+    const QDate& startDate, const QDate& endDate)
+{
+    std::string signature = JoinSorted(queryCond.vecDeviceSN) + "|" + JoinSorted(queryCond.vecReagentLot);
+    auto fetch = [&queryCond](const QDate& start, const QDate& end, std::vector<::tf::SampleStatisPieData>& bucketRows)
+    {
+        ::tf::SampleStatisPieQueryCond cond = queryCond;
+        cond.__set_startTime(StartTimeString(start));
+        cond.__set_endTime(EndTimeString(end));
+        ::tf::SampleStatisPieQueryResp ret;
+        if (!DcsControlProxy::GetInstance()->QuerySampleStatisPie(ret, cond))
+        {
+            ULOG(LOG_ERROR, "QuerySampleStatisPie Failed");
+            return false;
+        }
+
+        bucketRows = std::move(ret.lstSampleStatisPieDatas);
+        return true;
+    };
+
+    // 样本数按样本去重，各时间段不可加，整个时间段精确查询
+    std::vector<::tf::SampleStatisPieData> allRows;
+    if (!CollectExact(m_samplePie, signature, startDate, endDate, fetch, allRows) || allRows.empty())
+    {
+        return false;
+    }
+
+    pieData = allRows.front();
+    return true;
+}
+
+///
+/// @brief 查询校准统计表（按模块、项目、试剂批号汇总）
+///
+/// @param[out] rows       统计结果
+/// @param[in]  queryCond  查询条件（起止时间由startDate、endDate决定）
+/// @param[in]  startDate  起始日期
+/// @param[in]  endDate    截止日期（包含）
+///
+/// @return true:查询成功
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool StatisticsRollupStore::QueryStatisCaliTab(std::vector<::tf::StatisCaliTab>& rows, const ::tf::StatisCaliTabQueryCond& queryCond,
+    const QDate& startDate, const QDate& endDate)
+{
+    std::string signature = JoinSorted(queryCond.vecDeviceSN) + "|" + JoinSorted(queryCond.vecAssayCode) + "|" + JoinSorted(queryCond.vecReagentLot);
+    auto fetch = [&queryCond](const QDate& start, const QDate& end, std::vector<::tf::StatisCaliTab>& bucketRows)
+    {
+        ::tf::StatisCaliTabQueryCond cond = queryCond;
+        cond.__set_startTime(StartTimeString(start));
+        cond.__set_endTime(EndTimeString(end));
+        ::tf::StatisCaliTabQueryResp ret;
+        if (!DcsControlProxy::GetInstance()->QueryStatisCaliTab(ret, cond))
+        {
+            ULOG(LOG_ERROR, "QueryStatisCaliTab Failed");
+            return false;
+        }
+
+        bucketRows = std::move(ret.lstStatisCaliTab);
+        return true;
+    };
+
+    std::vector<::tf::StatisCaliTab> allRows;
+    if (!CollectAdditive(m_caliTab, signature, startDate, endDate, fetch, allRows))
+    {
+        return false;
+    }
+
+    if (allRows.empty())
+    {
+        rows.clear();
+        return true;
+    }
+
+    // 校准次数按执行日期计数，各时间段可加；按批号区分合并，与DCS整段查询返回的行一致
+    rows = MergeRows(allRows,
+        [](const ::tf::StatisCaliTab& row) { return std::make_tuple(row.deviceSN, row.assayCode, row.reagentLot); },
+        [](::tf::StatisCaliTab& sum, const ::tf::StatisCaliTab& row)
+    {
+        sum.caliSteps += row.caliSteps;
+        sum.caliSucceedSteps += row.caliSucceedSteps;
+        sum.caliFailSteps += row.caliFailSteps;
+    });
+
+    // 通过率由合并后的次数重新计算
+    for (auto& row : rows)
+    {
+        row.caliSucceedratio = (row.caliSteps > 0) ? qRound(row.caliSucceedSteps * 100.0 / row.caliSteps) : 0;
+    }
+
+    return true;
+}
+
+///
+/// @brief 样本信息更新（样本所在日期的统计会变化，使包含这些日期的时间段失效）
+///
+/// @param[in]  enUpdateType  更新类型
+/// @param[in]  vSIs          样本信息
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void StatisticsRollupStore::OnSampleUpdate(tf::UpdateType::type enUpdateType, std::vector<tf::SampleInfo, std::allocator<tf::SampleInfo>> vSIs)
+{
+    // 收集样本的登记、检测、复查日期，当天及以后的数据不缓存，无需处理
+    const QDate today = QDate::currentDate();
+    std::set<QDate> sampleDates;
+    std::set<QDate> caliDates;
+    for (const auto& sample : vSIs)
+    {
+        bool hasDate = false;
+        for (const std::string& time : { sample.registerTime, sample.endTestTime, sample.endRetestTime })
+        {
+            QDate date = DateOfTime(time);
+            if (!date.isValid())
+            {
+                continue;
+            }
+
+            hasDate = true;
+            if (date >= today)
+            {
+                continue;
+            }
+
+            sampleDates.insert(date);
+            if (sample.sampleType == tf::SampleType::SAMPLE_TYPE_CALIBRATOR)
+            {
+                caliDates.insert(date);
+            }
+        }
+
+        // 新增样本没有时间即为当天登记；修改和删除无法确定日期时清空全部缓存
+        if (!hasDate && enUpdateType != tf::UpdateType::UPDATE_TYPE_ADD)
+        {
+            ULOG(LOG_INFO, "%s(sample %lld has no time, clear all)", __FUNCTION__, sample.id);
+            Clear();
+            return;
+        }
+    }
+
+    for (const QDate& date : sampleDates)
+    {
+        InvalidateDate(m_sampleTab, date);
+        InvalidateDate(m_samplePie, date);
+    }
+
+    for (const QDate& date : caliDates)
+    {
+        InvalidateDate(m_caliTab, date);
+    }
+}
+
+///
+/// @brief 免疫校准结束（使包含校准执行日期的校准统计时间段失效）
+///
+/// @param[in]  curve  校准曲线
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void StatisticsRollupStore::OnImCaliEnd(const im::tf::CaliCurve curve)
+{
+    QDate date = DateOfTime(curve.caliExcuteDate);
+    if (!date.isValid())
+    {
+        m_caliTab.clear();
+        return;
+    }
+
+    if (date < QDate::currentDate())
+    {
+        InvalidateDate(m_caliTab, date);
+    }
+}
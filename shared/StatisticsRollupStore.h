@@ -0,0 +1,194 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     StatisticsRollupStore.h
+/// @brief    统计页面的按时间分桶汇总缓存
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <map>
+#include <string>
+#include <vector>
+#include <QObject>
+#include <QDate>
+#include "src/thrift/gen-cpp/defs_types.h"
+#include "src/thrift/im/gen-cpp/im_types.h"
+
+///
+/// @brief 统计汇总缓存
+///     校准次数按校准执行日期计数，各时间段可加：已结束的日期按连续的未缓存时间段合并为一次DCS查询后缓存，
+///     当天（及之后）的部分每次都精确查询，合并后即为整个时间段的统计；
+///     样本量按样本去重计数（一个样本的检测、复查可能跨越多个时间段），各时间段不可加，
+///     整个时间段精确查询一次，已结束的时间段按起止日期缓存
+///
+class StatisticsRollupStore : public QObject
+{
+    Q_OBJECT
+
+public:
+    ///
+    /// @brief 获取单例
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static StatisticsRollupStore& GetInstance();
+
+    ///
+    /// @brief 查询样本量统计表（按模块、试剂批号、项目汇总）
+    ///
+    /// @param[out] rows       统计结果
+    /// @param[in]  queryCond  查询条件（起止时间由startDate、endDate决定）
+    /// @param[in]  startDate  起始日期
+    /// @param[in]  endDate    截止日期（包含）
+    ///
+    /// @return true:查询成功
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool QuerySampleStatisTab(std::vector<::tf::SampleStatisTabData>& rows, const ::tf::SampleStatisTabDataQueryCond& queryCond,
+        const QDate& startDate, const QDate& endDate);
+
+    ///
+    /// @brief 查询样本量饼状图
+    ///
+    /// @param[out] pieData    统计结果
+    /// @param[in]  queryCond  查询条件（起止时间由startDate、endDate决定）
+    /// @param[in]  startDate  起始日期
+    /// @param[in]  endDate    截止日期（包含）
+    ///
+    /// @return true:查询成功且有数据
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool QuerySampleStatisPie(::tf::SampleStatisPieData& pieData, const ::tf::SampleStatisPieQueryCond& queryCond,
+        const QDate& startDate, const QDate& endDate);
+
+    ///
+    /// @brief 查询校准统计表（按模块、项目、试剂批号汇总）
+    ///
+    /// @param[out] rows       统计结果
+    /// @param[in]  queryCond  查询条件（起止时间由startDate、endDate决定）
+    /// @param[in]  startDate  起始日期
+    /// @param[in]  endDate    截止日期（包含）
+    ///
+    /// @return true:查询成功
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool QueryStatisCaliTab(std::vector<::tf::StatisCaliTab>& rows, const ::tf::StatisCaliTabQueryCond& queryCond,
+        const QDate& startDate, const QDate& endDate);
+
+    ///
+    /// @brief 清空所有缓存
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Clear();
+
+protected slots:
+    ///
+    /// @brief 样本信息更新（样本所在日期的统计会变化，使包含这些日期的时间段失效）
+    ///
+    /// @param[in]  enUpdateType  更新类型
+    /// @param[in]  vSIs          样本信息
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnSampleUpdate(tf::UpdateType::type enUpdateType, std::vector<tf::SampleInfo, std::allocator<tf::SampleInfo>> vSIs);
+
+    ///
+    /// @brief 免疫校准结束（使包含校准执行日期的校准统计时间段失效）
+    ///
+    /// @param[in]  curve  校准曲线
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnImCaliEnd(const im::tf::CaliCurve curve);
+
+private:
+    StatisticsRollupStore();
+
+    // 某一查询条件下各时间段的结果（键为起始日期，值为截止日期和结果）
+    template<typename Row>
+    using BucketMap = std::map<QDate, std::pair<QDate, std::vector<Row>>>;
+
+    // 各查询条件的缓存（键为查询条件签名）
+    template<typename Row>
+    using RollupTable = std::map<std::string, BucketMap<Row>>;
+
+    ///
+    /// @brief 按时间段收集可加的结果，已结束日期中未缓存的连续时间段合并为一次fetch查询
+    ///
+    template<typename Row, typename FetchFunc>
+    bool CollectAdditive(RollupTable<Row>& table, const std::string& signature,
+        const QDate& startDate, const QDate& endDate, FetchFunc fetch, std::vector<Row>& rows);
+
+    ///
+    /// @brief 整个时间段精确查询一次（用于不可加的结果），已结束的时间段按起止日期缓存
+    ///
+    template<typename Row, typename FetchFunc>
+    bool CollectExact(RollupTable<Row>& table, const std::string& signature,
+        const QDate& startDate, const QDate& endDate, FetchFunc fetch, std::vector<Row>& rows);
+
+    ///
+    /// @brief 查询条件数超出上限时清空该类缓存，返回查询条件对应的缓存
+    ///
+    template<typename Row>
+    static BucketMap<Row>& BucketsOf(RollupTable<Row>& table, const std::string& signature);
+
+    ///
+    /// @brief 删除各查询条件下包含指定日期的时间段
+    ///
+    template<typename Row>
+    static void InvalidateDate(RollupTable<Row>& table, const QDate& date);
+
+private:
+    RollupTable<::tf::SampleStatisTabData>      m_sampleTab;        ///< 样本量统计表
+    RollupTable<::tf::SampleStatisPieData>      m_samplePie;        ///< 样本量饼状图
+    RollupTable<::tf::StatisCaliTab>            m_caliTab;          ///< 校准统计表
+};
@@ -0,0 +1,336 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     UiWatchdog.cpp
+/// @brief    界面响应看门狗（事件循环延迟直方图、慢调用检测、卡顿时导出线程栈）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#include "UiWatchdog.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QThread>
+#include "shared/LatencyProfiler.h"
+#include "src/common/Mlog/mlog.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <DbgHelp.h>
+#endif
+
+// 心跳间隔（毫秒）
+#define UI_HEARTBEAT_INTERVAL_MS        (100)
+// 统计输出间隔（毫秒）
+#define UI_REPORT_INTERVAL_MS           (10 * 60 * 1000)
+// 慢调用阈值（毫秒）
+#define UI_SLOW_CALL_MS                 (200)
+// 卡顿阈值（毫秒），超过时导出线程栈
+#define UI_STALL_MS                     (3000)
+// 监视线程检查间隔（毫秒）
+#define UI_WATCH_INTERVAL_MS            (250)
+// 每次运行最多导出的dump数量
+#define UI_MAX_STALL_DUMPS              (5)
+// 日志中输出的慢调用点数量
+#define UI_REPORT_TOP_SITES             (10)
+
+// 事件循环延迟直方图的上界（毫秒），最后一档为以上
+static const qint64 s_lagBounds[] = { 16, 50, 100, 250, 500, 1000, 3000 };
+
+bool UiWatchdog::SiteLess::operator()(const char* lhs, const char* rhs) const
+{
+    return std::strcmp(lhs, rhs) < 0;
+}
+
+UiWatchdog::UiWatchdog()
+    : m_running(false)
+    , m_guiThread(nullptr)
+    , m_expectedBeatMs(0)
+    , m_lastBeatMs(0)
+    , m_currentSite(nullptr)
+    , m_lagBuckets{}
+    , m_dumpCount(0)
+{
+    m_heartbeat.setTimerType(Qt::PreciseTimer);
+    connect(&m_heartbeat, &QTimer::timeout, this, &UiWatchdog::OnHeartbeat);
+    connect(&m_reportTimer, &QTimer::timeout, this, &UiWatchdog::OnReportTimer);
+}
+
+UiWatchdog::~UiWatchdog()
+{
+    Stop();
+}
+
+///
+/// @brief 获取单例
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+UiWatchdog& UiWatchdog::GetInstance()
+{
+    static UiWatchdog instance;
+    return instance;
+}
+
+///
+/// @brief 启动（须在界面线程调用）
+///
+/// @param[in]  dumpDir  卡顿dump文件的目录
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void UiWatchdog::Start(const std::string& dumpDir)
+{
+    ULOG(LOG_INFO, "%s(%s)", __FUNCTION__, dumpDir.c_str());
+    if (IsRunning())
+    {
+        return;
+    }
+
+    m_guiThread = QThread::currentThread();
+    m_dumpDir = dumpDir;
+    m_clock.start();
+    m_expectedBeatMs = UI_HEARTBEAT_INTERVAL_MS;
+    m_lastBeatMs.store(0);
+    m_running.store(true);
+
+    m_heartbeat.start(UI_HEARTBEAT_INTERVAL_MS);
+    m_reportTimer.start(UI_REPORT_INTERVAL_MS);
+    m_watcher = std::thread(&UiWatchdog::WatchThread, this);
+}
+
+///
+/// @brief 停止并输出最后一次统计
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void UiWatchdog::Stop()
+{
+    if (!m_running.exchange(false))
+    {
+        return;
+    }
+
+    m_watchCond.notify_all();
+    if (m_watcher.joinable())
+    {
+        m_watcher.join();
+    }
+
+    m_heartbeat.stop();
+    m_reportTimer.stop();
+    OnReportTimer();
+}
+
+///
+/// @brief 当前线程是否为界面线程
+///
+bool UiWatchdog::IsGuiThread() const
+{
+    return m_guiThread != nullptr && QThread::currentThread() == m_guiThread;
+}
+
+///
+/// @brief 进入调用点（只在界面线程调用）
+///
+/// @param[in]  site  调用点名称（须为静态字符串）
+///
+/// @return 之前的调用点
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+const char* UiWatchdog::EnterCallSite(const char* site)
+{
+    return m_currentSite.exchange(site);
+}
+
+///
+/// @brief 离开调用点（只在界面线程调用）
+///
+/// @param[in]  site      调用点名称
+/// @param[in]  previous  之前的调用点
+/// @param[in]  ms        调用耗时（毫秒）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void UiWatchdog::LeaveCallSite(const char* site, const char* previous, qint64 ms)
+{
+    m_currentSite.store(previous);
+    if (ms < UI_SLOW_CALL_MS)
+    {
+        return;
+    }
+
+    SlowStat& stat = m_slowCalls[site];
+    ++stat.count;
+    stat.maxMs = std::max(stat.maxMs, ms);
+    ULOG(LOG_WARN, "%s(slow call on ui thread: %s, %lld ms, outer: %s)", __FUNCTION__, site, ms, (previous == nullptr) ? "-" : previous);
+}
+
+///
+/// @brief 心跳（统计事件循环延迟）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void UiWatchdog::OnHeartbeat()
+{
+    qint64 now = m_clock.elapsed();
+    qint64 lag = std::max<qint64>(0, now - m_expectedBeatMs);
+    m_expectedBeatMs = now + UI_HEARTBEAT_INTERVAL_MS;
+    m_lastBeatMs.store(now);
+
+    const int boundCount = int(sizeof(s_lagBounds) / sizeof(s_lagBounds[0]));
+    int bucket = int(std::upper_bound(s_lagBounds, s_lagBounds + boundCount, lag) - s_lagBounds);
+    ++m_lagBuckets[bucket];
+
+    LatencyProfiler::GetInstance().Record("ui.dispatchLag", lag * 1000 * 1000);
+    if (lag >= UI_STALL_MS)
+    {
+        ULOG(LOG_WARN, "%s(ui thread was blocked for %lld ms)", __FUNCTION__, lag);
+    }
+}
+
+///
+/// @brief 定期输出统计
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void UiWatchdog::OnReportTimer()
+{
+    // 延迟直方图：<16:n <50:n ... >=3000:n
+    QString report("lag(ms)");
+    const int boundCount = int(sizeof(s_lagBounds) / sizeof(s_lagBounds[0]));
+    for (int i = 0; i <= boundCount; ++i)
+    {
+        report += (i < boundCount) ? QString(" <%1:%2").arg(s_lagBounds[i]).arg(m_lagBuckets[i])
+            : QString(" >=%1:%2").arg(s_lagBounds[boundCount - 1]).arg(m_lagBuckets[i]);
+        m_lagBuckets[i] = 0;
+    }
+
+    // 慢调用：次数最多的若干个调用点，调用点(次数/最大毫秒)
+    std::vector<std::pair<const char*, SlowStat>> slowCalls(m_slowCalls.begin(), m_slowCalls.end());
+    std::sort(slowCalls.begin(), slowCalls.end(), [](const std::pair<const char*, SlowStat>& lhs, const std::pair<const char*, SlowStat>& rhs)
+    {
+        return lhs.second.count > rhs.second.count;
+    });
+    report += " | slow";
+    for (size_t i = 0; i < slowCalls.size() && i < UI_REPORT_TOP_SITES; ++i)
+    {
+        report += QString(" %1(%2/%3)").arg(slowCalls[i].first).arg(slowCalls[i].second.count).arg(slowCalls[i].second.maxMs);
+    }
+    m_slowCalls.clear();
+
+    ULOG(LOG_INFO, "%s(%s)", __FUNCTION__, report.toStdString().c_str());
+}
+
+///
+/// @brief 监视线程（检测卡顿）
+///
+void UiWatchdog::WatchThread()
+{
+    qint64 dumpedBeat = -1;
+    std::unique_lock<std::mutex> lock(m_watchMutex);
+    while (IsRunning())
+    {
+        m_watchCond.wait_for(lock, std::chrono::milliseconds(UI_WATCH_INTERVAL_MS));
+        if (!IsRunning())
+        {
+            break;
+        }
+
+        // 心跳停止的时间（扣除正常的心跳间隔）
+        qint64 lastBeat = m_lastBeatMs.load();
+        qint64 stalled = m_clock.elapsed() - lastBeat - UI_HEARTBEAT_INTERVAL_MS;
+        if (stalled < UI_STALL_MS || lastBeat == dumpedBeat)
+        {
+            continue;
+        }
+
+        // 同一次卡顿只处理一次
+        dumpedBeat = lastBeat;
+        const char* site = m_currentSite.load();
+        ULOG(LOG_WARN, "%s(ui thread stalled for %lld ms, current call site: %s)", __FUNCTION__, stalled, (site == nullptr) ? "-" : site);
+        DumpStall(stalled, site);
+    }
+}
+
+///
+/// @brief 导出卡顿时的线程栈
+///
+/// @param[in]  stalledMs  已卡顿的时间（毫秒）
+/// @param[in]  site       卡顿时的调用点
+///
+void UiWatchdog::DumpStall(qint64 stalledMs, const char* site)
+{
+    if (m_dumpCount >= UI_MAX_STALL_DUMPS)
+    {
+        return;
+    }
+    ++m_dumpCount;
+
+#ifdef _WIN32
+    QDir().mkpath(QString::fromStdString(m_dumpDir));
+    QString fileName = QString::fromStdString(m_dumpDir) + QString("/stall-%1-%2ms.dmp")
+        .arg(QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss")).arg(stalledMs);
+
+    // 只导出线程栈等基本信息，文件较小
+    HANDLE hDumpFile = CreateFileW(reinterpret_cast<LPCWSTR>(QDir::toNativeSeparators(fileName).utf16()),
+        GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (INVALID_HANDLE_VALUE == hDumpFile)
+    {
+        ULOG(LOG_ERROR, "%s(create dump file failed: %s)", __FUNCTION__, fileName.toStdString().c_str());
+        return;
+    }
+
+    MiniDumpWriteDump(GetCurrentProcess(), GetCurrentProcessId(), hDumpFile, MiniDumpNormal, NULL, NULL, NULL);
+    CloseHandle(hDumpFile);
+    ULOG(LOG_INFO, "%s(stall dump: %s, site: %s)", __FUNCTION__, fileName.toStdString().c_str(), (site == nullptr) ? "-" : site);
+#endif
+}
@@ -0,0 +1,239 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     UiWatchdog.h
+/// @brief    界面响应看门狗（事件循环延迟直方图、慢调用检测、卡顿时导出线程栈）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+
+class QThread;
+
+///
+/// @brief 界面响应看门狗
+///     1. 界面线程上的心跳定时器按实际触发时间与预期时间之差统计事件循环延迟；
+///     2. 界面线程上的消息总线处理函数、定时器、DcsControlProxy调用超过阈值时记录调用点；
+///     3. 监视线程发现心跳长时间未更新时记录当前调用点，并导出一份线程栈dump；
+///     延迟直方图和慢调用统计定期以一行的形式写入日志
+///
+class UiWatchdog : public QObject
+{
+    Q_OBJECT
+
+public:
+    ///
+    /// @brief 获取单例
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static UiWatchdog& GetInstance();
+    ~UiWatchdog();
+
+    ///
+    /// @brief 启动（须在界面线程调用）
+    ///
+    /// @param[in]  dumpDir  卡顿dump文件的目录
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Start(const std::string& dumpDir);
+
+    ///
+    /// @brief 停止并输出最后一次统计
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Stop();
+
+    ///
+    /// @brief 是否已启动
+    ///
+    bool IsRunning() const { return m_running.load(std::memory_order_relaxed); }
+
+    ///
+    /// @brief 当前线程是否为界面线程
+    ///
+    bool IsGuiThread() const;
+
+    ///
+    /// @brief 进入调用点（只在界面线程调用）
+    ///
+    /// @param[in]  site  调用点名称（须为静态字符串）
+    ///
+    /// @return 之前的调用点
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    const char* EnterCallSite(const char* site);
+
+    ///
+    /// @brief 离开调用点（只在界面线程调用）
+    ///
+    /// @param[in]  site      调用点名称
+    /// @param[in]  previous  之前的调用点
+    /// @param[in]  ms        调用耗时（毫秒）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void LeaveCallSite(const char* site, const char* previous, qint64 ms);
+
+protected Q_SLOTS:
+    ///
+    /// @brief 心跳（统计事件循环延迟）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnHeartbeat();
+
+    ///
+    /// @brief 定期输出统计
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnReportTimer();
+
+private:
+    UiWatchdog();
+
+    ///
+    /// @brief 监视线程（检测卡顿）
+    ///
+    void WatchThread();
+
+    ///
+    /// @brief 导出卡顿时的线程栈
+    ///
+    /// @param[in]  stalledMs  已卡顿的时间（毫秒）
+    /// @param[in]  site       卡顿时的调用点
+    ///
+    void DumpStall(qint64 stalledMs, const char* site);
+
+    ///
+    /// @brief 慢调用统计
+    ///
+    struct SlowStat
+    {
+        quint64     count = 0;          ///< 次数
+        qint64      maxMs = 0;          ///< 最大耗时
+    };
+
+    ///
+    /// @brief 按字符串内容比较调用点
+    ///
+    struct SiteLess
+    {
+        bool operator()(const char* lhs, const char* rhs) const;
+    };
+
+private:
+    std::atomic<bool>                           m_running;          ///< 是否已启动
+    QThread*                                    m_guiThread;        ///< 界面线程
+    QTimer                                      m_heartbeat;        ///< 心跳定时器
+    QTimer                                      m_reportTimer;      ///< 统计输出定时器
+    QElapsedTimer                               m_clock;            ///< 单调时钟
+    qint64                                      m_expectedBeatMs;   ///< 下一次心跳的预期时间
+    std::atomic<qint64>                         m_lastBeatMs;       ///< 最近一次心跳时间（监视线程读取）
+    std::atomic<const char*>                    m_currentSite;      ///< 界面线程当前的调用点
+    quint64                                     m_lagBuckets[8];    ///< 事件循环延迟直方图
+    std::map<const char*, SlowStat, SiteLess>   m_slowCalls;        ///< 调用点到慢调用统计（界面线程访问）
+    std::string                                 m_dumpDir;          ///< dump目录
+    int                                         m_dumpCount;        ///< 已导出的dump数量
+    std::thread                                 m_watcher;          ///< 监视线程
+    std::mutex                                  m_watchMutex;       ///< 监视线程等待锁
+    std::condition_variable                     m_watchCond;        ///< 监视线程唤醒
+};
+
+///
+/// @brief 界面线程调用点（作用域内的耗时超过阈值时记录）
+///     非界面线程或看门狗未启动时不做任何事
+///
+class UiCallSite
+{
+public:
+    explicit UiCallSite(const char* site)
+        : m_site(nullptr)
+        , m_previous(nullptr)
+    {
+        UiWatchdog& watchdog = UiWatchdog::GetInstance();
+        if (!watchdog.IsRunning() || !watchdog.IsGuiThread())
+        {
+            return;
+        }
+
+        m_site = site;
+        m_previous = watchdog.EnterCallSite(site);
+        m_timer.start();
+    }
+
+    ~UiCallSite()
+    {
+        if (m_site != nullptr)
+        {
+            UiWatchdog::GetInstance().LeaveCallSite(m_site, m_previous, m_timer.elapsed());
+        }
+    }
+
+private:
+    Q_DISABLE_COPY(UiCallSite)
+
+    const char*         m_site;             ///< 调用点，为空时不记录
+    const char*         m_previous;         ///< 外层调用点
+    QElapsedTimer       m_timer;            ///< 计时
+};
+
+// 以当前函数名作为调用点
+#define UI_CALL_SITE()      UiCallSite uiCallSite(__FUNCTION__)
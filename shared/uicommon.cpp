@@ -63,6 +63,7 @@
 #include "shared/qcustomcalendarwidget.h"
 #include "manager/UserInfoManager.h"
 #include "manager/DictionaryQueryManager.h"
+#include "manager/OperationLogManager.h"
 
 #include <QApplication>
 #include <QComboBox>
@@ -1365,8 +1366,8 @@ bool UiCommon::AddOperateLog(::tf::OperationType::type type, const QString& reco
     ol.__set_operationTime(GetCurrentLocalTimeString());
     ol.__set_operationRecord(record.toStdString());
 
-    ::tf::ResultLong ret;
-    return DcsControlProxy::GetInstance()->AddOperationLog(ret, ol);
+    // 后台按顺序写入，不阻塞界面操作
+    return COperationLogManager::GetInstance()->PostOperationLog(ol);
 }
 
 bool UiCommon::DeviceIsRunning(const ::tf::DeviceInfo& stuTfDevInfo)
@@ -418,8 +418,8 @@ void SystemOverviewWgt::initConnect()
 	// 注册设备倒计时刷新槽函数
 	REGISTER_HANDLER(MSG_ID_DEV_COUNT_DOWN_UPDATE, this, OnDeviceCountDownUpdate);
 
-	// 注册设备状态改变处理槽函数
-    REGISTER_HANDLER(MSG_ID_DEVS_STATUS_CHANGED, this, OnDevStateChange);
+	// 设备状态改变（按帧率合并，只投递有变化的设备）
+    connect(&DeviceStateCache::GetInstance(), &DeviceStateCache::signalDeviceStateChanged, this, &SystemOverviewWgt::OnDevStateChange);
 
     // 注册当前用户权限更新处理函数
     SEG_REGIST_PERMISSION(this, OnPermisionChanged);
@@ -1224,14 +1224,14 @@ void SystemOverviewWgt::OnDeviceCountDownUpdate(int totalSeconds, const QMap<QSt
 	}
 }
 
-void SystemOverviewWgt::OnDevStateChange(tf::DeviceInfo deviceInfo)
+void SystemOverviewWgt::OnDevStateChange(const DeviceStateDiff& diff)
 {
-	ULOG(LOG_INFO, "%s(deviceInfo=[ %s ])", __FUNCTION__, ToString(deviceInfo));
+	ULOG(LOG_INFO, "%s(devSN=%s, fields=%d, status=%d, iomStatus=%d)", __FUNCTION__, diff.deviceSN, diff.fields, diff.status, diff.iomStatus);
 
 	// 生化单机
 	if (m_spChSingleDev)
 	{
-		if (deviceInfo.deviceSN != m_spChSingleDev->m_devCh.devSN && deviceInfo.deviceSN != m_spChSingleDev->m_devIse.devSN)
+		if (diff.deviceSN != m_spChSingleDev->m_devCh.devSN && diff.deviceSN != m_spChSingleDev->m_devIse.devSN)
 		{
 			ULOG(LOG_INFO, "not ch single care device sn.");
 			return;
@@ -1242,14 +1242,14 @@ void SystemOverviewWgt::OnDevStateChange(tf::DeviceInfo deviceInfo)
 		int tmpIseStatus = m_spChSingleDev->m_devIse.status;
 		int tmpIomStatus = m_spChSingleDev->m_iomStatus;
 
-		if (deviceInfo.deviceSN == m_spChSingleDev->m_devCh.devSN)
+		if (diff.deviceSN == m_spChSingleDev->m_devCh.devSN)
 		{
-			m_spChSingleDev->m_devCh.status = deviceInfo.status;
-			m_spChSingleDev->m_iomStatus = deviceInfo.iomStatus;
+			m_spChSingleDev->m_devCh.status = diff.status;
+			m_spChSingleDev->m_iomStatus = diff.iomStatus;
 		}
-		else if (deviceInfo.deviceSN == m_spChSingleDev->m_devIse.devSN)
+		else if (diff.deviceSN == m_spChSingleDev->m_devIse.devSN)
 		{
-			m_spChSingleDev->m_devIse.status = deviceInfo.status;
+			m_spChSingleDev->m_devIse.status = diff.status;
 		}
 
 		// 状态有变化
@@ -1265,23 +1265,15 @@ void SystemOverviewWgt::OnDevStateChange(tf::DeviceInfo deviceInfo)
 
 	std::shared_ptr<QBaseDeviceWgt> currDev = nullptr;
 
-	if (deviceInfo.groupName.empty())
+	if (diff.groupName.empty())
 	{
-		// 轨道设备 且联机
-		if (deviceInfo.deviceType == tf::DeviceType::DEVICE_TYPE_TRACK 
+		// 轨道设备 且联机：只更新状态有变化的子模块
+		if (diff.deviceType == tf::DeviceType::DEVICE_TYPE_TRACK 
 			&& DictionaryQueryManager::GetInstance()->GetPipeLine())
 		{
-			// 解析轨道模块
-			track::bcyime::TrackOtherInfo tdoi;
-			if (!DecodeJson(tdoi, deviceInfo.otherInfo))
+			for (const auto& node : diff.changedNodes)
 			{
-				ULOG(LOG_ERROR, "DecodeJson Failed.");
-				return;
-			}
-
-			for (const auto& node : tdoi.node_infos)
-			{
-				auto dev = getDeviceBySn(deviceInfo.deviceSN + "-" + to_string(node.first));
+				auto dev = getDeviceBySn(diff.deviceSN + "-" + to_string(node.first));
 				if (dev && dev->m_devStatus != node.second.status)
 				{
 					dev->m_devStatus = node.second.status;
@@ -1292,17 +1284,17 @@ void SystemOverviewWgt::OnDevStateChange(tf::DeviceInfo deviceInfo)
 			return;
 		}
 
-		currDev = getDeviceBySn(deviceInfo.deviceSN);
+		currDev = getDeviceBySn(diff.deviceSN);
 	}
 	// 2000速设备
 	else
 	{
-		currDev = getDeviceBySn(deviceInfo.groupName);
+		currDev = getDeviceBySn(diff.groupName);
 	}
 
 	if (currDev == nullptr)
 	{
-		ULOG(LOG_INFO, "can not find groupName=%s, devSN=%s, no need update status.", deviceInfo.groupName, deviceInfo.deviceSN);
+		ULOG(LOG_INFO, "can not find groupName=%s, devSN=%s, no need update status.", diff.groupName, diff.deviceSN);
 		return;
 	}
 
@@ -1311,10 +1303,10 @@ void SystemOverviewWgt::OnDevStateChange(tf::DeviceInfo deviceInfo)
 	case EDT_I6000_SINGLE: 	// 免疫单机
 	{
 		auto imSingleDev = dynamic_cast<I6000SingleDeviceWgt*>(currDev.get());
-		if (imSingleDev->m_devStatus != deviceInfo.status || imSingleDev->m_iomStatus != deviceInfo.iomStatus)
+		if (imSingleDev->m_devStatus != diff.status || imSingleDev->m_iomStatus != diff.iomStatus)
 		{
-			imSingleDev->m_devStatus = deviceInfo.status;
-			imSingleDev->m_iomStatus = deviceInfo.iomStatus;
+			imSingleDev->m_devStatus = diff.status;
+			imSingleDev->m_iomStatus = diff.iomStatus;
 			imSingleDev->changeStatus();
 		}
 		break;
@@ -1327,13 +1319,13 @@ void SystemOverviewWgt::OnDevStateChange(tf::DeviceInfo deviceInfo)
 		int tmpChAStatus = ch2000Dev->m_devA.status;
 		int tmpChBStatus = ch2000Dev->m_devB.status;
 
-		if (deviceInfo.deviceSN == ch2000Dev->m_devA.devSN)
+		if (diff.deviceSN == ch2000Dev->m_devA.devSN)
 		{
-			ch2000Dev->m_devA.status = deviceInfo.status;
+			ch2000Dev->m_devA.status = diff.status;
 		}
-		else if (deviceInfo.deviceSN == ch2000Dev->m_devB.devSN)
+		else if (diff.deviceSN == ch2000Dev->m_devB.devSN)
 		{
-			ch2000Dev->m_devB.status = deviceInfo.status;
+			ch2000Dev->m_devB.status = diff.status;
 		}
 
 		// 状态有变化
@@ -1348,9 +1340,9 @@ void SystemOverviewWgt::OnDevStateChange(tf::DeviceInfo deviceInfo)
 	default:	// 其他设备
 	{
 		// 更新状态
-		if (currDev->m_devStatus != deviceInfo.status)
+		if (currDev->m_devStatus != diff.status)
 		{
-			currDev->m_devStatus = deviceInfo.status;
+			currDev->m_devStatus = diff.status;
 			currDev->changeStatus();
 		}
 		break;
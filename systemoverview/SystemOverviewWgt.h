@@ -50,6 +50,7 @@
 #include <QDateTime>
 #include "src/thrift/gen-cpp/defs_types.h"
 #include "manager/WarnSetManager.h"
+#include "shared/DeviceStateCache.h"
 
 using namespace std;
 
@@ -321,12 +322,13 @@ protected Q_SLOTS:
 	///
 	/// @brief  设备状态改变
 	///
-	/// @param[in]  deviceInfo  设备信息
+	/// @param[in]  diff  设备状态变化（按帧率合并后的最新状态）
 	///
 	/// @par History:
 	/// @li 7997/XuXiaoLong，2024年3月12日，新建函数
+	/// @li 5774/WuHongTao，2026年10月19日，改为接收设备状态缓存的变化
 	///
-	void OnDevStateChange(tf::DeviceInfo deviceInfo);
+	void OnDevStateChange(const DeviceStateDiff& diff);
 
     ///
     /// @bref	权限变化响应
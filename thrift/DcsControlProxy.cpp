@@ -50,6 +50,7 @@
 #include <thrift/protocol/TMultiplexedProtocol.h>
 
 #include "shared/uidef.h"
+#include "thrift/ProxyCallMetrics.h"
 #include "src/thrift/gen-cpp/dcs_control_constants.h"
 #include "src/public/DictionaryKeyName.h"
 #include "src/dcs/interface/DcsControlHandler.h"
@@ -62,6 +63,26 @@
 ///
 std::shared_ptr<DcsControlProxy>    DcsControlProxy::s_dcp(new DcsControlProxy);
 
+#ifdef LEONIS_WORKPLACE_BENCH
+///
+/// @brief 替身应答（基准测试），工作线程中读取，使用原子操作访问
+///
+static std::shared_ptr<DcsControlProxy::StandIn> s_spStandIn;
+
+///
+/// @brief 设置替身，设置后样本、项目和计算项目结果的查询由替身应答
+///
+/// @param[in]  spStandIn  替身（为空表示取消）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void DcsControlProxy::SetStandIn(const std::shared_ptr<StandIn>& spStandIn)
+{
+    std::atomic_store(&s_spStandIn, spStandIn);
+}
+#endif
+
 ///
 /// @brief
 ///     获得单例对象
@@ -140,6 +161,7 @@ void DcsControlProxy::UnInit()
 /// @li 7685/likai，2023年11月23日，新建函数
 bool DcsControlProxy::RecordStartEvent()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -163,6 +185,7 @@ bool DcsControlProxy::RecordStartEvent()
 /// @li 7685/likai，2023年11月23日，新建函数
 bool DcsControlProxy::RecordExitEvent()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -186,6 +209,7 @@ bool DcsControlProxy::RecordExitEvent()
 ///
 bool DcsControlProxy::Login(const tf::UserInfo& userInfo)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	
 	if (nullptr == m_spDcs)
@@ -208,6 +232,7 @@ bool DcsControlProxy::Login(const tf::UserInfo& userInfo)
 ///
 std::string DcsControlProxy::AutoLogin()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
     // 构造返回值
     std::string strAutoLoginUser("");
@@ -237,6 +262,7 @@ std::string DcsControlProxy::AutoLogin()
 ///
 bool DcsControlProxy::UserIdentityVerify(const std::string& userName, const std::string& password)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -250,6 +276,7 @@ bool DcsControlProxy::UserIdentityVerify(const std::string& userName, const std:
 
 bool DcsControlProxy::StartTest(const ::tf::StartTestParams& params)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -273,6 +300,7 @@ bool DcsControlProxy::StartTest(const ::tf::StartTestParams& params)
 ///
 bool DcsControlProxy::StopTest()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -294,6 +322,7 @@ bool DcsControlProxy::StopTest()
 ///
 bool DcsControlProxy::PauseTest()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -318,6 +347,7 @@ bool DcsControlProxy::PauseTest()
 ///
 bool DcsControlProxy::Maintain(const tf::MaintainExeParams& exeParams)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -342,6 +372,7 @@ bool DcsControlProxy::Maintain(const tf::MaintainExeParams& exeParams)
 ///
 bool DcsControlProxy::StopMaintain(const std::vector< ::tf::DevicekeyInfo> & lstDev)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -366,8 +397,19 @@ bool DcsControlProxy::StopMaintain(const std::vector< ::tf::DevicekeyInfo> & lst
 ///
 bool DcsControlProxy::QueryTestItems(const ::tf::TestItemQueryCond& qryCond, ::tf::TestItemQueryResp& qryResp)
 {
+    PROXY_CALL_RESP(qryResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
+#ifdef LEONIS_WORKPLACE_BENCH
+    // 替身应答（基准测试）
+    auto spStandIn = std::atomic_load(&s_spStandIn);
+    if (spStandIn != nullptr && spStandIn->queryTestItems)
+    {
+        spStandIn->queryTestItems(qryResp, qryCond);
+        return qryResp.result == ::tf::ThriftResult::THRIFT_RESULT_SUCCESS;
+    }
+#endif
+
 	if (nullptr == m_spDcs)
 	{
 		ULOG(LOG_ERROR, "m_spDcs is nullptr");
@@ -398,6 +440,7 @@ bool DcsControlProxy::QueryTestItems(const ::tf::TestItemQueryCond& qryCond, ::t
 ///
 bool DcsControlProxy::AddSampleInfo(::tf::ResultListInt64& _return, const ::tf::SampleInfo& sampleInfo, const int32_t count)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -428,6 +471,7 @@ bool DcsControlProxy::AddSampleInfo(::tf::ResultListInt64& _return, const ::tf::
 ///
 bool DcsControlProxy::ModifySampleInfo(const ::tf::SampleInfo& sampInfo)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -451,6 +495,7 @@ bool DcsControlProxy::ModifySampleInfo(const ::tf::SampleInfo& sampInfo)
 ///
 bool DcsControlProxy::ModifyTestItemInfo(const ::tf::TestItem& ti)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -475,6 +520,7 @@ bool DcsControlProxy::ModifyTestItemInfo(const ::tf::TestItem& ti)
 ///
 bool DcsControlProxy::RemoveSampleInfo(const ::tf::SampleInfoQueryCond& queryCond)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -499,6 +545,7 @@ bool DcsControlProxy::RemoveSampleInfo(const ::tf::SampleInfoQueryCond& queryCon
 ///
 bool DcsControlProxy::RemoveSampleInfos(const std::vector<int64_t>& dbNos)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -524,6 +571,7 @@ bool DcsControlProxy::RemoveSampleInfos(const std::vector<int64_t>& dbNos)
 ///
 bool DcsControlProxy::WhetherSeqNoUsed(::tf::ResultBool& _return, const int32_t startSeqNo, const int32_t endSeqNo)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -554,8 +602,19 @@ bool DcsControlProxy::WhetherSeqNoUsed(::tf::ResultBool& _return, const int32_t
 ///
 bool DcsControlProxy::QuerySampleInfo(const ::tf::SampleInfoQueryCond& qryCond, ::tf::SampleInfoQueryResp& qryResp)
 {
+    PROXY_CALL_RESP(qryResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
+#ifdef LEONIS_WORKPLACE_BENCH
+    // 替身应答（基准测试）
+    auto spStandIn = std::atomic_load(&s_spStandIn);
+    if (spStandIn != nullptr && spStandIn->querySampleInfo)
+    {
+        spStandIn->querySampleInfo(qryResp, qryCond);
+        return qryResp.result == ::tf::ThriftResult::THRIFT_RESULT_SUCCESS;
+    }
+#endif
+
 	if (nullptr == m_spDcs)
 	{
 		ULOG(LOG_ERROR, "m_spDcs is nullptr");
@@ -586,6 +645,7 @@ bool DcsControlProxy::QuerySampleInfo(const ::tf::SampleInfoQueryCond& qryCond,
 ///
 bool DcsControlProxy::PushSampleToLIS(const std::vector<int64_t> & vecSampleKeys, const int32_t transType, const bool history)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -611,6 +671,7 @@ bool DcsControlProxy::PushSampleToLIS(const std::vector<int64_t> & vecSampleKeys
 ///
 bool DcsControlProxy::GetMaxSampleSeqno(::tf::ResultStr& _return, bool stat, int mode)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -642,6 +703,7 @@ bool DcsControlProxy::GetMaxSampleSeqno(::tf::ResultStr& _return, bool stat, int
 ///
 bool DcsControlProxy::AddPatientInfo(::tf::ResultLong& _return, const  ::tf::PatientInfo& pi, const int64_t sampleId)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -672,6 +734,7 @@ bool DcsControlProxy::AddPatientInfo(::tf::ResultLong& _return, const  ::tf::Pat
 ///
 bool DcsControlProxy::DeletePatientInfo(const ::tf::PatientInfoQueryCond& piqc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -696,6 +759,7 @@ bool DcsControlProxy::DeletePatientInfo(const ::tf::PatientInfoQueryCond& piqc)
 ///
 bool DcsControlProxy::ModifyPatientInfo(const ::tf::PatientInfo& pi)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -721,6 +785,7 @@ bool DcsControlProxy::ModifyPatientInfo(const ::tf::PatientInfo& pi)
 ///
 bool DcsControlProxy::QueryPatientInfo(::tf::PatientInfoQueryResp& _return, const ::tf::PatientInfoQueryCond& piqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -740,6 +805,7 @@ bool DcsControlProxy::QueryPatientInfo(::tf::PatientInfoQueryResp& _return, cons
 
 bool DcsControlProxy::QueryAiRecognizeResult(::tf::AiRecognizeResultQueryResp& _return, const ::tf::AiRecognizeResultQueryCond& piqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -759,6 +825,7 @@ bool DcsControlProxy::QueryAiRecognizeResult(::tf::AiRecognizeResultQueryResp& _
 
 bool DcsControlProxy::ModifyDeviceInfo(const ::tf::DeviceInfo& di)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -784,6 +851,7 @@ bool DcsControlProxy::ModifyDeviceInfo(const ::tf::DeviceInfo& di)
 ///
 bool DcsControlProxy::QueryDeviceInfo(::tf::DeviceInfoQueryResp& _return, const ::tf::DeviceInfoQueryCond& diqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -803,6 +871,7 @@ bool DcsControlProxy::QueryDeviceInfo(::tf::DeviceInfoQueryResp& _return, const
 
 bool DcsControlProxy::QueryDeviceVersion(std::map<std::string, std::map<std::string, std::string> > & _return)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -819,6 +888,7 @@ void DcsControlProxy::GetTemperautureConfigInfo(
     std::map<::tf::DeviceType::type, std::vector< ::tf::TemperautureInfo>>& _return, 
     const std::vector< ::tf::DeviceType::type>& types)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
     if (nullptr == m_spDcs)
@@ -834,6 +904,7 @@ void DcsControlProxy::GetLiquidPathConfigInfo(
     std::map<::tf::DeviceType::type, std::vector<std::string>>& _return, 
     const std::vector< ::tf::DeviceType::type>& types)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
     if (nullptr == m_spDcs)
@@ -849,6 +920,7 @@ void DcsControlProxy::GetUnitConfigInfo(
     std::map<::tf::DeviceType::type, std::vector<std::string>>& _return, 
     const std::vector< ::tf::DeviceType::type>& types)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
     if (nullptr == m_spDcs)
@@ -864,6 +936,7 @@ void DcsControlProxy::GetCountConfigInfo(
     std::map<::tf::DeviceType::type, std::vector< ::tf::CountInfo>>& _return, 
     const std::vector< ::tf::DeviceType::type>& types)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
     if (nullptr == m_spDcs)
@@ -877,6 +950,7 @@ void DcsControlProxy::GetCountConfigInfo(
 
 bool DcsControlProxy::SetLowerComponentCount(const bool isReset, const ::tf::CountInfo& ci, const std::string& devSn, const int32_t moduleIndex /*= 1*/)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -900,6 +974,7 @@ bool DcsControlProxy::SetLowerComponentCount(const bool isReset, const ::tf::Cou
 ///
 bool DcsControlProxy::DevicePowerOn(const std::vector<std::string> & lstDeviceSN)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -913,6 +988,7 @@ bool DcsControlProxy::DevicePowerOn(const std::vector<std::string> & lstDeviceSN
 
 bool DcsControlProxy::DevicePowerOff(const std::vector<std::string>& lstDevSN)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -936,6 +1012,7 @@ bool DcsControlProxy::DevicePowerOff(const std::vector<std::string>& lstDevSN)
 ///
 bool DcsControlProxy::UpdetePowerOnSchedule(const std::map<std::string, ::tf::PowerOnSchedule>& mapDevice2Pos)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -949,6 +1026,7 @@ bool DcsControlProxy::UpdetePowerOnSchedule(const std::map<std::string, ::tf::Po
 
 bool DcsControlProxy::DeviceSleep()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -962,6 +1040,7 @@ bool DcsControlProxy::DeviceSleep()
 
 bool DcsControlProxy::DeviceAwake()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -988,6 +1067,7 @@ bool DcsControlProxy::DeviceAwake()
 ///
 bool DcsControlProxy::QueryGeneralAssayPage(::tf::GeneralAssayPageQueryResp& _return, ::tf::AssayClassify::type ac, int32_t pageIdx)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1019,6 +1099,7 @@ bool DcsControlProxy::QueryGeneralAssayPage(::tf::GeneralAssayPageQueryResp& _re
 ///
 bool DcsControlProxy::QueryProfileAssayPage(::tf::ProfileAssayPageQueryResp& _return, const ::tf::AssayClassify::type ac, const int32_t pageIdx)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1049,6 +1130,7 @@ bool DcsControlProxy::QueryProfileAssayPage(::tf::ProfileAssayPageQueryResp& _re
 ///
 bool DcsControlProxy::QueryGeneralAssayInfo(::tf::GeneralAssayInfoQueryResp& _return, const ::tf::GeneralAssayInfoQueryCond& gaiq)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1080,6 +1162,7 @@ bool DcsControlProxy::QueryGeneralAssayInfo(::tf::GeneralAssayInfoQueryResp& _re
 ///
 bool DcsControlProxy::QueryProfileInfo(::tf::ProfileInfoQueryResp& _return, const ::tf::ProfileInfoQueryCond& piqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1110,6 +1193,7 @@ bool DcsControlProxy::QueryProfileInfo(::tf::ProfileInfoQueryResp& _return, cons
 ///
 bool DcsControlProxy::ModifyProfileInfo(const ::tf::ProfileInfo& pi)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1123,6 +1207,7 @@ bool DcsControlProxy::ModifyProfileInfo(const ::tf::ProfileInfo& pi)
 
 bool DcsControlProxy::DeleteProfileInfo(const ::tf::ProfileInfoQueryCond& pi)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1136,6 +1221,7 @@ bool DcsControlProxy::DeleteProfileInfo(const ::tf::ProfileInfoQueryCond& pi)
 
 bool DcsControlProxy::AddProfileInfo(tf::ResultLong& _return, const ::tf::ProfileInfo& pi)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1166,6 +1252,7 @@ bool DcsControlProxy::AddProfileInfo(tf::ResultLong& _return, const ::tf::Profil
 ///
 bool DcsControlProxy::ModifyGeneralAssayInfo(const ::tf::GeneralAssayInfo& gai)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1190,6 +1277,7 @@ bool DcsControlProxy::ModifyGeneralAssayInfo(const ::tf::GeneralAssayInfo& gai)
 ///
 bool DcsControlProxy::DeleteGeneralAssayInfo(const ::tf::GeneralAssayInfoQueryCond& gaiq)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1213,6 +1301,7 @@ bool DcsControlProxy::DeleteGeneralAssayInfo(const ::tf::GeneralAssayInfoQueryCo
 ///
 void DcsControlProxy::AddGeneralAssayInfo(::tf::ResultLong& _return, const ::tf::GeneralAssayInfo& gai)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1236,6 +1325,7 @@ void DcsControlProxy::AddGeneralAssayInfo(::tf::ResultLong& _return, const ::tf:
 ///
 void DcsControlProxy::AddOpenAssayRecord(::tf::ResultLong& _return, const ::tf::OpenAssayRecord& oar)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1260,6 +1350,7 @@ void DcsControlProxy::AddOpenAssayRecord(::tf::ResultLong& _return, const ::tf::
 ///
 bool DcsControlProxy::DeleteOpenAssayRecord(const ::tf::OpenAssayRecordQueryCond& oarqc)
 {
+    PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1284,6 +1375,7 @@ bool DcsControlProxy::DeleteOpenAssayRecord(const ::tf::OpenAssayRecordQueryCond
 ///
 bool DcsControlProxy::ModifyOpenAssayRecord(const ::tf::OpenAssayRecord& oar)
 {
+    PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1309,6 +1401,7 @@ bool DcsControlProxy::ModifyOpenAssayRecord(const ::tf::OpenAssayRecord& oar)
 ///
 bool DcsControlProxy::QueryOpenAssayRecord(::tf::OpenAssayRecordQueryResp&  _return, ::tf::OpenAssayRecordQueryCond& oarqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1328,6 +1421,7 @@ bool DcsControlProxy::QueryOpenAssayRecord(::tf::OpenAssayRecordQueryResp&  _ret
 
 bool DcsControlProxy::DeleteDictionaryInfo(const::tf::DictionaryInfoQueryCond & dictionaryInfo)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1352,6 +1446,7 @@ bool DcsControlProxy::DeleteDictionaryInfo(const::tf::DictionaryInfoQueryCond &
 ///
 bool DcsControlProxy::ModifyDictionaryInfo(const ::tf::DictionaryInfo& dictionaryInfo)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1377,6 +1472,7 @@ bool DcsControlProxy::ModifyDictionaryInfo(const ::tf::DictionaryInfo& dictionar
 ///
 bool DcsControlProxy::AddDictionaryInfo(const ::tf::DictionaryInfo& dictionaryInfo, ::tf::ResultLong& lRet)
 {
+    PROXY_CALL_RESP(lRet);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1408,6 +1504,7 @@ bool DcsControlProxy::AddDictionaryInfo(const ::tf::DictionaryInfo& dictionaryIn
 ///
 bool DcsControlProxy::QueryDictionaryInfo(::tf::DictionaryInfoQueryResp& _return, ::tf::DictionaryInfoQueryCond& gaiq)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1439,6 +1536,7 @@ bool DcsControlProxy::QueryDictionaryInfo(::tf::DictionaryInfoQueryResp& _return
 ///
 bool DcsControlProxy::AddMaintainItem(::tf::ResultLong & _return, const::tf::MaintainItem & mi)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1469,6 +1567,7 @@ bool DcsControlProxy::AddMaintainItem(::tf::ResultLong & _return, const::tf::Mai
 ///
 bool DcsControlProxy::DeleteMaintainItem(const::tf::MaintainItemQueryCond & miqc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1493,6 +1592,7 @@ bool DcsControlProxy::DeleteMaintainItem(const::tf::MaintainItemQueryCond & miqc
 ///
 bool DcsControlProxy::ModifyMaintainItem(const::tf::MaintainItem & mi)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1518,6 +1618,7 @@ bool DcsControlProxy::ModifyMaintainItem(const::tf::MaintainItem & mi)
 ///
 bool DcsControlProxy::QueryMaintainItem(::tf::MaintainItemQueryResp & _return, const::tf::MaintainItemQueryCond & miqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1549,6 +1650,7 @@ bool DcsControlProxy::QueryMaintainItem(::tf::MaintainItemQueryResp & _return, c
 ///
 bool DcsControlProxy::AddMaintainGroup(::tf::ResultLong & _return, const::tf::MaintainGroup & mg)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1579,6 +1681,7 @@ bool DcsControlProxy::AddMaintainGroup(::tf::ResultLong & _return, const::tf::Ma
 ///
 bool DcsControlProxy::DeleteMaintainGroup(const::tf::MaintainGroupQueryCond & mgqc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1603,6 +1706,7 @@ bool DcsControlProxy::DeleteMaintainGroup(const::tf::MaintainGroupQueryCond & mg
 ///
 bool DcsControlProxy::ModifyMaintainGroups(const std::vector<::tf::MaintainGroup>& lstMg)
 {
+    PROXY_CALL();
 	ULOG(LOG_INFO, "%s() param size:%d.", __FUNCTION__, lstMg.size());
 
 	if (nullptr == m_spDcs)
@@ -1628,6 +1732,7 @@ bool DcsControlProxy::ModifyMaintainGroups(const std::vector<::tf::MaintainGroup
 ///
 bool DcsControlProxy::QueryMaintainGroup(::tf::MaintainGroupQueryResp & _return, const::tf::MaintainGroupQueryCond & mgqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1659,6 +1764,7 @@ bool DcsControlProxy::QueryMaintainGroup(::tf::MaintainGroupQueryResp & _return,
 ///
 bool DcsControlProxy::AddMaintainLog(::tf::ResultLong & _return, const::tf::MaintainLog & ml)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1689,6 +1795,7 @@ bool DcsControlProxy::AddMaintainLog(::tf::ResultLong & _return, const::tf::Main
 ///
 bool DcsControlProxy::DeleteMaintainLog(const::tf::MaintainLogQueryCond & mlqc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1714,6 +1821,7 @@ bool DcsControlProxy::DeleteMaintainLog(const::tf::MaintainLogQueryCond & mlqc)
 ///
 bool DcsControlProxy::QueryMaintainLog(::tf::MaintainLogQueryResp & _return, const::tf::MaintainLogQueryCond & mlqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1742,6 +1850,7 @@ bool DcsControlProxy::QueryMaintainLog(::tf::MaintainLogQueryResp & _return, con
 ///
 bool DcsControlProxy::RecordMaintainFailReasonStringRc(const std::map<int, string>& mapStrRc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
     if (nullptr == m_spDcs)
@@ -1764,6 +1873,7 @@ bool DcsControlProxy::RecordMaintainFailReasonStringRc(const std::map<int, strin
 ///
 bool DcsControlProxy::RecordMaintainItemNameStringRc(const std::map<int, std::string>& mapStrRc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
     if (nullptr == m_spDcs)
@@ -1789,6 +1899,7 @@ bool DcsControlProxy::RecordMaintainItemNameStringRc(const std::map<int, std::st
 ///
 bool DcsControlProxy::AddLatestMaintainInfo(::tf::ResultLong & _return, const::tf::LatestMaintainInfo & lmi)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1820,6 +1931,7 @@ bool DcsControlProxy::AddLatestMaintainInfo(::tf::ResultLong & _return, const::t
 ///
 bool DcsControlProxy::QueryLatestMaintainInfo(::tf::LatestMaintainInfoQueryResp & _return, const::tf::LatestMaintainInfoQueryCond & lmiqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1850,6 +1962,7 @@ bool DcsControlProxy::QueryLatestMaintainInfo(::tf::LatestMaintainInfoQueryResp
 ///
 bool DcsControlProxy::ModifyLatestMaintainInfo(const ::tf::LatestMaintainInfo& lmi)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1875,6 +1988,7 @@ bool DcsControlProxy::ModifyLatestMaintainInfo(const ::tf::LatestMaintainInfo& l
 ///
 bool DcsControlProxy::AddOperationLog(::tf::ResultLong & _return, const::tf::OperationLog & ol)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1905,6 +2019,7 @@ bool DcsControlProxy::AddOperationLog(::tf::ResultLong & _return, const::tf::Ope
 ///
 bool DcsControlProxy::DeleteOperationLog(const::tf::OperationLogQueryCond & olqc)
 {
+    PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1930,6 +2045,7 @@ bool DcsControlProxy::DeleteOperationLog(const::tf::OperationLogQueryCond & olqc
 ///
 bool DcsControlProxy::QueryOperationLog(::tf::OperationLogQueryResp & _return, const::tf::OperationLogQueryCond & olqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1960,6 +2076,7 @@ bool DcsControlProxy::QueryOperationLog(::tf::OperationLogQueryResp & _return, c
 ///
 int64_t DcsControlProxy::QueryOperationLogCount(const::tf::OperationLogQueryCond & olqc)
 {
+    PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -1985,6 +2102,7 @@ int64_t DcsControlProxy::QueryOperationLogCount(const::tf::OperationLogQueryCond
 ///
 bool DcsControlProxy::AddConsumableChangeLog(::tf::ResultLong & _return, const::tf::ConsumableChangeLog & ccl)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2015,6 +2133,7 @@ bool DcsControlProxy::AddConsumableChangeLog(::tf::ResultLong & _return, const::
 ///
 bool DcsControlProxy::DeleteConsumableChangeLog(const::tf::ConsumableChangeLogQueryCond & cclqc)
 {
+    PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2040,6 +2159,7 @@ bool DcsControlProxy::DeleteConsumableChangeLog(const::tf::ConsumableChangeLogQu
 ///
 bool DcsControlProxy::QueryConsumableChangeLog(::tf::ConsumableChangeLogQueryResp & _return, const::tf::ConsumableChangeLogQueryCond & cclqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2069,6 +2189,7 @@ bool DcsControlProxy::QueryConsumableChangeLog(::tf::ConsumableChangeLogQueryRes
 ///
 void DcsControlProxy::QueryConsumableChangeLogNames(std::vector<std::string> & _return)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2093,6 +2214,7 @@ void DcsControlProxy::QueryConsumableChangeLogNames(std::vector<std::string> & _
 ///
 int64_t DcsControlProxy::QueryConsumableChangeLogCount(const::tf::ConsumableChangeLogQueryCond & cclqc)
 {
+    PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2106,6 +2228,7 @@ int64_t DcsControlProxy::QueryConsumableChangeLogCount(const::tf::ConsumableChan
 
 bool DcsControlProxy::AddDisableAlarmCodes(const std::vector< ::tf::DisableAlarmCode> & dacs)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2119,6 +2242,7 @@ bool DcsControlProxy::AddDisableAlarmCodes(const std::vector< ::tf::DisableAlarm
 
 bool DcsControlProxy::DeleteDisableAlarmCodes(const std::vector< ::tf::DisableAlarmCode> & dacs)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2132,6 +2256,7 @@ bool DcsControlProxy::DeleteDisableAlarmCodes(const std::vector< ::tf::DisableAl
 
 bool DcsControlProxy::DeviceAlarmReaded(const std::vector<std::string> & deviceSns, const bool fromLeonis)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2145,6 +2270,7 @@ bool DcsControlProxy::DeviceAlarmReaded(const std::vector<std::string> & deviceS
 
 bool DcsControlProxy::QueryDisableAlarmCode(::tf::DisableAlarmCodeQueryResp& _return, const ::tf::DisableAlarmCode& dac)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2164,6 +2290,7 @@ bool DcsControlProxy::QueryDisableAlarmCode(::tf::DisableAlarmCodeQueryResp& _re
 
 void DcsControlProxy::GetAllAlarmPrompt(std::vector< ::tf::AlarmPrompt> & _return)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2189,6 +2316,7 @@ void DcsControlProxy::GetAllAlarmPrompt(std::vector< ::tf::AlarmPrompt> & _retur
 ///
 bool DcsControlProxy::DeleteCurAlarm(bool delAll, const std::vector<std::string> & devSns)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2202,6 +2330,7 @@ bool DcsControlProxy::DeleteCurAlarm(bool delAll, const std::vector<std::string>
 
 std::vector<::tf::AlarmDesc> DcsControlProxy::QueryCurAlarm()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2227,6 +2356,7 @@ std::vector<::tf::AlarmDesc> DcsControlProxy::QueryCurAlarm()
 ///
 bool DcsControlProxy::QueryAlarmInfo(::tf::AlarmInfoQueryResp& _return, const ::tf::AlarmInfoQueryCond& aiq)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2256,6 +2386,7 @@ bool DcsControlProxy::QueryAlarmInfo(::tf::AlarmInfoQueryResp& _return, const ::
 ///
 int64_t DcsControlProxy::QueryAlarmInfoCount(const ::tf::AlarmInfoQueryCond& aiq)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2269,6 +2400,7 @@ int64_t DcsControlProxy::QueryAlarmInfoCount(const ::tf::AlarmInfoQueryCond& aiq
 
 std::string DcsControlProxy::GetAlarmTitleByCode(const  ::tf::DeviceType::type type, const std::string& code)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2284,6 +2416,7 @@ std::string DcsControlProxy::GetAlarmTitleByCode(const  ::tf::DeviceType::type t
 
 void DcsControlProxy::ClearAllAlarmShield()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2297,6 +2430,7 @@ void DcsControlProxy::ClearAllAlarmShield()
 
 bool DcsControlProxy::QueryDataAlarm(std::vector<::tf::DataAlarmItem>& _return, const std::string& code)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2322,6 +2456,7 @@ bool DcsControlProxy::QueryDataAlarm(std::vector<::tf::DataAlarmItem>& _return,
 ///
 bool DcsControlProxy::AddQcDoc(::tf::ResultLong& _return, const ::tf::QcDoc& qcDoc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2341,6 +2476,7 @@ bool DcsControlProxy::AddQcDoc(::tf::ResultLong& _return, const ::tf::QcDoc& qcD
 
 bool DcsControlProxy::AddUserInfo(tf::ResultLong& ret, const ::tf::UserInfo& userInfo)
 {
+    PROXY_CALL_RESP(ret);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2355,6 +2491,7 @@ bool DcsControlProxy::AddUserInfo(tf::ResultLong& ret, const ::tf::UserInfo& use
 
 bool DcsControlProxy::DeleteUserInfo(const std::string& userName)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2370,6 +2507,7 @@ bool DcsControlProxy::DeleteUserInfo(const std::string& userName)
 
 bool DcsControlProxy::ModefyUserInfo(const ::tf::UserInfo& userInfo)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2383,6 +2521,7 @@ bool DcsControlProxy::ModefyUserInfo(const ::tf::UserInfo& userInfo)
 
 bool DcsControlProxy::QueryUserInfo(const std::string& userName, std::shared_ptr<tf::UserInfo>& userInfo)
 {
+    PROXY_CALL_RESP(userInfo);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2406,6 +2545,7 @@ bool DcsControlProxy::QueryUserInfo(const std::string& userName, std::shared_ptr
 
 bool DcsControlProxy::QueryAllUserInfo(tf::UserInfoQueryResp& _return, tf::UserInfoQueryCond& uiqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2432,6 +2572,7 @@ bool DcsControlProxy::QueryAllUserInfo(tf::UserInfoQueryResp& _return, tf::UserI
 ///
 bool DcsControlProxy::AddSplReqInfo(tf::ResultLong& _return, const ::tf::SplRequireInfo& splReqInfo)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2457,6 +2598,7 @@ bool DcsControlProxy::AddSplReqInfo(tf::ResultLong& _return, const ::tf::SplRequ
 ///
 bool DcsControlProxy::DeleteSplReqInfo(const ::tf::SplRequireInfoQueryCond& sriqc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2481,6 +2623,7 @@ bool DcsControlProxy::DeleteSplReqInfo(const ::tf::SplRequireInfoQueryCond& sriq
 ///
 bool DcsControlProxy::ModifySplReqInfo(const ::tf::SplRequireInfo& splReqInfo)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2506,6 +2649,7 @@ bool DcsControlProxy::ModifySplReqInfo(const ::tf::SplRequireInfo& splReqInfo)
 ///
 bool DcsControlProxy::QuerySplReqInfo(::tf::SplRequireInfoQueryResp& _return, const ::tf::SplRequireInfoQueryCond& sriqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2530,6 +2674,7 @@ bool DcsControlProxy::QuerySplReqInfo(::tf::SplRequireInfoQueryResp& _return, co
 ///
 bool DcsControlProxy::ModifyQcDoc(tf::ResultLong& ret, const ::tf::QcDoc& qcDoc)
 {
+    PROXY_CALL_RESP(ret);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2560,6 +2705,7 @@ bool DcsControlProxy::ModifyQcDoc(tf::ResultLong& ret, const ::tf::QcDoc& qcDoc)
 ///
 bool DcsControlProxy::QueryQcDoc(::tf::QcDocQueryResp& _return, const ::tf::QcDocQueryCond& cdqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2588,6 +2734,7 @@ bool DcsControlProxy::QueryQcDoc(::tf::QcDocQueryResp& _return, const ::tf::QcDo
 ///
 bool DcsControlProxy::QueryQcDocAll(::tf::QcDocQueryResp& _return)
 {
+    PROXY_CALL_RESP(_return);
     ::tf::QcDocQueryCond tempCond;
     return QueryQcDoc(_return, tempCond);
 }
@@ -2605,6 +2752,7 @@ bool DcsControlProxy::QueryQcDocAll(::tf::QcDocQueryResp& _return)
 ///
 bool DcsControlProxy::QueryQcDocByAssayCode(::tf::QcDocQueryResp & _return, int32_t assayCode)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2635,6 +2783,7 @@ bool DcsControlProxy::QueryQcDocByAssayCode(::tf::QcDocQueryResp & _return, int3
 ///
 bool DcsControlProxy::DeleteQcDoc(const ::tf::QcDocQueryCond& cdgq, std::vector<int64_t>& failedDelete)
 {
+    PROXY_CALL_RESP(failedDelete);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2666,6 +2815,7 @@ bool DcsControlProxy::DeleteQcDoc(const ::tf::QcDocQueryCond& cdgq, std::vector<
 ///
 bool DcsControlProxy::ParseQCBarcodeInfo(::tf::QcBarCodeInfo& _return, const std::string& strBarcode)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2696,6 +2846,7 @@ bool DcsControlProxy::ParseQCBarcodeInfo(::tf::QcBarCodeInfo& _return, const std
 ///
 bool DcsControlProxy::AddMachineFactor(::tf::ResultLong & _return, const::tf::MachineFactor & mf)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2725,6 +2876,7 @@ bool DcsControlProxy::AddMachineFactor(::tf::ResultLong & _return, const::tf::Ma
 ///
 bool DcsControlProxy::ModifyMachineFactor(const std::vector< ::tf::MachineFactor> & mf)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2749,6 +2901,7 @@ bool DcsControlProxy::ModifyMachineFactor(const std::vector< ::tf::MachineFactor
 ///
 bool DcsControlProxy::QueryMachineFactors(::tf::MachineFactorQueryResp & _return, const::tf::MachineFactorQueryCond mfqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2768,6 +2921,7 @@ bool DcsControlProxy::QueryMachineFactors(::tf::MachineFactorQueryResp & _return
 
 bool DcsControlProxy::AddCalcAssayInfo(::tf::ResultLong& _return, const ::tf::CalcAssayInfo& cai)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2787,6 +2941,7 @@ bool DcsControlProxy::AddCalcAssayInfo(::tf::ResultLong& _return, const ::tf::Ca
 
 bool DcsControlProxy::DeleteCalcAssayInfo(const ::tf::CalcAssayInfoQueryCond& caiqc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2800,6 +2955,7 @@ bool DcsControlProxy::DeleteCalcAssayInfo(const ::tf::CalcAssayInfoQueryCond& ca
 
 bool DcsControlProxy::ModifyCalcAssayInfo(const ::tf::CalcAssayInfo& cais)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2813,6 +2969,7 @@ bool DcsControlProxy::ModifyCalcAssayInfo(const ::tf::CalcAssayInfo& cais)
 
 bool DcsControlProxy::QueryCalcAssayInfo(::tf::CalcAssayInfoQueryResp& _return, const ::tf::CalcAssayInfoQueryCond& caiqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2832,6 +2989,7 @@ bool DcsControlProxy::QueryCalcAssayInfo(::tf::CalcAssayInfoQueryResp& _return,
 
 bool DcsControlProxy::AddCalcAssayTestResult(::tf::ResultLong& _return, const ::tf::CalcAssayTestResult& catr)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2851,6 +3009,7 @@ bool DcsControlProxy::AddCalcAssayTestResult(::tf::ResultLong& _return, const ::
 
 bool DcsControlProxy::DeleteCalcAssayTestResult(const ::tf::CalcAssayTestResultQueryCond& catrqc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2864,6 +3023,7 @@ bool DcsControlProxy::DeleteCalcAssayTestResult(const ::tf::CalcAssayTestResultQ
 
 bool DcsControlProxy::ModifyCalcAssayTestResult(const ::tf::CalcAssayTestResult& catr)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2877,8 +3037,19 @@ bool DcsControlProxy::ModifyCalcAssayTestResult(const ::tf::CalcAssayTestResult&
 
 bool DcsControlProxy::QueryCalcAssayTestResult(::tf::CalcAssayTestResultQueryResp& _return, const ::tf::CalcAssayTestResultQueryCond& catrqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
+#ifdef LEONIS_WORKPLACE_BENCH
+    // 替身应答（基准测试）
+    auto spStandIn = std::atomic_load(&s_spStandIn);
+    if (spStandIn != nullptr && spStandIn->queryCalcAssayTestResult)
+    {
+        spStandIn->queryCalcAssayTestResult(_return, catrqc);
+        return _return.result == ::tf::ThriftResult::THRIFT_RESULT_SUCCESS;
+    }
+#endif
+
 	if (nullptr == m_spDcs)
 	{
 		ULOG(LOG_ERROR, "m_spDcs is nullptr");
@@ -2906,6 +3077,7 @@ bool DcsControlProxy::QueryCalcAssayTestResult(::tf::CalcAssayTestResultQueryRes
 ///
 bool DcsControlProxy::SetOutQcRules(int assayCode, const tf::QcJudgeParam& param)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2931,6 +3103,7 @@ bool DcsControlProxy::SetOutQcRules(int assayCode, const tf::QcJudgeParam& param
 ///
 bool DcsControlProxy::UpdateHistoryBaseDataUserUseRetestInfo(::tf::ResultLong& _return, const ::tf::HistoryBaseDataUserUseRetestUpdate& ri)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2961,6 +3134,7 @@ bool DcsControlProxy::UpdateHistoryBaseDataUserUseRetestInfo(::tf::ResultLong& _
 ///
 bool DcsControlProxy::UpdateHistoryBaseDataCheckStatus(::tf::ResultLong& _return, const ::tf::HistoryBaseDataCheckUpdate & cs)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -2980,6 +3154,7 @@ bool DcsControlProxy::UpdateHistoryBaseDataCheckStatus(::tf::ResultLong& _return
 
 bool DcsControlProxy::UpdateHistoryBaseDataPrint(const std::vector<int64_t>& samples, bool isPrinted)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
     if (nullptr == m_spDcs)
@@ -2993,6 +3168,7 @@ bool DcsControlProxy::UpdateHistoryBaseDataPrint(const std::vector<int64_t>& sam
 
 bool DcsControlProxy::QueryDictionary(const std::string& keyName, tf::DictionaryInfo& outVaule)
 {
+    PROXY_CALL_RESP(outVaule);
 	if (nullptr == m_spDcs)
 	{
 		ULOG(LOG_ERROR, "m_spDcs is nullptr");
@@ -3015,6 +3191,7 @@ bool DcsControlProxy::QueryDictionary(const std::string& keyName, tf::Dictionary
 
 int DcsControlProxy::GetDictionaryValueInt(const std::string& keyName, int defaultValue)
 {
+    PROXY_CALL();
     tf::DictionaryInfo dicInfo;
     if (!QueryDictionary(keyName, dicInfo))
     {
@@ -3028,6 +3205,7 @@ int DcsControlProxy::GetDictionaryValueInt(const std::string& keyName, int defau
 
 bool DcsControlProxy::SetDictionaryValueInt(const std::string& keyName, int iValue)
 {  
+	PROXY_CALL();
 	if (nullptr == m_spDcs)
 	{
 		ULOG(LOG_ERROR, "m_spDcs is nullptr");
@@ -3058,6 +3236,7 @@ bool DcsControlProxy::SetDictionaryValueInt(const std::string& keyName, int iVal
 
 bool DcsControlProxy::GetQcLjNoCalculateFlag()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s", __FUNCTION__);
 
     // 不为零则代表设置了显示不计算标记
@@ -3066,12 +3245,14 @@ bool DcsControlProxy::GetQcLjNoCalculateFlag()
 
 void DcsControlProxy::SetQcLjNoCalculateFlag(bool showNoCalculateFlag)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s", __FUNCTION__);
     SetDictionaryValueInt(DKN_UI_QC_LJ_SHOWNOCALCULATE, showNoCalculateFlag);
 }
 
 bool DcsControlProxy::GetQcLjSubPointFlag()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s", __FUNCTION__);
 
     // 不为零则代表设置了显示子点标记
@@ -3080,6 +3261,7 @@ bool DcsControlProxy::GetQcLjSubPointFlag()
 
 void DcsControlProxy::SetQcLjSubPointFlag(bool showSubPoint)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s", __FUNCTION__);
     SetDictionaryValueInt(DKN_UI_QC_LJ_SHOWSUBPOINT, showSubPoint);
 }
@@ -3093,6 +3275,7 @@ void DcsControlProxy::SetQcLjSubPointFlag(bool showSubPoint)
 ///
 bool DcsControlProxy::GetQcTpNoCalculateFlag()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s", __FUNCTION__);
     // 不为零则代表设置了显示子点标记
     return GetDictionaryValueInt(DKN_UI_QC_TP_SHOWNOCALCULATE, 1);
@@ -3109,6 +3292,7 @@ bool DcsControlProxy::GetQcTpNoCalculateFlag()
 ///
 void DcsControlProxy::SetQcTpNoCalculateFlag(bool showNoCalculateFlag)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s", __FUNCTION__);
     SetDictionaryValueInt(DKN_UI_QC_TP_SHOWNOCALCULATE, showNoCalculateFlag);
 }
@@ -3122,23 +3306,27 @@ void DcsControlProxy::SetQcTpNoCalculateFlag(bool showNoCalculateFlag)
 ///
 bool DcsControlProxy::GetAppAssayPositionSearchEditShow()
 {
+    PROXY_CALL();
     return GetDictionaryValueInt(DKN_ENGRETAIN_ASSAYPOSSEARCHSHOW, false);
 }
 
 int DcsControlProxy::GetQcConfigLengthSn()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, __FUNCTION__);
     return GetDictionaryValueInt(DKN_UI_QC_LENGTH_SN, 3);
 }
 
 int DcsControlProxy::GetQcConfigLengthLot()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, __FUNCTION__);
     return GetDictionaryValueInt(DKN_UI_QC_LENGTH_LOT, 7);
 }
 
 int DcsControlProxy::GetQcLevelLimit()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, __FUNCTION__);
     return GetDictionaryValueInt(DKN_UI_QC_LEVEL_LIMIT, 6);
 }
@@ -3152,6 +3340,7 @@ int DcsControlProxy::GetQcLevelLimit()
 ///
 int DcsControlProxy::GetQcBarcodeLength()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, __FUNCTION__);
     return GetDictionaryValueInt(DKN_UI_QC_BARCODE_LENGTH, 498); // 如果获取失败，默认质控二维码长度498
 }
@@ -3165,6 +3354,7 @@ int DcsControlProxy::GetQcBarcodeLength()
 ///
 bool DcsControlProxy::SavePrintSetInfo(const std::vector< ::tf::PrintSetInfo> & pi)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3178,6 +3368,7 @@ bool DcsControlProxy::SavePrintSetInfo(const std::vector< ::tf::PrintSetInfo> &
 
 void DcsControlProxy::GetPrintSetInfo(std::vector< ::tf::PrintSetInfo> & _return)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3191,6 +3382,7 @@ void DcsControlProxy::GetPrintSetInfo(std::vector< ::tf::PrintSetInfo> & _return
 
 std::string DcsControlProxy::GetSeqStartSampleNumber(const std::string& lastSeqNo)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3215,6 +3407,7 @@ std::string DcsControlProxy::GetSeqStartSampleNumber(const std::string& lastSeqN
 ///
 bool DcsControlProxy::GetRolePermision(tf::UserType::type userType, tf::PermissionType::type perType, std::set<int>& vecPermission)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s() userType:%d.", __FUNCTION__, userType);
     vecPermission.clear();
 
@@ -3263,6 +3456,7 @@ bool DcsControlProxy::GetRolePermision(tf::UserType::type userType, tf::Permissi
 
 bool DcsControlProxy::QueryLisConnectionStatus(bool& status)
 {
+    PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3286,6 +3480,7 @@ bool DcsControlProxy::QueryLisConnectionStatus(bool& status)
 ///
 bool DcsControlProxy::GetDilutionRatioListIm(std::vector<int>& lstDuli)
 {
+    PROXY_CALL_RESP(lstDuli);
     lstDuli.clear();
 
     tf::DictionaryInfo dicInfo;
@@ -3318,12 +3513,14 @@ bool DcsControlProxy::GetDilutionRatioListIm(std::vector<int>& lstDuli)
 ///
 void DcsControlProxy::SetAssayTabSignleRowAmount(int rowAmount)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, __FUNCTION__);
     SetDictionaryValueInt(DKN_UI_SETTINGS_SINGLEASSAY_ROW_AMOUNT, rowAmount);
 }
 
 int DcsControlProxy::GetAssayTabSignleRowAmount()
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, __FUNCTION__);
     return GetDictionaryValueInt(DKN_UI_SETTINGS_SINGLEASSAY_ROW_AMOUNT, UI_DEFAULT_ASSAYSELECTTB_SINGLEROW);
 }
@@ -3341,6 +3538,7 @@ int DcsControlProxy::GetAssayTabSignleRowAmount()
 ///
 bool DcsControlProxy::QuerySampleStatisTab(::tf::SampleStatisTabQueryResp & _return, const::tf::SampleStatisTabDataQueryCond & sstdqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3371,6 +3569,7 @@ bool DcsControlProxy::QuerySampleStatisTab(::tf::SampleStatisTabQueryResp & _ret
 ///
 bool DcsControlProxy::QuerySampleStatisPie(::tf::SampleStatisPieQueryResp & _return, const  ::tf::SampleStatisPieQueryCond& sspqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3401,6 +3600,7 @@ bool DcsControlProxy::QuerySampleStatisPie(::tf::SampleStatisPieQueryResp & _ret
 ///
 bool DcsControlProxy::QueryResultStatisCurve(::tf::ResultStatisCurveQueryResp & _return, const::tf::ResultStatisCurveQueryCond & rscqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3431,6 +3631,7 @@ bool DcsControlProxy::QueryResultStatisCurve(::tf::ResultStatisCurveQueryResp &
 ///
 bool DcsControlProxy::QueryStatisCaliTab(::tf::StatisCaliTabQueryResp & _return, const::tf::StatisCaliTabQueryCond & sctqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3461,6 +3662,7 @@ bool DcsControlProxy::QueryStatisCaliTab(::tf::StatisCaliTabQueryResp & _return,
 ///
 bool DcsControlProxy::QueryStatisCaliFailCauseTab(::tf::StatisCaliFailCauseTabQueryResp & _return, const::tf::StatisCaliFailCauseTabQueryCond & scfctqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3491,6 +3693,7 @@ bool DcsControlProxy::QueryStatisCaliFailCauseTab(::tf::StatisCaliFailCauseTabQu
 ///
 bool DcsControlProxy::AddStatisCaliInfo(::tf::ResultLong & _return, const::tf::StatisCali & sc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3521,6 +3724,7 @@ bool DcsControlProxy::AddStatisCaliInfo(::tf::ResultLong & _return, const::tf::S
 ///
 bool DcsControlProxy::QueryStatisReagentCurve(::tf::StatisReagentCurveQueryResp & _return, const::tf::StatisReagentCurveQueryCond & srcqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3553,6 +3757,7 @@ bool DcsControlProxy::QueryStatisReagentCurve(::tf::StatisReagentCurveQueryResp
 ///
 bool DcsControlProxy::QueryDynamicCalVal(::tf::DynamicCalcQueryResp& _return, const bool isReagent, const ::tf::DynamicCalcQueryCond& dcqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3583,6 +3788,7 @@ bool DcsControlProxy::QueryDynamicCalVal(::tf::DynamicCalcQueryResp& _return, co
 ///
 bool DcsControlProxy::QueryStatisSupCurve(::tf::StatisSupCurveQueryResp & _return, const::tf::StatisSupCurveQueryCond & sscqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3613,6 +3819,7 @@ bool DcsControlProxy::QueryStatisSupCurve(::tf::StatisSupCurveQueryResp & _retur
 ///
 bool DcsControlProxy::QueryDeviceSN(::tf::DeviceSNQueryResp & _return, const ::tf::StatisComboBoxQueryCond &scbqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3643,6 +3850,7 @@ bool DcsControlProxy::QueryDeviceSN(::tf::DeviceSNQueryResp & _return, const ::t
 ///
 bool DcsControlProxy::QueryReagentLot(::tf::ReagentLotQueryResp & _return, const ::tf::StatisComboBoxQueryCond &scbqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3673,6 +3881,7 @@ bool DcsControlProxy::QueryReagentLot(::tf::ReagentLotQueryResp & _return, const
 ///
 bool DcsControlProxy::QueryAssayCode(::tf::AssayCodeQueryResp & _return, const ::tf::StatisComboBoxQueryCond &scbqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3703,6 +3912,7 @@ bool DcsControlProxy::QueryAssayCode(::tf::AssayCodeQueryResp & _return, const :
 ///
 bool DcsControlProxy::QueryConsumables(::tf::ConsumablesQueryResp & _return, const ::tf::StatisComboBoxQueryCond &scbqc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3722,6 +3932,7 @@ bool DcsControlProxy::QueryConsumables(::tf::ConsumablesQueryResp & _return, con
 
 bool DcsControlProxy::UnlockFlap(const std::vector<std::string> & deviceSNs, const  ::tf::EnumFlapType::type type)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3746,6 +3957,7 @@ bool DcsControlProxy::UnlockFlap(const std::vector<std::string> & deviceSNs, con
 ///
 bool DcsControlProxy::DownloadQcDocs(::adapter::tf::CloudQcDocResp& _return, const  ::adapter::tf::QueryCloudQcCond& qqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3775,6 +3987,7 @@ bool DcsControlProxy::DownloadQcDocs(::adapter::tf::CloudQcDocResp& _return, con
 ///
 bool DcsControlProxy::LoadAllSubDeviceInfo(std::vector<::tf::SubDeviceInfo>& vecDevice)
 {
+    PROXY_CALL_RESP(vecDevice);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3800,6 +4013,7 @@ bool DcsControlProxy::LoadAllSubDeviceInfo(std::vector<::tf::SubDeviceInfo>& vec
 ///
 bool DcsControlProxy::LoadSensorInfo(std::vector< ::tf::ModuleSensorInfo> & _return, const ::tf::SubDeviceInfo& deviceInfo)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3824,6 +4038,7 @@ bool DcsControlProxy::LoadSensorInfo(std::vector< ::tf::ModuleSensorInfo> & _ret
 ///
 bool DcsControlProxy::StartSensorMonitor(const ::tf::SubDeviceInfo& deviceInfo)
 {
+    PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3847,6 +4062,7 @@ bool DcsControlProxy::StartSensorMonitor(const ::tf::SubDeviceInfo& deviceInfo)
 ///
 bool DcsControlProxy::StopSensorMonitor(const ::tf::SubDeviceInfo& deviceInfo)
 {
+    PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3871,6 +4087,7 @@ bool DcsControlProxy::StopSensorMonitor(const ::tf::SubDeviceInfo& deviceInfo)
 ///
 bool DcsControlProxy::GetCloudAssayParamUrls(::adapter::tf::CloudAssayParamResp& _return, const  ::adapter::tf::QueryCloudAssayParamCond& qcapc)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3901,6 +4118,7 @@ bool DcsControlProxy::GetCloudAssayParamUrls(::adapter::tf::CloudAssayParamResp&
 ///
 bool DcsControlProxy::GetCloudAssayParamInfos(::adapter::tf::CloudAssayParamResp& _return, const std::vector< ::adapter::tf::CloudAssayParam> & lscp)
 {
+    PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	if (nullptr == m_spDcs)
@@ -3920,6 +4138,7 @@ bool DcsControlProxy::GetCloudAssayParamInfos(::adapter::tf::CloudAssayParamResp
 
 ::tf::ResultBool DcsControlProxy::QueryReagentAlarmReaded(const std::string& devSn)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s(devSn=%s)", __FUNCTION__, devSn);
 
 	::tf::ResultBool ret;
@@ -2064,6 +2064,29 @@ private:
     ///
     std::shared_ptr<tf::DcsControlConcurrentClient> GetClient() { return m_spClient; };
 
+#ifdef LEONIS_WORKPLACE_BENCH
+public:
+    ///
+    /// @brief 替身应答（只在WorkplaceBench中编译，脱离DCS运行工作页面基准测试时使用）
+    ///
+    struct StandIn
+    {
+        std::function<void(::tf::SampleInfoQueryResp&, const ::tf::SampleInfoQueryCond&)>                      querySampleInfo;
+        std::function<void(::tf::TestItemQueryResp&, const ::tf::TestItemQueryCond&)>                          queryTestItems;
+        std::function<void(::tf::CalcAssayTestResultQueryResp&, const ::tf::CalcAssayTestResultQueryCond&)>    queryCalcAssayTestResult;
+    };
+
+    ///
+    /// @brief 设置替身，设置后样本、项目和计算项目结果的查询由替身应答
+    ///
+    /// @param[in]  spStandIn  替身（为空表示取消）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static void SetStandIn(const std::shared_ptr<StandIn>& spStandIn);
+#endif
+
 private:
     static std::shared_ptr<DcsControlProxy>                 s_dcp;              ///< 单例对象
     std::shared_ptr<tf::DcsControlConcurrentClient>         m_spClient;         ///< 连接对象
@@ -0,0 +1,423 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     ProxyCallMetrics.cpp
+/// @brief    代理调用统计（按方法记录调用次数、耗时分位数、应答数据量、调用线程）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#include "ProxyCallMetrics.h"
+#include <algorithm>
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QFile>
+#include <QString>
+#include <QThread>
+#include <thrift/protocol/TCompactProtocol.h>
+#include <thrift/protocol/TVirtualProtocol.h>
+#include <thrift/transport/TBufferTransports.h>
+#include "UiNotifyQueue.h"
+#include "src/common/Mlog/mlog.h"
+
+// 每个方法保留的耗时样本数
+#define PROXY_METRICS_MAX_SAMPLES       (1024)
+
+namespace
+{
+    using apache::thrift::protocol::TType;
+    using apache::thrift::protocol::TVirtualProtocol;
+    using apache::thrift::protocol::TCompactProtocolT;
+    using apache::thrift::transport::TTransport;
+    using apache::thrift::transport::TMemoryBuffer;
+
+    ///
+    /// @brief 计数协议：按代理实际使用的压缩协议序列化，同时累计列表/集合/映射的元素个数
+    ///
+    class CountingProtocol : public TVirtualProtocol<CountingProtocol, TCompactProtocolT<TTransport>>
+    {
+    public:
+        explicit CountingProtocol(std::shared_ptr<TTransport> transport)
+            : TVirtualProtocol<CountingProtocol, TCompactProtocolT<TTransport>>(transport)
+            , m_elements(0)
+        {
+        }
+
+        uint32_t writeListBegin(const TType elemType, const uint32_t size)
+        {
+            m_elements += size;
+            return TCompactProtocolT<TTransport>::writeListBegin(elemType, size);
+        }
+
+        uint32_t writeSetBegin(const TType elemType, const uint32_t size)
+        {
+            m_elements += size;
+            return TCompactProtocolT<TTransport>::writeSetBegin(elemType, size);
+        }
+
+        uint32_t writeMapBegin(const TType keyType, const TType valType, const uint32_t size)
+        {
+            m_elements += size;
+            return TCompactProtocolT<TTransport>::writeMapBegin(keyType, valType, size);
+        }
+
+        quint64 Elements() const { return m_elements; }
+
+    private:
+        quint64             m_elements;         ///< 元素个数
+    };
+
+    // 取分位数（样本已排序）
+    qint64 Percentile(const std::vector<qint64>& sorted, int p)
+    {
+        if (sorted.empty())
+        {
+            return 0;
+        }
+
+        size_t index = std::min(sorted.size() - 1, sorted.size() * p / 100);
+        return sorted[index];
+    }
+}
+
+ProxyCallMetrics::ProxyCallMetrics()
+    : m_mode(MODE_SAMPLED)
+    , m_sampleEvery(16)
+{
+    connect(&m_dumpTimer, &QTimer::timeout, this, &ProxyCallMetrics::OnDumpTimer);
+}
+
+///
+/// @brief 获取单例
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+ProxyCallMetrics& ProxyCallMetrics::GetInstance()
+{
+    static ProxyCallMetrics instance;
+    return instance;
+}
+
+///
+/// @brief 启动定期输出（须在界面线程调用）
+///
+/// @param[in]  dumpFile         输出文件（每次覆盖）
+/// @param[in]  dumpIntervalSec  输出间隔（秒）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ProxyCallMetrics::Start(const std::string& dumpFile, int dumpIntervalSec)
+{
+    ULOG(LOG_INFO, "%s(file: %s, interval: %d, mode: %d)", __FUNCTION__, dumpFile.c_str(), dumpIntervalSec, int(GetMode()));
+    m_dumpFile = dumpFile;
+
+    if (dumpIntervalSec > 0)
+    {
+        m_dumpTimer.start(dumpIntervalSec * 1000);
+    }
+}
+
+///
+/// @brief 停止定期输出并写入最后一次统计
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ProxyCallMetrics::Stop()
+{
+    if (m_dumpFile.empty())
+    {
+        return;
+    }
+
+    m_dumpTimer.stop();
+    OnDumpTimer();
+    m_dumpFile.clear();
+}
+
+///
+/// @brief 设置统计模式
+///
+/// @param[in]  mode         统计模式
+/// @param[in]  sampleEvery  采样模式下每多少次调用取一次样本
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ProxyCallMetrics::SetMode(MODE mode, quint32 sampleEvery)
+{
+    ULOG(LOG_INFO, "%s(mode: %d, sampleEvery: %u)", __FUNCTION__, int(mode), sampleEvery);
+    m_sampleEvery.store(std::max<quint32>(1, sampleEvery), std::memory_order_relaxed);
+    m_mode.store(mode, std::memory_order_relaxed);
+}
+
+///
+/// @brief 本次调用是否取样本（调用次数按线程计数）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool ProxyCallMetrics::ShouldSample() const
+{
+    if (GetMode() == MODE_FULL)
+    {
+        return true;
+    }
+
+    static thread_local quint32 s_tick = 0;
+    return (++s_tick % m_sampleEvery.load(std::memory_order_relaxed)) == 0;
+}
+
+///
+/// @brief 记录一次调用
+///
+/// @param[in]  name      方法名（须为字符串常量，只保存指针）
+/// @param[in]  ns        耗时（纳秒）
+/// @param[in]  sampled   是否为样本
+/// @param[in]  elements  应答元素个数（样本且有应答时有效）
+/// @param[in]  bytes     应答字节数（样本且有应答时有效）
+/// @param[in]  payload   是否统计了应答数据量
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ProxyCallMetrics::Record(const char* name, qint64 ns, bool sampled, quint64 elements, quint64 bytes, bool payload)
+{
+    if (name == nullptr)
+    {
+        return;
+    }
+
+    QCoreApplication* app = QCoreApplication::instance();
+    bool guiThread = (app != nullptr) && (QThread::currentThread() == app->thread());
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Stat& stat = m_stats[name];
+    ++stat.calls;
+    stat.guiCalls += guiThread ? 1 : 0;
+    stat.totalNs += ns;
+    stat.maxNs = std::max(stat.maxNs, ns);
+
+    if (!sampled)
+    {
+        return;
+    }
+
+    ++stat.sampleCount;
+    if (stat.samples.size() < PROXY_METRICS_MAX_SAMPLES)
+    {
+        stat.samples.push_back(ns);
+    }
+    else
+    {
+        stat.samples[stat.next] = ns;
+        stat.next = (stat.next + 1) % PROXY_METRICS_MAX_SAMPLES;
+    }
+
+    if (payload)
+    {
+        ++stat.payloadCount;
+        stat.totalElements += elements;
+        stat.maxElements = std::max(stat.maxElements, elements);
+        stat.totalBytes += bytes;
+        stat.maxBytes = std::max(stat.maxBytes, bytes);
+    }
+}
+
+///
+/// @brief 获取统计摘要（按总耗时从大到小排序）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<ProxyCallMetrics::Summary> ProxyCallMetrics::Snapshot() const
+{
+    std::map<const char*, Stat, NameLess> stats;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        stats = m_stats;
+    }
+
+    std::vector<Summary> summaries;
+    summaries.reserve(stats.size());
+    for (auto& item : stats)
+    {
+        Stat& stat = item.second;
+        if (stat.calls == 0)
+        {
+            continue;
+        }
+
+        std::sort(stat.samples.begin(), stat.samples.end());
+
+        Summary summary;
+        summary.name = item.first;
+        summary.calls = stat.calls;
+        summary.guiCalls = stat.guiCalls;
+        summary.samples = stat.sampleCount;
+        summary.totalMs = stat.totalNs / 1e6;
+        summary.meanMs = summary.totalMs / stat.calls;
+        summary.p50Ms = Percentile(stat.samples, 50) / 1e6;
+        summary.p90Ms = Percentile(stat.samples, 90) / 1e6;
+        summary.p99Ms = Percentile(stat.samples, 99) / 1e6;
+        summary.maxMs = stat.maxNs / 1e6;
+        if (stat.payloadCount > 0)
+        {
+            summary.meanElements = double(stat.totalElements) / stat.payloadCount;
+            summary.maxElements = stat.maxElements;
+            summary.meanBytes = double(stat.totalBytes) / stat.payloadCount;
+            summary.maxBytes = stat.maxBytes;
+        }
+
+        summaries.push_back(std::move(summary));
+    }
+
+    std::sort(summaries.begin(), summaries.end(), [](const Summary& lhs, const Summary& rhs)
+    {
+        return lhs.totalMs > rhs.totalMs;
+    });
+
+    return summaries;
+}
+
+///
+/// @brief 清空统计
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ProxyCallMetrics::Reset()
+{
+    ULOG(LOG_INFO, "%s()", __FUNCTION__);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.clear();
+}
+
+///
+/// @brief 生成文本报告（每个方法一行）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::string ProxyCallMetrics::Report() const
+{
+    QString report = QString("%1 %2 %3 %4 %5 %6 %7 %8 %9")
+        .arg("method", -48).arg("calls", 8).arg("gui", 8).arg("samples", 8).arg("total(ms)", 12)
+        .arg("mean", 9).arg("p50", 9).arg("p90", 9).arg("p99", 9);
+    report += QString(" %1 %2 %3 %4\n").arg("max", 9).arg("elems", 9).arg("maxElems", 9).arg("bytes", 10);
+
+    for (const Summary& summary : Snapshot())
+    {
+        report += QString("%1 %2 %3 %4 %5 %6 %7 %8 %9")
+            .arg(QString::fromStdString(summary.name), -48)
+            .arg(summary.calls, 8)
+            .arg(summary.guiCalls, 8)
+            .arg(summary.samples, 8)
+            .arg(summary.totalMs, 12, 'f', 1)
+            .arg(summary.meanMs, 9, 'f', 2)
+            .arg(summary.p50Ms, 9, 'f', 2)
+            .arg(summary.p90Ms, 9, 'f', 2)
+            .arg(summary.p99Ms, 9, 'f', 2);
+        report += QString(" %1 %2 %3 %4\n")
+            .arg(summary.maxMs, 9, 'f', 2)
+            .arg(summary.meanElements, 9, 'f', 1)
+            .arg(summary.maxElements, 9)
+            .arg(summary.meanBytes, 10, 'f', 0);
+    }
+
+    return report.toStdString();
+}
+
+///
+/// @brief 统计thrift结构的应答数据量（序列化一次，累计列表/集合/映射的元素个数）
+///
+/// @param[in]  obj       thrift结构
+/// @param[out] elements  累加元素个数
+/// @param[out] bytes     累加序列化字节数
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ProxyCallMetrics::MeasureThrift(const apache::thrift::TBase& obj, quint64& elements, quint64& bytes)
+{
+    try
+    {
+        CountingProtocol protocol(std::make_shared<TMemoryBuffer>());
+        bytes += obj.write(&protocol);
+        elements += protocol.Elements();
+    }
+    catch (std::exception& ex)
+    {
+        ULOG(LOG_WARN, "%s(measure failed: %s)", __FUNCTION__, ex.what());
+    }
+}
+
+///
+/// @brief 定期输出统计到文件
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ProxyCallMetrics::OnDumpTimer()
+{
+    if (m_dumpFile.empty())
+    {
+        return;
+    }
+
+    QFile file(QString::fromStdString(m_dumpFile));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+    {
+        ULOG(LOG_WARN, "%s(open %s failed)", __FUNCTION__, m_dumpFile.c_str());
+        return;
+    }
+
+    QString header = QString("time: %1, mode: %2, sampleEvery: %3\n")
+        .arg(QDateTime::currentDateTime().toString("yyyy-MM-dd hh:mm:ss"))
+        .arg(int(GetMode()))
+        .arg(m_sampleEvery.load(std::memory_order_relaxed));
+    file.write(header.toUtf8());
+    file.write(Report().c_str());
+
+    // 界面通知入站队列的积压和排队时间
+    file.write("\n");
+    file.write(UiNotifyQueue::GetInstance().Report().c_str());
+}
@@ -0,0 +1,386 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     ProxyCallMetrics.h
+/// @brief    代理调用统计（按方法记录调用次数、耗时分位数、应答数据量、调用线程）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <thrift/TBase.h>
+#include "shared/UiWatchdog.h"
+
+///
+/// @brief 代理调用统计
+///     DcsControlProxy及各LogicControlProxy的每个方法入口放置一个统计作用域，按方法名记录：
+///     调用次数、界面线程调用次数、耗时（平均/P50/P90/P99/最大）、应答元素个数和序列化字节数；
+///     采样模式下每次调用只累计次数和耗时，每N次调用取一次耗时样本并统计应答数据量；
+///     统计结果可在诊断弹窗查看，并定期覆盖写入日志目录下的文件
+///
+class ProxyCallMetrics : public QObject
+{
+    Q_OBJECT
+
+public:
+    ///
+    /// @brief 统计模式
+    ///
+    enum MODE
+    {
+        MODE_OFF = 0,                   ///< 关闭
+        MODE_SAMPLED,                   ///< 采样（默认）
+        MODE_FULL                       ///< 每次调用都统计
+    };
+
+    ///
+    /// @brief 单个方法的统计摘要
+    ///
+    struct Summary
+    {
+        std::string     name;               ///< 方法名
+        quint64         calls = 0;          ///< 调用次数
+        quint64         guiCalls = 0;       ///< 界面线程上的调用次数
+        quint64         samples = 0;        ///< 样本次数
+        double          totalMs = 0;        ///< 总耗时（毫秒）
+        double          meanMs = 0;         ///< 平均耗时
+        double          p50Ms = 0;          ///< P50耗时
+        double          p90Ms = 0;          ///< P90耗时
+        double          p99Ms = 0;          ///< P99耗时
+        double          maxMs = 0;          ///< 最大耗时
+        double          meanElements = 0;   ///< 平均应答元素个数
+        quint64         maxElements = 0;    ///< 最大应答元素个数
+        double          meanBytes = 0;      ///< 平均应答字节数
+        quint64         maxBytes = 0;       ///< 最大应答字节数
+    };
+
+    ///
+    /// @brief 获取单例
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static ProxyCallMetrics& GetInstance();
+
+    ///
+    /// @brief 启动定期输出（须在界面线程调用）
+    ///
+    /// @param[in]  dumpFile         输出文件（每次覆盖）
+    /// @param[in]  dumpIntervalSec  输出间隔（秒）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Start(const std::string& dumpFile, int dumpIntervalSec);
+
+    ///
+    /// @brief 停止定期输出并写入最后一次统计
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Stop();
+
+    ///
+    /// @brief 设置统计模式
+    ///
+    /// @param[in]  mode         统计模式
+    /// @param[in]  sampleEvery  采样模式下每多少次调用取一次样本
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void SetMode(MODE mode, quint32 sampleEvery = 16);
+
+    ///
+    /// @brief 获取统计模式
+    ///
+    MODE GetMode() const { return MODE(m_mode.load(std::memory_order_relaxed)); }
+
+    ///
+    /// @brief 本次调用是否取样本（调用次数按线程计数）
+    ///
+    bool ShouldSample() const;
+
+    ///
+    /// @brief 记录一次调用
+    ///
+    /// @param[in]  name      方法名（须为字符串常量，只保存指针）
+    /// @param[in]  ns        耗时（纳秒）
+    /// @param[in]  sampled   是否为样本
+    /// @param[in]  elements  应答元素个数（样本且有应答时有效）
+    /// @param[in]  bytes     应答字节数（样本且有应答时有效）
+    /// @param[in]  payload   是否统计了应答数据量
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Record(const char* name, qint64 ns, bool sampled, quint64 elements, quint64 bytes, bool payload);
+
+    ///
+    /// @brief 获取统计摘要（按总耗时从大到小排序）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::vector<Summary> Snapshot() const;
+
+    ///
+    /// @brief 清空统计
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Reset();
+
+    ///
+    /// @brief 生成文本报告（每个方法一行）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::string Report() const;
+
+    ///
+    /// @brief 统计thrift结构的应答数据量（序列化一次，累计列表/集合/映射的元素个数）
+    ///
+    /// @param[in]  obj       thrift结构
+    /// @param[out] elements  累加元素个数
+    /// @param[out] bytes     累加序列化字节数
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static void MeasureThrift(const apache::thrift::TBase& obj, quint64& elements, quint64& bytes);
+
+protected Q_SLOTS:
+    ///
+    /// @brief 定期输出统计到文件
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnDumpTimer();
+
+private:
+    ProxyCallMetrics();
+
+    ///
+    /// @brief 单个方法的统计
+    ///
+    struct Stat
+    {
+        quint64                 calls = 0;          ///< 调用次数
+        quint64                 guiCalls = 0;       ///< 界面线程上的调用次数
+        qint64                  totalNs = 0;        ///< 总耗时
+        qint64                  maxNs = 0;          ///< 最大耗时
+        std::vector<qint64>     samples;            ///< 耗时样本（环形）
+        size_t                  next = 0;           ///< 样本满后下一个覆盖的位置
+        quint64                 sampleCount = 0;    ///< 样本次数
+        quint64                 payloadCount = 0;   ///< 统计了应答数据量的次数
+        quint64                 totalElements = 0;  ///< 应答元素总数
+        quint64                 maxElements = 0;    ///< 最大应答元素个数
+        quint64                 totalBytes = 0;     ///< 应答总字节数
+        quint64                 maxBytes = 0;       ///< 最大应答字节数
+    };
+
+    ///
+    /// @brief 按字符串内容比较方法名
+    ///
+    struct NameLess
+    {
+        bool operator()(const char* lhs, const char* rhs) const { return std::strcmp(lhs, rhs) < 0; }
+    };
+
+private:
+    std::atomic<int>                            m_mode;             ///< 统计模式
+    std::atomic<quint32>                        m_sampleEvery;      ///< 采样间隔
+    mutable std::mutex                          m_mutex;            ///< 统计锁
+    std::map<const char*, Stat, NameLess>       m_stats;            ///< 方法名到统计
+    QTimer                                      m_dumpTimer;        ///< 定期输出定时器
+    std::string                                 m_dumpFile;         ///< 输出文件
+};
+
+namespace proxy_metrics
+{
+    ///
+    /// @brief 统计应答数据量：thrift结构序列化统计，其它类型不统计
+    ///
+    template<typename T>
+    inline bool Measure(const T& obj, quint64& elements, quint64& bytes, std::true_type)
+    {
+        ProxyCallMetrics::MeasureThrift(obj, elements, bytes);
+        return true;
+    }
+
+    template<typename T>
+    inline bool Measure(const T&, quint64&, quint64&, std::false_type)
+    {
+        return false;
+    }
+
+    template<typename T>
+    inline bool Measure(const T& obj, quint64& elements, quint64& bytes)
+    {
+        return Measure(obj, elements, bytes, std::is_base_of<apache::thrift::TBase, T>());
+    }
+
+    ///
+    /// @brief 统计应答数据量：列表按元素个数计，元素为thrift结构时再累计其数据量
+    ///
+    template<typename T>
+    inline bool Measure(const std::vector<T>& objs, quint64& elements, quint64& bytes)
+    {
+        elements += objs.size();
+        if (std::is_base_of<apache::thrift::TBase, T>::value)
+        {
+            for (const auto& obj : objs)
+            {
+                Measure(obj, elements, bytes);
+            }
+        }
+        else
+        {
+            bytes += objs.size() * sizeof(T);
+        }
+
+        return true;
+    }
+}
+
+///
+/// @brief 代理调用统计作用域（同时作为界面看门狗的调用点）
+///
+class ProxyCallScope
+{
+public:
+    explicit ProxyCallScope(const char* name)
+        : m_uiCallSite(name)
+        , m_name(nullptr)
+        , m_sampled(false)
+    {
+        ProxyCallMetrics& metrics = ProxyCallMetrics::GetInstance();
+        if (metrics.GetMode() == ProxyCallMetrics::MODE_OFF)
+        {
+            return;
+        }
+
+        m_name = name;
+        m_sampled = metrics.ShouldSample();
+        m_timer.start();
+    }
+
+    ~ProxyCallScope()
+    {
+        if (m_name != nullptr)
+        {
+            Finish(m_timer.nsecsElapsed(), 0, 0, false);
+        }
+    }
+
+protected:
+    ///
+    /// @brief 记录本次调用
+    ///
+    void Finish(qint64 ns, quint64 elements, quint64 bytes, bool payload)
+    {
+        ProxyCallMetrics::GetInstance().Record(m_name, ns, m_sampled, elements, bytes, payload);
+        m_name = nullptr;
+    }
+
+    bool IsSampled() const { return m_name != nullptr && m_sampled; }
+
+    qint64 ElapsedNs() const { return m_timer.nsecsElapsed(); }
+
+private:
+    Q_DISABLE_COPY(ProxyCallScope)
+
+    UiCallSite          m_uiCallSite;       ///< 界面看门狗调用点
+    const char*         m_name;             ///< 方法名，为空时不记录
+    bool                m_sampled;          ///< 是否为样本
+    QElapsedTimer       m_timer;            ///< 计时
+};
+
+///
+/// @brief 带应答的代理调用统计作用域（样本调用结束时统计应答数据量）
+///
+template<typename T>
+class ProxyRespScope : public ProxyCallScope
+{
+public:
+    ProxyRespScope(const char* name, const T* resp)
+        : ProxyCallScope(name)
+        , m_resp(resp)
+    {
+    }
+
+    ~ProxyRespScope()
+    {
+        if (!IsSampled())
+        {
+            return;
+        }
+
+        // 耗时不包含数据量统计本身
+        qint64 ns = ElapsedNs();
+        quint64 elements = 0;
+        quint64 bytes = 0;
+        bool payload = proxy_metrics::Measure(*m_resp, elements, bytes);
+        Finish(ns, elements, bytes, payload);
+    }
+
+private:
+    const T*            m_resp;             ///< 应答
+};
+
+// 以当前函数名统计代理调用
+#define PROXY_CALL()            ProxyCallScope proxyCall(__FUNCTION__)
+
+// 以当前函数名统计代理调用，并统计应答数据量
+#define PROXY_CALL_RESP(resp)   ProxyRespScope<std::decay<decltype(resp)>::type> proxyCall(__FUNCTION__, &(resp))
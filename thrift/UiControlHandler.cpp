@@ -55,6 +55,138 @@
 #include "shared/uicommon.h"
 #include "manager/SystemPowerManager.h"
 #include "DcsControlProxy.h"
+#include "UiNotifyQueue.h"
+
+namespace
+{
+///
+/// @brief
+///     合并排队中的设备状态通知（只覆盖新通知中设置了的字段）
+///
+/// @param[in]  pending  排队中的通知
+/// @param[in]  newer    新通知
+///
+/// @return 不能合并时返回false（两次通知的状态不同，状态跳变须依次投递）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool MergeDeviceStatus(tf::DeviceInfo& pending, const tf::DeviceInfo& newer)
+{
+    if (pending.__isset.status && newer.__isset.status && pending.status != newer.status)
+    {
+        return false;
+    }
+
+    if (newer.__isset.status)
+    {
+        pending.__set_status(newer.status);
+    }
+    if (newer.__isset.iomStatus)
+    {
+        pending.__set_iomStatus(newer.iomStatus);
+    }
+    if (newer.__isset.otherInfo)
+    {
+        pending.__set_otherInfo(newer.otherInfo);
+    }
+
+    return true;
+}
+
+///
+/// @brief
+///     按名称更新或追加列表项
+///
+/// @param[in]  items   排队中的列表
+/// @param[in]  newer   新列表
+/// @param[in]  keyOf   取名称
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+template<typename T, typename KEY>
+void UpsertByName(std::vector<T>& items, const std::vector<T>& newer, KEY keyOf)
+{
+    for (const T& item : newer)
+    {
+        auto it = std::find_if(items.begin(), items.end(), [&](const T& old) { return keyOf(old) == keyOf(item); });
+        if (it != items.end())
+        {
+            *it = item;
+        }
+        else
+        {
+            items.push_back(item);
+        }
+    }
+}
+
+///
+/// @brief
+///     合并排队中的单元状态通知（温度、液路、单元按名称更新，计数按模块和名称更新）
+///
+/// @param[in]  pending  排队中的通知
+/// @param[in]  newer    新通知
+///
+/// @return 总是可以合并
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool MergeUnitStatus(tf::UnitStatusInfo& pending, const tf::UnitStatusInfo& newer)
+{
+    UpsertByName(pending.temperautureInfos, newer.temperautureInfos, [](const tf::TemperautureInfo& ti) { return ti.subDevName; });
+    UpsertByName(pending.liquidPathInfos, newer.liquidPathInfos, [](const tf::LiquidPathInfo& li) { return li.name; });
+    UpsertByName(pending.unitInfos, newer.unitInfos, [](const tf::UnitInfo& ui) { return ui.name; });
+    for (const auto& ci : newer.countInfos)
+    {
+        UpsertByName(pending.countInfos[ci.first], ci.second, [](const tf::CountInfo& info) { return info.unitName + "/" + info.name; });
+    }
+    if (newer.__isset.wasteCnt)
+    {
+        pending.__set_wasteCnt(newer.wasteCnt);
+    }
+
+    return true;
+}
+
+///
+/// @brief
+///     合并排队中的传感器状态通知（按传感器索引更新）
+///
+/// @param[in]  pending  排队中的通知
+/// @param[in]  newer    新通知
+///
+/// @return 总是可以合并
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool MergeSensorStatus(std::pair<tf::SubDeviceInfo, QMap<int, tf::EmSensorResultType::type>>& pending,
+    const std::pair<tf::SubDeviceInfo, QMap<int, tf::EmSensorResultType::type>>& newer)
+{
+    pending.first = newer.first;
+    for (auto it = newer.second.constBegin(); it != newer.second.constEnd(); ++it)
+    {
+        pending.second.insert(it.key(), it.value());
+    }
+
+    return true;
+}
+
+///
+/// @brief
+///     值相同的通知才合并（开关类通知须保留每次跳变）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool MergeIfEqual(bool& pending, const bool& newer)
+{
+    return pending == newer;
+}
+}
 
 ///
 /// @brief
@@ -69,14 +201,14 @@ void UiControlHandler::NotifyDeviceStatus(const ::tf::DeviceInfo& deviceInfo)
 {
     ULOG(LOG_INFO, "%s(%s)", __FUNCTION__, ToString(deviceInfo).c_str());
     // 发送设备状态信息,使通用信息管理器更新
-    POST_MESSAGE(MSG_ID_DCS_REPORT_STATUS_CHANGED, deviceInfo);
+    QUEUE_NOTIFY_MERGED(MSG_ID_DCS_REPORT_STATUS_CHANGED, deviceInfo.deviceSN, deviceInfo, MergeDeviceStatus);
 }
 
 void UiControlHandler::NotifyCanAppendTest(const std::string& devSN, const std::set<::tf::FaultAffectAppendTest::type>& faats)
 {
     ULOG(LOG_INFO, "%s(%s, %s)", __FUNCTION__, devSN, ToString(faats));
 
-	POST_MESSAGE(MSG_ID_DEVS_CAN_APPEND_TEST, QString::fromStdString(devSN), faats);
+	QUEUE_NOTIFY(MSG_ID_DEVS_CAN_APPEND_TEST, QString::fromStdString(devSN), faats);
 }
 
 ///
@@ -93,14 +225,14 @@ void UiControlHandler::NotifySampleUpdate(const ::tf::UpdateType::type enUpdateT
 {
 	ULOG(LOG_INFO, "%s(%s)", __FUNCTION__, ToString(lstSIs).c_str());
     // 将样本信息更新消息发送到UI消息总线
-    POST_MESSAGE(MSG_ID_SAMPLE_INFO_UPDATE, enUpdateType, const_cast<std::vector<tf::SampleInfo>&>(lstSIs));
+    QUEUE_NOTIFY(MSG_ID_SAMPLE_INFO_UPDATE, enUpdateType, const_cast<std::vector<tf::SampleInfo>&>(lstSIs));
 }
 
 void UiControlHandler::NotifyTestItemUpdate(const ::tf::UpdateType::type enUpdateType, const std::vector<::tf::TestItem>& lstTestItems)
 {
 	ULOG(LOG_INFO, "%s(%s)", __FUNCTION__, ToString(lstTestItems).c_str());
 	// 将样本项目信息更新消息发送到UI消息总线
-	POST_MESSAGE(MSG_ID_SAMPLE_TEST_ITEM_UPDATE, enUpdateType, const_cast<std::vector<::tf::TestItem>&>(lstTestItems));
+	QUEUE_NOTIFY(MSG_ID_SAMPLE_TEST_ITEM_UPDATE, enUpdateType, const_cast<std::vector<::tf::TestItem>&>(lstTestItems));
 }
 
 ///
@@ -117,21 +249,21 @@ void UiControlHandler::NotifySampleLisUpdate(const int64_t sampleID)
 {
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	// 发送到UI消息总线
-	POST_MESSAGE(MSG_ID_SAMPLE_LIS_UPDATE, sampleID);
+	QUEUE_NOTIFY(MSG_ID_SAMPLE_LIS_UPDATE, sampleID);
 }
 
 void UiControlHandler::NotifyDeviceFaultInfo(const ::tf::AlarmDesc& alarmDesc)
 {
 	ULOG(LOG_INFO, "%s(%s)", __FUNCTION__, ToString(alarmDesc).c_str());
 	// 发送告警日志更新信息到UI消息总线
-	POST_MESSAGE(MSG_ID_DEVS_FAULT_INFO, alarmDesc);
+	QUEUE_NOTIFY(MSG_ID_DEVS_FAULT_INFO, alarmDesc);
 }
 
 void UiControlHandler::NotifyDisCurrentAlarm(const ::tf::AlarmDesc& alarmDesc)
 {
     ULOG(LOG_INFO, "%s(%s)", __FUNCTION__, ToString(alarmDesc).c_str());
     // 发送告警日志更新信息到UI消息总线
-    POST_MESSAGE(MSG_ID_DEVS_DIS_ALARM, alarmDesc);
+    QUEUE_NOTIFY(MSG_ID_DEVS_DIS_ALARM, alarmDesc);
 }
 
 void UiControlHandler::NotifyUpdateCurrentAlarm(const ::tf::AlarmDesc& alarmDesc, const bool increaseParams)
@@ -139,7 +271,7 @@ void UiControlHandler::NotifyUpdateCurrentAlarm(const ::tf::AlarmDesc& alarmDesc
     ULOG(LOG_INFO, "%s(%s, %d)", __FUNCTION__, ToString(alarmDesc), increaseParams);
     
     // 将报警信息详情更新消息发送到UI消息总线
-    POST_MESSAGE(MSG_ID_ALARM_DETAIL_UPDATE, alarmDesc, increaseParams);
+    QUEUE_NOTIFY(MSG_ID_ALARM_DETAIL_UPDATE, alarmDesc, increaseParams);
 }
 
 void UiControlHandler::NotifyAlarmReaded(const std::vector< ::tf::AlarmDesc> & alarmDescs)
@@ -147,7 +279,7 @@ void UiControlHandler::NotifyAlarmReaded(const std::vector< ::tf::AlarmDesc> & a
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
     // 将报警信息更新消息发送到UI消息总线
-    POST_MESSAGE(MSG_ID_ALARM_READED, const_cast<std::vector<tf::AlarmDesc>&>(alarmDescs));
+    QUEUE_NOTIFY(MSG_ID_ALARM_READED, const_cast<std::vector<tf::AlarmDesc>&>(alarmDescs));
 }
 
 ///
@@ -162,7 +294,7 @@ void UiControlHandler::NotifyQcDocInfoUpdate(const std::vector<::tf::QcDocUpdate
 {
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
     // 将质控文档信息更新消息发送到UI消息总线
-    POST_MESSAGE(MSG_ID_QC_DOC_INFO_UPDATE, const_cast<std::vector<tf::QcDocUpdate>&>(infos));
+    QUEUE_NOTIFY(MSG_ID_QC_DOC_INFO_UPDATE, const_cast<std::vector<tf::QcDocUpdate>&>(infos));
 }
 
 ///
@@ -178,7 +310,7 @@ void UiControlHandler::NotifyUnitStatusInfo(const ::tf::UnitStatusInfo& statusIn
 	ULOG(LOG_INFO, "%s", __FUNCTION__);
 	// 发送温度更新信息到UI消息总线
 
-	POST_MESSAGE(MSG_ID_DEVICE_STATUS_INFO, statusInfo);
+	QUEUE_NOTIFY_MERGED(MSG_ID_DEVICE_STATUS_INFO, statusInfo.devSn, statusInfo, MergeUnitStatus);
 }
 
 ///
@@ -195,7 +327,7 @@ void UiControlHandler::ReportMaintainItemInfo(const std::string& devSN, const in
 {
 	ULOG(LOG_INFO, "%s : %s", __FUNCTION__, ToString(mier));
 
-	POST_MESSAGE(MSG_ID_MAINTAIN_ITEM_UPDATE, QString::fromStdString(devSN), groupId, mier);
+	QUEUE_NOTIFY(MSG_ID_MAINTAIN_ITEM_UPDATE, QString::fromStdString(devSN), groupId, mier);
 }
 
 ///
@@ -210,7 +342,7 @@ void UiControlHandler::ReportMaintainItemInfo(const std::string& devSN, const in
 void UiControlHandler::ReportMaintainGroupInfo(const ::tf::LatestMaintainInfo& lmi)
 {
 	ULOG(LOG_INFO, "%s : %s", __FUNCTION__, ToString(lmi));
-	POST_MESSAGE(MSG_ID_MAINTAIN_GROUP_UPDATE, lmi);
+	QUEUE_NOTIFY(MSG_ID_MAINTAIN_GROUP_UPDATE, lmi);
 }
 
 ///
@@ -233,14 +365,14 @@ void UiControlHandler::ReportMaintainDataInit(const std::string& devSN)
 void UiControlHandler::NotifyAlarmShieldClearAll()
 {
     ULOG(LOG_INFO, "%s", __FUNCTION__);
-    POST_MESSAGE(MSG_ID_ALARM_SHIELD_CLEAR_ALL);
+    QUEUE_NOTIFY(MSG_ID_ALARM_SHIELD_CLEAR_ALL);
 }
 
 void UiControlHandler::NotifyLisConnectionStatus(const bool status)
 {
 	ULOG(LOG_INFO, "%s : status:%d", __FUNCTION__,status);
 
-	POST_MESSAGE(MSG_ID_LIS_CONNECTION_STATUS, status);
+	QUEUE_NOTIFY_MERGED(MSG_ID_LIS_CONNECTION_STATUS, std::string(), status, MergeIfEqual);
 }
 
 ///
@@ -255,7 +387,7 @@ void UiControlHandler::NotifyLisConnectionStatus(const bool status)
 void UiControlHandler::NotifyRecycleRackUpdate(const int32_t trayNo, const std::vector< ::tf::RecycleRackInfo> & rackInfo)
 {
 	ULOG(LOG_INFO, "%s(tray: %d { %s })", __FUNCTION__, trayNo, ToString(rackInfo).c_str());
-	POST_MESSAGE(MSG_ID_RACK_RECYCLE_UPDATE, trayNo, const_cast<std::vector<tf::RecycleRackInfo>&>(rackInfo));
+	QUEUE_NOTIFY(MSG_ID_RACK_RECYCLE_UPDATE, trayNo, const_cast<std::vector<tf::RecycleRackInfo>&>(rackInfo));
 }
 
 ///
@@ -270,12 +402,12 @@ void UiControlHandler::NotifyQcResultUpdate(const std::string& devceSn, const in
     ULOG(LOG_INFO, "%s", __FUNCTION__);
     QVector<int64_t> vUpdateId;
     std::copy(std::begin(updatedId), std::end(updatedId), std::back_inserter(vUpdateId));
-    POST_MESSAGE(MSG_ID_QC_RESULT_UPDATE, QString::fromStdString(devceSn), qcDocId, vUpdateId);
+    QUEUE_NOTIFY(MSG_ID_QC_RESULT_UPDATE, QString::fromStdString(devceSn), qcDocId, vUpdateId);
 }
 
 void UiControlHandler::NotifyTrackStatusUpdate(const ::track::tf::LowerStatusInfo& statusInfo)
 {
-	POST_MESSAGE(MSG_ID_TRACT_STATE_UPDATE, const_cast<::track::tf::LowerStatusInfo&>(statusInfo));
+	QUEUE_NOTIFY(MSG_ID_TRACT_STATE_UPDATE, const_cast<::track::tf::LowerStatusInfo&>(statusInfo));
 }
 
 ///
@@ -295,7 +427,7 @@ void UiControlHandler::NotifySensorStatusUpdate(const ::tf::SubDeviceInfo& devic
         qtMapStatuss.insert(p.first, p.second);
     }
 
-	POST_MESSAGE(MSG_ID_SENSOR_STATUS_UPDATE, deviceInfo, qtMapStatuss);
+	QUEUE_NOTIFY_MERGED(MSG_ID_SENSOR_STATUS_UPDATE, deviceInfo.deviceName, std::make_pair(deviceInfo, qtMapStatuss), MergeSensorStatus);
 }
 
 ///
@@ -310,7 +442,7 @@ void UiControlHandler::NotifySensorStatusUpdate(const ::tf::SubDeviceInfo& devic
 ///
 void UiControlHandler::NotifyConsumableChangeLog(const ::tf::ConsumableChangeLog& ccl)
 {
-	POST_MESSAGE(MSG_ID_CONSUMABLE_CHANGE_LOG_UPDATE, const_cast<::tf::ConsumableChangeLog&>(ccl));
+	QUEUE_NOTIFY(MSG_ID_CONSUMABLE_CHANGE_LOG_UPDATE, const_cast<::tf::ConsumableChangeLog&>(ccl));
 }
 
 void UiControlHandler::NotifyDevServiceLefTime(const int32_t totalSeconds, const std::map<std::string, int32_t> & sn2seconds)
@@ -321,12 +453,14 @@ void UiControlHandler::NotifyDevServiceLefTime(const int32_t totalSeconds, const
 		qtSn2seconds[p.first.c_str()] = p.second;
 	}
 
-	POST_MESSAGE(MSG_ID_DEV_COUNT_DOWN_UPDATE, totalSeconds, qtSn2seconds);
+	// 倒计时只需要最新值
+	QUEUE_NOTIFY_MERGED(MSG_ID_DEV_COUNT_DOWN_UPDATE, std::string(), std::make_pair(totalSeconds, qtSn2seconds),
+		[](std::pair<int, QMap<QString, int>>& pending, const std::pair<int, QMap<QString, int>>& newer) { pending = newer; return true; });
 }
 
 void UiControlHandler::NotifyAutoWeekMaintain(const std::string& devSN)
 {
-    POST_MESSAGE(MSG_ID_UPDATE_STOP_MAINTAIN_TYPE, QString::fromStdString(devSN), (int)tf::MaintainGroupType::MAINTAIN_GROUP_WEEK);
+    QUEUE_NOTIFY(MSG_ID_UPDATE_STOP_MAINTAIN_TYPE, QString::fromStdString(devSN), (int)tf::MaintainGroupType::MAINTAIN_GROUP_WEEK);
 }
 
 ///
@@ -393,5 +527,5 @@ void UiControlHandler::NotifyRgtAlarmReadFlagChange(const std::string& devSn, co
 {
 	ULOG(LOG_INFO, "%s(devSn=%s,readed=%d)", __FUNCTION__, devSn, readed);
 
-	POST_MESSAGE(MSG_ID_RGT_ALARM_READ_FLAG_UPDATE, QString::fromStdString(devSn), readed);
+	QUEUE_NOTIFY(MSG_ID_RGT_ALARM_READ_FLAG_UPDATE, QString::fromStdString(devSn), readed);
 }
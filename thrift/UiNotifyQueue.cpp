@@ -0,0 +1,296 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     UiNotifyQueue.cpp
+/// @brief    界面通知入站队列（thrift通知按消息类型限长，状态类消息合并，按节拍投递到界面线程）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#include "UiNotifyQueue.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include <QCoreApplication>
+#include <QThread>
+#include "src/common/Mlog/mlog.h"
+
+// 每类消息默认的积压上限
+#define UI_NOTIFY_DEFAULT_CAPACITY          (512)
+
+// 每次投递的最大条数（投递完再取下一批，中间让出界面线程处理其它事件）
+#define UI_NOTIFY_DRAIN_BATCH               (32)
+
+// 积压达到上限时生产线程的最长等待时间（毫秒）
+#define UI_NOTIFY_MAX_WAIT_MS               (500)
+
+namespace
+{
+    // 单调时钟（毫秒）
+    int64_t NowMs()
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+UiNotifyQueue::UiNotifyQueue()
+    : m_capacity(UI_NOTIFY_DEFAULT_CAPACITY)
+    , m_drainScheduled(false)
+{
+}
+
+///
+/// @brief 获取单例（须先在界面线程调用一次）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+UiNotifyQueue& UiNotifyQueue::GetInstance()
+{
+    static UiNotifyQueue instance;
+    return instance;
+}
+
+///
+/// @brief 设置每类消息的积压上限
+///
+/// @param[in]  capacity  积压上限
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void UiNotifyQueue::SetCapacity(size_t capacity)
+{
+    ULOG(LOG_INFO, "%s(%u)", __FUNCTION__, unsigned(capacity));
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = std::max<size_t>(1, capacity);
+}
+
+///
+/// @brief 入队
+///
+/// @param[in]  msgId    消息id
+/// @param[in]  key      合并键值，为空表示按顺序投递
+/// @param[in]  spItem   通知内容
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void UiNotifyQueue::Enqueue(int msgId, const std::string* key, std::shared_ptr<Pending>&& spItem)
+{
+    bool scheduleDrain = false;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        TypeStat& stat = m_stats[msgId];
+        ++stat.enqueued;
+
+        if (key != nullptr)
+        {
+            // 状态通知：合并到排队中同一键值的最新一条，位置和入队时间不变
+            auto itLatest = m_latest.find(std::make_pair(msgId, *key));
+            if (itLatest != m_latest.end() && itLatest->second->pending->Merge(*spItem))
+            {
+                ++stat.coalesced;
+                return;
+            }
+
+            // 积压达到上限时丢弃该类型最旧的一条
+            if (stat.depth >= m_capacity)
+            {
+                auto itOldest = std::find_if(m_queue.begin(), m_queue.end(), [msgId](const Item& item)
+                {
+                    return item.msgId == msgId;
+                });
+                if (itOldest != m_queue.end())
+                {
+                    auto itKey = m_latest.find(std::make_pair(msgId, itOldest->key));
+                    if (itKey != m_latest.end() && itKey->second == itOldest)
+                    {
+                        m_latest.erase(itKey);
+                    }
+                    m_queue.erase(itOldest);
+                    --stat.depth;
+                    ++stat.dropped;
+                }
+            }
+        }
+        else if (stat.depth >= m_capacity)
+        {
+            // 普通通知不丢弃：界面线程以外的生产线程等待界面线程投递，超时后仍然入队
+            QCoreApplication* app = QCoreApplication::instance();
+            bool guiThread = (app != nullptr) && (QThread::currentThread() == app->thread());
+            if (!guiThread)
+            {
+                ++stat.waited;
+                m_spaceCond.wait_for(lock, std::chrono::milliseconds(UI_NOTIFY_MAX_WAIT_MS), [&stat, this]()
+                {
+                    return stat.depth < m_capacity;
+                });
+            }
+
+            if (stat.depth >= m_capacity)
+            {
+                ++stat.overflowed;
+                ULOG(LOG_WARN, "%s(msg %d backlog %u exceeds capacity)", __FUNCTION__, msgId, unsigned(stat.depth));
+            }
+        }
+
+        Item item;
+        item.msgId = msgId;
+        item.latest = (key != nullptr);
+        item.key = (key != nullptr) ? *key : std::string();
+        item.pending = std::move(spItem);
+        item.enqueueMs = NowMs();
+        m_queue.push_back(std::move(item));
+        if (key != nullptr)
+        {
+            m_latest[std::make_pair(msgId, *key)] = std::prev(m_queue.end());
+        }
+
+        ++stat.depth;
+        stat.maxDepth = std::max(stat.maxDepth, stat.depth);
+
+        if (!m_drainScheduled)
+        {
+            m_drainScheduled = true;
+            scheduleDrain = true;
+        }
+    }
+
+    if (scheduleDrain)
+    {
+        QMetaObject::invokeMethod(this, "OnDrain", Qt::QueuedConnection);
+    }
+}
+
+///
+/// @brief 在界面线程投递一批通知
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void UiNotifyQueue::OnDrain()
+{
+    std::vector<std::shared_ptr<Pending>> batch;
+    bool more = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        int64_t now = NowMs();
+        while (!m_queue.empty() && batch.size() < UI_NOTIFY_DRAIN_BATCH)
+        {
+            Item& item = m_queue.front();
+            TypeStat& stat = m_stats[item.msgId];
+            int64_t ageMs = now - item.enqueueMs;
+            --stat.depth;
+            ++stat.delivered;
+            stat.totalAgeMs += ageMs;
+            stat.maxAgeMs = std::max(stat.maxAgeMs, ageMs);
+
+            // 合并位置指向这一条时才移除
+            if (item.latest)
+            {
+                auto itKey = m_latest.find(std::make_pair(item.msgId, item.key));
+                if (itKey != m_latest.end() && itKey->second == m_queue.begin())
+                {
+                    m_latest.erase(itKey);
+                }
+            }
+
+            batch.push_back(std::move(item.pending));
+            m_queue.pop_front();
+        }
+
+        more = !m_queue.empty();
+        m_drainScheduled = more;
+    }
+    m_spaceCond.notify_all();
+
+    // 按到达顺序投递到消息总线
+    for (const auto& spItem : batch)
+    {
+        spItem->Deliver();
+    }
+
+    // 剩余的排在本批通知之后再投递
+    if (more)
+    {
+        QMetaObject::invokeMethod(this, "OnDrain", Qt::QueuedConnection);
+    }
+}
+
+///
+/// @brief 是否没有排队中的通知
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool UiNotifyQueue::IsEmpty() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_queue.empty();
+}
+
+///
+/// @brief 生成文本报告（每类消息一行）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::string UiNotifyQueue::Report() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::string report;
+    char line[512];
+    for (const auto& item : m_stats)
+    {
+        const TypeStat& stat = item.second;
+        double meanAgeMs = (stat.delivered == 0) ? 0.0 : double(stat.totalAgeMs) / stat.delivered;
+        snprintf(line, sizeof(line), "notify %-6d depth: %u (max %u), enqueued: %llu, delivered: %llu, coalesced: %llu, "
+            "dropped: %llu, waited: %llu, overflowed: %llu, age: mean %.1f ms, max %lld ms\n",
+            item.first, unsigned(stat.depth), unsigned(stat.maxDepth),
+            (unsigned long long)stat.enqueued, (unsigned long long)stat.delivered, (unsigned long long)stat.coalesced,
+            (unsigned long long)stat.dropped, (unsigned long long)stat.waited, (unsigned long long)stat.overflowed,
+            meanAgeMs, (long long)stat.maxAgeMs);
+        report += line;
+    }
+
+    return report;
+}
@@ -0,0 +1,268 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     UiNotifyQueue.h
+/// @brief    界面通知入站队列（thrift通知按消息类型限长，状态类消息合并，按节拍投递到界面线程）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <QObject>
+#include "shared/messagebus.h"
+
+///
+/// @brief 界面通知入站队列
+///     thrift工作线程收到的通知不再直接投递到界面线程的事件队列，而是先进入本队列，
+///     界面线程每次取一批投递到消息总线，处理完再取下一批，界面线程处理不过来时通知积压在本队列：
+///     1. 普通通知按到达顺序投递，不丢弃；某类消息积压达到上限时，生产线程最多等待一段时间再入队；
+///     2. 状态类通知（设备状态、传感器状态、单元状态等）按同一消息类型、同一键值合并到还在排队的那一条，
+///        由调用者提供合并规则（合并后投递的效果须与依次投递相同，不能合并时返回false另起一条），
+///        积压达到上限时丢弃该类型最旧的一条；
+///     按消息类型统计入队、合并、丢弃、等待次数，积压深度和排队时间
+///
+class UiNotifyQueue : public QObject
+{
+    Q_OBJECT
+
+public:
+    ///
+    /// @brief 获取单例（须先在界面线程调用一次）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static UiNotifyQueue& GetInstance();
+
+    ///
+    /// @brief 设置每类消息的积压上限
+    ///
+    /// @param[in]  capacity  积压上限
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void SetCapacity(size_t capacity);
+
+    ///
+    /// @brief 按顺序投递一条通知（不丢弃）
+    ///
+    /// @param[in]  msgId  消息id
+    /// @param[in]  args   处理函数参数
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    template<typename...ARGS>
+    void Post(int msgId, ARGS...args)
+    {
+        auto deliver = [msgId, args...]()
+        {
+            MessageBus::Instance()->CustomPostMessage(msgId, args...);
+        };
+        Enqueue(msgId, nullptr, std::make_shared<FunctionPending<decltype(deliver)>>(std::move(deliver)));
+    }
+
+    ///
+    /// @brief 投递一条状态通知（与排队中同一消息类型、同一键值的通知合并）
+    ///
+    /// @param[in]  msgId    消息id
+    /// @param[in]  key      合并键值（如设备序列号）
+    /// @param[in]  payload  处理函数参数（std::pair表示两个参数）
+    /// @param[in]  merge    合并规则 bool(T& pending, const T& newer)，返回false表示不能合并
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    template<typename T, typename MERGE>
+    void PostMerged(int msgId, const std::string& key, const T& payload, MERGE merge)
+    {
+        Enqueue(msgId, &key, std::make_shared<MergedPending<T, MERGE>>(msgId, payload, merge));
+    }
+
+    ///
+    /// @brief 生成文本报告（每类消息一行）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::string Report() const;
+
+    ///
+    /// @brief 是否没有排队中的通知
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool IsEmpty() const;
+
+protected Q_SLOTS:
+    ///
+    /// @brief 在界面线程投递一批通知
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnDrain();
+
+private:
+    UiNotifyQueue();
+
+    ///
+    /// @brief 排队中的通知内容
+    ///
+    struct Pending
+    {
+        virtual ~Pending() {}
+
+        ///
+        /// @brief 投递到消息总线
+        ///
+        virtual void Deliver() = 0;
+
+        ///
+        /// @brief 合并一条更新的同类通知，返回false表示不能合并
+        ///
+        virtual bool Merge(const Pending& newer) = 0;
+    };
+
+    ///
+    /// @brief 按顺序投递的通知
+    ///
+    template<typename FUNC>
+    struct FunctionPending : public Pending
+    {
+        explicit FunctionPending(FUNC&& func) : deliver(std::move(func)) {}
+        void Deliver() override { deliver(); }
+        bool Merge(const Pending&) override { return false; }
+
+        FUNC                        deliver;        ///< 投递函数
+    };
+
+    ///
+    /// @brief 可合并的状态通知
+    ///
+    template<typename T, typename MERGE>
+    struct MergedPending : public Pending
+    {
+        MergedPending(int id, const T& data, MERGE func) : msgId(id), payload(data), merge(func) {}
+        void Deliver() override { DeliverPayload(msgId, payload); }
+        bool Merge(const Pending& newer) override { return merge(payload, static_cast<const MergedPending&>(newer).payload); }
+
+        int                         msgId;          ///< 消息id
+        T                           payload;        ///< 处理函数参数
+        MERGE                       merge;          ///< 合并规则
+    };
+
+    template<typename T>
+    static void DeliverPayload(int msgId, const T& payload)
+    {
+        MessageBus::Instance()->CustomPostMessage(msgId, payload);
+    }
+
+    template<typename A, typename B>
+    static void DeliverPayload(int msgId, const std::pair<A, B>& payload)
+    {
+        MessageBus::Instance()->CustomPostMessage(msgId, payload.first, payload.second);
+    }
+
+    ///
+    /// @brief 入队
+    ///
+    /// @param[in]  msgId    消息id
+    /// @param[in]  key      合并键值，为空表示按顺序投递
+    /// @param[in]  spItem   通知内容
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Enqueue(int msgId, const std::string* key, std::shared_ptr<Pending>&& spItem);
+
+    ///
+    /// @brief 队列中的一条通知
+    ///
+    struct Item
+    {
+        int                         msgId;          ///< 消息id
+        bool                        latest;         ///< 是否为合并的状态通知
+        std::string                 key;            ///< 合并键值
+        std::shared_ptr<Pending>    pending;        ///< 通知内容
+        int64_t                     enqueueMs;      ///< 入队时间（合并时保留最早的入队时间）
+    };
+
+    ///
+    /// @brief 单类消息的统计
+    ///
+    struct TypeStat
+    {
+        size_t                      depth = 0;          ///< 当前积压数
+        size_t                      maxDepth = 0;       ///< 最大积压数
+        uint64_t                    enqueued = 0;       ///< 入队次数
+        uint64_t                    delivered = 0;      ///< 投递次数
+        uint64_t                    coalesced = 0;      ///< 合并次数
+        uint64_t                    dropped = 0;        ///< 丢弃次数
+        uint64_t                    waited = 0;         ///< 生产线程等待次数
+        uint64_t                    overflowed = 0;     ///< 等待超时后超限入队的次数
+        int64_t                     totalAgeMs = 0;     ///< 总排队时间
+        int64_t                     maxAgeMs = 0;       ///< 最大排队时间
+    };
+
+private:
+    mutable std::mutex                                      m_mutex;            ///< 队列锁
+    std::condition_variable                                 m_spaceCond;        ///< 积压减少时唤醒等待的生产线程
+    std::list<Item>                                         m_queue;            ///< 待投递的通知（到达顺序）
+    std::map<std::pair<int, std::string>, std::list<Item>::iterator> m_latest;  ///< 状态通知的键值到队列位置
+    std::map<int, TypeStat>                                 m_stats;            ///< 消息id到统计
+    size_t                                                  m_capacity;         ///< 每类消息的积压上限
+    bool                                                    m_drainScheduled;   ///< 是否已安排投递
+};
+
+// 按顺序投递界面通知
+#define QUEUE_NOTIFY(msgid, ...)                UiNotifyQueue::GetInstance().Post(msgid, ##__VA_ARGS__)
+
+// 投递状态类界面通知（与排队中同一键值的通知合并）
+#define QUEUE_NOTIFY_MERGED(msgid, key, payload, merge)     UiNotifyQueue::GetInstance().PostMerged(msgid, key, payload, merge)
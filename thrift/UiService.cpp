@@ -92,21 +92,25 @@ std::shared_ptr<UiService> UiService::GetInstance()
 /// @brief
 ///     开启服务
 ///
-/// @param[in]  usPort  thrift服务监听端口
+/// @param[in]  usPort          thrift服务监听端口
+/// @param[in]  ioThreads       IO线程数，0表示按CPU核数自动计算
+/// @param[in]  workerThreads   工作线程数，0表示按CPU核数自动计算
 ///
 /// @return true表示成功
 ///
 /// @par History:
 /// @li 3558/ZhouGuangMing，2021年3月18日，新建函数
+/// @li 5774/WuHongTao，2026年10月19日，线程数可配置
 ///
-bool UiService::Start(unsigned short usPort)
+bool UiService::Start(unsigned short usPort, int ioThreads, int workerThreads)
 {
     ULOG(LOG_INFO, "%s(%d)", __FUNCTION__, usPort);
 
-    // 获得CUP核数
+    // 获得CUP核数，未配置线程数时按核数计算
     unsigned int hw_threads = std::thread::hardware_concurrency();
-    int io_threads = hw_threads / 2 + 1;
-    int worker_threads = hw_threads * 2 + 2;
+    int io_threads = (ioThreads > 0) ? ioThreads : (hw_threads / 2 + 1);
+    int worker_threads = (workerThreads > 0) ? workerThreads : (hw_threads * 2 + 2);
+    ULOG(LOG_INFO, "UiService threads: io=%d, worker=%d (cpu=%u)", io_threads, worker_threads, hw_threads);
 
     // 创建多路复用的事务处理器
     std::shared_ptr<apache::thrift::TMultiplexedProcessor> mprocessor(new apache::thrift::TMultiplexedProcessor);
@@ -80,14 +80,17 @@ public:
     /// @brief
     ///     开启服务
     ///
-    /// @param[in]  usPort  thrift服务监听端口
+    /// @param[in]  usPort          thrift服务监听端口
+    /// @param[in]  ioThreads       IO线程数，0表示按CPU核数自动计算
+    /// @param[in]  workerThreads   工作线程数，0表示按CPU核数自动计算
     ///
     /// @return true表示成功
     ///
     /// @par History:
     /// @li 3558/ZhouGuangMing，2021年3月18日，新建函数
+    /// @li 5774/WuHongTao，2026年10月19日，线程数可配置
     ///
-    bool Start(unsigned short usPort);
+    bool Start(unsigned short usPort, int ioThreads = 0, int workerThreads = 0);
 
     ///
     /// @brief
@@ -45,6 +45,7 @@
 ///////////////////////////////////////////////////////////////////////////
 #include "ChLogicControlProxy.h"
 #include "src/common/Mlog/mlog.h"
+#include "thrift/ProxyCallMetrics.h"
 #include "src/dcs/interface/ch/ChLogicControlHandler.h"
 #include "src/thrift/ch/gen-cpp/ch_logic_control_constants.h"
 #include <thrift/transport/TSocket.h>
@@ -108,6 +109,7 @@ std::shared_ptr<ch::tf::ChLogicControlClient> ch::LogicControlProxy::GetChLogicC
 ///
 bool ch::LogicControlProxy::AddGeneralAssayInfo(::tf::ResultLong& _return, const ::ch::tf::GeneralAssayInfo& gai)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -133,6 +135,7 @@ bool ch::LogicControlProxy::AddGeneralAssayInfo(::tf::ResultLong& _return, const
 ///
 bool ch::LogicControlProxy::DeleteGeneralAssayInfo(const ::ch::tf::GeneralAssayInfoQueryCond& gaiq)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -152,6 +155,7 @@ bool ch::LogicControlProxy::DeleteGeneralAssayInfo(const ::ch::tf::GeneralAssayI
 ///
 bool ch::LogicControlProxy::ModifyAssayConfigInfo(const ch::tf::GeneralAssayInfo& aci)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -172,6 +176,7 @@ bool ch::LogicControlProxy::ModifyAssayConfigInfo(const ch::tf::GeneralAssayInfo
 ///
 bool ch::LogicControlProxy::QueryAssayConfigInfo(const ::ch::tf::GeneralAssayInfoQueryCond& qryCond, ::ch::tf::GeneralAssayInfoQueryResp& qryResp)
 {
+    PROXY_CALL_RESP(qryResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -195,6 +200,7 @@ bool ch::LogicControlProxy::QueryAssayConfigInfo(const ::ch::tf::GeneralAssayInf
 ///
 void ch::LogicControlProxy::AddSupplyAttribute(::tf::ResultLong& _return, const ::ch::tf::SupplyAttribute& sa)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -213,6 +219,7 @@ void ch::LogicControlProxy::AddSupplyAttribute(::tf::ResultLong& _return, const
 ///
 bool ch::LogicControlProxy::DeleteSupplyAttribute(const ::ch::tf::SupplyAttributeQueryCond& saq)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -231,6 +238,7 @@ bool ch::LogicControlProxy::DeleteSupplyAttribute(const ::ch::tf::SupplyAttribut
 ///
 bool ch::LogicControlProxy::ModifySupplyAttribute(const ::ch::tf::SupplyAttribute& sa)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -248,6 +256,7 @@ bool ch::LogicControlProxy::ModifySupplyAttribute(const ::ch::tf::SupplyAttribut
 ///
 bool ch::LogicControlProxy::QuerySupplyAttribute(::ch::tf::SupplyAttributeQueryResp& _return, const ::ch::tf::SupplyAttributeQueryCond& saq)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -272,6 +281,7 @@ bool ch::LogicControlProxy::QuerySupplyAttribute(::ch::tf::SupplyAttributeQueryR
 ///
 void ch::LogicControlProxy::AddSpecialAssayInfo(::tf::ResultLong& _return, const ::ch::tf::SpecialAssayInfo& sai)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -291,6 +301,7 @@ void ch::LogicControlProxy::AddSpecialAssayInfo(::tf::ResultLong& _return, const
 ///
 bool ch::LogicControlProxy::DeleteSpecialAssayInfo(const ::ch::tf::SpecialAssayInfoQueryCond& saiq)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -310,6 +321,7 @@ bool ch::LogicControlProxy::DeleteSpecialAssayInfo(const ::ch::tf::SpecialAssayI
 ///
 ::tf::ThriftResult::type ch::LogicControlProxy::ModifySpecialAssayInfo(const ::ch::tf::SpecialAssayInfo& sai)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -318,6 +330,7 @@ bool ch::LogicControlProxy::DeleteSpecialAssayInfo(const ::ch::tf::SpecialAssayI
 
 bool ch::LogicControlProxy::AddAssayInfo(const ::tf::GeneralAssayInfo& gai, const ::ch::tf::GeneralAssayInfo& chGai, const ::ch::tf::SpecialAssayInfo& sai)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -326,6 +339,7 @@ bool ch::LogicControlProxy::AddAssayInfo(const ::tf::GeneralAssayInfo& gai, cons
 
 ::tf::ThriftResult::type ch::LogicControlProxy::ModifyAssayInfo(const ::tf::GeneralAssayInfo& gai, const ::ch::tf::GeneralAssayInfo& chGai, const ::ch::tf::SpecialAssayInfo& sai)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -344,6 +358,7 @@ bool ch::LogicControlProxy::AddAssayInfo(const ::tf::GeneralAssayInfo& gai, cons
 ///
 bool ch::LogicControlProxy::QuerySpecialAssayInfo(::ch::tf::SpecialAssayInfoQueryResp& _return, const ::ch::tf::SpecialAssayInfoQueryCond& saiq)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -370,6 +385,7 @@ bool ch::LogicControlProxy::QuerySpecialAssayInfo(::ch::tf::SpecialAssayInfoQuer
 ///
 bool ch::LogicControlProxy::EncodeChAssayInfo(std::string& strAssayCode, const ::ch::tf::ChAssayInfoList& caiList, bool isEncryption)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -405,6 +421,7 @@ bool ch::LogicControlProxy::EncodeChAssayInfo(std::string& strAssayCode, const :
 ///
 bool ch::LogicControlProxy::DecodeChAssayInfo(const std::string& strAssayCode, ::ch::tf::ChAssayInfoList& caiList)
 {
+	PROXY_CALL_RESP(caiList);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -438,6 +455,7 @@ bool ch::LogicControlProxy::DecodeChAssayInfo(const std::string& strAssayCode, :
 ///
 void ch::LogicControlProxy::QueryReagentOverviews(std::vector< ::ch::tf::ReagentOverview> & _return)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -456,6 +474,7 @@ void ch::LogicControlProxy::QueryReagentOverviews(std::vector< ::ch::tf::Reagent
 ///
 void ch::LogicControlProxy::QuerySuppliesOverviews(std::vector< ::ch::tf::SuppliesOverview> & _return, const std::string& deviceSN)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -473,6 +492,7 @@ void ch::LogicControlProxy::QuerySuppliesOverviews(std::vector< ::ch::tf::Suppli
 ///
 void ch::LogicControlProxy::AddQcApply(::tf::ResultLong& _return, const ::ch::tf::QcApply& qcApp)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -491,6 +511,7 @@ void ch::LogicControlProxy::AddQcApply(::tf::ResultLong& _return, const ::ch::tf
 ///
 bool ch::LogicControlProxy::DeleteQcApply(const ::ch::tf::QcApplyQueryCond& qcapcd)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -509,6 +530,7 @@ bool ch::LogicControlProxy::DeleteQcApply(const ::ch::tf::QcApplyQueryCond& qcap
 ///
 bool ch::LogicControlProxy::ModifyQcApply(const ::ch::tf::QcApply& qcApp)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -526,6 +548,7 @@ bool ch::LogicControlProxy::ModifyQcApply(const ::ch::tf::QcApply& qcApp)
 ///
 void ch::LogicControlProxy::QueryQcApply(::ch::tf::QcApplyQueryResp& _return, const ::ch::tf::QcApplyQueryCond& qcapcd)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -544,6 +567,7 @@ void ch::LogicControlProxy::QueryQcApply(::ch::tf::QcApplyQueryResp& _return, co
 ///
 void ch::LogicControlProxy::QueryQcCalculateResult(::ch::tf::QcCalculateResultQueryResp& _return, const ::ch::tf::QcCalculateResultQueryCond& qccalccd)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -562,6 +586,7 @@ void ch::LogicControlProxy::QueryQcCalculateResult(::ch::tf::QcCalculateResultQu
 ///
 void ch::LogicControlProxy::QueryQcResult(::ch::tf::QcResultQueryResp& _return, const ::ch::tf::QcResultQueryCond& qcrltcd)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -581,6 +606,7 @@ void ch::LogicControlProxy::QueryQcResult(::ch::tf::QcResultQueryResp& _return,
 ///
 bool ch::LogicControlProxy::ModifyQcResult(const ::ch::tf::QcResult& qcRlt)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -599,6 +625,7 @@ bool ch::LogicControlProxy::ModifyQcResult(const ::ch::tf::QcResult& qcRlt)
 ///
 void ch::LogicControlProxy::QueryUnionQcResult(::ch::tf::UnionQcResultQueryResp& _return, const ::ch::tf::UnionQcResultQueryCond& qcrltcd)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -618,6 +645,7 @@ void ch::LogicControlProxy::QueryUnionQcResult(::ch::tf::UnionQcResultQueryResp&
 ///
 bool ch::LogicControlProxy::ModifyUnionQcResult(const ::ch::tf::UnionQcResult& qcRlt)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -636,6 +664,7 @@ bool ch::LogicControlProxy::ModifyUnionQcResult(const ::ch::tf::UnionQcResult& q
 ///
 void ch::LogicControlProxy::AddReagentNeed(::tf::ResultLong& _return, const ::ch::tf::ReagentNeed& rn)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -655,6 +684,7 @@ void ch::LogicControlProxy::AddReagentNeed(::tf::ResultLong& _return, const ::ch
 ///
 bool ch::LogicControlProxy::DeleteReagentNeed(const ::ch::tf::ReagentNeedQueryCond& rnqc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -674,6 +704,7 @@ bool ch::LogicControlProxy::DeleteReagentNeed(const ::ch::tf::ReagentNeedQueryCo
 ///
 bool ch::LogicControlProxy::ModifyReagentNeed(const std::vector< ::ch::tf::ReagentNeed>& rn)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -692,6 +723,7 @@ bool ch::LogicControlProxy::ModifyReagentNeed(const std::vector< ::ch::tf::Reage
 ///
 void ch::LogicControlProxy::QueryReagentNeed(::ch::tf::ReagentNeedQueryResp& _return, const ::ch::tf::ReagentNeedQueryCond& rnqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -712,6 +744,7 @@ void ch::LogicControlProxy::QueryReagentNeed(::ch::tf::ReagentNeedQueryResp& _re
 ///
 bool ch::LogicControlProxy::QueryCaliDoc(::ch::tf::CaliDocQueryResp& _return, const ::ch::tf::CaliDocQueryCond& cdqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -737,6 +770,7 @@ bool ch::LogicControlProxy::QueryCaliDoc(::ch::tf::CaliDocQueryResp& _return, co
 ///
 bool ch::LogicControlProxy::ModifyCaliDoc(const ::ch::tf::CaliDoc& cali)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	ch::LogicControlHandler logicControl;
     return logicControl.ModifyCaliDoc(cali);
@@ -754,6 +788,7 @@ bool ch::LogicControlProxy::ModifyCaliDoc(const ::ch::tf::CaliDoc& cali)
 ///
 void ch::LogicControlProxy::AddCaliDoc(::tf::ResultLong& _return, const ::ch::tf::CaliDoc& cali)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -773,6 +808,7 @@ void ch::LogicControlProxy::AddCaliDoc(::tf::ResultLong& _return, const ::ch::tf
 ///
 bool ch::LogicControlProxy::DeleteCaliDoc(const::ch::tf::CaliDocQueryCond & cdgq)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	ch::LogicControlHandler logicControl;
 	return logicControl.DeleteCaliDoc(cdgq);
@@ -792,6 +828,7 @@ bool ch::LogicControlProxy::DeleteCaliDoc(const::ch::tf::CaliDocQueryCond & cdgq
 ///
 void ch::LogicControlProxy::AddCaliDocGroup(::tf::ResultLong& _return, const ::ch::tf::CaliDocGroup& cdg)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -811,6 +848,7 @@ void ch::LogicControlProxy::AddCaliDocGroup(::tf::ResultLong& _return, const ::c
 ///
 bool ch::LogicControlProxy::ModifyCaliDocGroup(const ::ch::tf::CaliDocGroup& cdg)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	ch::LogicControlHandler logicControl;
     return logicControl.ModifyCaliDocGroup(cdg);
@@ -830,6 +868,7 @@ bool ch::LogicControlProxy::ModifyCaliDocGroup(const ::ch::tf::CaliDocGroup& cdg
 ///
 bool ch::LogicControlProxy::DeleteCaliDocGroup(const ::ch::tf::CaliDocGroupQueryCond& cdgq)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -850,6 +889,7 @@ bool ch::LogicControlProxy::DeleteCaliDocGroup(const ::ch::tf::CaliDocGroupQuery
 ///
 bool ch::LogicControlProxy::QueryCaliDocGroup(::ch::tf::CaliDocGroupQueryResp& _return, const ::ch::tf::CaliDocGroupQueryCond& cdgq)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -876,6 +916,7 @@ bool ch::LogicControlProxy::QueryCaliDocGroup(::ch::tf::CaliDocGroupQueryResp& _
 ///
 bool ch::LogicControlProxy::ParseCaliQRcode(::ch::tf::CaliGroupQRcode& _return, const std::string& strQRcode)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -913,6 +954,7 @@ bool ch::LogicControlProxy::ParseCaliQRcode(::ch::tf::CaliGroupQRcode& _return,
 ///
 bool ch::LogicControlProxy::DownloadCaliDocGroup(::adapter::chCloudDef::tf::CloudCaliDocGroupResp& _return, const  ::adapter::chCloudDef::tf::QueryCloudCaliDocGroupCond& qqcdgc)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -939,6 +981,7 @@ bool ch::LogicControlProxy::DownloadCaliDocGroup(::adapter::chCloudDef::tf::Clou
 ///
 bool ch::LogicControlProxy::AddNewCaliDocGroup(const ::ch::tf::CaliDocGroup& cdg, const  std::vector< ::ch::tf::CaliDoc> & lstdoc)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -947,6 +990,7 @@ bool ch::LogicControlProxy::AddNewCaliDocGroup(const ::ch::tf::CaliDocGroup& cdg
 
 void ch::LogicControlProxy::AddSpecialWashReagentProbe(::tf::ResultLong& _return, const ::ch::tf::SpecialWashReagentProbe& swrp)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -955,6 +999,7 @@ void ch::LogicControlProxy::AddSpecialWashReagentProbe(::tf::ResultLong& _return
 
 bool ch::LogicControlProxy::DeleteSpecialWashReagentProbe(const ::ch::tf::SpecialWashReagentProbeQueryCond& swrpq)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	bool bRet = false;
 
@@ -964,6 +1009,7 @@ bool ch::LogicControlProxy::DeleteSpecialWashReagentProbe(const ::ch::tf::Specia
 
 bool ch::LogicControlProxy::ModifySpecialWashReagentProbe(const ::ch::tf::SpecialWashReagentProbe& swrp)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	bool bRet = false;
 
@@ -974,6 +1020,7 @@ bool ch::LogicControlProxy::ModifySpecialWashReagentProbe(const ::ch::tf::Specia
 void ch::LogicControlProxy::QuerySpecialWashReagentProbe(::ch::tf::SpecialWashReagentProbeQueryResp& _return
 	, const ::ch::tf::SpecialWashReagentProbeQueryCond& swrpq)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -982,6 +1029,7 @@ void ch::LogicControlProxy::QuerySpecialWashReagentProbe(::ch::tf::SpecialWashRe
 
 int32_t ch::LogicControlProxy::QuerySpecialWashReagentProbeCount(const ::ch::tf::SpecialWashReagentProbeQueryCond& swrpq)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -990,6 +1038,7 @@ int32_t ch::LogicControlProxy::QuerySpecialWashReagentProbeCount(const ::ch::tf:
 
 void ch::LogicControlProxy::AddSpecialWashSampleProbe(::tf::ResultLong& _return, const ::ch::tf::SpecialWashSampleProbe& swsp)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -998,6 +1047,7 @@ void ch::LogicControlProxy::AddSpecialWashSampleProbe(::tf::ResultLong& _return,
 
 bool ch::LogicControlProxy::DeleteSpecialWashSampleProbe(const ::ch::tf::SpecialWashSampleProbeQueryCond& swspq)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	bool bRet = false;
 
@@ -1007,6 +1057,7 @@ bool ch::LogicControlProxy::DeleteSpecialWashSampleProbe(const ::ch::tf::Special
 
 bool ch::LogicControlProxy::ModifySpecialWashSampleProbe(const ::ch::tf::SpecialWashSampleProbe& swsp)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	bool bRet = false;
 
@@ -1016,6 +1067,7 @@ bool ch::LogicControlProxy::ModifySpecialWashSampleProbe(const ::ch::tf::Special
 
 void ch::LogicControlProxy::QuerySpecialWashSampleProbe(::ch::tf::SpecialWashSampleProbeQueryResp& _return, const ::ch::tf::SpecialWashSampleProbeQueryCond& swsp)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -1024,6 +1076,7 @@ void ch::LogicControlProxy::QuerySpecialWashSampleProbe(::ch::tf::SpecialWashSam
 
 int32_t ch::LogicControlProxy::QuerySpecialWashSampleProbeCount(const ::ch::tf::SpecialWashSampleProbeQueryCond& swsp)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -1032,6 +1085,7 @@ int32_t ch::LogicControlProxy::QuerySpecialWashSampleProbeCount(const ::ch::tf::
 
 void ch::LogicControlProxy::AddSpecialWashCup(::tf::ResultLong& _return, const ::ch::tf::SpecialWashCup& swc)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -1040,6 +1094,7 @@ void ch::LogicControlProxy::AddSpecialWashCup(::tf::ResultLong& _return, const :
 
 bool ch::LogicControlProxy::DeleteSpecialWashCup(const ::ch::tf::SpecialWashCupQueryCond& swcq)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	bool bRet = false;
 
@@ -1049,6 +1104,7 @@ bool ch::LogicControlProxy::DeleteSpecialWashCup(const ::ch::tf::SpecialWashCupQ
 
 bool ch::LogicControlProxy::ModifySpecialWashCup(const ::ch::tf::SpecialWashCup& swc)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	bool bRet = false;
 
@@ -1058,6 +1114,7 @@ bool ch::LogicControlProxy::ModifySpecialWashCup(const ::ch::tf::SpecialWashCup&
 
 void ch::LogicControlProxy::QuerySpecialWashCup(::ch::tf::SpecialWashCupQueryResp& _return, const ::ch::tf::SpecialWashCupQueryCond& swcq)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -1066,6 +1123,7 @@ void ch::LogicControlProxy::QuerySpecialWashCup(::ch::tf::SpecialWashCupQueryRes
 
 int32_t ch::LogicControlProxy::QuerySpecialWashCupCount(const ::ch::tf::SpecialWashCupQueryCond& swcq)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -1084,6 +1142,7 @@ int32_t ch::LogicControlProxy::QuerySpecialWashCupCount(const ::ch::tf::SpecialW
 ///
 void ch::LogicControlProxy::AddMaintainItemResultInfo(::tf::ResultLong& _return, const  ::ch::tf::MaintainItemResultInfo& miri)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -1102,6 +1161,7 @@ void ch::LogicControlProxy::AddMaintainItemResultInfo(::tf::ResultLong& _return,
 ///
 void ch::LogicControlProxy::QueryMaintainItemResultInfo(::ch::tf::MaintainItemResultInfoQueryResp& _return, const  ::ch::tf::MaintainItemResultInfoQueryCond& miriqc)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -1110,6 +1170,7 @@ void ch::LogicControlProxy::QueryMaintainItemResultInfo(::ch::tf::MaintainItemRe
 
 void ch::LogicControlProxy::QueryReactionCupHistoryInfo(std::vector< ::ch::tf::ReactionCupHistoryInfo> & _return, const std::string& sn)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
@@ -1118,6 +1179,7 @@ void ch::LogicControlProxy::QueryReactionCupHistoryInfo(std::vector< ::ch::tf::R
 
 bool ch::LogicControlProxy::ResetReactionCupHistoryInfo(const std::string& sn, const std::vector<int32_t> & cupNums)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::LogicControlHandler logicControl;
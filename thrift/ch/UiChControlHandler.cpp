@@ -48,6 +48,7 @@
 #include "src/common/Mlog/mlog.h"
 #include "shared/messagebus.h"
 #include "shared/msgiddef.h"
+#include "thrift/UiNotifyQueue.h"
 
 
 ///
@@ -62,7 +63,7 @@ void UiChControlHandler::NotifyQcAppUpdate(const std::vector< ::ch::tf::QcApply>
 {
     ULOG(LOG_INFO, "%s", __FUNCTION__);
     // 发送质控申请更新信息到UI消息总线
-    POST_MESSAGE(MSG_ID_QCAPP_INFO_UPDATE, sus);
+    QUEUE_NOTIFY(MSG_ID_QCAPP_INFO_UPDATE, sus);
 }
 
 ///
@@ -77,7 +78,7 @@ void UiChControlHandler::NotifyCaliDocGroupInfoUpdate(const std::vector<ch::tf::
 {
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
     // 将校准品组信息更新消息发送到UI消息总线
-    POST_MESSAGE(MSG_ID_CALI_GRP_INFO_UPDATE, const_cast<std::vector<ch::tf::CaliGroupUpdate>&>(infos));
+    QUEUE_NOTIFY(MSG_ID_CALI_GRP_INFO_UPDATE, const_cast<std::vector<ch::tf::CaliGroupUpdate>&>(infos));
     
 }
 
@@ -86,6 +87,6 @@ void UiChControlHandler::NotifyReactionCupInfoUpdate(const std::string& deviceSN
 {
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
-    POST_MESSAGE(MSG_ID_REACTION_CUP_INFO_UPDATE, QString::fromStdString(deviceSN),
+    QUEUE_NOTIFY(MSG_ID_REACTION_CUP_INFO_UPDATE, QString::fromStdString(deviceSN),
         const_cast<std::vector<::ch::tf::ReactionCupHistoryInfo>&>(lrcs));
 }
@@ -45,6 +45,7 @@
 ///////////////////////////////////////////////////////////////////////////
 #include "C1005LogicControlProxy.h"
 #include "src/common/Mlog/mlog.h"
+#include "thrift/ProxyCallMetrics.h"
 #include "src/common/defs.h"
 #include "src/dcs/interface/ch/c1005/C1005LogicControlHandler.h"
 #include "src/thrift/ch/c1005/gen-cpp/c1005_logic_control_constants.h"
@@ -112,6 +113,7 @@ std::shared_ptr<ch::c1005::tf::C1005LogicControlClient> ch::c1005::LogicControlP
 bool ch::c1005::LogicControlProxy::QueryAssayTestResult(ch::tf::AssayTestResultQueryResp& qryResp
 	, ch::tf::AssayTestResultQueryCond& qryCond)
 {
+    PROXY_CALL_RESP(qryResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -137,6 +139,7 @@ bool ch::c1005::LogicControlProxy::QueryAssayTestResult(ch::tf::AssayTestResultQ
 ///
 bool ch::c1005::LogicControlProxy::ModifyAssayTestResult(ch::tf::AssayTestResult& tr)
 {
+    PROXY_CALL_RESP(tr);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -158,6 +161,7 @@ bool ch::c1005::LogicControlProxy::ModifyAssayTestResult(ch::tf::AssayTestResult
 bool ch::c1005::LogicControlProxy::QuerySuppliesInfo(ch::tf::SuppliesInfoQueryResp& qryResp
 	, ch::tf::SuppliesInfoQueryCond& qryCond)
 {
+    PROXY_CALL_RESP(qryResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -183,6 +187,7 @@ bool ch::c1005::LogicControlProxy::QuerySuppliesInfo(ch::tf::SuppliesInfoQueryRe
 ///
 bool ch::c1005::LogicControlProxy::MaskReagentGroups(const std::vector<::ch::tf::SuppliesInfoQueryCond>& siqc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -202,6 +207,7 @@ bool ch::c1005::LogicControlProxy::MaskReagentGroups(const std::vector<::ch::tf:
 ///
 bool ch::c1005::LogicControlProxy::UnMaskReagentGroups(const std::vector< ::ch::tf::SuppliesInfoQueryCond>& siqc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -221,6 +227,7 @@ bool ch::c1005::LogicControlProxy::UnMaskReagentGroups(const std::vector< ::ch::
 ///
 bool ch::c1005::LogicControlProxy::UnMaskCalibrate(const std::vector<::ch::tf::ReagentGroupQueryCond>& siqc)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -240,6 +247,7 @@ bool ch::c1005::LogicControlProxy::UnMaskCalibrate(const std::vector<::ch::tf::R
 ///
 bool ch::c1005::LogicControlProxy::PriorUsingReagents(const std::vector< ::ch::tf::SuppliesInfoQueryCond>& siqc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -259,6 +267,7 @@ bool ch::c1005::LogicControlProxy::PriorUsingReagents(const std::vector< ::ch::t
 ///
 bool ch::c1005::LogicControlProxy::PriorUsingSupplies(const std::vector< ::ch::tf::SuppliesInfoQueryCond>& siqc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -279,6 +288,7 @@ bool ch::c1005::LogicControlProxy::PriorUsingSupplies(const std::vector< ::ch::t
 ///
 bool ch::c1005::LogicControlProxy::UnloadSupplies(const std::string& deviceSN, const std::vector<int32_t>& pos)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -301,6 +311,7 @@ bool ch::c1005::LogicControlProxy::UnloadSupplies(const std::string& deviceSN, c
 bool ch::c1005::LogicControlProxy::ScanSuppliesInfo(const std::string& deviceSN
 	, const std::vector<::ch::tf::SuppliesPosition>& pos,const bool probeResidual, const bool isFastMode)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::tf::SuppliesScanParamInfo sspi;
@@ -323,6 +334,7 @@ bool ch::c1005::LogicControlProxy::ScanSuppliesInfo(const std::string& deviceSN
 ///
 void ch::c1005::LogicControlProxy::QueryReagentLoader(const std::string& deviceSN, ::ch::tf::ReagentLoaderInfo& _return)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -331,6 +343,7 @@ void ch::c1005::LogicControlProxy::QueryReagentLoader(const std::string& deviceS
 
 bool ch::c1005::LogicControlProxy::CancelReagentLoader(const std::string& deviceSN, const std::vector<int32_t>& pos)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -350,6 +363,7 @@ bool ch::c1005::LogicControlProxy::CancelReagentLoader(const std::string& device
 void ch::c1005::LogicControlProxy::QueryCaliCurve(::ch::tf::CaliCurveQueryResp& _return
 	, const ::ch::tf::CaliCurveQueryCond& ccqc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -373,6 +387,7 @@ void ch::c1005::LogicControlProxy::QueryCaliCurve(::ch::tf::CaliCurveQueryResp&
 ///
 bool ch::c1005::LogicControlProxy::ModifyCaliCurves(const std::vector<::ch::tf::CaliCurve>& cc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -393,6 +408,7 @@ bool ch::c1005::LogicControlProxy::ModifyCaliCurves(const std::vector<::ch::tf::
 ///
 void ch::c1005::LogicControlProxy::AddCaliCurve(::tf::ResultLong& _return, const ::ch::tf::CaliCurve& cc)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -402,6 +418,7 @@ void ch::c1005::LogicControlProxy::AddCaliCurve(::tf::ResultLong& _return, const
 ::tf::StCanResult ch::c1005::LogicControlProxy::SendCanCommand(const std::string& deviceSN, const int dstCanId
 	, const ::tf::StCanSendData &data)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	::tf::StCanResult result;
@@ -425,6 +442,7 @@ void ch::c1005::LogicControlProxy::AddCaliCurve(::tf::ResultLong& _return, const
 ///
 bool ch::c1005::LogicControlProxy::QueryReagentGroup(::ch::tf::ReagentGroupQueryResp& qryResp, const ::ch::tf::ReagentGroupQueryCond& qryCond)
 {
+    PROXY_CALL_RESP(qryResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -451,6 +469,7 @@ bool ch::c1005::LogicControlProxy::QueryReagentGroup(::ch::tf::ReagentGroupQuery
 ///
 void ch::c1005::LogicControlProxy::AddReagentGroup(::tf::ResultLong& _return, const ::ch::tf::ReagentGroup& rg)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -470,6 +489,7 @@ void ch::c1005::LogicControlProxy::AddReagentGroup(::tf::ResultLong& _return, co
 ///
 bool ch::c1005::LogicControlProxy::DeleteReagentGroup(const ::ch::tf::ReagentGroupQueryCond& rgqc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -489,6 +509,7 @@ bool ch::c1005::LogicControlProxy::DeleteReagentGroup(const ::ch::tf::ReagentGro
 ///
 bool ch::c1005::LogicControlProxy::ModifyReagentGroup(const ::ch::tf::ReagentGroup& rg)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
     ch::c1005::LogicControlHandler logicControl;
@@ -507,6 +528,7 @@ bool ch::c1005::LogicControlProxy::ModifyReagentGroup(const ::ch::tf::ReagentGro
 ///
 void ch::c1005::LogicControlProxy::AddSuppliesInfo(::tf::ResultLong& _return, const ::ch::tf::SuppliesInfo& si)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -526,6 +548,7 @@ void ch::c1005::LogicControlProxy::AddSuppliesInfo(::tf::ResultLong& _return, co
 ///
 ::ch::tf::ManualRegisterResult::type ch::c1005::LogicControlProxy::ManualRegisterSupplies(const ::ch::tf::SuppliesInfo& si)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -545,6 +568,7 @@ void ch::c1005::LogicControlProxy::AddSuppliesInfo(::tf::ResultLong& _return, co
 ///
 bool ch::c1005::LogicControlProxy::DeleteSuppliesInfo(const ::ch::tf::SuppliesInfoQueryCond& siqc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
@@ -564,6 +588,7 @@ bool ch::c1005::LogicControlProxy::DeleteSuppliesInfo(const ::ch::tf::SuppliesIn
 ///
 bool ch::c1005::LogicControlProxy::ModifySuppliesInfo(const ::ch::tf::SuppliesInfo& si)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ch::c1005::LogicControlHandler logicControl;
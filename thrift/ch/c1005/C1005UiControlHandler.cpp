@@ -47,6 +47,7 @@
 #include "src/common/Mlog/mlog.h"
 #include "shared/messagebus.h"
 #include "shared/msgiddef.h"
+#include "thrift/UiNotifyQueue.h"
 
 ///
 /// @brief 上报耗材更新信息
@@ -62,7 +63,7 @@ void ch::c1005::UiControlHandler::NotifySupplyInfoUpdate(const std::vector<ch::t
 {
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
     // 将试剂信息更新消息发送到UI消息总线
-    POST_MESSAGE(MSG_ID_REAGENT_INFO_UPDATE, const_cast<std::vector<ch::tf::SupplyUpdate>&>(sus));
+    QUEUE_NOTIFY(MSG_ID_REAGENT_INFO_UPDATE, const_cast<std::vector<ch::tf::SupplyUpdate>&>(sus));
 }
 
 ///
@@ -78,13 +79,13 @@ void ch::c1005::UiControlHandler::NotifyReagentLoaderStatusUpdate(const std::str
 {
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
-    POST_MESSAGE(MSG_ID_REAGENT_LOADER_UPDATE, QString::fromStdString(deviceSN), const_cast<::ch::tf::ReagentLoaderInfo&>(rli));
+    QUEUE_NOTIFY(MSG_ID_REAGENT_LOADER_UPDATE, QString::fromStdString(deviceSN), const_cast<::ch::tf::ReagentLoaderInfo&>(rli));
 }
 
 void ch::c1005::UiControlHandler::NotifyReagentPlateInfoUpdate(const std::string & deviceSN, const::ch::tf::ReagentPlateInfo& rpi)
 {
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	// 将试剂盘信息更新消息发送到UI消息总线
-	POST_MESSAGE(MSG_ID_REAGENT_PLATE_INFO_UPDATE, QString::fromStdString(deviceSN), const_cast<::ch::tf::ReagentPlateInfo&>(rpi));
+	QUEUE_NOTIFY(MSG_ID_REAGENT_PLATE_INFO_UPDATE, QString::fromStdString(deviceSN), const_cast<::ch::tf::ReagentPlateInfo&>(rpi));
 }
 
@@ -45,6 +45,7 @@
 ///////////////////////////////////////////////////////////////////////////
 #include "ImLogicControlProxy.h"
 #include "src/common/Mlog/mlog.h"
+#include "thrift/ProxyCallMetrics.h"
 #include "src/dcs/interface/im/ImLogicControlHandler.h"
 #include "src/thrift/im/gen-cpp/im_logic_control_constants.h"
 #include <thrift/transport/TSocket.h>
@@ -114,6 +115,7 @@ std::shared_ptr<im::tf::ImLogicControlClient> im::LogicControlProxy::GetImLogicC
 ///
 void im::LogicControlProxy::AddGeneralAssayInfo(::tf::ResultLong& _return, const ::im::tf::GeneralAssayInfo& gai)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -133,6 +135,7 @@ void im::LogicControlProxy::AddGeneralAssayInfo(::tf::ResultLong& _return, const
 ///
 bool im::LogicControlProxy::DeleteGeneralAssayInfo(const ::im::tf::GeneralAssayInfoQueryCond& gaiq)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -152,6 +155,7 @@ bool im::LogicControlProxy::DeleteGeneralAssayInfo(const ::im::tf::GeneralAssayI
 ///
 bool im::LogicControlProxy::ModifyGeneralAssayInfo(const ::im::tf::GeneralAssayInfo& aci)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -171,6 +175,7 @@ bool im::LogicControlProxy::ModifyGeneralAssayInfo(const ::im::tf::GeneralAssayI
 void im::LogicControlProxy::QueryImGeneralAssayInfo(::im::tf::GeneralAssayInfoQueryResp& _return
 	, const ::im::tf::GeneralAssayInfoQueryCond& gaiq)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
     
 	im::LogicControlHandler logicControl;
@@ -190,6 +195,7 @@ void im::LogicControlProxy::QueryImGeneralAssayInfo(::im::tf::GeneralAssayInfoQu
 ///
 void im::LogicControlProxy::AddReagentInfo(::tf::ResultLong& _return, const im::tf::ReagentInfoTable& rgntInfo)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -211,6 +217,7 @@ void im::LogicControlProxy::AddReagentInfo(::tf::ResultLong& _return, const im::
 bool im::LogicControlProxy::QueryReagentInfo(::im::tf::ReagentInfoTableQueryResp& qryResp
 	, const  ::im::tf::ReagentInfoTableQueryCond& qryCond)
 {
+    PROXY_CALL_RESP(qryResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -238,6 +245,7 @@ bool im::LogicControlProxy::QueryReagentInfo(::im::tf::ReagentInfoTableQueryResp
 bool im::LogicControlProxy::QueryReagentInfoForUI(::im::tf::ReagentInfoTableQueryResp& qryResp
 	, const  ::im::tf::ReagTableUIQueryCond& qryCond)
 {
+	PROXY_CALL_RESP(qryResp);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
     return RgntNoticeDataMng::GetInstance()->QueryReagentInfoForUI(qryResp, qryCond);
 }
@@ -255,6 +263,7 @@ bool im::LogicControlProxy::QueryReagentInfoForUI(::im::tf::ReagentInfoTableQuer
 bool im::LogicControlProxy::QueryReagentInfoForUIDirectly(::im::tf::ReagentInfoTableQueryResp& qryResp
 	, const ::im::tf::ReagTableUIQueryCond& qryCond)
 {
+    PROXY_CALL_RESP(qryResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -280,6 +289,7 @@ bool im::LogicControlProxy::QueryReagentInfoForUIDirectly(::im::tf::ReagentInfoT
 ///
 bool im::LogicControlProxy::ModifyReagentInfo(const ::im::tf::ReagentInfoTable& reagInfo)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -298,6 +308,7 @@ bool im::LogicControlProxy::ModifyReagentInfo(const ::im::tf::ReagentInfoTable&
 ///
 void im::LogicControlProxy::AddSuppliesInfo(::tf::ResultLong& _return, const im::tf::SuppliesInfoTable& splInfo)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -319,6 +330,7 @@ void im::LogicControlProxy::AddSuppliesInfo(::tf::ResultLong& _return, const im:
 bool im::LogicControlProxy::QuerySuppliesInfo(::im::tf::SuppliesInfoTableQueryResp& qryResp
 	, const ::im::tf::SuppliesInfoTableQueryCond& qryCond)
 {
+    PROXY_CALL_RESP(qryResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
     return RgntNoticeDataMng::GetInstance()->QuerySuppliesInfo(qryResp, qryCond);
 }
@@ -338,6 +350,7 @@ bool im::LogicControlProxy::QuerySuppliesInfo(::im::tf::SuppliesInfoTableQueryRe
 bool im::LogicControlProxy::QuerySuppliesInfoDirectly(::im::tf::SuppliesInfoTableQueryResp& qryResp
 	, const ::im::tf::SuppliesInfoTableQueryCond& qryCond)
 {
+    PROXY_CALL_RESP(qryResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -363,6 +376,7 @@ bool im::LogicControlProxy::QuerySuppliesInfoDirectly(::im::tf::SuppliesInfoTabl
 ///
 bool im::LogicControlProxy::ModifySuppliesInfo(const ::im::tf::SuppliesInfoTable& splInfo)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -383,6 +397,7 @@ bool im::LogicControlProxy::ModifySuppliesInfo(const ::im::tf::SuppliesInfoTable
 ///
 bool im::LogicControlProxy::QueryGeneralAssayInfo(const ::im::tf::GeneralAssayInfoQueryCond& qryCond, ::im::tf::GeneralAssayInfoQueryResp& qryResp)
 {
+    PROXY_CALL_RESP(qryResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -409,6 +424,7 @@ bool im::LogicControlProxy::QueryGeneralAssayInfo(const ::im::tf::GeneralAssayIn
 ///
 void im::LogicControlProxy::AddCaliDocGroup(::tf::ResultLong& _return, const ::im::tf::CaliDocGroup& cdg)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -428,6 +444,7 @@ void im::LogicControlProxy::AddCaliDocGroup(::tf::ResultLong& _return, const ::i
 ///
 bool im::LogicControlProxy::ModifyCaliDocGroup(const ::im::tf::CaliDocGroup& cdg)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -448,6 +465,7 @@ bool im::LogicControlProxy::ModifyCaliDocGroup(const ::im::tf::CaliDocGroup& cdg
 ///
 bool im::LogicControlProxy::DeleteCaliDocGroup(const ::im::tf::CaliDocGroupQueryCond& cdgq)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -472,6 +490,7 @@ bool im::LogicControlProxy::DeleteCaliDocGroup(const ::im::tf::CaliDocGroupQuery
 bool im::LogicControlProxy::QueryCaliDocGroup(::im::tf::CaliDocGroupQueryResp& _return
 	, const ::im::tf::CaliDocGroupQueryCond& cdgq)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -499,6 +518,7 @@ bool im::LogicControlProxy::QueryCaliDocGroup(::im::tf::CaliDocGroupQueryResp& _
 ///
 bool im::LogicControlProxy::QueryCaliDoc(::im::tf::CaliDocQueryResp& _return, const ::im::tf::CaliDocQueryCond& cdgq)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -525,6 +545,7 @@ bool im::LogicControlProxy::QueryCaliDoc(::im::tf::CaliDocQueryResp& _return, co
 ///
 bool im::LogicControlProxy::DownloadAssayInfo(::tf::ResultLong& _return, const im::tf::DownloadAssayInfo& dai)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -550,6 +571,7 @@ bool im::LogicControlProxy::DownloadAssayInfo(::tf::ResultLong& _return, const i
 ///
 bool im::LogicControlProxy::ParseCaliGrpBarcodeInfo(tf::CaliDocGroup& _return, const std::string& strBarcode)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -576,6 +598,7 @@ bool im::LogicControlProxy::ParseCaliGrpBarcodeInfo(tf::CaliDocGroup& _return, c
 ///
 void im::LogicControlProxy::AddDiluentInfo(::tf::ResultLong& _return, const ::im::tf::DiluentInfoTable& dlt)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -597,6 +620,7 @@ void im::LogicControlProxy::AddDiluentInfo(::tf::ResultLong& _return, const ::im
 bool im::LogicControlProxy::QueryDiluentInfoTable(::im::tf::DiluentInfoTableQueryResp& dltr
 	, const ::im::tf::DiluentInfoTableQueryCond& dltc)
 {
+    PROXY_CALL_RESP(dltr);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -623,6 +647,7 @@ bool im::LogicControlProxy::QueryDiluentInfoTable(::im::tf::DiluentInfoTableQuer
 bool im::LogicControlProxy::QueryDiluentInfoForUI(::im::tf::DiluentInfoTableQueryResp& dltr
 	, const  ::im::tf::ReagTableUIQueryCond& dltc)
 {
+	PROXY_CALL_RESP(dltr);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
     return RgntNoticeDataMng::GetInstance()->QueryDiluentInfoForUI(dltr, dltc);
 }
@@ -640,6 +665,7 @@ bool im::LogicControlProxy::QueryDiluentInfoForUI(::im::tf::DiluentInfoTableQuer
 bool im::LogicControlProxy::QueryDiluentInfoForUIDirectly(::im::tf::DiluentInfoTableQueryResp& dltr
 	, const ::im::tf::ReagTableUIQueryCond& dltc)
 {
+    PROXY_CALL_RESP(dltr);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -665,6 +691,7 @@ bool im::LogicControlProxy::QueryDiluentInfoForUIDirectly(::im::tf::DiluentInfoT
 ///
 bool im::LogicControlProxy::ModifyDiluentInfo(const ::im::tf::DiluentInfoTable& dlt)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -684,6 +711,7 @@ bool im::LogicControlProxy::ModifyDiluentInfo(const ::im::tf::DiluentInfoTable&
 ///
 bool im::LogicControlProxy::DeleteDiluentInfo(::tf::ResultLong& _return, const ::im::tf::DiluentInfoTableQueryCond& dltc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -713,6 +741,7 @@ bool im::LogicControlProxy::DeleteDiluentInfo(::tf::ResultLong& _return, const :
 ///
 im::tf::QcReason::type im::LogicControlProxy::GetQcApplyReason(const std::string& deviceSN, const int64_t id, const int32_t assaycode)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -730,6 +759,7 @@ im::tf::QcReason::type im::LogicControlProxy::GetQcApplyReason(const std::string
 ///
 void im::LogicControlProxy::AddQcApply(::tf::ResultLong& _return, const im::tf::QcApply& qa)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -750,6 +780,7 @@ void im::LogicControlProxy::AddQcApply(::tf::ResultLong& _return, const im::tf::
 ///
 bool im::LogicControlProxy::DeleteQcApply(const ::im::tf::QcApplyQueryCond& dltc)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -767,6 +798,7 @@ bool im::LogicControlProxy::DeleteQcApply(const ::im::tf::QcApplyQueryCond& dltc
 ///
 bool im::LogicControlProxy::ModifyQcApply(const im::tf::QcApply& qa)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -785,6 +817,7 @@ bool im::LogicControlProxy::ModifyQcApply(const im::tf::QcApply& qa)
 ///
 void im::LogicControlProxy::QueryQcApply(const ::im::tf::QcApplyQueryCond& dltc, std::vector<::im::tf::QcApply>& ret)
 {
+    PROXY_CALL_RESP(ret);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -810,6 +843,7 @@ void im::LogicControlProxy::QueryQcApply(const ::im::tf::QcApplyQueryCond& dltc,
 ///
 bool im::LogicControlProxy::QueryQcApply(::im::tf::QcApplyQueryResp& qarp, const ::im::tf::QcApplyQueryCond& qacd)
 {
+    PROXY_CALL_RESP(qarp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -835,6 +869,7 @@ bool im::LogicControlProxy::QueryQcApply(::im::tf::QcApplyQueryResp& qarp, const
 ///
 bool im::LogicControlProxy::QueryQcLjAssay(::im::tf::QcLjAssayResp& QcLjResp, const ::im::tf::QcResultQueryCond& QcRltCond)
 {
+    PROXY_CALL_RESP(QcLjResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -861,6 +896,7 @@ bool im::LogicControlProxy::QueryQcLjAssay(::im::tf::QcLjAssayResp& QcLjResp, co
 ///
 bool im::LogicControlProxy::QueryQcLjMaterial(::im::tf::QcLjMaterialResp& QcRlt, const ::im::tf::QcResultQueryCond& QcRltCond)
 {
+    PROXY_CALL_RESP(QcRlt);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -887,6 +923,7 @@ bool im::LogicControlProxy::QueryQcLjMaterial(::im::tf::QcLjMaterialResp& QcRlt,
 ///
 bool im::LogicControlProxy::QueryQcYouden(::im::tf::QcYoudenResp& QcRlt, const ::im::tf::QcResultQueryCond& QcRltCond)
 {
+    PROXY_CALL_RESP(QcRlt);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -915,6 +952,7 @@ bool im::LogicControlProxy::QueryQcYouden(::im::tf::QcYoudenResp& QcRlt, const :
 ///
 bool im::LogicControlProxy::UpdateQcBreakReasonAndSolution(const int64_t qcResultId, const ::im::tf::controlWay::type cway, const std::string& reason, const std::string& solution)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -934,6 +972,7 @@ bool im::LogicControlProxy::UpdateQcBreakReasonAndSolution(const int64_t qcResul
 ///
 bool im::LogicControlProxy::UpdateQcResultExclude(const int64_t qcResultId, const ::im::tf::controlWay::type cway, bool exclude)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -954,6 +993,7 @@ bool im::LogicControlProxy::UpdateQcResultExclude(const int64_t qcResultId, cons
 ///
 bool im::LogicControlProxy::DetectModuleDebug(const  ::tf::MaintainItemType::type itemType, const std::vector<std::string> & lstDevSN, const std::vector<int32_t> & lstParam)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -976,6 +1016,7 @@ bool im::LogicControlProxy::DetectModuleDebug(const  ::tf::MaintainItemType::typ
 ///
 bool im::LogicControlProxy::ProcessCheck(const  ::tf::MaintainItemType::type itemType, const std::vector<std::string> & lstDevSN, const std::vector<int32_t> & lstParam)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -997,6 +1038,7 @@ bool im::LogicControlProxy::ProcessCheck(const  ::tf::MaintainItemType::type ite
 ///
 bool im::LogicControlProxy::SingleMaintance(const ::tf::MaintainItemType::type itemType, const std::string & deviceSN, const std::vector<int32_t>& lstParam)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1018,6 +1060,7 @@ bool im::LogicControlProxy::SingleMaintance(const ::tf::MaintainItemType::type i
 ///
 bool im::LogicControlProxy::ParseSupplyCupInfo(::im::tf::ParseSupplyeCupResp& CupRlt, const std::string& cupBarcode, const std::string& deviceSN)
 {
+    PROXY_CALL_RESP(CupRlt);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1044,6 +1087,7 @@ bool im::LogicControlProxy::ParseSupplyCupInfo(::im::tf::ParseSupplyeCupResp& Cu
 ///
 bool im::LogicControlProxy::AddSupplyCup(::tf::ResultLong& _return, const im::tf::SuppliesInfoTable& si)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1068,6 +1112,7 @@ bool im::LogicControlProxy::AddSupplyCup(::tf::ResultLong& _return, const im::tf
 ///
 bool im::LogicControlProxy::UpdateUtilityUserChose(const ::im::tf::UserConsumablesState& utilityConsumablesState)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
     
 	im::LogicControlHandler logicControl;
@@ -1086,6 +1131,7 @@ bool im::LogicControlProxy::UpdateUtilityUserChose(const ::im::tf::UserConsumabl
 ///
 bool im::LogicControlProxy::QueryGeagentCoverStatus(const std::string& deviceSN)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1104,6 +1150,7 @@ bool im::LogicControlProxy::QueryGeagentCoverStatus(const std::string& deviceSN)
 ///
 void im::LogicControlProxy::QueryReagentLoadUnloadExistReagent(::tf::ResultBool& _return, const std::string& deviceSN)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1122,6 +1169,7 @@ void im::LogicControlProxy::QueryReagentLoadUnloadExistReagent(::tf::ResultBool&
 ///
 void im::LogicControlProxy::QueryDeviceTemperatureErr(::tf::ResultBool& _return, const std::string& deviceSN)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1141,6 +1189,7 @@ void im::LogicControlProxy::QueryDeviceTemperatureErr(::tf::ResultBool& _return,
 bool im::LogicControlProxy::QueryReagentInfoForReCalc(::im::tf::ReagentInfoTableQueryResp& qryResp
 	, const  ::im::tf::ReagentInfoTableQueryCond& qryCond)
 {
+	PROXY_CALL_RESP(qryResp);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1156,6 +1205,7 @@ bool im::LogicControlProxy::QueryReagentInfoForReCalc(::im::tf::ReagentInfoTable
 void im::LogicControlProxy::AddSpecialWashSampleProbe(::tf::ResultLong& _return
 	, const ::im::tf::SpecialWashSampleProbe& swsp)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1164,12 +1214,14 @@ void im::LogicControlProxy::AddSpecialWashSampleProbe(::tf::ResultLong& _return
 
 bool im::LogicControlProxy::DeleteSpecialWashSampleProbe(const ::im::tf::SpecialWashSampleProbeQueryCond& swspq)
 {
+	PROXY_CALL();
 	im::LogicControlHandler logicControl;
 	return logicControl.DeleteSpecialWashSampleProbe(swspq);
 }
 
 bool im::LogicControlProxy::ModifySpecialWashSampleProbe(const ::im::tf::SpecialWashSampleProbe& swsp)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1179,6 +1231,7 @@ bool im::LogicControlProxy::ModifySpecialWashSampleProbe(const ::im::tf::Special
 void im::LogicControlProxy::QuerySpecialWashSampleProbe(::im::tf::SpecialWashSampleProbeQueryResp& _return
 	, const ::im::tf::SpecialWashSampleProbeQueryCond& swsp)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1187,6 +1240,7 @@ void im::LogicControlProxy::QuerySpecialWashSampleProbe(::im::tf::SpecialWashSam
 
 int32_t im::LogicControlProxy::QuerySpecialWashSampleProbeCount(const ::im::tf::SpecialWashSampleProbeQueryCond& swsp)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1205,6 +1259,7 @@ int32_t im::LogicControlProxy::QuerySpecialWashSampleProbeCount(const ::im::tf::
 ///
 void im::LogicControlProxy::AddSupplyAttribute(::tf::ResultLong& _return, const ::im::tf::SupplyAttribute& sa)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1224,6 +1279,7 @@ void im::LogicControlProxy::AddSupplyAttribute(::tf::ResultLong& _return, const
 ///
 bool im::LogicControlProxy::QuerySupplyAttribute(::im::tf::SupplyAttributeQueryResp& _return, const ::im::tf::SupplyAttributeQueryCond& saq)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1249,6 +1305,7 @@ bool im::LogicControlProxy::QuerySupplyAttribute(::im::tf::SupplyAttributeQueryR
 ///
 bool im::LogicControlProxy::ModifySupplyAttribute(const ::im::tf::SupplyAttribute& sa)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
     im::LogicControlHandler logicControl;
@@ -1278,6 +1335,7 @@ bool im::LogicControlProxy::ModifySupplyAttribute(const ::im::tf::SupplyAttribut
 ///
 bool im::LogicControlProxy::UpdateLowerAlarmValue(const  ::im::tf::SuppliesType::type supType)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1297,6 +1355,7 @@ bool im::LogicControlProxy::UpdateLowerAlarmValue(const  ::im::tf::SuppliesType:
 ///
 bool im::LogicControlProxy::DeleteSupplyAttribute(const::im::tf::SupplyAttributeQueryCond& saq)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1314,6 +1373,7 @@ bool im::LogicControlProxy::DeleteSupplyAttribute(const::im::tf::SupplyAttribute
 ///
 bool im::LogicControlProxy::IsCaliGrpCaling(const ::im::tf::CaliDocGroup& cdg,const bool pos)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1328,6 +1388,7 @@ bool im::LogicControlProxy::IsCaliGrpCaling(const ::im::tf::CaliDocGroup& cdg,co
 ///
 bool im::LogicControlProxy::GetResultCodeSet(std::vector< ::im::tf::ResultCodeSet> & _return)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1348,6 +1409,7 @@ bool im::LogicControlProxy::GetResultCodeSet(std::vector< ::im::tf::ResultCodeSe
 ///
 bool im::LogicControlProxy::SaveResultCode(const std::vector< ::im::tf::ResultCodeSet> & rcs)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1365,6 +1427,7 @@ bool im::LogicControlProxy::SaveResultCode(const std::vector< ::im::tf::ResultCo
 ///
 bool im::LogicControlProxy::IsQcUsed(int64_t qcDocId)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1373,6 +1436,7 @@ bool im::LogicControlProxy::IsQcUsed(int64_t qcDocId)
 
 void im::LogicControlProxy::QueryQcResult(const ::im::tf::QcResultQueryCond& cond, ::im::tf::QcResultQueryResp& resp)
 {
+	PROXY_CALL_RESP(resp);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1391,6 +1455,7 @@ void im::LogicControlProxy::QueryQcResult(const ::im::tf::QcResultQueryCond& con
 ///
 bool im::LogicControlProxy::IsReagentControling(const ::im::tf::ReagentInfoTable& di)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1408,6 +1473,7 @@ bool im::LogicControlProxy::IsReagentControling(const ::im::tf::ReagentInfoTable
 ///
 bool im::LogicControlProxy::UpdateCurResult(::im::tf::AssayTestResult& _return, const ::tf::CurResultUpdate & cr)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1433,6 +1499,7 @@ bool im::LogicControlProxy::UpdateCurResult(::im::tf::AssayTestResult& _return,
 ///
 bool im::LogicControlProxy::TestModeUpdateByUI(const std::vector<std::string>& vecDeviceSn)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1451,6 +1518,7 @@ bool im::LogicControlProxy::TestModeUpdateByUI(const std::vector<std::string>& v
 ///
 void im::LogicControlProxy::ParaseAssayBarCode(const std::vector<std::string>& vecBar, std::vector<im::tf::ImportAssayParamInfo>& assayInfo)
 {
+	PROXY_CALL_RESP(assayInfo);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1459,6 +1527,7 @@ void im::LogicControlProxy::ParaseAssayBarCode(const std::vector<std::string>& v
 
 bool im::LogicControlProxy::ParaseAssayBarCodeToDB(const std::string& strBarCode)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1477,6 +1546,7 @@ bool im::LogicControlProxy::ParaseAssayBarCodeToDB(const std::string& strBarCode
 ///
 bool im::LogicControlProxy::IsCanLoadReagent(const std::string & deviceSN)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1494,6 +1564,7 @@ bool im::LogicControlProxy::IsCanLoadReagent(const std::string & deviceSN)
 ///
 bool im::LogicControlProxy::DetectModeUpdateByUI()
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::LogicControlHandler logicControl;
@@ -1511,6 +1582,7 @@ bool im::LogicControlProxy::DetectModeUpdateByUI()
 ///
 bool im::LogicControlProxy::ExecuteDebugProcess(const im::tf::DebugProcess& Process)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
     
 	im::LogicControlHandler logicControl;
@@ -1531,6 +1603,7 @@ bool im::LogicControlProxy::ExecuteDebugProcess(const im::tf::DebugProcess& Proc
 ///
 bool im::LogicControlProxy::GetDebugModules(const std::string& DeviceSn, im::tf::DebugModuleQueryResp& stuDbgMdResp)
 {
+    PROXY_CALL_RESP(stuDbgMdResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
     im::LogicControlHandler logicControl;
     logicControl.GetDebugModules(stuDbgMdResp, DeviceSn);
@@ -1554,6 +1627,7 @@ bool im::LogicControlProxy::GetDebugModules(const std::string& DeviceSn, im::tf:
 ///
 bool im::LogicControlProxy::MoveMotor(::tf::ResultLong& retl, const std::string& DeviceSn, bool forward, const im::tf::DebugPart& DebugPart, int step)
 {
+    PROXY_CALL_RESP(retl);
     ULOG(LOG_INFO, "%s(%s, %d, %d, %d)", __FUNCTION__, DeviceSn, DebugPart.MotorInd, int(forward), step);
     im::LogicControlHandler logicControl;
     logicControl.MoveMotor(retl, DeviceSn, forward, DebugPart, step);
@@ -1575,6 +1649,7 @@ bool im::LogicControlProxy::MoveMotor(::tf::ResultLong& retl, const std::string&
 ///
 bool im::LogicControlProxy::SaveDebugParameter(::tf::ResultLong& retl, const std::string& DeviceSn, const im::tf::DebugPart& DebugPart)
 {
+    PROXY_CALL_RESP(retl);
     ULOG(LOG_INFO, "%s(%s, %d, %d)", __FUNCTION__, DeviceSn, DebugPart.MotorInd, DebugPart.tempParam);
     im::LogicControlHandler logicControl;
     logicControl.SaveDebugParameter(retl, DeviceSn, DebugPart);
@@ -1596,6 +1671,7 @@ bool im::LogicControlProxy::SaveDebugParameter(::tf::ResultLong& retl, const std
 ///
 bool im::LogicControlProxy::ExcuteDebugUnit(::tf::ResultLong& retl, const std::string& DeviceSn, const im::tf::DebugUnit& DebugUnit)
 {
+    PROXY_CALL_RESP(retl);
     ULOG(LOG_INFO, "%s(%s, %s)", __FUNCTION__, DeviceSn, DebugUnit.UnitName);
     im::LogicControlHandler logicControl;
     logicControl.ExcuteDebugUnit(retl, DeviceSn, DebugUnit);
@@ -1618,6 +1694,7 @@ bool im::LogicControlProxy::ExcuteDebugUnit(::tf::ResultLong& retl, const std::s
 ///
 bool im::LogicControlProxy::Switch(::tf::ResultLong& retl, const std::string& DeviceSn, bool bOn, const im::tf::DebugPart& DebugPart)
 {
+    PROXY_CALL_RESP(retl);
     ULOG(LOG_INFO, "%s(%s, %d, %d)", __FUNCTION__, DeviceSn, DebugPart.GetCmdCode, int(bOn));
     im::LogicControlHandler logicControl;
     logicControl.Switch(retl, DeviceSn, bOn, DebugPart);
@@ -1639,6 +1716,7 @@ bool im::LogicControlProxy::Switch(::tf::ResultLong& retl, const std::string& De
 ///
 bool im::LogicControlProxy::ExportParamFile(::tf::ResultLong& retl, const std::string& DeviceSn, const std::string& path)
 {
+    PROXY_CALL_RESP(retl);
     ULOG(LOG_INFO, "%s(%s, %s)", __FUNCTION__, DeviceSn, path);
     im::LogicControlHandler logicControl;
     logicControl.ExportParamFile(retl, path, DeviceSn);
@@ -1660,6 +1738,7 @@ bool im::LogicControlProxy::ExportParamFile(::tf::ResultLong& retl, const std::s
 ///
 bool im::LogicControlProxy::ImportParamFile(::tf::ResultLong& retl, const std::string& DeviceSn, const std::string& path)
 {
+    PROXY_CALL_RESP(retl);
     ULOG(LOG_INFO, "%s(%s, %s)", __FUNCTION__, DeviceSn, path);
     im::LogicControlHandler logicControl;
     logicControl.ImportParamFile(retl, path, DeviceSn);
@@ -1681,6 +1760,7 @@ bool im::LogicControlProxy::ImportParamFile(::tf::ResultLong& retl, const std::s
 ///
 bool im::LogicControlProxy::ReadDebugParameter(::tf::ResultLong& retl, const std::string& DeviceSn, const im::tf::DebugPart& DebugPart)
 {
+    PROXY_CALL_RESP(retl);
     ULOG(LOG_INFO, "%s(%s, %d, %d)", __FUNCTION__, DeviceSn, DebugPart.MotorInd, DebugPart.tempParam);
     im::LogicControlHandler logicControl;
     logicControl.ReadDebugParameter(retl, DeviceSn, DebugPart);
@@ -1700,6 +1780,7 @@ bool im::LogicControlProxy::ReadDebugParameter(::tf::ResultLong& retl, const std
 ///
 bool  im::LogicControlProxy::UpdateResultToItemHist(::tf::ResultLong& _return, const std::vector<int64_t> & lstItemId)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s", __FUNCTION__);
     im::LogicControlHandler logicControl;
     logicControl.UpdateResultToItemHist(_return, lstItemId);
@@ -45,6 +45,7 @@
 ///////////////////////////////////////////////////////////////////////////
 #include "I6000LogicControlProxy.h"
 #include "src/common/Mlog/mlog.h"
+#include "thrift/ProxyCallMetrics.h"
 #include "src/common/defs.h"
 #include "src/dcs/interface/im/i6000/I6000LogicControlHandler.h"
 #include "src/thrift/im/i6000/gen-cpp/i6000_logic_control_constants.h"
@@ -116,6 +117,7 @@ std::shared_ptr<im::i6000::tf::I6000LogicControlClient> im::i6000::LogicControlP
 ///
 bool im::i6000::LogicControlProxy::QueryAssayTestResult(im::tf::AssayTestResultQueryResp& qryResp, im::tf::AssayTestResultQueryCond& qryCond)
 {
+	PROXY_CALL_RESP(qryResp);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -142,6 +144,7 @@ bool im::i6000::LogicControlProxy::QueryAssayTestResult(im::tf::AssayTestResultQ
 ///
 bool im::i6000::LogicControlProxy::CheckLoadReagent(::tf::ResultLong& _return, const std::string& deviceSN, const int32_t pos)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -166,6 +169,7 @@ bool im::i6000::LogicControlProxy::CheckLoadReagent(::tf::ResultLong& _return, c
 ///
 bool im::i6000::LogicControlProxy::CheckReagentCoverReagentScan(const std::string& deviceSN, bool& HasReagentScan)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -188,6 +192,7 @@ bool im::i6000::LogicControlProxy::CheckReagentCoverReagentScan(const std::strin
 ///
 bool im::i6000::LogicControlProxy::LoadReagent(::tf::ResultLong& _return, const std::string& deviceSN, const int32_t pos)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -209,6 +214,7 @@ bool im::i6000::LogicControlProxy::LoadReagent(::tf::ResultLong& _return, const
 ///
 bool im::i6000::LogicControlProxy::CancelLoadReagent(::tf::ResultLong& _return, const std::string& deviceSN)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -231,6 +237,7 @@ bool im::i6000::LogicControlProxy::CancelLoadReagent(::tf::ResultLong& _return,
 ///
 bool im::i6000::LogicControlProxy::CheckUnLoadReagent(::tf::ResultLong& _return, const std::string& deviceSN, const int32_t pos /*= -1*/)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s(, %s, %d)", __FUNCTION__, deviceSN, pos);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -253,6 +260,7 @@ bool im::i6000::LogicControlProxy::CheckUnLoadReagent(::tf::ResultLong& _return,
 ///
 bool im::i6000::LogicControlProxy::UnLoadReagent(::tf::ResultLong& _return, const std::string& deviceSN, const int32_t pos)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -275,6 +283,7 @@ bool im::i6000::LogicControlProxy::UnLoadReagent(::tf::ResultLong& _return, cons
 ///
 bool im::i6000::LogicControlProxy::CancelUnLoadReagent(::tf::ResultLong& _return, const std::string& deviceSN)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -296,6 +305,7 @@ bool im::i6000::LogicControlProxy::CancelUnLoadReagent(::tf::ResultLong& _return
 ///
 bool im::i6000::LogicControlProxy::SetReagentMask(::im::i6000::tf::ResultReagent& _return, const  ::im::tf::ReagentInfoTable& reag)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -317,6 +327,7 @@ bool im::i6000::LogicControlProxy::SetReagentMask(::im::i6000::tf::ResultReagent
 ///
 bool im::i6000::LogicControlProxy::SetReagentPreUse(::tf::ResultLong& _return, const  ::im::tf::ReagentInfoTable& reag)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -339,6 +350,7 @@ bool im::i6000::LogicControlProxy::SetReagentPreUse(::tf::ResultLong& _return, c
 ///
 bool im::i6000::LogicControlProxy::SetDiluentMask(::tf::ResultLong& _return, const ::im::tf::DiluentInfoTable& dilu)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -361,6 +373,7 @@ bool im::i6000::LogicControlProxy::SetDiluentMask(::tf::ResultLong& _return, con
 ///
 bool im::i6000::LogicControlProxy::SetDiluentPreUse(::tf::ResultLong& _return, const ::im::tf::DiluentInfoTable& dilu)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -380,6 +393,7 @@ bool im::i6000::LogicControlProxy::SetDiluentPreUse(::tf::ResultLong& _return, c
 ///
 bool im::i6000::LogicControlProxy::SetReagentCaliSel(::tf::ResultLong& _return, const  ::im::tf::ReagentInfoTable& reag)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -402,6 +416,7 @@ bool im::i6000::LogicControlProxy::SetReagentCaliSel(::tf::ResultLong& _return,
 ///
 bool im::i6000::LogicControlProxy::SetReagentScan(::tf::ResultLong& _return, const std::string& deviceSN, const std::vector<int32_t>& pos)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -424,6 +439,7 @@ bool im::i6000::LogicControlProxy::SetReagentScan(::tf::ResultLong& _return, con
 ///
 bool im::i6000::LogicControlProxy::SetVortexReagent(::tf::ResultLong& _return, const std::string& deviceSN)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -445,6 +461,7 @@ bool im::i6000::LogicControlProxy::SetVortexReagent(::tf::ResultLong& _return, c
 ///
 bool im::i6000::LogicControlProxy::ClearReagentCaliMask(::tf::ResultLong& _return, const  ::im::tf::ReagentInfoTable& reag)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -466,6 +483,7 @@ bool im::i6000::LogicControlProxy::ClearReagentCaliMask(::tf::ResultLong& _retur
 ///
 bool im::i6000::LogicControlProxy::QueryCaliCurve(::im::tf::CaliCurveQueryResp& _return, const ::im::tf::CaliCurveQueryCond& ccqc)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -476,6 +494,7 @@ bool im::i6000::LogicControlProxy::QueryCaliCurve(::im::tf::CaliCurveQueryResp&
 
 bool im::i6000::LogicControlProxy::ModifyCaliCurve(const ::im::tf::CaliCurve& caliCurv)
 {
+    PROXY_CALL();
     im::i6000::LogicControlHandler logicControl;
     return logicControl.ModifyCaliCurve(caliCurv);
 }
@@ -493,6 +512,7 @@ bool im::i6000::LogicControlProxy::ModifyCaliCurve(const ::im::tf::CaliCurve& ca
 ///
 bool im::i6000::LogicControlProxy::GetReagentCurveInfo(::im::tf::CaliCurveQueryResp & _return, const::im::tf::ReagentInfoTable & reag)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -515,6 +535,7 @@ bool im::i6000::LogicControlProxy::GetReagentCurveInfo(::im::tf::CaliCurveQueryR
 ///
 bool im::i6000::LogicControlProxy::GetHistoryCurveInfo(::im::tf::CaliCurveQueryResp& _return, const std::string& deviceSN, const int32_t assayCode)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -536,6 +557,7 @@ bool im::i6000::LogicControlProxy::GetHistoryCurveInfo(::im::tf::CaliCurveQueryR
 ///
 bool im::i6000::LogicControlProxy::UpdateCurentCurve(const  ::im::tf::CaliCurve& curve, const  ::im::tf::ReagentInfoTable& reag)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -558,6 +580,7 @@ bool im::i6000::LogicControlProxy::UpdateCurentCurve(const  ::im::tf::CaliCurve&
 ///
 bool im::i6000::LogicControlProxy::QueryMaterialStatus(const std::string& DeviceSn, const im::i6000::tf::MonitorMessageType::type msgType)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -579,6 +602,7 @@ bool im::i6000::LogicControlProxy::QueryMaterialStatus(const std::string& Device
 ///
 bool im::i6000::LogicControlProxy::ReCalcResult(::im::tf::AssayTestResultQueryResp& _return, const std::vector< ::im::tf::AssayTestResult> & lsResult, const::im::tf::ReagentInfoTable& reag)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -601,6 +625,7 @@ bool im::i6000::LogicControlProxy::ReCalcResult(::im::tf::AssayTestResultQueryRe
 ///
 bool im::i6000::LogicControlProxy::QueryResultsUnCalc(::im::tf::AssayTestResultQueryResp& _return, const  ::im::tf::ReagentInfoTable& reag)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -621,6 +646,7 @@ bool im::i6000::LogicControlProxy::QueryResultsUnCalc(::im::tf::AssayTestResultQ
 ///
 bool im::i6000::LogicControlProxy::ModifyAssayTestResult(const ::im::tf::AssayTestResult& rt)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -640,6 +666,7 @@ bool im::i6000::LogicControlProxy::ModifyAssayTestResult(const ::im::tf::AssayTe
 ///
 bool im::i6000::LogicControlProxy::SetSupplyPreUse(::tf::ResultLong& _return, const ::im::tf::SuppliesInfoTable& supply)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -661,6 +688,7 @@ bool im::i6000::LogicControlProxy::SetSupplyPreUse(::tf::ResultLong& _return, co
 ///
 bool im::i6000::LogicControlProxy::CheckLoadUnloadIsMask(::tf::ResultLong& _return, const std::string& deviceSN)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -684,6 +712,7 @@ bool im::i6000::LogicControlProxy::CheckLoadUnloadIsMask(::tf::ResultLong& _retu
 ///
 bool im::i6000::LogicControlProxy::ManualHandlReag(::tf::ResultBool& _return, const std::string& deviceSN, bool bChangeReag)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -705,6 +734,7 @@ bool im::i6000::LogicControlProxy::ManualHandlReag(::tf::ResultBool& _return, co
 ///
 bool im::i6000::LogicControlProxy::GetReagentCurrentCurveInfo(::im::tf::CaliCurveQueryResp & _return, const::im::tf::ReagentInfoTable & reag)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	im::i6000::LogicControlHandler logicControl;
@@ -726,6 +756,7 @@ bool im::i6000::LogicControlProxy::GetReagentCurrentCurveInfo(::im::tf::CaliCurv
 ///
 bool im::i6000::LogicControlProxy::ResetReagentLoader(::tf::ResultLong& _return, const std::string& deviceSN)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
     im::i6000::LogicControlHandler logicControl;
@@ -48,6 +48,7 @@
 #include "src/common/Mlog/mlog.h"
 #include "shared/messagebus.h"
 #include "shared/msgiddef.h"
+#include "thrift/UiNotifyQueue.h"
 #include "shared/CommonInformationManager.h"
 #include "shared/ThriftEnumTransform.h"
 #include "src/leonis/manager/OperationLogManager.h"
@@ -65,7 +66,7 @@
 ///
 void im::i6000::I6000UiControlHandler::ReportReagentChanged(const ::im::tf::ReagentInfoTable& reag, const ::im::tf::ChangeType::type type)
 {
-    POST_MESSAGE(MSG_ID_IM_REAGENT_INFO_UPDATE, reag, type);
+    QUEUE_NOTIFY(MSG_ID_IM_REAGENT_INFO_UPDATE, reag, type);
 }
 
 ///
@@ -81,7 +82,7 @@ void im::i6000::I6000UiControlHandler::ReportReagentChanged(const ::im::tf::Reag
 ///
 void im::i6000::I6000UiControlHandler::ReportDiluentChanged(const im::tf::DiluentInfoTable& dilu, const  im::tf::ChangeType::type type)
 {
-	POST_MESSAGE(MSG_ID_IM_DILUENT_INFO_UPDATE, dilu, type);
+	QUEUE_NOTIFY(MSG_ID_IM_DILUENT_INFO_UPDATE, dilu, type);
 }
 
 ///
@@ -96,7 +97,7 @@ void im::i6000::I6000UiControlHandler::ReportDiluentChanged(const im::tf::Diluen
 ///
 void im::i6000::I6000UiControlHandler::ReportSupplyChanged(const im::tf::SuppliesInfoTable& supply, const im::tf::ChangeType::type type)
 {
-	POST_MESSAGE(MSG_ID_IM_SUPPLY_INFO_UPDATE, supply, type);
+	QUEUE_NOTIFY(MSG_ID_IM_SUPPLY_INFO_UPDATE, supply, type);
 }
 
 ///
@@ -139,7 +140,7 @@ void im::i6000::I6000UiControlHandler::ReportDetectSignal(const::tf::MaintainIte
 {
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	// 发送设备状态信息到UI消息总线
-	POST_MESSAGE(MSG_ID_MAINTAIN_DETECT_UPDATE, mit, sigValue);
+	QUEUE_NOTIFY(MSG_ID_MAINTAIN_DETECT_UPDATE, mit, sigValue);
 }
 
 ///
@@ -155,7 +156,7 @@ void im::i6000::I6000UiControlHandler::ReportDetectSignal(const::tf::MaintainIte
 void im::i6000::I6000UiControlHandler::ReportQcApplyDel(const ::im::tf::QcApply& qa)
 {
 	// 发送试剂扫描结果信息到UI消息总线
-	POST_MESSAGE(MSG_ID_IM_QCAPP_INFO_UPDATE, qa);
+	QUEUE_NOTIFY(MSG_ID_IM_QCAPP_INFO_UPDATE, qa);
 }
 
 ///
@@ -171,7 +172,7 @@ void im::i6000::I6000UiControlHandler::ReportQcApplyDel(const ::im::tf::QcApply&
 ///
 void im::i6000::I6000UiControlHandler::ReportCaliGrpChanged(const im::tf::CaliDocGroup& cdg, const im::tf::ChangeType::type type)
 {
-	POST_MESSAGE(MSG_ID_IM_CALI_GRP_UPDATE, cdg, type);
+	QUEUE_NOTIFY(MSG_ID_IM_CALI_GRP_UPDATE, cdg, type);
 }
 
 ///
@@ -187,7 +188,8 @@ void im::i6000::I6000UiControlHandler::ReportCaliGrpChanged(const im::tf::CaliDo
 ///
 void im::i6000::I6000UiControlHandler::ReportReagentLoadStatus(const std::string& deviceSN, const bool isRunning)
 {
-	POST_MESSAGE(MSG_ID_REAGENT_LOAD_STATUS_UPDATE, QString::fromStdString(deviceSN), isRunning);
+	QUEUE_NOTIFY_MERGED(MSG_ID_REAGENT_LOAD_STATUS_UPDATE, deviceSN, std::make_pair(QString::fromStdString(deviceSN), isRunning),
+        [](std::pair<QString, bool>& pending, const std::pair<QString, bool>& newer) { return pending.second == newer.second; });
 }
 
 ///
@@ -201,7 +203,7 @@ void im::i6000::I6000UiControlHandler::ReportReagentLoadStatus(const std::string
 ///
 void im::i6000::I6000UiControlHandler::ReportReagentLoaderResetRlt(const std::string& deviceSN, const ::im::i6000::tf::ReagentLoaderResetRlt::type rlt)
 {
-    POST_MESSAGE(MSG_ID_IM_RGNT_LOADER_RESET_FINISH, QString::fromStdString(deviceSN), rlt);
+    QUEUE_NOTIFY(MSG_ID_IM_RGNT_LOADER_RESET_FINISH, QString::fromStdString(deviceSN), rlt);
 }
 
 ///
@@ -216,7 +218,7 @@ void im::i6000::I6000UiControlHandler::ReportReagentLoaderResetRlt(const std::st
 ///
 void im::i6000::I6000UiControlHandler::ReportTakeReagentMessage(const std::string& deviceSN)
 {
-	POST_MESSAGE(MSG_ID_REAGENT_TAKE_MESSAGE, QString::fromStdString(deviceSN));
+	QUEUE_NOTIFY(MSG_ID_REAGENT_TAKE_MESSAGE, QString::fromStdString(deviceSN));
 }
 
 ///
@@ -231,7 +233,7 @@ void im::i6000::I6000UiControlHandler::ReportTakeReagentMessage(const std::strin
 ///
 void im::i6000::I6000UiControlHandler::NotifyUIContinueRun(const std::string& deviceSN)
 {
-	POST_MESSAGE(MSG_ID_CONTINUE_RUN);
+	QUEUE_NOTIFY(MSG_ID_CONTINUE_RUN);
 }
 
 ///
@@ -248,7 +250,7 @@ void im::i6000::I6000UiControlHandler::NotifyUIContinueRun(const std::string& de
 void im::i6000::I6000UiControlHandler::ReportManualHandlReagResult(const std::string& deviceSN, const int result)
 {
 	ULOG(LOG_INFO, "%s : %s,%d", __FUNCTION__, deviceSN, result);
-	POST_MESSAGE(MSG_ID_MANUAL_HANDL_REAG, QString::fromStdString(deviceSN), result);
+	QUEUE_NOTIFY(MSG_ID_MANUAL_HANDL_REAG, QString::fromStdString(deviceSN), result);
 }
 
 ///
@@ -277,7 +279,7 @@ void im::i6000::I6000UiControlHandler::GetSuppliesTypeName(std::string& _return,
 ///
 void im::i6000::I6000UiControlHandler::ReportCaliEnd(const  ::im::tf::CaliCurve& curve)
 {
-    POST_MESSAGE(MSG_ID_IM_CALI_END, curve);
+    QUEUE_NOTIFY(MSG_ID_IM_CALI_END, curve);
 }
 
 ///
@@ -292,7 +294,8 @@ void im::i6000::I6000UiControlHandler::ReportCaliEnd(const  ::im::tf::CaliCurve&
 ///
 void im::i6000::I6000UiControlHandler::ReportTemperatureErr(const std::string& deviceSN, const bool isErr)
 {
-    POST_MESSAGE(MSG_ID_TEMPERATURE_ERR, QString::fromStdString(deviceSN), isErr);
+    QUEUE_NOTIFY_MERGED(MSG_ID_TEMPERATURE_ERR, deviceSN, std::make_pair(QString::fromStdString(deviceSN), isErr),
+        [](std::pair<QString, bool>& pending, const std::pair<QString, bool>& newer) { return pending.second == newer.second; });
 }
 
 ///
@@ -308,6 +311,6 @@ void im::i6000::I6000UiControlHandler::ReportTemperatureErr(const std::string& d
 ///
 bool im::i6000::I6000UiControlHandler::ReportExecuteDebugProResult(const  ::im::tf::DebugProcess& Process)
 {
-    POST_MESSAGE(MSG_ID_DEBUGPRO_RESULT, Process);
+    QUEUE_NOTIFY(MSG_ID_DEBUGPRO_RESULT, Process);
     return true;
 }
@@ -45,6 +45,7 @@
 ///////////////////////////////////////////////////////////////////////////
 #include "IseLogicControlProxy.h"
 #include "src/common/Mlog/mlog.h"
+#include "thrift/ProxyCallMetrics.h"
 #include "src/dcs/interface/ise/IseLogicControlHandler.h"
 #include "src/thrift/Ise/gen-cpp/Ise_logic_control_constants.h"
 #include <thrift/transport/TSocket.h>
@@ -108,6 +109,7 @@ std::shared_ptr<ise::tf::IseLogicControlClient> ise::LogicControlProxy::GetIseLo
 ///
 void ise::LogicControlProxy::AddGeneralAssayInfo(::tf::ResultLong& _return, const ::ise::tf::GeneralAssayInfo& gai)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -127,6 +129,7 @@ void ise::LogicControlProxy::AddGeneralAssayInfo(::tf::ResultLong& _return, cons
 ///
 bool ise::LogicControlProxy::DeleteGeneralAssayInfo(const ::ise::tf::GeneralAssayInfoQueryCond& gaiq)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -146,6 +149,7 @@ bool ise::LogicControlProxy::DeleteGeneralAssayInfo(const ::ise::tf::GeneralAssa
 ///
 bool ise::LogicControlProxy::ModifyAssayConfigInfo(const ise::tf::GeneralAssayInfo& aci)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -166,6 +170,7 @@ bool ise::LogicControlProxy::ModifyAssayConfigInfo(const ise::tf::GeneralAssayIn
 ///
 bool ise::LogicControlProxy::QueryAssayConfigInfo(const ::ise::tf::GeneralAssayInfoQueryCond& qryCond, ::ise::tf::GeneralAssayInfoQueryResp& qryResp)
 {
+    PROXY_CALL_RESP(qryResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -190,6 +195,7 @@ bool ise::LogicControlProxy::QueryAssayConfigInfo(const ::ise::tf::GeneralAssayI
 ///
 void ise::LogicControlProxy::AddSpecialAssayInfo(::tf::ResultLong& _return, const ::ise::tf::SpecialAssayInfo& sai)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -209,6 +215,7 @@ void ise::LogicControlProxy::AddSpecialAssayInfo(::tf::ResultLong& _return, cons
 ///
 bool ise::LogicControlProxy::DeleteSpecialAssayInfo(const ::ise::tf::SpecialAssayInfoQueryCond& saiq)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -228,6 +235,7 @@ bool ise::LogicControlProxy::DeleteSpecialAssayInfo(const ::ise::tf::SpecialAssa
 ///
 bool ise::LogicControlProxy::ModifySpecialAssayInfo(const ::ise::tf::SpecialAssayInfo& sai)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -246,6 +254,7 @@ bool ise::LogicControlProxy::ModifySpecialAssayInfo(const ::ise::tf::SpecialAssa
 ///
 bool ise::LogicControlProxy::QuerySpecialAssayInfo(::ise::tf::SpecialAssayInfoQueryResp& _return, const ::ise::tf::SpecialAssayInfoQueryCond& saiq)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -272,6 +281,7 @@ bool ise::LogicControlProxy::QuerySpecialAssayInfo(::ise::tf::SpecialAssayInfoQu
 ///
 bool ise::LogicControlProxy::EncodeIseAssayInfo(std::string& strAssayCode, const ::ise::tf::IseAssayInfoList& iaiList)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -294,6 +304,7 @@ bool ise::LogicControlProxy::EncodeIseAssayInfo(std::string& strAssayCode, const
 ///
 bool ise::LogicControlProxy::DecodeIseAssayInfo(const std::string& strAssayCode, ::ise::tf::IseAssayInfoList& iaiList)
 {
+	PROXY_CALL_RESP(iaiList);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -313,6 +324,7 @@ bool ise::LogicControlProxy::DecodeIseAssayInfo(const std::string& strAssayCode,
 ///
 void ise::LogicControlProxy::AddSupplyAttribute(::tf::ResultLong& _return, const ::ise::tf::SupplyAttribute& sa)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -331,6 +343,7 @@ void ise::LogicControlProxy::AddSupplyAttribute(::tf::ResultLong& _return, const
 ///
 bool ise::LogicControlProxy::DeleteSupplyAttribute(const ::ise::tf::SupplyAttributeQueryCond& saq)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -349,6 +362,7 @@ bool ise::LogicControlProxy::DeleteSupplyAttribute(const ::ise::tf::SupplyAttrib
 ///
 bool ise::LogicControlProxy::ModifySupplyAttribute(const ::ise::tf::SupplyAttribute& sa)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -366,6 +380,7 @@ bool ise::LogicControlProxy::ModifySupplyAttribute(const ::ise::tf::SupplyAttrib
 ///
 bool ise::LogicControlProxy::QuerySupplyAttribute(::ise::tf::SupplyAttributeQueryResp& _return, const ::ise::tf::SupplyAttributeQueryCond& saq)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -391,6 +406,7 @@ bool ise::LogicControlProxy::QuerySupplyAttribute(::ise::tf::SupplyAttributeQuer
 ///
 void ise::LogicControlProxy::AddIseModuleInfo(::tf::ResultLong & _return, const::ise::tf::IseModuleInfo & imi)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -409,6 +425,7 @@ void ise::LogicControlProxy::AddIseModuleInfo(::tf::ResultLong & _return, const:
 ///
 bool ise::LogicControlProxy::DeleteIseModuleInfo(const::ise::tf::IseModuleInfoQueryCond & imiq)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -427,6 +444,7 @@ bool ise::LogicControlProxy::DeleteIseModuleInfo(const::ise::tf::IseModuleInfoQu
 ///
 bool ise::LogicControlProxy::ModifyIseModuleInfo(const::ise::tf::IseModuleInfo & imi)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
@@ -446,6 +464,7 @@ bool ise::LogicControlProxy::ModifyIseModuleInfo(const::ise::tf::IseModuleInfo &
 ///
 void ise::LogicControlProxy::QueryIseModuleInfo(::ise::tf::IseModuleInfoQueryResp & _return, const::ise::tf::IseModuleInfoQueryCond & imiq)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::LogicControlHandler logicControl;
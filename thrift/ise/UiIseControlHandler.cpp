@@ -48,6 +48,7 @@
 #include "src/common/Mlog/mlog.h"
 #include "shared/messagebus.h"
 #include "shared/msgiddef.h"
+#include "thrift/UiNotifyQueue.h"
 
 
 ///
@@ -62,11 +63,11 @@ void ise::UiIseControlHandler::NotifyIseCaliAppUpdate(const std::vector< ::ise::
 {
     ULOG(LOG_INFO, "%s", __FUNCTION__);
     // 发送更新信息到UI消息总线
-    POST_MESSAGE(MSG_ID_ISE_CALI_APP_UPDATE, imis);
+    QUEUE_NOTIFY(MSG_ID_ISE_CALI_APP_UPDATE, imis);
 }
 
 void ise::UiIseControlHandler::NotifySupplyInfoUpdate(const std::vector<::ise::tf::SupplyUpdate> & supplyUpdates)
 {
 	ULOG(LOG_INFO, "%s", __FUNCTION__);
-	POST_MESSAGE(MSG_ID_ISE_INFO_UPDATE, supplyUpdates);
+	QUEUE_NOTIFY(MSG_ID_ISE_INFO_UPDATE, supplyUpdates);
 }
@@ -45,6 +45,7 @@
 ///////////////////////////////////////////////////////////////////////////
 #include "Ise1005LogicControlProxy.h"
 #include "src/common/Mlog/mlog.h"
+#include "thrift/ProxyCallMetrics.h"
 #include "src/common/defs.h"
 #include "src/dcs/interface/ise/ise1005/Ise1005LogicControlHandler.h"
 #include "src/thrift/ise/ise1005/gen-cpp/ise1005_logic_control_constants.h"
@@ -109,6 +110,7 @@ std::shared_ptr<ise::ise1005::tf::Ise1005LogicControlClient> ise::ise1005::Logic
 ///
 bool ise::ise1005::LogicControlProxy::ModifyAssayTestResult(const  ::ise::tf::AssayTestResult& tr)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::ise1005::LogicControlHandler logicControl;
@@ -130,6 +132,7 @@ bool ise::ise1005::LogicControlProxy::ModifyAssayTestResult(const  ::ise::tf::As
 bool ise::ise1005::LogicControlProxy::QueryAssayTestResult(ise::tf::AssayTestResultQueryResp& qryResp
 	, ise::tf::AssayTestResultQueryCond& qryCond)
 {
+    PROXY_CALL_RESP(qryResp);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::ise1005::LogicControlHandler logicControl;
@@ -154,6 +157,7 @@ bool ise::ise1005::LogicControlProxy::QueryAssayTestResult(ise::tf::AssayTestRes
 void ise::ise1005::LogicControlProxy::QuerySuppliesInfo(::ise::tf::SuppliesInfoQueryResp& _return
 	, const ::ise::tf::SuppliesInfoQueryCond& siqc)
 {
+	PROXY_CALL_RESP(_return);
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::ise1005::LogicControlHandler logicControl;
@@ -173,6 +177,7 @@ void ise::ise1005::LogicControlProxy::QuerySuppliesInfo(::ise::tf::SuppliesInfoQ
 ::ise::tf::ManualRegisterResult::type ise::ise1005::LogicControlProxy::ManualRegisterSupplies(
 	const ::ise::tf::SuppliesInfo& si)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::ise1005::LogicControlHandler logicControl;
@@ -191,6 +196,7 @@ void ise::ise1005::LogicControlProxy::QuerySuppliesInfo(::ise::tf::SuppliesInfoQ
 ///
 bool ise::ise1005::LogicControlProxy::AskForLoadSupply(const std::string& deviceSN)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::ise1005::LogicControlHandler logicControl;
@@ -212,6 +218,7 @@ bool ise::ise1005::LogicControlProxy::AskForLoadSupply(const std::string& device
 bool ise::ise1005::LogicControlProxy::LoadSupply(const ::ise::tf::SupplyPosInfo& supplyPos
 	, const int32_t fillPipeTime, const bool switchRunAfterMaintain)
 {
+	PROXY_CALL();
 	ULOG(LOG_INFO, "%s()", __FUNCTION__);
 	
 	ise::ise1005::LogicControlHandler logicControl;
@@ -231,6 +238,7 @@ bool ise::ise1005::LogicControlProxy::LoadSupply(const ::ise::tf::SupplyPosInfo&
 ///
 void ise::ise1005::LogicControlProxy::AddIseCaliCurve(::tf::ResultLong & _return, const::ise::tf::CaliCurve & cc)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::ise1005::LogicControlHandler logicControl;
@@ -249,6 +257,7 @@ void ise::ise1005::LogicControlProxy::AddIseCaliCurve(::tf::ResultLong & _return
 ///
 bool ise::ise1005::LogicControlProxy::DeleteIseCaliCurve(const::ise::tf::IseCaliCurveQueryCond & iccq)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::ise1005::LogicControlHandler logicControl;
@@ -267,6 +276,7 @@ bool ise::ise1005::LogicControlProxy::DeleteIseCaliCurve(const::ise::tf::IseCali
 ///
 bool ise::ise1005::LogicControlProxy::ModifyIseCaliCurve(const::ise::tf::CaliCurve & cc)
 {
+    PROXY_CALL();
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::ise1005::LogicControlHandler logicControl;
@@ -287,6 +297,7 @@ bool ise::ise1005::LogicControlProxy::ModifyIseCaliCurve(const::ise::tf::CaliCur
 void ise::ise1005::LogicControlProxy::QueryIseCaliCurve(::ise::tf::IseCaliCurveQueryResp & _return
 	, const::ise::tf::IseCaliCurveQueryCond & iccq)
 {
+    PROXY_CALL_RESP(_return);
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
 	ise::ise1005::LogicControlHandler logicControl;
@@ -0,0 +1,221 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     FaultLogQueryJob.cpp
+/// @brief    告警日志的后台查询任务（按id键集分页流式返回，支持取消）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#include "FaultLogQueryJob.h"
+#include <thread>
+#include <algorithm>
+#include <chrono>
+#include <QtConcurrent/QtConcurrent>
+#include "thrift/DcsControlProxy.h"
+#include "src/common/Mlog/mlog.h"
+
+#define FAULT_LOG_PAGE_SIZE                 (500)                   // 每页查询的条数
+#define FAULT_LOG_MAX_PENDING_PAGES         (4)                     // 界面未处理的最大页数
+#define FAULT_LOG_WAIT_INTERVAL             (10)                    // 等待界面处理的间隔（毫秒）
+
+FaultLogQueryJob::FaultLogQueryJob(QObject* parent)
+    : QObject(parent)
+    , m_jobId(0)
+    , m_running(0)
+    , m_pendingPages(0)
+{
+    qRegisterMetaType<std::vector<::tf::AlarmDesc>>("std::vector<::tf::AlarmDesc>");
+    m_pool.setMaxThreadCount(1);
+}
+
+FaultLogQueryJob::~FaultLogQueryJob()
+{
+    Cancel();
+    m_pool.waitForDone();
+}
+
+///
+/// @brief 开始查询（取消正在进行的查询）
+///
+/// @param[in]  cond  查询条件
+///
+/// @return 本次查询的编号
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+int FaultLogQueryJob::Start(const FaultLogQueryCond& cond)
+{
+    int jobId = ++m_jobId;
+    m_pendingPages = 0;
+    ++m_running;
+    QtConcurrent::run(&m_pool, [this, jobId, cond]()
+    {
+        Run(jobId, cond);
+        --m_running;
+    });
+
+    return jobId;
+}
+
+///
+/// @brief 取消当前查询（正在执行的分页查询完成后停止）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void FaultLogQueryJob::Cancel()
+{
+    ++m_jobId;
+}
+
+///
+/// @brief 界面已处理完一页结果（用于限制未处理的页数）
+///
+/// @param[in]  jobId  查询编号
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void FaultLogQueryJob::PageConsumed(int jobId)
+{
+    if (!IsCanceled(jobId) && m_pendingPages > 0)
+    {
+        --m_pendingPages;
+    }
+}
+
+///
+/// @brief 执行查询（工作线程）
+///
+/// @param[in]  jobId  查询编号
+/// @param[in]  cond   查询条件
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void FaultLogQueryJob::Run(int jobId, const FaultLogQueryCond& cond)
+{
+    ULOG(LOG_INFO, "%s(jobId:%d)", __FUNCTION__, jobId);
+
+    int total = 0;
+    try
+    {
+        ::tf::AlarmInfoQueryCond qryCond(cond.cond);
+
+        // id降序，键集分页
+        ::tf::OrderByCond orderCnd;
+        orderCnd.__set_asc(false);
+        orderCnd.__set_fieldName("id");
+        qryCond.orderByConds.clear();
+        qryCond.orderByConds.push_back(orderCnd);
+        qryCond.__isset.orderByConds = true;
+
+        ::tf::LimitCond lc;
+        lc.__set_offset(0);
+        lc.__set_count(FAULT_LOG_PAGE_SIZE);
+        qryCond.__set_limit(lc);
+
+        const auto& dcp = DcsControlProxy::GetInstance();
+        while (!IsCanceled(jobId))
+        {
+            ::tf::AlarmInfoQueryResp qryResp;
+            if (!dcp->QueryAlarmInfo(qryResp, qryCond) || qryResp.result != ::tf::ThriftResult::THRIFT_RESULT_SUCCESS)
+            {
+                ULOG(LOG_ERROR, "QueryAlarmInfo() failed");
+                break;
+            }
+
+            if (qryResp.lstAlarmDescs.empty())
+            {
+                break;
+            }
+
+            // 下一页从本页最小id之前开始
+            bool isLastPage = (qryResp.lstAlarmDescs.size() < FAULT_LOG_PAGE_SIZE);
+            ::tf::IdRangeCond idRangeCond;
+            idRangeCond.startId = 0;
+            idRangeCond.endId = qryResp.lstAlarmDescs.back().id - 1;
+            qryCond.__set_idRangeCond(idRangeCond);
+
+            // 关键字过滤
+            if (!cond.keyword.isEmpty())
+            {
+                auto iter = std::remove_if(qryResp.lstAlarmDescs.begin(), qryResp.lstAlarmDescs.end(), [&cond](const ::tf::AlarmDesc& desc)
+                {
+                    return !QString::fromStdString(desc.alarmName).contains(cond.keyword, Qt::CaseInsensitive)
+                        && !QString::fromStdString(desc.alarmDetail).contains(cond.keyword, Qt::CaseInsensitive);
+                });
+                qryResp.lstAlarmDescs.erase(iter, qryResp.lstAlarmDescs.end());
+            }
+
+            if (!qryResp.lstAlarmDescs.empty())
+            {
+                // 界面处理不过来时等待
+                while (m_pendingPages >= FAULT_LOG_MAX_PENDING_PAGES && !IsCanceled(jobId))
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(FAULT_LOG_WAIT_INTERVAL));
+                }
+
+                if (IsCanceled(jobId))
+                {
+                    break;
+                }
+
+                total += qryResp.lstAlarmDescs.size();
+                ++m_pendingPages;
+                emit pageReady(jobId, std::move(qryResp.lstAlarmDescs));
+            }
+
+            if (isLastPage || idRangeCond.endId <= 0)
+            {
+                break;
+            }
+        }
+    }
+    catch (...)
+    {
+        ULOG(LOG_ERROR, "%s() exception", __FUNCTION__);
+    }
+
+    bool canceled = IsCanceled(jobId);
+    ULOG(LOG_INFO, "%s(jobId:%d) finished, total:%d, canceled:%d", __FUNCTION__, jobId, total, canceled);
+    emit finished(jobId, canceled, total);
+}
@@ -0,0 +1,156 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     FaultLogQueryJob.h
+/// @brief    告警日志的后台查询任务（按id键集分页流式返回，支持取消）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <atomic>
+#include <vector>
+#include <QObject>
+#include <QString>
+#include <QThreadPool>
+#include "src/thrift/gen-cpp/defs_types.h"
+
+///
+/// @brief 告警日志查询条件（在界面线程中生成）
+///
+struct FaultLogQueryCond
+{
+    ::tf::AlarmInfoQueryCond        cond;           ///< 数据库查询条件
+    QString                         keyword;        ///< 报警名称/详情关键字（为空不过滤）
+};
+
+///
+/// @brief 告警日志的后台查询任务
+///     按id降序做键集分页（每页以上一页最小id为上界），不再依赖总数和偏移量，
+///     每页结果通过信号送回界面线程；开始新的查询时自动取消之前的查询
+///
+class FaultLogQueryJob : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit FaultLogQueryJob(QObject* parent = Q_NULLPTR);
+    ~FaultLogQueryJob();
+
+    ///
+    /// @brief 开始查询（取消正在进行的查询）
+    ///
+    /// @param[in]  cond  查询条件
+    ///
+    /// @return 本次查询的编号
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    int Start(const FaultLogQueryCond& cond);
+
+    ///
+    /// @brief 取消当前查询（正在执行的分页查询完成后停止）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Cancel();
+
+    ///
+    /// @brief 是否有查询正在执行
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool IsRunning() const { return m_running > 0; }
+
+    ///
+    /// @brief 界面已处理完一页结果（用于限制未处理的页数）
+    ///
+    /// @param[in]  jobId  查询编号
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void PageConsumed(int jobId);
+
+signals:
+    ///
+    /// @brief 一页结果查询完成
+    ///
+    /// @param[in]  jobId  查询编号
+    /// @param[in]  descs  告警日志（按id降序）
+    ///
+    void pageReady(int jobId, std::vector<::tf::AlarmDesc> descs);
+
+    ///
+    /// @brief 查询结束
+    ///
+    /// @param[in]  jobId     查询编号
+    /// @param[in]  canceled  是否被取消
+    /// @param[in]  total     返回的告警日志条数
+    ///
+    void finished(int jobId, bool canceled, int total);
+
+private:
+    ///
+    /// @brief 执行查询（工作线程）
+    ///
+    /// @param[in]  jobId  查询编号
+    /// @param[in]  cond   查询条件
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Run(int jobId, const FaultLogQueryCond& cond);
+
+    ///
+    /// @brief 查询是否已被取消（有新的查询或手动取消）
+    ///
+    bool IsCanceled(int jobId) const { return jobId != m_jobId; }
+
+private:
+    QThreadPool                     m_pool;                 ///< 查询线程池（单线程，查询依次执行）
+    std::atomic<int>                m_jobId;                ///< 当前查询编号
+    std::atomic<int>                m_running;              ///< 正在执行的查询数
+    std::atomic<int>                m_pendingPages;         ///< 界面未处理的页数
+};
+
+Q_DECLARE_METATYPE(std::vector<::tf::AlarmDesc>)
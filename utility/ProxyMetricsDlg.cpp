@@ -0,0 +1,200 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     ProxyMetricsDlg.cpp
+/// @brief    代理调用统计诊断弹窗
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+
+#include "ProxyMetricsDlg.h"
+#include "ui_ProxyMetricsDlg.h"
+
+#include <cmath>
+#include <QHeaderView>
+#include <QStandardItemModel>
+#include "thrift/ProxyCallMetrics.h"
+
+#include "src/common/Mlog/mlog.h"
+
+// 表格中各列的信息
+enum TABLE_VIEW_COLUMN
+{
+    METHOD_COLUMN,                  // 方法名
+    CALLS_COLUMN,                   // 调用次数
+    GUI_CALLS_COLUMN,               // 界面线程调用次数
+    SAMPLES_COLUMN,                 // 样本次数
+    TOTAL_COLUMN,                   // 总耗时
+    MEAN_COLUMN,                    // 平均耗时
+    P50_COLUMN,                     // P50耗时
+    P90_COLUMN,                     // P90耗时
+    P99_COLUMN,                     // P99耗时
+    MAX_COLUMN,                     // 最大耗时
+    MEAN_ELEMENTS_COLUMN,           // 平均应答元素个数
+    MAX_ELEMENTS_COLUMN,            // 最大应答元素个数
+    MEAN_BYTES_COLUMN,              // 平均应答字节数
+    MAX_BYTES_COLUMN                // 最大应答字节数
+};
+
+namespace
+{
+    // 生成按数值排序的单元格
+    QStandardItem* NumberItem(double value, int decimals)
+    {
+        double factor = std::pow(10.0, decimals);
+        QStandardItem* item = new QStandardItem();
+        item->setData(std::round(value * factor) / factor, Qt::DisplayRole);
+        item->setTextAlignment(Qt::AlignCenter);
+        return item;
+    }
+}
+
+ProxyMetricsDlg::ProxyMetricsDlg(QWidget *parent)
+    : BaseDlg(parent)
+    , ui(new Ui::ProxyMetricsDlg)
+    , m_tabViewMode(new QStandardItemModel(this))
+{
+    ui->setupUi(this);
+
+    // 设置标题
+    BaseDlg::SetTitleName(tr("接口调用统计"));
+
+    InitCtrls();
+    OnRefresh();
+}
+
+ProxyMetricsDlg::~ProxyMetricsDlg()
+{
+    delete ui;
+}
+
+///
+/// @brief	初始化控件
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ProxyMetricsDlg::InitCtrls()
+{
+    ui->tableView->setModel(m_tabViewMode);
+
+    QStringList headers;
+    headers << tr("方法") << tr("调用次数") << tr("界面线程") << tr("样本数") << tr("总耗时(ms)")
+        << tr("平均(ms)") << tr("P50(ms)") << tr("P90(ms)") << tr("P99(ms)") << tr("最大(ms)")
+        << tr("平均元素") << tr("最大元素") << tr("平均字节") << tr("最大字节");
+    m_tabViewMode->setHorizontalHeaderLabels(headers);
+    ui->tableView->setColumnWidth(METHOD_COLUMN, 320);
+
+    // 默认按总耗时从大到小
+    ui->tableView->horizontalHeader()->setSortIndicator(TOTAL_COLUMN, Qt::DescendingOrder);
+
+    // 统计模式
+    ui->mode_combo->addItem(tr("关闭"), ProxyCallMetrics::MODE_OFF);
+    ui->mode_combo->addItem(tr("采样"), ProxyCallMetrics::MODE_SAMPLED);
+    ui->mode_combo->addItem(tr("全部"), ProxyCallMetrics::MODE_FULL);
+    ui->mode_combo->setCurrentIndex(ui->mode_combo->findData(ProxyCallMetrics::GetInstance().GetMode()));
+
+    connect(ui->mode_combo, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this, &ProxyMetricsDlg::OnModeChanged);
+    connect(ui->refresh_btn, &QPushButton::clicked, this, &ProxyMetricsDlg::OnRefresh);
+    connect(ui->reset_btn, &QPushButton::clicked, this, &ProxyMetricsDlg::OnReset);
+}
+
+///
+/// @brief	刷新统计
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ProxyMetricsDlg::OnRefresh()
+{
+    // 保持当前的排序列
+    int sortColumn = ui->tableView->horizontalHeader()->sortIndicatorSection();
+    Qt::SortOrder sortOrder = ui->tableView->horizontalHeader()->sortIndicatorOrder();
+    m_tabViewMode->removeRows(0, m_tabViewMode->rowCount());
+
+    for (const auto& summary : ProxyCallMetrics::GetInstance().Snapshot())
+    {
+        QList<QStandardItem*> row;
+        row << new QStandardItem(QString::fromStdString(summary.name))
+            << NumberItem(summary.calls, 0)
+            << NumberItem(summary.guiCalls, 0)
+            << NumberItem(summary.samples, 0)
+            << NumberItem(summary.totalMs, 1)
+            << NumberItem(summary.meanMs, 2)
+            << NumberItem(summary.p50Ms, 2)
+            << NumberItem(summary.p90Ms, 2)
+            << NumberItem(summary.p99Ms, 2)
+            << NumberItem(summary.maxMs, 2)
+            << NumberItem(summary.meanElements, 1)
+            << NumberItem(summary.maxElements, 0)
+            << NumberItem(summary.meanBytes, 0)
+            << NumberItem(summary.maxBytes, 0);
+        m_tabViewMode->appendRow(row);
+    }
+
+    ui->tableView->sortByColumn(sortColumn, sortOrder);
+}
+
+///
+/// @brief	清空统计
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ProxyMetricsDlg::OnReset()
+{
+    ULOG(LOG_INFO, "%s()", __FUNCTION__);
+    ProxyCallMetrics::GetInstance().Reset();
+    OnRefresh();
+}
+
+///
+/// @brief	统计模式改变
+///
+/// @param[in]  index  模式下拉框索引
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ProxyMetricsDlg::OnModeChanged(int index)
+{
+    ULOG(LOG_INFO, "%s(%d)", __FUNCTION__, index);
+    ProxyCallMetrics::GetInstance().SetMode(ProxyCallMetrics::MODE(ui->mode_combo->itemData(index).toInt()));
+}
@@ -0,0 +1,105 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     ProxyMetricsDlg.h
+/// @brief    代理调用统计诊断弹窗
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "shared/basedlg.h"
+
+class QStandardItemModel;
+
+namespace Ui {
+    class ProxyMetricsDlg;
+};
+
+///
+/// @brief 代理调用统计诊断弹窗（工程师权限，查看各代理方法的调用次数、耗时和应答数据量）
+///
+class ProxyMetricsDlg : public BaseDlg
+{
+    Q_OBJECT
+
+public:
+    ProxyMetricsDlg(QWidget *parent = Q_NULLPTR);
+    ~ProxyMetricsDlg();
+
+private:
+    ///
+    /// @brief	初始化控件
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void InitCtrls();
+
+protected Q_SLOTS:
+    ///
+    /// @brief	刷新统计
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnRefresh();
+
+    ///
+    /// @brief	清空统计
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnReset();
+
+    ///
+    /// @brief	统计模式改变
+    ///
+    /// @param[in]  index  模式下拉框索引
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnModeChanged(int index);
+
+private:
+    Ui::ProxyMetricsDlg*                        ui;
+    QStandardItemModel*                         m_tabViewMode;          // 表格的model
+};
@@ -49,6 +49,7 @@
 #include "shared/CommonInformationManager.h"
 #include "shared/tipdlg.h"
 #include "shared/uicommon.h"
+#include "shared/StatisticsRollupStore.h"
 #include "thrift/DcsControlProxy.h"
 #include "src/common/Mlog/mlog.h"
 #include <QStandardItemModel>
@@ -297,7 +298,6 @@ void QCalibrationStatistics::OnQueryBtnClicked()
 	ui->tableView_statistics->setColumnHidden(CALI_SUCCEED_RATIO, true);
 	
 	::tf::StatisCaliTabQueryCond queryCond;
-	::tf::StatisCaliTabQueryResp ret;
 	queryCond.__set_startTime(strStartTime);
 	queryCond.__set_endTime(strSendTime);
 	queryCond.__set_vecDeviceSN(vecDeviceSN);
@@ -307,17 +307,18 @@ void QCalibrationStatistics::OnQueryBtnClicked()
 		queryCond.__set_vecReagentLot(vecReagentLot);
 	}
 	
-	if (!DcsControlProxy::GetInstance()->QueryStatisCaliTab(ret, queryCond))
+	// 通过汇总缓存查询，已结束的日期不再重复统计
+	std::vector<::tf::StatisCaliTab> vecData;
+	if (!StatisticsRollupStore::GetInstance().QueryStatisCaliTab(vecData, queryCond,
+		ui->lower_date_edit->date(), ui->upper_date_edit->date()))
 	{
-		ULOG(LOG_ERROR, "QueryStatisCaliTab Failed");
 		return;
 	}
-	if (ret.lstStatisCaliTab.empty())
+	if (vecData.empty())
 	{
 		ULOG(LOG_ERROR, "lstStatisCaliTab is null");
 		return;
 	}
-	auto &vecData = ret.lstStatisCaliTab;
 
 	for (int i = 0; i < vecData.size(); ++i)
 	{
@@ -47,7 +47,7 @@
 #include "QFaultLogWidget.h"
 #include "SortHeaderView.h"
 #include "ui_QFaultLogWidget.h"
-#include <QTimer>
+#include <QRegularExpression>
 #include "shared/messagebus.h"
 #include "shared/msgiddef.h"
 #include "shared/tipdlg.h"
@@ -63,22 +63,15 @@
 #include "src/common/TimeUtil.h"
 #include "src/common/Mlog/mlog.h"
 
-#define QUERY_ID_RANG										(1000)					  // 分页查询id范围
-#define QUERY_BUFF_SIZE										(1000)					  // 异步查询缓存大小（数据条数）
-#define GET_BUFF_INTERVAL									(10)					  // 获取缓存的时间间隔（毫秒）
-
-
 QFaultLogWidget::QFaultLogWidget(QWidget *parent)
 	: QWidget(parent),
     m_isManager(false),
-	m_pGetBufferTimer(new QTimer(this)),
+	m_pQueryJob(new FaultLogQueryJob(this)),
+	m_curJobId(-1),
 	ui(new Ui::QFaultLogWidget)
 {
 	ui->setupUi(this);
 
-	// 设置读取缓存间隔
-	m_pGetBufferTimer->setInterval(GET_BUFF_INTERVAL);
-
 	Init();
 }
 
@@ -92,10 +85,7 @@ void QFaultLogWidget::ResetWidget()
     ULOG(LOG_INFO, "%s()", __FUNCTION__);
 
     // 停止查询线程
-    if (m_pGetBufferTimer->isActive())
-    {
-        m_ambNeedStop = true;
-    }
+    StopQueryAlarmLog();
 
     // 清空表格
     FaultLogTableModel::Instance().RemoveAllRows();
@@ -217,8 +207,8 @@ void QFaultLogWidget::Init()
 	// 连接信号槽
 	connect(ui->query_btn, &QPushButton::clicked, this, &QFaultLogWidget::OnFaultLogQueryBtn);
     connect(ui->reset_btn, &QPushButton::clicked, this, &QFaultLogWidget::ResetWidget);
-	connect(this, SIGNAL(QueryFinished()), this, SLOT(OnQueryFinished()));
-	connect(m_pGetBufferTimer, SIGNAL(timeout()), this, SLOT(GetBuffer()));	
+	connect(m_pQueryJob, &FaultLogQueryJob::pageReady, this, &QFaultLogWidget::OnQueryPage);
+	connect(m_pQueryJob, &FaultLogQueryJob::finished, this, &QFaultLogWidget::OnQueryFinished);
     connect(ui->tableView->selectionModel(), &QItemSelectionModel::currentChanged, this, &QFaultLogWidget::OnCurrentRowChanged);
     connect(ui->expand_btn, &QPushButton::clicked, this, [&]
     {
@@ -231,7 +221,7 @@ void QFaultLogWidget::Init()
 			status ? ui->tableView->columnWidth(FaultLogTableModel::FAULT_LOG_LIST_COL::NAME) - iWidth : ui->tableView->columnWidth(FaultLogTableModel::FAULT_LOG_LIST_COL::NAME) + iWidth);
     });
 
-	// 绑定起止日期编辑框(间隔时间不超过2个月)
+	// 绑定起止日期编辑框(默认间隔2个月，查询不限制跨度)
 	BindDateEdit(ui->lower_date_edit, ui->upper_date_edit, 2);
 
     // 注册当前用户权限更新处理函数
@@ -286,19 +276,24 @@ FaultLogTableModel::StFaultLogItem QFaultLogWidget::AlarmDescDecode(::tf::AlarmD
 	return item;
 }
 
+void QFaultLogWidget::StopQueryAlarmLog()
+{
+    if (m_curJobId < 0)
+    {
+        return;
+    }
+
+    m_pQueryJob->Cancel();
+    m_curJobId = -1;
+    ui->query_btn->setEnabled(true);
+}
+
 void QFaultLogWidget::OnFaultLogQueryBtn()
 {
     //清空详情
     ui->detail_label->clear();
     ui->solution_label->clear();
 
-	if (!ui->alarm_code_edit->text().isEmpty()
-		&& ui->alarm_code_edit->text().split("-").size() != 3)
-	{
-		TipDlg(tr("报警代码格式错误")).exec();
-		return;
-	}
-
 	QDateTime startTime(ui->lower_date_edit->date(), QTime(0,0,0));
 	QDateTime endTime(ui->upper_date_edit->date(), QTime(0,0,0));
 
@@ -308,219 +303,88 @@ void QFaultLogWidget::OnFaultLogQueryBtn()
 		return;
 	}
 
-	if (startTime.addMonths(2) < endTime)
-	{
-		TipDlg(tr("日志查找最大时间跨度不得超过两个月")).exec();
-		return;
-	}
-
-    if (startTime > endTime)
-    {
-        TipDlg(tr("报警的开始时间不能小于结束时间")).exec();
-        return;
-    }
-
-    FaultLogTableModel::Instance().RemoveAllRows();
-    update();
-
-	ui->query_btn->setEnabled(false);
-    m_vecAlarmDescs.clear();
-
-    // 设置线程停止标志
-    m_ambNeedStop = false;
-
-	// 启动查询线程
-	m_pQryTrd = std::make_shared<std::thread>(std::bind(&QFaultLogWidget::FaultLogQuery, this));
-	m_pQryTrd->detach();
-	
-	// 启动读取缓存定时器
-	m_pGetBufferTimer->start();
-}
-
-void QFaultLogWidget::FaultLogQuery()
-{
-	ULOG(LOG_INFO, "%s()", __FUNCTION__);
+	// 查询条件在界面线程中生成，查询线程不再访问控件
+	FaultLogQueryCond cond;
 
-	try
-	{
-		::tf::AlarmInfoQueryCond qryCond;
-		::tf::AlarmInfoQueryResp qryResp;
-
-        // 时间
-        ::tf::TimeRangeCond temp;
-        temp.startTime = ui->lower_date_edit->date().toString("yyyy-MM-dd").toStdString() + " 00:00:00";
-        temp.endTime = ui->upper_date_edit->date().toString("yyyy-MM-dd").toStdString() + " 23:59:59";
-        qryCond.__set_alarmTime(temp);
-
-        // 报警码
-        QStringList tempList = ui->alarm_code_edit->text().split("-");
-        if (tempList.size() == 3)
-        {
-            qryCond.__set_mainCode(tempList[0].toInt());
-            qryCond.__set_middleCode(tempList[1].toInt());
-            qryCond.__set_subCode(tempList[2].toInt());
-        }
+    // 时间
+    ::tf::TimeRangeCond temp;
+    temp.startTime = ui->lower_date_edit->date().toString("yyyy-MM-dd").toStdString() + " 00:00:00";
+    temp.endTime = ui->upper_date_edit->date().toString("yyyy-MM-dd").toStdString() + " 23:59:59";
+    cond.cond.__set_alarmTime(temp);
 
-        // 报警级别
-        if (ui->level_combox->currentIndex() > 0)
+    // 报警码（支持只输入主码或主码-中码），其他内容按报警名称/详情关键字查询
+    QString codeText = ui->alarm_code_edit->text().trimmed();
+    if (QRegularExpression("^\\d+(-\\d+){0,2}$").match(codeText).hasMatch())
+    {
+        QStringList tempList = codeText.split("-");
+        cond.cond.__set_mainCode(tempList[0].toInt());
+        if (tempList.size() > 1)
         {
-            qryCond.__set_alarmLevel((tf::AlarmLevel::type)ui->level_combox->currentIndex());
+            cond.cond.__set_middleCode(tempList[1].toInt());
         }
 
-        // 模块
-        if (ui->model_cobox->currentIndex() != 0)
+        if (tempList.size() > 2)
         {
-            qryCond.__set_devSn(ui->model_cobox->currentData().toString().toStdString());
+            cond.cond.__set_subCode(tempList[2].toInt());
         }
+    }
+    else
+    {
+        cond.keyword = codeText;
+    }
 
-        const auto& dcp = DcsControlProxy::GetInstance();
-
-        // 获取数据库的最大主键
-        int64_t maxDbId = 0;
-        {
-            ::tf::AlarmInfoQueryCond qc(qryCond);
-            ::tf::AlarmInfoQueryResp qr;
-
-            // id降序
-            ::tf::OrderByCond orderCnd;
-            orderCnd.__set_asc(false);
-            orderCnd.__set_fieldName("id");
-            qc.orderByConds.push_back(orderCnd);
-
-            // 只查一条
-            ::tf::LimitCond lc;
-            lc.__set_offset(0);
-            lc.__set_count(1);
-            qc.__set_limit(std::move(lc));
-
-            // 执行查询条件
-            if (!dcp->QueryAlarmInfo(qryResp, qc) 
-                || qryResp.result != ::tf::ThriftResult::THRIFT_RESULT_SUCCESS
-                || qryResp.lstAlarmDescs.empty())
-            {
-                // 查询失败
-                ULOG(LOG_ERROR, "Query AlarmInfo Max Id Failed");
-
-                // 发送异步查询完成信号
-                emit QueryFinished();
-
-                return;
-            }
+    // 报警级别
+    if (ui->level_combox->currentIndex() > 0)
+    {
+        cond.cond.__set_alarmLevel((tf::AlarmLevel::type)ui->level_combox->currentIndex());
+    }
 
-            maxDbId = qryResp.lstAlarmDescs[0].id;
-        }
+    // 模块
+    if (ui->model_cobox->currentIndex() != 0)
+    {
+        cond.cond.__set_devSn(ui->model_cobox->currentData().toString().toStdString());
+    }
 
-        int allResultCount = dcp->QueryAlarmInfoCount(qryCond);
-		FaultLogTableModel::Instance().ReserveDataSize(allResultCount);
-
-		// id范围,解决深度分页问题
-		int resultCount = 0;
-		tf::IdRangeCond idRangeCond;
-		idRangeCond.startId = maxDbId - QUERY_ID_RANG;
-		idRangeCond.endId = maxDbId;
-		qryCond.__set_idRangeCond(idRangeCond);
-
-		do
-		{
-			// 执行查询条件
-            qryResp.lstAlarmDescs.clear();
-            qryResp.result = ::tf::ThriftResult::THRIFT_RESULT_UNKNOWN_ERROR;
-			if (!dcp->QueryAlarmInfo(qryResp, qryCond) || qryResp.result != ::tf::ThriftResult::THRIFT_RESULT_SUCCESS)
-			{
-				// 查询失败
-				ULOG(LOG_ERROR, "FaultLogQuery QueryAlarmInfo() failed");
-				break;
-			}
-
-			// 统计结果数量
-			resultCount += qryResp.lstAlarmDescs.size();
-
-			// id范围
-            idRangeCond.endId = idRangeCond.startId - 1;
-			idRangeCond.startId = idRangeCond.endId - QUERY_ID_RANG;
-
-
-			qryCond.__set_idRangeCond(idRangeCond);
-
-			// 查询完成
-			if (qryResp.lstAlarmDescs.empty() && (resultCount >= allResultCount))
-			{
-				ULOG(LOG_INFO, "FaultLogQuery QueryAlarmInfo() Finished");
-				break;
-			}
-
-			// 往缓存里写数据
-			{
-				std::unique_lock<std::mutex> buffLock(s_mtxAlarmData);
-
-				// 如果缓存已满，则等待
-				if (m_vecAlarmDescs.size() >= QUERY_BUFF_SIZE)
-				{
-					m_condPutBuffer.wait(buffLock);
-				}
-
-				m_vecAlarmDescs.insert(m_vecAlarmDescs.end(), qryResp.lstAlarmDescs.begin(), qryResp.lstAlarmDescs.end());
-			}
-
-		} while (!m_ambNeedStop);
-	}
-	catch (...)
-	{
-		// 退出线程
-		ULOG(LOG_INFO, "FaultLogQuery exec this thread %s()", __FUNCTION__);
-	}
+    FaultLogTableModel::Instance().RemoveAllRows();
+    update();
 
-	// 发送异步查询完成信号
-	emit QueryFinished();
+	// 启动后台查询（自动取消之前的查询）
+	ui->query_btn->setEnabled(false);
+	m_curJobId = m_pQueryJob->Start(cond);
 }
 
-void QFaultLogWidget::OnQueryFinished()
+void QFaultLogWidget::OnQueryFinished(int jobId, bool canceled, int total)
 {
-	ULOG(LOG_INFO, "%s()", __FUNCTION__);
+	ULOG(LOG_INFO, "%s(jobId:%d, canceled:%d, total:%d)", __FUNCTION__, jobId, canceled, total);
 
-	// 最后一次获取缓存中数据
-	GetBuffer();
+    // 已取消的查询
+    if (jobId != m_curJobId)
+    {
+        return;
+    }
 
+	m_curJobId = -1;
 	ui->query_btn->setEnabled(true);
-
-    // 停止读取缓存定时器
-    m_pGetBufferTimer->stop();
-    m_ambNeedStop = false;
 }
 
-void QFaultLogWidget::GetBuffer()
+void QFaultLogWidget::OnQueryPage(int jobId, std::vector<::tf::AlarmDesc> descs)
 {
-	ULOG(LOG_INFO, "%s() ", __FUNCTION__);
-
-    // 如果是手动停止查询线程，则不处理结果
-    if (m_ambNeedStop)
+    // 已取消的查询，不处理结果
+    if (jobId != m_curJobId)
     {
-        m_vecAlarmDescs.clear();
-        ui->query_btn->setEnabled(true);
         return;
     }
 
-	// 从缓存里取数据
-	std::vector<::tf::AlarmDesc> vAlarmDescBuffer;
+	std::vector<FaultLogTableModel::StFaultLogItem> items;
+	items.reserve(descs.size());
+	for (const auto& data : descs)
 	{
-		std::unique_lock<std::mutex> buffLock(s_mtxAlarmData);
-		// 如果缓存已空，则返回
-		if (m_vecAlarmDescs.empty())
-		{
-			return;
-		}
-
-		vAlarmDescBuffer.swap(m_vecAlarmDescs);
+		items.push_back(AlarmDescDecode(data));
 	}
 
-	// 通知生产者往缓存中放数据
-	m_condPutBuffer.notify_one();
-
-	for (auto data : vAlarmDescBuffer)
-	{
-		// 加载告警日志到表格
-		FaultLogTableModel::Instance().AppendData(AlarmDescDecode(data));
-	}
+	// 加载告警日志到表格
+	FaultLogTableModel::Instance().AppendDatas(items);
+	m_pQueryJob->PageConsumed(jobId);
 }
 
 void QFaultLogWidget::OnCurrentRowChanged(const QModelIndex &current, const QModelIndex &previous)
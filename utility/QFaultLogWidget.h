@@ -45,14 +45,11 @@
 ///////////////////////////////////////////////////////////////////////////
 #pragma once
 
-#include <thread>
 #include <QWidget>
-#include <atomic>
-#include <condition_variable>
 #include "model/FaultLogTableModel.h"
+#include "FaultLogQueryJob.h"
 #include "src/thrift/gen-cpp/defs_types.h"
 
-class QTimer;
 class QUtilitySortFilterProxyModel;
 namespace Ui {
     class QFaultLogWidget;
@@ -80,7 +77,7 @@ public:
     /// @par History:
     /// @li 7951/LuoXin，2023年10月23日，新建函数
     ///
-    void StopQueryAlarmLog() { m_ambNeedStop = true; }
+    void StopQueryAlarmLog();
 
 private:
 	///
@@ -91,13 +88,6 @@ private:
 	///
 	void Init();
 
-	///
-	/// @brief	查询指定的告警日志
-	/// @par History:
-	/// @li 7951/LuoXin，2022年7月28日，新建函数
-	///
-	void FaultLogQuery();
-
 	///
 	/// @brief
 	///     报警描述信息解码
@@ -125,19 +115,29 @@ protected Q_SLOTS:
 
 	///
 	/// @brief	查询完成响应的槽函数
+	///
+	/// @param[in]  jobId     查询编号
+	/// @param[in]  canceled  是否被取消
+	/// @param[in]  total     返回的告警日志条数
+	///
 	/// @par History:
 	/// @li 7951/LuoXin，2022年7月28日，新建函数
+	/// @li 5774/WuHongTao，2026年10月19日，改为响应后台查询任务
 	///
-	void OnQueryFinished();
+	void OnQueryFinished(int jobId, bool canceled, int total);
 
 	///
 	/// @brief
-	///     获取异步查询缓存
+	///     加载一页查询结果到表格
+	///
+	/// @param[in]  jobId  查询编号
+	/// @param[in]  descs  告警日志
 	///
 	/// @par History:
 	/// @li 7951/LuoXin，2022年12月23日，新建函数
+	/// @li 5774/WuHongTao，2026年10月19日，改为按页接收后台查询结果
 	///
-	void GetBuffer();
+	void OnQueryPage(int jobId, std::vector<::tf::AlarmDesc> descs);
 
     ///
     /// @brief
@@ -157,25 +157,11 @@ protected Q_SLOTS:
     ///
     void OnPermisionChanged();
 
-Q_SIGNALS:
-	///
-	/// @brief
-	///     查询完成信号
-	///
-	/// @par History:
-	/// @li 7951/LuoXin，2022年7月28日，新建函数
-	///
-	void QueryFinished();
 private:
 	Ui::QFaultLogWidget							*ui;
 
-	// 线程同步对象
-	std::shared_ptr<std::thread>				 m_pQryTrd;					// 告警日志查询线程
-	std::mutex									 s_mtxAlarmData;			// 告警日志查询结果队列互斥锁
-	std::atomic_bool					         m_ambNeedStop;			    // 线程停止原子变量
-	std::condition_variable					     m_condPutBuffer;			// 写缓存条件变量
-	std::vector<::tf::AlarmDesc>				 m_vecAlarmDescs;			// 告警日志查询结果队列
-	QTimer*										 m_pGetBufferTimer;			// 告警日志查询结果队列
+	FaultLogQueryJob*							 m_pQueryJob;				// 告警日志后台查询任务
+	int											 m_curJobId;				// 当前查询编号（过滤已取消查询的结果）
     QUtilitySortFilterProxyModel*                m_sortModel;               // 表格排序的model
     bool                                         m_isManager;               // 当前登录的是否是工程师以上的权限
 };
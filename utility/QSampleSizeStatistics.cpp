@@ -50,6 +50,7 @@
 #include "shared/CommonInformationManager.h"
 #include "shared/tipdlg.h"
 #include "shared/uicommon.h"
+#include "shared/StatisticsRollupStore.h"
 #include "thrift/DcsControlProxy.h"
 #include "src/common/Mlog/mlog.h"
 
@@ -319,19 +320,16 @@ void QSampleSizeStatistics::QueryPieData()
 	{
 		queryCond.__set_vecReagentLot(vecReagentLot);
 	}
-	::tf::SampleStatisPieQueryResp ret;
-	if (!DcsControlProxy::GetInstance()->QuerySampleStatisPie(ret, queryCond))
-	{
-		ULOG(LOG_ERROR, "QuerySampleStatisPie Failed");
-		return;
-	}
-	if (ret.lstSampleStatisPieDatas.empty())
+	// 通过汇总缓存查询，已结束的日期不再重复统计
+	::tf::SampleStatisPieData pieData;
+	if (!StatisticsRollupStore::GetInstance().QuerySampleStatisPie(pieData, queryCond,
+		ui->lower_date_edit->date(), ui->upper_date_edit->date()))
 	{
 		ULOG(LOG_ERROR, "Pie Query Resp is null");
 		return;
 	}
 
-	m_pieData = std::make_shared<::tf::SampleStatisPieData>(std::move(ret.lstSampleStatisPieDatas.front()));
+	m_pieData = std::make_shared<::tf::SampleStatisPieData>(std::move(pieData));
 	QVector<double> vecPieData;
 	vecPieData.append(m_pieData->totalNormalSamples);
 	vecPieData.append(m_pieData->totalEmerSamples);
@@ -381,7 +379,6 @@ void QSampleSizeStatistics::OnQueryBtnClicked()
 	m_pTableModel->clear();
 	m_pTableModel->setHorizontalHeaderLabels(m_headerData);
 	::tf::SampleStatisTabDataQueryCond queryCond;
-	::tf::SampleStatisTabQueryResp ret;
 	queryCond.__set_startTime(strStartTime);
 	queryCond.__set_endTime(strSendTime);
 	queryCond.__set_vecDeviceSN(vecDeviceSN);
@@ -390,17 +387,18 @@ void QSampleSizeStatistics::OnQueryBtnClicked()
 		queryCond.__set_vecReagentLot(vecReagentLot);
 	}
 
-	if (!DcsControlProxy::GetInstance()->QuerySampleStatisTab(ret, queryCond))
+	// 通过汇总缓存查询，已结束的日期不再重复统计
+	std::vector<::tf::SampleStatisTabData> vecData;
+	if (!StatisticsRollupStore::GetInstance().QuerySampleStatisTab(vecData, queryCond,
+		ui->lower_date_edit->date(), ui->upper_date_edit->date()))
 	{
-		ULOG(LOG_ERROR, "QuerySampleStatisTab Failed");
 		return;
 	}
-	if (ret.lstSampleStatisTabDatas.empty())
+	if (vecData.empty())
 	{
 		ULOG(LOG_ERROR, "lstSampleStatisTabDatas is null");
 		return;
 	}
-	auto &vecData = ret.lstSampleStatisTabDatas;
 
 	for (int i = 0; i < vecData.size(); ++i)
 	{
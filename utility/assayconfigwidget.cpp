@@ -721,7 +721,8 @@ void AssayConfigWidget::OnSelectedAssayChanged(const QModelIndex &current, const
     {
         // 生化开放项目编号用完后禁用新增按钮，bug2777
         int count = ::tf::AssayCodeRange::CH_OPEN_RANGE_MAX - ::tf::AssayCodeRange::CH_OPEN_RANGE_MIN + 1;
-        for (auto& iter : CIM->GetAssayInfo())
+        auto spAssaySnapshot = CIM->GetAssaySnapshot();
+        for (const auto& iter : spAssaySnapshot->codeMap)
         {
             if (iter.second->openAssay && iter.second->assayClassify == ::tf::AssayClassify::ASSAY_CLASSIFY_CHEMISTRY)
             {
@@ -99,6 +99,20 @@ void FaultLogTableModel::AppendData(StFaultLogItem& data)
     endInsertRows();
 }
 
+void FaultLogTableModel::AppendDatas(std::vector<StFaultLogItem>& datas)
+{
+    if (datas.empty())
+    {
+        return;
+    }
+
+	// 更新数据
+    int start = m_data.size();
+    beginInsertRows(QModelIndex(), start, start + datas.size() - 1);
+	m_data.insert(m_data.end(), std::make_move_iterator(datas.begin()), std::make_move_iterator(datas.end()));
+    endInsertRows();
+}
+
 bool FaultLogTableModel::GetRowData(int row, StFaultLogItem& rowData)
 {
     if (m_data.size() > row)
@@ -152,6 +152,16 @@ public:
 	///
 	void AppendData(StFaultLogItem& data);
 
+	///
+	/// @brief
+	///     批量追加显示数据到模型（一次插入通知）
+	///
+	/// @param[in]  datas  显示数据
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void AppendDatas(std::vector<StFaultLogItem>& datas);
+
 	///
 	/// @brief
 	///     设置缓存数据的空间大小
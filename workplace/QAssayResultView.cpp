@@ -44,6 +44,7 @@
 #include <qwt_scale_widget.h>
 #include <qwt_plot_magnifier.h>
 #include <qwt_plot_panner.h>
+#include <qnumeric.h>
 
 #define _MATH_DEFINES_DEFINED
 #include "QSampleAssayModel.h"
@@ -56,6 +57,7 @@
 #include "shared/messagebus.h"
 #include "shared/uidef.h"
 #include "shared/ReagentCommon.h"
+#include "shared/ResultDetailCache.h"
 #include "WorkpageCommon.h"
 
 #include "src/common/StringUtil.h"
@@ -377,17 +379,14 @@ void QAssayResultView::SetAssayResult(int64_t reuslt, tf::TestItem& testItem)
 		ui->stackedWidget_2->setCurrentWidget(ui->page_4);
 	}
 
-    ch::tf::AssayTestResultQueryResp qryResp;
-    ch::tf::AssayTestResultQueryCond qryCond;
-    qryCond.__set_id(reuslt);
-    if (!ch::c1005::LogicControlProxy::QueryAssayTestResult(qryResp, qryCond)
-        || qryResp.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS
-        || qryResp.lstAssayTestResult.empty())
+    // 结果详情翻页时大多已经预取
+    auto spResult = ResultDetailCache::GetInstance().GetChResult(reuslt);
+    if (spResult == nullptr)
     {
         return;
     }
 
-    auto assayResult = qryResp.lstAssayTestResult[0];
+    auto assayResult = *spResult;
     // 保存当前结果信息
     m_assayResult = assayResult;
 
@@ -982,6 +981,7 @@ void QAssayResultView::SaveAssayResultEdit()
             return;
         }
 
+		ResultDetailCache::GetInstance().InvalidateResult(m_assayResult.id);
 		// modify bug0013752
 		m_assayResult.__set_concEdit(std::to_string(edit));
 		QString logOpt = QString(tr("编辑样本结果, 样本号: %1, 条码: %2, 申请时间: %3, 项目: %4, 原始结果: %5, 编辑结果: %6"))
@@ -1024,6 +1024,7 @@ void QAssayResultView::SaveAssayResultEdit()
             return;
         }
 
+		ResultDetailCache::GetInstance().InvalidateResult(m_assayResult.id);
 		// modify bug0013752
 		m_assayResult.__set_concEdit(std::to_string(edit));
 		QString logOpt = QString(tr("编辑样本结果, 样本号: %1, 条码: %2, 申请时间: %3, 项目: %4, 原始结果: %5, 编辑结果: %6"))
@@ -2487,46 +2488,49 @@ bool QAssayResultView::DisplayCurve(ch::tf::AssayTestResult& assayResult)
 	}
 
 	DisplayAnalyPointInfo(assayResult, m_pSplitGrid);
-    int primaryWave = -1;
-    primaryWave = assayResult.primarySubWaves[0];
-    int secondWave = -1;
-    if (assayResult.primarySubWaves.size() >= 2)
-    {
-        secondWave = assayResult.primarySubWaves[1];
-    }
-
 	m_reactionDatas.clear();
+	// 反应曲线在结果缓存中只解析一次，翻页回来时直接使用
+	auto spReaction = ResultDetailCache::GetInstance().GetChReactionCurve(assayResult);
+	if (spReaction == nullptr)
+	{
+		return false;
+	}
+
 	QReactionCurveData::DetectCurveData primaryCurve;
 	QReactionCurveData::DetectCurveData secondCurve;
 	QReactionCurveData::DetectCurveData primarySecondCurve;
-    for (const auto& detectPoint : assayResult.detectPoints)
+	primaryCurve.detectPointers.reserve(int(spReaction->pointSN.size()));
+	primaryCurve.absorbValues.reserve(int(spReaction->pointSN.size()));
+    for (size_t i = 0; i < spReaction->pointSN.size(); i++)
     {
         // 主波长
-        if (detectPoint.ods.count(primaryWave) != 0)
+        bool hasPrimary = !qIsNaN(spReaction->primary[i]);
+        if (hasPrimary)
         {
             // 测光点编号
-			primaryCurve.detectPointers.push_back(detectPoint.pointSN);
+			primaryCurve.detectPointers.push_back(spReaction->pointSN[i]);
             // 吸光度
-			primaryCurve.absorbValues.push_back(detectPoint.ods.at(primaryWave));
+			primaryCurve.absorbValues.push_back(spReaction->primary[i]);
         }
 
         // 次波长
-        if (detectPoint.ods.count(secondWave) != 0)
+        if (!spReaction->HasSecondary() || qIsNaN(spReaction->secondary[i]))
         {
-            // 测光点编号
-            secondCurve.detectPointers.push_back(detectPoint.pointSN);
-            // 吸光度
-            secondCurve.absorbValues.push_back(detectPoint.ods.at(secondWave));
+            continue;
         }
 
+        // 测光点编号
+        secondCurve.detectPointers.push_back(spReaction->pointSN[i]);
+        // 吸光度
+        secondCurve.absorbValues.push_back(spReaction->secondary[i]);
+
         // 主次波长
-        if (detectPoint.ods.count(primaryWave) != 0 && detectPoint.ods.count(secondWave) != 0)
+        if (hasPrimary)
         {
             // 测光点编号
-            primarySecondCurve.detectPointers.push_back(detectPoint.pointSN);
-            auto value = detectPoint.ods.at(primaryWave) - detectPoint.ods.at(secondWave);
+            primarySecondCurve.detectPointers.push_back(spReaction->pointSN[i]);
             // 吸光度差值
-            primarySecondCurve.absorbValues.push_back(value);
+            primarySecondCurve.absorbValues.push_back(double(spReaction->primary[i]) - double(spReaction->secondary[i]));
         }
     }
 
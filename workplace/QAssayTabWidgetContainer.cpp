@@ -355,8 +355,8 @@ bool QAssayTabWidgetContainer::SetProfileCardInfo(int profileId)
     }
 
     // 获取通用组合项目地图
-    auto ProfileAssayMaps = CommonInformationManager::GetInstance()->GetCommonProfileMap();
-    if (!ProfileAssayMaps || ProfileAssayMaps.value().count(profileId - UI_PROFILESTART) == 0)
+    auto spProfile = CommonInformationManager::GetInstance()->GetCommonProfile(profileId - UI_PROFILESTART);
+    if (spProfile == nullptr)
     {
         // 查询失败
         ULOG(LOG_WARN, "Faield to get profile.");
@@ -380,7 +380,7 @@ bool QAssayTabWidgetContainer::SetProfileCardInfo(int profileId)
 
     currentAttribute.bIsRequest = true;
     currentAttribute.assayCode = profileId;
-    currentAttribute.strAssayName = QString::fromStdString(ProfileAssayMaps.value()[profileId - UI_PROFILESTART]->profileName);
+    currentAttribute.strAssayName = QString::fromStdString(spProfile->profileName);
     if (!m_pageKeyinfo[m_currentDevType].assayTable->SetAssayButtonAttribute(m_currentIndex, currentAttribute))
     {
         ULOG(LOG_WARN, "Faield to set profile attribute.");
@@ -1071,25 +1071,22 @@ boost::optional<AssayButtons> QAssayTabWidgetContainer::GetCombAssayCardList(con
     }
 
     // 获取通用组合项目地图
-    auto ProfileAssayMaps = assayMgr->GetCommonProfileMap();
-    if (!ProfileAssayMaps)
-    {
-        // 查询失败
-        return boost::none;
-    }
+    auto spAssaySnapshot = assayMgr->GetAssaySnapshot();
+    const auto& ProfileAssayMaps = spAssaySnapshot->profileMap;
 
     AssayButtons pageMap;
     // 将结果设置到界面
     for (const auto& assayItem : profileItems)
     {
         // 项目按钮数据
-        if (ProfileAssayMaps.value().count(assayItem.id) == 0)
+        auto itProfile = ProfileAssayMaps.find(assayItem.id);
+        if (itProfile == ProfileAssayMaps.end())
         {
             continue;
         }
 
         AssayButtonData assayBtnData;
-        auto assayProfile = ProfileAssayMaps.value()[assayItem.id];
+        auto assayProfile = itProfile->second;
         assayBtnData.bIsUse = true;
         assayBtnData.assayCode = assayProfile->id + UI_PROFILESTART;
         assayBtnData.strAssayName = QString::fromStdString(assayProfile->profileName);
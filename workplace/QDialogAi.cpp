@@ -31,6 +31,7 @@
 #include "QDialogAi.h"
 #include "ui_QDialogAi.h"
 #include "shared/CommonInformationManager.h"
+#include "shared/AiImageService.h"
 #include "thrift/DcsControlProxy.h"
 #include "bcy_ime_common.h"
 
@@ -42,6 +43,7 @@ QDialogAi::QDialogAi(QWidget *parent)
 	SetTitleName(tr("视觉识别"));
 	connect(ui->Cancel_button, &QPushButton::clicked, this, [&]() {this->close(); });
 	connect(ui->ok_btn, &QPushButton::clicked, this, [&]() {this->close(); });
+	connect(&AiImageService::GetInstance(), &AiImageService::imageReady, this, &QDialogAi::OnImageReady);
 }
 
 QDialogAi::~QDialogAi()
@@ -50,6 +52,7 @@ QDialogAi::~QDialogAi()
 
 void QDialogAi::Clear()
 {
+	m_strPicPath.clear();
 	ui->label->setText(tr("图片"));
 	ui->label_2->setText(tr("无"));
 	ui->label_3->setText(tr("无"));
@@ -241,9 +244,60 @@ void QDialogAi::SetAiRecognizeId(const qint64 aiRecognizeId)
 		ui->label_10->setText(QString::number(tubeInfo.lipemiaLevel));
 	}
 
-	// 图片
+	// 图片（缓存未命中时在工作线程中按显示尺寸解码，完成后由OnImageReady显示）
 	if (tubeInfo.__isset.picPath)
 	{
-		ui->label->setPixmap(QPixmap(tubeInfo.picPath.c_str()).scaled(ui->label->size(), Qt::KeepAspectRatio));
+		m_strPicPath = QString::fromStdString(tubeInfo.picPath);
+		m_picSize = ui->label->size();
+		QImage image;
+		if (AiImageService::GetInstance().TryGetImage(m_strPicPath, m_picSize, image))
+		{
+			ui->label->setPixmap(QPixmap::fromImage(image));
+		}
+		else
+		{
+			ui->label->setText(tr("加载中"));
+			AiImageService::GetInstance().RequestImage(m_strPicPath, m_picSize);
+		}
 	}
 }
+
+///
+/// @brief 预取相邻样本的识别图片
+///
+/// @param[in]  aiRecognizeIds  相邻样本的AI识别结果ID
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QDialogAi::PrefetchNeighbours(const std::vector<qint64>& aiRecognizeIds)
+{
+	AiImageService::GetInstance().PrefetchRecognizeResults(aiRecognizeIds, ui->label->size());
+}
+
+///
+/// @brief 图片解码完成
+///
+/// @param[in]  path   图片路径
+/// @param[in]  size   显示尺寸
+/// @param[in]  image  缩略图
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QDialogAi::OnImageReady(const QString& path, const QSize& size, const QImage& image)
+{
+	// 只显示当前样本的图片
+	if (path != m_strPicPath || size != m_picSize)
+	{
+		return;
+	}
+
+	if (image.isNull())
+	{
+		ui->label->setText(tr("图片"));
+		return;
+	}
+
+	ui->label->setPixmap(QPixmap::fromImage(image));
+}
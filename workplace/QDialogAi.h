@@ -48,6 +48,8 @@
 #include "shared/basedlg.h"
 #include "src/thrift/gen-cpp/defs_types.h"
 #include <memory>
+#include <vector>
+#include <QImage>
 
 namespace Ui {
     class QDialogAi;
@@ -64,6 +66,29 @@ public:
 	void SetAiRecognizeId(const qint64 aiRecognizeId);
 	~QDialogAi();
 
+	///
+	/// @brief 预取相邻样本的识别图片
+	///
+	/// @param[in]  aiRecognizeIds  相邻样本的AI识别结果ID
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void PrefetchNeighbours(const std::vector<qint64>& aiRecognizeIds);
+
+protected slots:
+	///
+	/// @brief 图片解码完成
+	///
+	/// @param[in]  path   图片路径
+	/// @param[in]  size   显示尺寸
+	/// @param[in]  image  缩略图
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void OnImageReady(const QString& path, const QSize& size, const QImage& image);
+
 private:
 	void Clear();
 
@@ -93,4 +118,6 @@ private:
 
 private:
 	Ui::QDialogAi*				ui;
+	QString						m_strPicPath;				///< 当前显示的图片路径
+	QSize						m_picSize;					///< 当前图片的显示尺寸
 };
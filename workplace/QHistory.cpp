@@ -172,6 +172,8 @@ QHistory::QHistory(QWidget *parent)
     Init();
 
     m_currentHighLightRow = 0;
+    // 页面隐藏时延后表格刷新
+    gHisSampleAssayModel.WatchPage(this);
 }
 
 QHistory::~QHistory()
@@ -1353,38 +1355,43 @@ void QHistory::OnHightLightChanged(int index)
         QModelIndex curIdx = ui->show_assay_list->model()->index(index, 1);
         OnAssayListSelChanged(curIdx, curIdx);
     }
+
+    // 视觉识别窗口打开时跟随切换样本
+    if (m_dialogAi != Q_NULLPTR && m_dialogAi->isVisible())
+    {
+        ShowAiRecognizeResult(index);
+    }
 }
 
 void QHistory::OnAIVisonResultIdentifyClicked()
 {
-    qint64 aiRecognizeResultId = -1;
     bool bIsSampleModel = (gHisSampleAssayModel.GetModule() == QHistorySampleAssayModel::VIEWMOUDLE::SAMPLEBROWSE);
-    if (bIsSampleModel)
-    {
-        // 获取样本的测试项目
-        int currentRow = m_currentHighLightRow;
-        auto index = ui->sample_list->currentIndex();
-        if (index.isValid())
-        {
-            currentRow = index.row();
-        }
+    QTableView* pTableView = bIsSampleModel ? ui->sample_list : ui->show_assay_list;
 
-        auto currentIndex = gHisSampleAssayModel.index(currentRow, 0);
-        aiRecognizeResultId = gHisSampleAssayModel.GetAiRecognizeResultId(currentIndex);
-    }
-    else
+    // 获取样本的测试项目
+    int currentRow = m_currentHighLightRow;
+    auto index = pTableView->currentIndex();
+    if (index.isValid())
     {
-        int currentRow = m_currentHighLightRow;
-        auto index = ui->show_assay_list->currentIndex();
-        if (index.isValid())
-        {
-            currentRow = index.row();
-        }
-
-        auto currentIndex = gHisSampleAssayModel.index(currentRow, 0);
-        aiRecognizeResultId = gHisSampleAssayModel.GetAiRecognizeResultId(currentIndex);
+        currentRow = index.row();
     }
 
+    ShowAiRecognizeResult(currentRow);
+}
+
+///
+/// @brief 显示指定行的视觉识别结果，并预取相邻行的图片
+///
+/// @param[in]  row  样本/项目列表的行
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QHistory::ShowAiRecognizeResult(int row)
+{
+    auto currentIndex = gHisSampleAssayModel.index(row, 0);
+    qint64 aiRecognizeResultId = gHisSampleAssayModel.GetAiRecognizeResultId(currentIndex);
+
     if (m_dialogAi == Q_NULLPTR)
     {
         m_dialogAi = new QDialogAi(this);
@@ -1392,6 +1399,19 @@ void QHistory::OnAIVisonResultIdentifyClicked()
 
     m_dialogAi->SetAiRecognizeId(aiRecognizeResultId);
     m_dialogAi->show();
+
+    // 预取前后相邻样本的图片，翻页时直接从缓存显示
+    std::vector<qint64> neighbourIds;
+    int rowCount = gHisSampleAssayModel.rowCount();
+    for (int offset : {1, -1, 2, -2})
+    {
+        int neighbour = row + offset;
+        if (neighbour >= 0 && neighbour < rowCount)
+        {
+            neighbourIds.push_back(gHisSampleAssayModel.GetAiRecognizeResultId(gHisSampleAssayModel.index(neighbour, 0)));
+        }
+    }
+    m_dialogAi->PrefetchNeighbours(neighbourIds);
 }
 
 void QHistory::OnPermisionChanged()
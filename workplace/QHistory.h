@@ -459,6 +459,16 @@ protected slots:
     void OnHightLightChanged(int index);
     void OnAIVisonResultIdentifyClicked();
 
+    ///
+    /// @brief 显示指定行的视觉识别结果，并预取相邻行的图片
+    ///
+    /// @param[in]  row  样本/项目列表的行
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void ShowAiRecognizeResult(int row);
+
     ///
     /// @bref
     ///		权限变化响应
@@ -67,6 +67,7 @@
 #include <cctype>
 #include <QRegularExpression>
 #define  INVALID_VALUE									(-1)
+#define  PAGE_HIDDEN_MAX_PENDING                        (500)       // 页面隐藏时最多记录的修改行数（超过则显示时重置）
 
 // 搜索的目标字段类型
 enum SearchField { SF_SEQ, SF_BARCODE };
@@ -911,6 +912,8 @@ void QHistorySampleAssayModel::UpdatePatienInfo(const int64_t& sampleId, const i
 }
 
 QHistorySampleAssayModel::QHistorySampleAssayModel()
+	: m_updatePolicy("QHistorySampleAssayModel", PAGE_HIDDEN_MAX_PENDING)
+	, m_pendingSamples(m_updatePolicy)
 {
 	m_moudleType = VIEWMOUDLE::SAMPLEBROWSE;
 	m_moduleStatus = MOUDLESTATUS::UNKONW;
@@ -936,6 +939,66 @@ QHistorySampleAssayModel::QHistorySampleAssayModel()
 		this->beginResetModel();
 		this->endResetModel();
 	});
+
+	// 页面显示时回放隐藏期间的修改，模型重置后整体刷新，无需回放
+	connect(&m_updatePolicy, &PageUpdatePolicy::pageShown, this, &QHistorySampleAssayModel::OnPageShown);
+	connect(this, &QAbstractItemModel::modelAboutToBeReset, this, [&]() { m_pendingSamples.Clear(); });
+}
+
+///
+/// @brief 页面显示时一次回放隐藏期间的修改
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QHistorySampleAssayModel::OnPageShown()
+{
+	std::map<int64_t, bool> changes;
+	if (!m_pendingSamples.Take(changes))
+	{
+		m_updatePolicy.OnReset();
+		beginResetModel();
+		endResetModel();
+		return;
+	}
+
+	if (changes.empty())
+	{
+		return;
+	}
+
+	// 隐藏期间行号可能已变化（排序、重新查询），按样本ID换算当前行号
+	std::set<int> rows;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_moudleType != VIEWMOUDLE::SAMPLEBROWSE)
+		{
+			return;
+		}
+
+		for (const auto& change : changes)
+		{
+			auto it = m_mapSampleIndex.find(change.first);
+			if (it != m_mapSampleIndex.end() && it->second < int64_t(m_vecHistoryBaseDataSamples.size()))
+			{
+				rows.insert(int(it->second));
+			}
+		}
+	}
+
+	// 相邻行合并为一段刷新
+	int lastColumn = columnCount() - 1;
+	for (auto it = rows.begin(); it != rows.end();)
+	{
+		int first = *it;
+		int last = first;
+		while (++it != rows.end() && *it == last + 1)
+		{
+			last = *it;
+		}
+
+		emit dataChanged(this->index(first, 0), this->index(last, lastColumn));
+	}
 }
 
 ///
@@ -1294,6 +1357,43 @@ void QHistorySampleAssayModel::GetSamplesInSelectedItems(const std::shared_ptr<H
     }
 }
 
+///
+///  @brief 批量获取项目数据的样本数据（一次遍历）
+///
+///  @param[in]   items     项目数据列表
+///  @param[out]  samples   样本id->样本数据
+///
+///  @par History: 
+///  @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QHistorySampleAssayModel::GetSamplesInSelectedItems(const std::vector<std::shared_ptr<HistoryBaseDataByItem>>& items, \
+    std::map<int64_t, std::shared_ptr<HistoryBaseDataSample>>& samples)
+{
+    samples.clear();
+    for (const auto& pItem : items)
+    {
+        if (pItem != nullptr)
+        {
+            samples.emplace(pItem->m_sampleId, nullptr);
+        }
+    }
+
+    if (samples.empty())
+    {
+        return;
+    }
+
+    // 与单个查询一致，相同样本id取第一个
+    for (const std::shared_ptr<HistoryBaseDataSample>& pS : m_vecHistoryBaseDataSamples)
+    {
+        auto iter = samples.find(pS->m_sampleId);
+        if (iter != samples.end() && iter->second == nullptr)
+        {
+            iter->second = pS;
+        }
+    }
+}
+
 
 ///
 /// @brief 设置全勾选还是全不勾选
@@ -2106,7 +2206,14 @@ void QHistorySampleAssayModel::UpdatePrintFlag(const std::vector<int64_t>& sampl
         sampIdSet.insert(id);
     }
 
-    beginResetModel();
+    // 页面隐藏时只修改数据，显示时再重置
+    bool visible = m_updatePolicy.IsPageVisible();
+    if (visible)
+    {
+        m_updatePolicy.CountApplied();
+        beginResetModel();
+    }
+
     for (std::shared_ptr<HistoryBaseDataSample>& sIt : m_vecHistoryBaseDataSamples)
     {
         if (sampIdSet.find(sIt->m_sampleId) != sampIdSet.end())
@@ -2122,7 +2229,15 @@ void QHistorySampleAssayModel::UpdatePrintFlag(const std::vector<int64_t>& sampl
             sIt->m_bPrint = isPrinted;
         }
     }
-    endResetModel();
+
+    if (visible)
+    {
+        endResetModel();
+    }
+    else
+    {
+        m_updatePolicy.DeferReset();
+    }
 
     emit sampleChanged();
 }
@@ -2302,8 +2417,17 @@ void QHistorySampleAssayModel::UpdateLisStatus(const QVector<int64_t>& vecSample
 			continue;
 		}
 		m_vecHistoryBaseDataSamples[index]->m_sendLis = true;
-		auto changedIndex = this->index(index, static_cast<int>(COL::STATUS));
-		emit dataChanged(changedIndex, changedIndex);
+		if (m_updatePolicy.IsPageVisible())
+		{
+			m_updatePolicy.CountApplied();
+			auto changedIndex = this->index(index, static_cast<int>(COL::STATUS));
+			emit dataChanged(changedIndex, changedIndex);
+		}
+		else
+		{
+			// 页面隐藏时记录样本ID，显示时换算行号后一次刷新
+			m_pendingSamples.Defer(sampleID, true);
+		}
 
 		// 更新按项目展示Lis状态
 		{
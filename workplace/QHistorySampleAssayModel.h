@@ -52,6 +52,7 @@
 #include "src/thrift/gen-cpp/defs_types.h"
 #include "src/public/ConfigDefine.h"
 #include "shared/CReadOnlyDelegate.h"
+#include "shared/PageUpdatePolicy.h"
 
 struct SampleShowSet;
 
@@ -527,6 +528,18 @@ public:
     ///
     void GetSamplesInSelectedItems(const std::shared_ptr<HistoryBaseDataByItem>& pItem, \
         std::shared_ptr<HistoryBaseDataSample>& pSample);
+
+    ///
+    ///  @brief 批量获取项目数据的样本数据（一次遍历）
+    ///
+    ///  @param[in]   items     项目数据列表
+    ///  @param[out]  samples   样本id->样本数据
+    ///
+    ///  @par History: 
+    ///  @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void GetSamplesInSelectedItems(const std::vector<std::shared_ptr<HistoryBaseDataByItem>>& items, \
+        std::map<int64_t, std::shared_ptr<HistoryBaseDataSample>>& samples);
 	
 	///
 	/// @brief 设置全勾选还是全不勾选
@@ -737,6 +750,21 @@ public:
 	///
 	void CheckSampleBySampleID(const std::vector<int64_t> &vecSampleID, bool bCheck, const bool bUpdate = true);	
 
+    ///
+    /// @brief 登记使用本模型的页面（页面隐藏时延后刷新）
+    ///
+    /// @param[in]  page  页面
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void WatchPage(QWidget* page) { m_updatePolicy.WatchPage(page); };
+
+    ///
+    /// @brief 获取页面更新策略（统计信息）
+    ///
+    const PageUpdatePolicy& GetUpdatePolicy() const { return m_updatePolicy; };
+
     int GetHistorySample(int64_t sampleId) const
     {
         for (const std::shared_ptr<HistoryBaseDataSample>& pS : m_vecHistoryBaseDataSamples)
@@ -751,6 +779,13 @@ public:
 
 private slots:
 	///
+	/// @brief 页面显示时一次回放隐藏期间的修改
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void OnPageShown();
+
 private:
 	// QStringList                     m_assaySelectHeader;        ///< 项目选择的表头
 	QStringList                     m_sampleBrowseHeader;       ///< 数据浏览的表头
@@ -770,6 +805,8 @@ private:
 	std::shared_ptr<std::thread>	m_spThread;					///< 组织映射表的子线程
 	std::atomic_bool				m_bThreadStopFlag;			///< 子线程停止标志
 	std::mutex						m_mutex;					///< 映射表锁
+	PageUpdatePolicy				m_updatePolicy;				///< 页面可见性更新策略
+	PendingChangeSet<int64_t, bool>	m_pendingSamples;			///< 页面隐藏期间修改的样本ID（按样本展示，显示时再换算行号）
 };
 
 // 历史数据按样本展示-项目数据
@@ -52,6 +52,7 @@
 #include "shared/CommonInformationManager.h"
 #include "shared/QComDelegate.h"
 #include "shared/QSerialModel.h"
+#include "ReCalcJobEngine.h"
 
 #include <QRadioButton>
 #include <QHBoxLayout>
@@ -83,6 +84,7 @@ QReCalcDialog::QReCalcDialog(QWidget *parent)
 	, m_tableModelReag(new QSerialModel)
 	, m_tableModelResults(new QSerialModel)
 	, m_curDevSN("")
+	, m_jobEngine(Q_NULLPTR)
 {
     ui = new Ui::QReCalcDialog();
 	SetTitleName(tr("重新计算"));
@@ -106,7 +108,24 @@ QReCalcDialog::QReCalcDialog(QWidget *parent)
     InitTableTitle();
     InitMachines();
 
-	connect(ui->cls_Button, &QPushButton::clicked, this, [this] { close(); });
+	// 重新计算和保存在后台分块执行
+	m_jobEngine = new ReCalcJobEngine(this);
+	connect(m_jobEngine, &ReCalcJobEngine::chunkReCalculated, this, &QReCalcDialog::OnChunkReCalculated);
+	connect(m_jobEngine, &ReCalcJobEngine::progress, this, &QReCalcDialog::OnJobProgress);
+	connect(m_jobEngine, &ReCalcJobEngine::finished, this, &QReCalcDialog::OnJobFinished);
+	ui->progressBar_job->setVisible(false);
+
+	// 任务执行中点击取消则停止任务
+	connect(ui->cls_Button, &QPushButton::clicked, this, [this]
+	{
+		if (m_jobEngine->IsRunning())
+		{
+			m_jobEngine->Cancel();
+			return;
+		}
+
+		close();
+	});
 	connect(ui->save_button, &QPushButton::clicked, this, &QReCalcDialog::SaveReCalcResults);
 	connect(ui->reCalc_Button, &QPushButton::clicked, this, &QReCalcDialog::onReCalcSelResults);
 	connect(ui->reCalc_All_Button, &QPushButton::clicked, this, &QReCalcDialog::onReCalcAllResults);
@@ -242,7 +261,7 @@ void QReCalcDialog::InitMachines()
 ///
 void QReCalcDialog::SaveReCalcResults()
 {
-    std::vector<int64_t> sItemId;
+	std::vector<im::tf::AssayTestResult> lsResult;
 	for (int iRowIndx = 0; iRowIndx < m_tableModelResults->rowCount(); iRowIndx++)
 	{
 		auto result = m_tableModelResults->item(iRowIndx, ImResultHeader::rcr_SampleNo);
@@ -255,27 +274,15 @@ void QReCalcDialog::SaveReCalcResults()
 		// 已经重新计算了
 		if (rt.caliCurveId > 0 )
 		{
-			if (!im::i6000::LogicControlProxy::ModifyAssayTestResult(rt))
-			{
-				ULOG(LOG_ERROR, "save testresult err.");
-				continue;
-			}
-            sItemId.push_back(rt.testItemId);
+			lsResult.push_back(rt);
 		}
 	}
 
-    if (sItemId.size() <= 0)
-    {
-        return;
-    }
-    // 删除重复itemid
-    sItemId.erase(unique(sItemId.begin(), sItemId.end()), sItemId.end());
-    ::tf::ResultLong rtl;
-    if (!im::LogicControlProxy::UpdateResultToItemHist(rtl,sItemId) || rtl.result != ::tf::ThriftResult::THRIFT_RESULT_SUCCESS)
-    {
-        ULOG(LOG_ERROR, "save item change err.");
-        return;
-    }
+	// 后台分块保存，每块只通知一次项目结果更新
+	if (m_jobEngine->StartSave(lsResult))
+	{
+		SetJobRunning(true);
+	}
 }
 
 ///
@@ -411,6 +418,7 @@ void QReCalcDialog::UpdateResultsInfoToTable()
 		return;
 	}
 	m_tableModelResults->removeRows(0, m_tableModelResults->rowCount());
+	m_resultRows.clear();
 	im::tf::ReagentInfoTable reag = curItem->data().value<im::tf::ReagentInfoTable>();
 
 	im::tf::AssayTestResultQueryResp resp;
@@ -445,6 +453,7 @@ void QReCalcDialog::UpdateResultsInfoToTable()
 		itemList.push_back(new QStandardItem(QString::fromStdString(strCodes)));
 	
 		// 插入内容
+		m_resultRows.insert(result.id, iRow);
 		m_tableModelResults->insertRow(iRow, itemList);
         m_tableModelResults->setData(m_tableModelResults->index(iRow++, 0), false, Qt::UserRole + 1);
 	}
@@ -512,38 +521,108 @@ void QReCalcDialog::reCalcResults(bool bAll)
         }
 	}
 
-	im::tf::AssayTestResultQueryResp resp;
-	if (!im::i6000::LogicControlProxy::ReCalcResult(resp, lsResult, reag) ||
-		resp.result != ::tf::ThriftResult::THRIFT_RESULT_SUCCESS)
+	// 后台分块计算，同一试剂的校准曲线在整个任务中复用
+	if (m_jobEngine->StartReCalc(lsResult, reag))
 	{
-		ULOG(LOG_ERROR, "ReCalcResult not success.");
-		return;
+		SetJobRunning(true);
 	}
+}
 
-	for (int iRowIndx = 0; iRowIndx < m_tableModelResults->rowCount(); iRowIndx++)
+///
+/// @brief  一块结果重新计算完成，更新表格
+///
+/// @param[in]  results  计算后的结果
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QReCalcDialog::OnChunkReCalculated(std::vector<im::tf::AssayTestResult> results)
+{
+	for (const auto& r : results)
 	{
-		auto result = m_tableModelResults->item(iRowIndx, ImResultHeader::rcr_SampleNo);
-		if (result == nullptr)
+		auto iter = m_resultRows.constFind(r.id);
+		if (iter == m_resultRows.cend())
 		{
 			continue;
 		}
-		// 获取结果信息
-		im::tf::AssayTestResult rt = result->data().value<im::tf::AssayTestResult>();
-		
-		for (const auto& r : resp.lstAssayTestResult)
+
+		int iRowIndx = iter.value();
+		auto result = m_tableModelResults->item(iRowIndx, ImResultHeader::rcr_SampleNo);
+		if (result == nullptr)
 		{
-			// 更新数据
-			if (r.id == rt.id)
-			{
-				result->setData(QVariant::fromValue<im::tf::AssayTestResult>(r));
-                m_tableModelResults->setItem(iRowIndx, RsResult, new QStandardItem(QString::number(r.conc)));
-                m_tableModelResults->setItem(iRowIndx, RsResultStat, new QStandardItem(QString::fromStdString(r.resultStatusCodes)));
-				break;
-			}
+			continue;
 		}
+
+		// 更新数据
+		result->setData(QVariant::fromValue<im::tf::AssayTestResult>(r));
+		m_tableModelResults->setItem(iRowIndx, RsResult, new QStandardItem(QString::number(r.conc)));
+		m_tableModelResults->setItem(iRowIndx, RsResultStat, new QStandardItem(QString::fromStdString(r.resultStatusCodes)));
 	}
 }
 
+///
+/// @brief  后台任务进度更新
+///
+/// @param[in]  done   已处理的结果数
+/// @param[in]  total  结果总数
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QReCalcDialog::OnJobProgress(int done, int total)
+{
+	ui->progressBar_job->setMaximum(total);
+	ui->progressBar_job->setValue(done);
+}
+
+///
+/// @brief  后台任务结束
+///
+/// @param[in]  type      任务类型（ReCalcJobEngine::JOBTYPE）
+/// @param[in]  canceled  是否被取消
+/// @param[in]  failed    处理失败的结果数
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QReCalcDialog::OnJobFinished(int type, bool canceled, int failed)
+{
+	ULOG(LOG_INFO, "%s(type: %d, canceled: %d, failed: %d)", __FUNCTION__, type, canceled, failed);
+	SetJobRunning(false);
+
+	// 被取消或有失败的结果时提示用户
+	QString title = (type == ReCalcJobEngine::JOB_SAVE) ? tr("保存") : tr("重新计算");
+	if (canceled)
+	{
+		TipDlg(title, tr("任务已取消，未处理的结果保持不变")).exec();
+	}
+	else if (failed > 0)
+	{
+		TipDlg(title, tr("%1个结果处理失败").arg(failed)).exec();
+	}
+}
+
+///
+/// @brief  后台任务执行时禁用会改变表格内容的操作
+///
+/// @param[in]  running  是否有任务正在执行
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QReCalcDialog::SetJobRunning(bool running)
+{
+	ui->progressBar_job->setVisible(running);
+	ui->reCalc_Button->setEnabled(!running);
+	ui->reCalc_All_Button->setEnabled(!running);
+	ui->save_button->setEnabled(!running);
+	ui->pushButton_search->setEnabled(!running);
+	ui->comboBox_projectName->setEnabled(!running);
+	ui->comboBox_reagLot->setEnabled(!running);
+	ui->tableView_reag->setEnabled(!running);
+	ui->radioButtons->setEnabled(!running);
+}
+
 ///
 /// @brief  重新计算该试剂全部未计算结果
 ///
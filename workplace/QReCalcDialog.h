@@ -50,12 +50,14 @@
 #include "../thrift/im/gen-cpp/im_types.h"
 #include "src/thrift/gen-cpp/defs_types.h"
 #include <QList>
+#include <QHash>
 #include <boost/optional.hpp>
 
 namespace Ui {
     class QReCalcDialog;
 };
 class QSerialModel;
+class ReCalcJobEngine;
 
 
 class QReCalcDialog : public BaseDlg
@@ -114,7 +116,50 @@ public slots:
 	///
 	void OnItemComboxChange(int sel);
 
+	///
+	/// @brief  一块结果重新计算完成，更新表格
+	///
+	/// @param[in]  results  计算后的结果
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void OnChunkReCalculated(std::vector<im::tf::AssayTestResult> results);
+
+	///
+	/// @brief  后台任务进度更新
+	///
+	/// @param[in]  done   已处理的结果数
+	/// @param[in]  total  结果总数
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void OnJobProgress(int done, int total);
+
+	///
+	/// @brief  后台任务结束
+	///
+	/// @param[in]  type      任务类型（ReCalcJobEngine::JOBTYPE）
+	/// @param[in]  canceled  是否被取消
+	/// @param[in]  failed    处理失败的结果数
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void OnJobFinished(int type, bool canceled, int failed);
+
 private:
+	///
+	/// @brief  后台任务执行时禁用会改变表格内容的操作
+	///
+	/// @param[in]  running  是否有任务正在执行
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void SetJobRunning(bool running);
+
     ///
     /// @brief 初始化表标题
     ///
@@ -208,6 +253,8 @@ private:
 	std::string                     m_curDevSN;                 ///当前设备序号
 	QSerialModel*					m_tableModelReag;	        ///< 试剂表数据
 	QSerialModel*					m_tableModelResults;	    ///< 结果表数据
+	ReCalcJobEngine*				m_jobEngine;			    ///< 重新计算、保存的后台任务
+	QHash<int64_t, int>				m_resultRows;			    ///< 结果ID到结果表行号
 };
 
 
@@ -45,7 +45,7 @@
 ///////////////////////////////////////////////////////////////////////////
 #include "QResultActionCurve.h"
 #include "ui_QResultActionCurve.h"
-#include "thrift/ch/c1005/C1005LogicControlProxy.h"
+#include "shared/ResultDetailCache.h"
 
 QResultActionCurve::QResultActionCurve(QWidget *parent)
 	: BaseDlg(parent)
@@ -80,34 +80,22 @@ void QResultActionCurve::ShowAssayCurve(tf::TestItem& testItem)
 	// 查找初测结果
 	if (testItem.__isset.firstTestResultKey)
 	{
-		// 查询项目测试结果
-		::ch::tf::AssayTestResultQueryCond resultQueryCond;
-		::ch::tf::AssayTestResultQueryResp resultQueryResp;
-		resultQueryCond.__set_id(testItem.firstTestResultKey.assayTestResultId);
-
-		// 执行查询条件
-		if (ch::c1005::LogicControlProxy::QueryAssayTestResult(resultQueryResp, resultQueryCond)
-			&& resultQueryResp.result == ::tf::ThriftResult::THRIFT_RESULT_SUCCESS
-			&& !resultQueryResp.lstAssayTestResult.empty())
+		// 查询项目测试结果（优先使用结果缓存）
+		auto spResult = ResultDetailCache::GetInstance().GetChResult(testItem.firstTestResultKey.assayTestResultId);
+		if (spResult != nullptr)
 		{
-			m_resultContainer[0] = resultQueryResp.lstAssayTestResult[0];
+			m_resultContainer[0] = *spResult;
 		}
 	}
 
 	// 查找复查结果
 	if (testItem.__isset.lastTestResultKey)
 	{
-		// 查询项目测试结果
-		::ch::tf::AssayTestResultQueryCond resultQueryCond;
-		::ch::tf::AssayTestResultQueryResp resultQueryResp;
-		resultQueryCond.__set_id(testItem.lastTestResultKey.assayTestResultId);
-
-		// 执行查询条件
-		if (ch::c1005::LogicControlProxy::QueryAssayTestResult(resultQueryResp, resultQueryCond)
-			&& resultQueryResp.result == ::tf::ThriftResult::THRIFT_RESULT_SUCCESS
-			&& !resultQueryResp.lstAssayTestResult.empty())
+		// 查询项目测试结果（优先使用结果缓存）
+		auto spResult = ResultDetailCache::GetInstance().GetChResult(testItem.lastTestResultKey.assayTestResultId);
+		if (spResult != nullptr)
 		{
-			m_resultContainer[1] = resultQueryResp.lstAssayTestResult[0];
+			m_resultContainer[1] = *spResult;
 		}
 	}
 
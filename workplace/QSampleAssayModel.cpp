@@ -52,6 +52,7 @@
 #include "shared/CommonInformationManager.h"
 #include "shared/ThriftEnumTransform.h"
 #include "shared/ReagentCommon.h"
+#include "shared/LatencyProfiler.h"
 
 #include "thrift/im/i6000/I6000LogicControlProxy.h"
 #include "thrift/ise/ise1005/Ise1005LogicControlProxy.h"
@@ -68,6 +69,7 @@
 #define  PAGE_LIMIT_ITEM                                (1000)      // 分页查询（每一页的样本数）
 #define  INVALID_VALUE									(-1)
 #define  TIMEINTERVAL                                   (1000)      // 定时器刷新时间
+#define  PAGE_HIDDEN_MAX_PENDING                        (2000)      // 页面隐藏时最多记录的修改数（超过则显示时整表刷新）
 
 #define COL_DATAMODE_CHECK   0   // 勾选框列
 #define COL_DATAMODE_STATUS  1   // 状态列
@@ -81,16 +83,37 @@
 ///
 QString GetTestItemUnit(const tf::TestItem& dataItem)
 {
-    QString strAssay = CommonInformationManager::GetInstance()->GetAssayNameByCodeEx(dataItem.assayCode);
-    if (!QStringList({ "H", "L", "I" }).contains(strAssay))
+    // H、L、I等指数项目不显示单位
+    auto spSnapshot = CommonInformationManager::GetInstance()->GetAssaySnapshot();
+    const AssayDisplayRecord* pRecord = spSnapshot->GetRecord(dataItem.assayCode);
+    return (pRecord != nullptr && pRecord->showUnit) ? pRecord->unit : QString();
+}
+
+///
+/// @bref
+///		从项目显示记录表中获取结果格式化所需的属性（小数位数、单位倍率、项目类型）
+///     未找到项目时保持传入的默认值
+///
+void ApplyAssayRecord(int assayCode, int& left, double& factor, tf::AssayClassify::type& classi)
+{
+    auto spSnapshot = CommonInformationManager::GetInstance()->GetAssaySnapshot();
+    const AssayDisplayRecord* pRecord = spSnapshot->GetRecord(assayCode);
+    if (pRecord == nullptr)
     {
-        return CommonInformationManager::GetInstance()->GetCurrentUnit(dataItem.assayCode);
+        return;
     }
 
-    return "";
+    left = pRecord->precision;
+    if (!pRecord->isCalc)
+    {
+        factor = pRecord->factor;
+        classi = pRecord->classify;
+    }
 }
 
 QSampleAssayModel::QSampleAssayModel()
+    : m_updatePolicy("QSampleAssayModel", PAGE_HIDDEN_MAX_PENDING)
+    , m_pendingChanges(m_updatePolicy)
 {
 	m_moudleType = VIEWMOUDLE::ASSAYSELECT;
 	m_currentRow = INVALID_VALUE;
@@ -118,6 +141,14 @@ QSampleAssayModel::QSampleAssayModel()
 
 			case DataPrivate::ACTIONTYPE::MODIFYSAMPLE:
             {
+                // 页面隐藏时不刷新，显示时一次回放
+                if (!m_updatePolicy.IsPageVisible())
+                {
+                    DeferModifiedRows(start, end);
+                    return;
+                }
+
+                m_updatePolicy.CountApplied();
                 auto indexstart = this->index(start, 0);
                 auto indexend = this->index(end, this->columnCount() - 1);
 				DoDataChanged(indexstart, indexend);
@@ -145,6 +176,10 @@ QSampleAssayModel::QSampleAssayModel()
         }
     });
 
+    // 页面显示时回放隐藏期间的修改，模型重置后待处理的修改不再需要
+    connect(&m_updatePolicy, &PageUpdatePolicy::pageShown, this, &QSampleAssayModel::OnPageShown);
+    connect(this, &QAbstractItemModel::modelAboutToBeReset, this, [&]() { m_pendingChanges.Clear(); });
+
 
     // 数据更新
     connect(&SampleColumn::Instance(), &SampleColumn::ColumnChanged, this, [&]()
@@ -174,6 +209,101 @@ bool QSampleAssayModel::DoDataChanged(const QModelIndex& startIndex, const QMode
 	return true;
 }
 
+///
+/// @brief 页面隐藏时记录修改的行（按数据库主键记录，行号可能因增删变化）
+///
+/// @param[in]  start  起始行
+/// @param[in]  end    结束行
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QSampleAssayModel::DeferModifiedRows(int start, int end)
+{
+    // 范围过大，显示时整表刷新
+    if (end - start + 1 > PAGE_HIDDEN_MAX_PENDING)
+    {
+        m_pendingChanges.Clear();
+        m_updatePolicy.DeferReset();
+        return;
+    }
+
+    for (int row = start; row <= end; row++)
+    {
+        auto db = GetIdByIndex(this->index(row, 0));
+        if (db)
+        {
+            m_pendingChanges.Defer(db.value(), true);
+        }
+    }
+}
+
+///
+/// @brief 页面显示时一次回放隐藏期间的修改
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QSampleAssayModel::OnPageShown()
+{
+    int rowCount = this->rowCount();
+    if (rowCount <= 0)
+    {
+        m_pendingChanges.Clear();
+        if (m_updatePolicy.NeedReset())
+        {
+            m_updatePolicy.OnReset();
+        }
+        return;
+    }
+
+    // 修改过多，整表刷新一次（不重置模型，保留选中状态）
+    std::map<int64_t, bool> changes;
+    if (!m_pendingChanges.Take(changes))
+    {
+        m_updatePolicy.OnReset();
+        DoDataChanged(this->index(0, 0), this->index(rowCount - 1, this->columnCount() - 1));
+        return;
+    }
+
+    if (changes.empty())
+    {
+        return;
+    }
+
+    // 按数据库主键换算当前行号
+    std::set<int> rows;
+    for (const auto& change : changes)
+    {
+        auto row = (m_moudleType == VIEWMOUDLE::ASSAYBROWSE)
+            ? DataPrivate::Instance().GetTestItemRowByDb(change.first)
+            : DataPrivate::Instance().GetSampleByDb(change.first);
+        if (!row || row.value() < 0 || row.value() >= rowCount)
+        {
+            continue;
+        }
+
+        rows.insert(row.value());
+    }
+
+    // 相邻行合并为一段刷新，不相邻的行不连带刷新中间的行
+    int lastColumn = this->columnCount() - 1;
+    int runs = 0;
+    for (auto it = rows.begin(); it != rows.end(); runs++)
+    {
+        int first = *it;
+        int last = first;
+        while (++it != rows.end() && *it == last + 1)
+        {
+            last = *it;
+        }
+
+        DoDataChanged(this->index(first, 0), this->index(last, lastColumn));
+    }
+
+    ULOG(LOG_INFO, "%s(replay changes:%d, rows:%d, runs:%d)", __FUNCTION__, int(changes.size()), int(rows.size()), runs);
+}
+
 ///
 /// @brief 获取样本的显示数据(按项目显示)
 ///
@@ -842,6 +972,8 @@ int QSampleAssayModel::columnCount(const QModelIndex &parent) const
 
 QVariant QSampleAssayModel::data(const QModelIndex &index, int role) const
 {
+    // 调用频繁，抽样统计
+    LATENCY_SCOPE_SAMPLED("workplace.data", 64);
     switch (m_moudleType)
     {
     case QSampleAssayModel::VIEWMOUDLE::ASSAYSELECT:
@@ -916,10 +1048,13 @@ bool QSampleAssayModel::SetAllSelectedFlag(int mode)
             DataPrivate::Instance().SetRange(0, rangLast);
         }
 
-        auto range  = DataPrivate::Instance().m_rangVisble.GetRange();
-        auto indexstart = this->index(range.first, 0, QModelIndex());
-        auto indexend = this->index(range.second, 0, QModelIndex());
-		DoDataChanged(indexstart, indexend);
+        // 可见行在源模型中可能不连续，按连续段刷新
+        for (const auto& run : DataPrivate::Instance().m_rangVisble.GetRuns())
+        {
+            auto indexstart = this->index(run.first, 0, QModelIndex());
+            auto indexend = this->index(run.second, 0, QModelIndex());
+            DoDataChanged(indexstart, indexend);
+        }
     }
 
 	// 状态发生变化
@@ -1951,31 +2086,7 @@ QString QDataItemInfo::GetAssayResult(bool reCheck, const tf::TestItem& testItem
     tf::AssayClassify::type classi = tf::AssayClassify::ASSAY_CLASSIFY_OTHER;
 
 	bool isCalc = CommonInformationManager::IsCalcAssay(testItem.assayCode);
-    if (isCalc)
-    {
-        auto spCalcInfo = CommonInformationManager::GetInstance()->GetCalcAssayInfo(testItem.assayCode);
-        if (spCalcInfo != Q_NULLPTR)
-        {
-            left = spCalcInfo->decimalDigit;
-        }
-    }
-    else
-    {
-        auto spAssayInfo = CommonInformationManager::GetInstance()->GetAssayInfo(testItem.assayCode);
-        if (spAssayInfo != Q_NULLPTR)
-        {
-            left = spAssayInfo->decimalPlace;
-            classi = spAssayInfo->assayClassify;
-            for (const tf::AssayUnit& unit: spAssayInfo->units)
-            {
-                if (unit.isCurrent)
-                {
-                    factor = unit.factor;
-                    break;
-                }
-            }
-        }
-    }
+    ApplyAssayRecord(testItem.assayCode, left, factor, classi);
 
 	bool isIse = IsISE(testItem.assayCode);
 	// 样本显示的设置
@@ -2208,31 +2319,7 @@ QString QDataItemInfo::SetAssayResultFlag(double dValue, bool reCheck, bool isOr
     // 项目类型
     tf::AssayClassify::type classi = tf::AssayClassify::ASSAY_CLASSIFY_OTHER;
     bool isCalc = CommonInformationManager::IsCalcAssay(testItem.assayCode);
-    if (isCalc)
-    {
-        auto spCalcInfo = CommonInformationManager::GetInstance()->GetCalcAssayInfo(testItem.assayCode);
-        if (spCalcInfo != Q_NULLPTR)
-        {
-            left = spCalcInfo->decimalDigit;
-        }
-    }
-    else
-    {
-        auto spAssayInfo = CommonInformationManager::GetInstance()->GetAssayInfo(testItem.assayCode);
-        if (spAssayInfo != Q_NULLPTR)
-        {
-            left = spAssayInfo->decimalPlace;
-            classi = spAssayInfo->assayClassify;
-            for (const tf::AssayUnit& unit : spAssayInfo->units)
-            {
-                if (unit.isCurrent)
-                {
-                    factor = unit.factor;
-                    break;
-                }
-            }
-        }
-    }
+    ApplyAssayRecord(testItem.assayCode, left, factor, classi);
 
     // 样本显示的设置
     const SampleShowSet &sampleSet = DictionaryQueryManager::GetInstance()->GetSampleResultSet();
@@ -2479,27 +2566,7 @@ QString QDataItemInfo::GetAssayResultStatus(const AssayResult& assayAnyResult, c
 ///
 std::string QDataItemInfo::GetAssayResultUnitName(int assayCode)
 {
-    if (CommonInformationManager::IsCalcAssay(assayCode))
-    {
-        auto pAssayCalc = CommonInformationManager::GetInstance()->GetCalcAssayInfo(assayCode);
-        return (pAssayCalc == nullptr) ? "" : pAssayCalc->resultUnit;
-    }
-    else
-    {
-        auto spAssayInfo = CommonInformationManager::GetInstance()->GetAssayInfo(assayCode);
-        if (spAssayInfo != nullptr)
-        {
-            for (const tf::AssayUnit& unit : spAssayInfo->units)
-            {
-                if (unit.isCurrent)
-                {
-                    return unit.name;
-                }
-            }
-        }
-    }
-
-    return "";
+    return CommonInformationManager::GetInstance()->GetCurrentUnit(assayCode).toStdString();
 }
 
 ///
@@ -3408,6 +3475,7 @@ AssayResults DataPrivate::GetAssayResultByTestItem(const tf::TestItem& testItem)
 ///
 boost::optional<tf::SampleInfo> DataPrivate::GetSampleByRow(const int row) const
 {
+    LATENCY_SCOPE_SAMPLED("workplace.rowLookup", 16);
     std::lock_guard<std::recursive_mutex> lockRead(m_readWriteLock);
 
     if (row < 0 || row >= m_samplePostionVec.size())
@@ -3437,6 +3505,7 @@ boost::optional<tf::SampleInfo> DataPrivate::GetSampleByRow(const int row) const
 ///
 std::shared_ptr<tf::TestItem> DataPrivate::GetTestItemByRow(const int row) const
 {
+    LATENCY_SCOPE_SAMPLED("workplace.rowLookup", 16);
     std::lock_guard<std::recursive_mutex> lockRead(m_readWriteLock);
 
     if (row < 0 || row >= m_testitemPostionVec.size())
@@ -3494,20 +3563,37 @@ boost::optional<int> DataPrivate::GetRowBySample(tf::SampleInfo& sample)
 boost::optional<tf::SampleInfo> DataPrivate::GetSampleBySeq(tf::TestMode::type mode, const std::string& seqNo, tf::SampleType::type type, bool IsEmerge)
 {
     std::lock_guard<std::recursive_mutex> lockRead(m_readWriteLock);
-    auto ret = std::find_if(m_sampInfoData.begin(), m_sampInfoData.end(), [&](const auto& sample)->bool {
-        return ((sample.second->seqNo == seqNo)
-            && (sample.second->testMode == mode)
-            && (sample.second->sampleType == type)
-            && (sample.second->stat == IsEmerge)); });
-
-    if (ret == m_sampInfoData.end())
+    // 空样本号不进索引，保持原有的遍历匹配
+    if (seqNo.empty())
     {
-        return boost::none;
+        auto ret = std::find_if(m_sampInfoData.begin(), m_sampInfoData.end(), [&](const auto& sample)->bool {
+            return ((sample.second->seqNo == seqNo)
+                && (sample.second->testMode == mode)
+                && (sample.second->sampleType == type)
+                && (sample.second->stat == IsEmerge)); });
+
+        return (ret == m_sampInfoData.end()) ? boost::none : boost::make_optional(*(ret->second));
     }
-    else
+
+    // 通过样本号索引缩小范围（主键升序，与按主键遍历的结果一致）
+    for (auto db : m_seqNoIndex.FindExact(seqNo))
     {
-        return boost::make_optional(*(ret->second));
+        auto iter = m_sampInfoData.find(db);
+        if (iter == m_sampInfoData.end() || iter->second == Q_NULLPTR)
+        {
+            continue;
+        }
+
+        const auto& spSample = iter->second;
+        if ((spSample->testMode == mode)
+            && (spSample->sampleType == type)
+            && (spSample->stat == IsEmerge))
+        {
+            return boost::make_optional(*spSample);
+        }
     }
+
+    return boost::none;
 }
 
 ///
@@ -3531,19 +3617,24 @@ boost::optional<tf::SampleInfo> DataPrivate::GetSampleByBarCode(tf::TestMode::ty
     }
 
     std::lock_guard<std::recursive_mutex> lockRead(m_readWriteLock);
-    auto ret = std::find_if(m_sampInfoData.begin(), m_sampInfoData.end(), [&](const auto& sample)->bool {
-        return ((sample.second->barcode == barCode)
-            && (sample.second->testMode == mode)
-            && (sample.second->sampleType == type)); });
-
-    if (ret == m_sampInfoData.end())
-    {
-        return boost::none;
-    }
-    else
+    // 通过条码索引缩小范围（主键升序，与按主键遍历的结果一致）
+    for (auto db : m_barcodeIndex.FindExact(barCode))
     {
-        return boost::make_optional(*(ret->second));
+        auto iter = m_sampInfoData.find(db);
+        if (iter == m_sampInfoData.end() || iter->second == Q_NULLPTR)
+        {
+            continue;
+        }
+
+        const auto& spSample = iter->second;
+        if ((spSample->testMode == mode)
+            && (spSample->sampleType == type))
+        {
+            return boost::make_optional(*spSample);
+        }
     }
+
+    return boost::none;
 }
 
 ///
@@ -3873,62 +3964,6 @@ QVariant DataPrivate::GetSampleDisplayData(SampleColumn::SAMPLEMODE mode, int ro
 	return dataVec[col];
 }
 
-///
-///  @brief 更新倒计时
-///
-///
-///  @param[in]   itemId  项目id
-///
-///  @return	
-///
-///  @par History: 
-///  @li 7656/zhang.changjiang，2023年3月20日，新建函数
-///
-void DataPrivate::UpdateCountDown(int64_t itemId)
-{
-    std::lock_guard<std::recursive_mutex> lockRead(m_readWriteLock);
-	if (m_itemShowMap.count(itemId) <= 0)
-	{
-		return;
-	}
-
-	if (m_itemShowMap.at(itemId).isEmpty())
-	{
-		return;
-	}
-	if (m_testItemData.count(itemId) <= 0)
-	{
-		return;
-	}
-
-	auto testItem = m_testItemData.at(itemId);
-	int col = -1;
-
-	if (testItem->__isset.status && testItem->status == tf::TestItemStatus::type::TEST_ITEM_STATUS_TESTING)
-	{
-		if (!testItem->__isset.conc)
-		{
-			col = static_cast<int> (SampleColumn::COLASSAY::RESULT);
-		}
-		else
-		{
-			col = static_cast<int> (SampleColumn::COLASSAY::RECHECKRESULT);
-		}
-	}
-
-	if (col <0 || col >= m_itemShowMap.at(itemId).size())
-	{
-		return;
-	}
-
-    auto times = m_countDown.getValue(itemId);
-	if (!times)
-	{
-		return;
-	}
-	m_itemShowMap.at(itemId)[col] = QDataItemInfo::ConvertTime(times.value());
-}
-
 ///
 /// @brief 初始化函数
 ///
@@ -3938,8 +3973,10 @@ void DataPrivate::UpdateCountDown(int64_t itemId)
 ///
 void DataPrivate::Init()
 {
+    LATENCY_SCOPE("workplace.initialLoad");
     m_moduleStatus = MOUDLESTATUS::UNKONW;
 	m_needPrintSample = true;
+	m_addFlushScheduled = false;
     m_isAssayUpdate = true;
     m_sampleCount = 0;
     m_testItemCount = 0;
@@ -3951,6 +3988,8 @@ void DataPrivate::Init()
 	// 监听项目的更新
 	REGISTER_HANDLER(MSG_ID_SAMPLE_TEST_ITEM_UPDATE, this, OnTestItemUpdate);
 	REGISTER_HANDLER(MSG_ID_DICTIONARY_UPDATE, this, OnUpDateTestItemResultFlag);
+	// 样本号的显示值随样本显示设置变化，需要重建索引
+	REGISTER_HANDLER(MSG_ID_SAMPLE_SHOWSET_UPDATE, this, RebuildShowSeqNoIndex);
 
 	// 查询样本数据
 	m_sampleFuture = std::async(std::launch::async, [&]()->bool {return Update(); });
@@ -3959,31 +3998,27 @@ void DataPrivate::Init()
     // 完成数据地图
     FinishMap();
 
-    // 递减
+    // 倒计时节拍（剩余时间在绘制时按截止时间计算，这里只合并刷新可见行）
     connect(&m_countDown, &MyCountDown::counterDecremented, this, [&]()
     {
         // 按项目展示
         if (m_modeType == int(QSampleAssayModel::VIEWMOUDLE::ASSAYBROWSE))
         {
-            // 更新倒计时数据
-			int rowCount = m_testitemPostionVec.size();
-            auto map = m_countDown.GetRuntimeMap();
-            for (auto iter = map.begin(); iter != map.end(); iter++)
+            int rowCount = 0;
             {
-                UpdateCountDown(iter.key());
-				auto row = GetTestItemRowByDb(iter.key());
-				if (!row)
-				{
-					continue;
-				}
-
-				int index = row.value();
-				if (index < 0 || index >= rowCount)
-				{
-					continue;
-				}
+                std::lock_guard<std::recursive_mutex> lockRead(m_readWriteLock);
+                rowCount = m_testitemPostionVec.size();
+            }
 
-				emit sampleChanged(ACTIONTYPE::MODIFYSAMPLE, index, index);
+            // 只刷新可见行，按源模型中的连续段发出
+            for (const auto& run : m_rangVisble.GetRuns())
+            {
+                int first = qMax(0, run.first);
+                int last = qMin(rowCount - 1, run.second);
+                if (first <= last)
+                {
+                    emit sampleChanged(ACTIONTYPE::MODIFYSAMPLE, first, last);
+                }
             }
             return;
         }
@@ -4092,8 +4127,11 @@ bool DataPrivate::Update()
     querySampleCond.orderByConds.push_back(orderByCond);
     m_moduleStatus = MOUDLESTATUS::PROCESS;
     // 清空样本数据
+    m_readWriteLock.lock();
     m_sampInfoData.clear();
     m_samplePostionVec.clear();
+    ClearSampleIndex();
+    m_readWriteLock.unlock();
     m_sampleCount = 0;
 
     do
@@ -4117,6 +4155,7 @@ bool DataPrivate::Update()
         {
             m_sampInfoData[sample.id] = std::make_shared<::tf::SampleInfo>(sample);
             m_samplePostionVec.push_back(sample.id);
+            IndexSample(sample);
         }
         int endRow = m_samplePostionVec.size();
         //endResetModel();
@@ -4472,6 +4511,297 @@ QString DataPrivate::GetItemShowData(const int column, const tf::TestItem & data
 	return GetItemData(column, std::make_pair(m_sampInfoData.at(dataItem.sampleInfoId), dataItem));
 }
 
+///
+/// @brief 根据样本条码获取样本数据库主键（二级索引，精确匹配）
+///
+/// @param[in]  barcode  样本条码
+///
+/// @return 样本数据库主键列表（升序）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<int64_t> DataPrivate::GetSampleIdsByBarcode(const std::string& barcode) const
+{
+    return SearchSampleIds(SAMPLEKEY::BARCODE, MATCHMODE::EXACT, barcode);
+}
+
+///
+/// @brief 根据样本号获取样本数据库主键（二级索引，精确匹配）
+///
+/// @param[in]  seqNo  样本号
+///
+/// @return 样本数据库主键列表（升序）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<int64_t> DataPrivate::GetSampleIdsBySeqNo(const std::string& seqNo) const
+{
+    return SearchSampleIds(SAMPLEKEY::SEQNO, MATCHMODE::EXACT, seqNo);
+}
+
+///
+/// @brief 根据架号和位置获取样本数据库主键（二级索引）
+///
+/// @param[in]  rack  样本架号
+/// @param[in]  pos   位置号
+///
+/// @return 样本数据库主键列表（升序，架子复用时会有多个）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<int64_t> DataPrivate::GetSampleIdsByRackPos(const std::string& rack, int pos) const
+{
+    std::lock_guard<std::recursive_mutex> lockRead(m_readWriteLock);
+    auto iter = m_rackPosIndex.find(std::make_pair(rack, pos));
+    if (iter == m_rackPosIndex.end())
+    {
+        return {};
+    }
+
+    return std::vector<int64_t>(iter->second.begin(), iter->second.end());
+}
+
+///
+/// @brief 通过二级索引检索样本
+///
+/// @param[in]  keyType  关键字类型
+/// @param[in]  mode     匹配方式
+/// @param[in]  text     检索内容
+///
+/// @return 样本数据库主键列表（升序）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<int64_t> DataPrivate::SearchSampleIds(SAMPLEKEY keyType, MATCHMODE mode, const std::string& text) const
+{
+    auto find = [mode, &text](const SampleKeyIndex& index)->std::vector<int64_t>
+    {
+        switch (mode)
+        {
+            case MATCHMODE::EXACT:
+                return index.FindExact(text);
+            case MATCHMODE::PREFIX:
+                return index.FindPrefix(text);
+            case MATCHMODE::CONTAINS:
+                return index.FindContains(text);
+            default:
+                return {};
+        }
+    };
+
+    std::lock_guard<std::recursive_mutex> lockRead(m_readWriteLock);
+    switch (keyType)
+    {
+        case SAMPLEKEY::BARCODE:
+            return find(m_barcodeIndex);
+        case SAMPLEKEY::SEQNO:
+            return find(m_seqNoIndex);
+        case SAMPLEKEY::SHOWSEQNO:
+            return find(m_showSeqNoIndex);
+        default:
+            return {};
+    }
+}
+
+///
+/// @brief 根据当前展示模式的行号获取样本主键（不拷贝样本数据）
+///
+/// @param[in]  row  行号（按项目展示时为项目行）
+///
+/// @return 样本主键，无效时返回-1
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+int64_t DataPrivate::GetSampleDbByRow(int row) const
+{
+    std::lock_guard<std::recursive_mutex> lockRead(m_readWriteLock);
+    if (m_modeType == int(QSampleAssayModel::VIEWMOUDLE::ASSAYBROWSE))
+    {
+        auto spTestItem = GetTestItemByRow(row);
+        return (spTestItem == Q_NULLPTR) ? -1 : spTestItem->sampleInfoId;
+    }
+
+    if (row < 0 || row >= m_samplePostionVec.size())
+    {
+        return -1;
+    }
+
+    return m_samplePostionVec[row];
+}
+
+///
+/// @brief 批量登记前一次检查一组样本号/条码中是否已有对应的病人样本
+///
+/// @param[in]  mode      样本所属模式
+/// @param[in]  keyType   关键字类型（SEQNO或BARCODE）
+/// @param[in]  keys      样本号/条码列表
+/// @param[in]  isEmerge  是否急诊（只对样本号有效）
+///
+/// @return 第一个已被使用的样本号/条码，没有时返回boost::none
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+boost::optional<std::string> DataPrivate::FindFirstUsedKey(tf::TestMode::type mode, SAMPLEKEY keyType,
+    const std::vector<std::string>& keys, bool isEmerge) const
+{
+    if (keyType != SAMPLEKEY::SEQNO && keyType != SAMPLEKEY::BARCODE)
+    {
+        return boost::none;
+    }
+
+    bool isSeqNo = (keyType == SAMPLEKEY::SEQNO);
+    const auto& index = isSeqNo ? m_seqNoIndex : m_barcodeIndex;
+
+    // 整段只加一次锁
+    std::lock_guard<std::recursive_mutex> lockRead(m_readWriteLock);
+    for (const auto& key : keys)
+    {
+        for (auto db : index.FindExact(key))
+        {
+            auto iter = m_sampInfoData.find(db);
+            if (iter == m_sampInfoData.end() || iter->second == Q_NULLPTR)
+            {
+                continue;
+            }
+
+            const auto& spSample = iter->second;
+            if (spSample->testMode == mode
+                && spSample->sampleType == tf::SampleType::SAMPLE_TYPE_PATIENT
+                && (!isSeqNo || spSample->stat == isEmerge))
+            {
+                return key;
+            }
+        }
+    }
+
+    return boost::none;
+}
+
+///
+/// @brief 将样本加入二级索引（调用者持有m_readWriteLock）
+///
+/// @param[in]  sample  样本信息
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void DataPrivate::IndexSample(const ::tf::SampleInfo& sample)
+{
+    m_barcodeIndex.Set(sample.id, sample.barcode);
+    m_seqNoIndex.Set(sample.id, sample.seqNo);
+    m_showSeqNoIndex.Set(sample.id, QDataItemInfo::GetSeqNo(sample).toStdString());
+
+    m_rackPosIndex[std::make_pair(sample.rack, sample.pos)].insert(sample.id);
+}
+
+///
+/// @brief 将样本从二级索引中移除（调用者持有m_readWriteLock）
+///
+/// @param[in]  sample  样本信息（需为建索引时的旧值）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void DataPrivate::UnindexSample(const ::tf::SampleInfo& sample)
+{
+    auto eraseFrom = [&sample](auto& index, const auto& key)
+    {
+        auto iter = index.find(key);
+        if (iter == index.end())
+        {
+            return;
+        }
+
+        iter->second.erase(sample.id);
+        if (iter->second.empty())
+        {
+            index.erase(iter);
+        }
+    };
+
+    m_barcodeIndex.Remove(sample.id);
+    m_seqNoIndex.Remove(sample.id);
+    m_showSeqNoIndex.Remove(sample.id);
+    eraseFrom(m_rackPosIndex, std::make_pair(sample.rack, sample.pos));
+}
+
+///
+/// @brief 清空二级索引（调用者持有m_readWriteLock）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void DataPrivate::ClearSampleIndex()
+{
+    m_barcodeIndex.Clear();
+    m_seqNoIndex.Clear();
+    m_showSeqNoIndex.Clear();
+    m_rackPosIndex.clear();
+}
+
+///
+/// @brief 将行号按连续区间合并后发出变化通知（批量新增时整段插入）
+///
+/// @param[in]  mode  变化类型
+/// @param[in]  rows  行号列表
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void DataPrivate::EmitRowRanges(ACTIONTYPE mode, std::vector<int> rows)
+{
+    if (rows.empty())
+    {
+        return;
+    }
+
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+    int start = rows.front();
+    int end = start;
+    for (size_t i = 1; i < rows.size(); ++i)
+    {
+        if (rows[i] == end + 1)
+        {
+            end = rows[i];
+            continue;
+        }
+
+        emit sampleChanged(mode, start, end);
+        start = end = rows[i];
+    }
+
+    emit sampleChanged(mode, start, end);
+}
+
+///
+/// @brief 处理合并后的新增样本（批量登记时同一轮事件循环内的多条新增消息只处理一次）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void DataPrivate::FlushPendingAddSamples()
+{
+    m_addFlushScheduled = false;
+    if (m_pendingAddSamples.empty())
+    {
+        return;
+    }
+
+    std::vector<tf::SampleInfo> samples;
+    samples.swap(m_pendingAddSamples);
+    ULOG(LOG_INFO, "%s(add samples: %d)", __FUNCTION__, samples.size());
+    LATENCY_SCOPE("workplace.sampleAdd");
+    AddSamples(samples);
+}
+
 ///
 /// @brief 添加样本信息
 ///
@@ -4496,10 +4826,20 @@ bool DataPrivate::AddSamples(const std::vector<::tf::SampleInfo>& samples)
     // 更新数据
     m_readWriteLock.lock();
     // 在数据之后插入一段数据
+    std::set<int64_t> changedDbs;
     for (const auto& sample : samples)
     {
+        // 重复推送的样本先移除旧索引
+        auto iterOld = m_sampInfoData.find(sample.id);
+        if (iterOld != m_sampInfoData.end() && iterOld->second != Q_NULLPTR)
+        {
+            UnindexSample(*iterOld->second);
+        }
+
         m_sampInfoData[sample.id] = std::make_shared<::tf::SampleInfo>(sample);
 		m_sampleShowMap[sample.id] = GetSampleShowDatas(sample);
+        IndexSample(sample);
+        changedDbs.insert(sample.id);
         // 样本地图
         m_samplePostionVec.push_back(sample.id);
         // 记录需要增加的样本行
@@ -4528,21 +4868,17 @@ bool DataPrivate::AddSamples(const std::vector<::tf::SampleInfo>& samples)
 
     // [增加样本/项目]
 	ACTIONTYPE mode = ACTIONTYPE::ADDSAMPLE;
+    emit sampleStoreChanged(mode, changedDbs);
+    // 新增行都追加在末尾，合并为连续区间一次插入
     // 若是按项目展示（当前模式）
     if (m_modeType == int(QSampleAssayModel::VIEWMOUDLE::ASSAYBROWSE))
     {
-        for (auto index : alterAssayRows)
-        {
-            emit sampleChanged(mode, index, index);
-        }
+        EmitRowRanges(mode, std::move(alterAssayRows));
     }
     // 若是按样本展示
     else
     {
-        for (auto index : alterSampleRows)
-        {
-            emit sampleChanged(mode, index, index);
-        }
+        EmitRowRanges(mode, std::move(alterSampleRows));
     }
 
     return true;
@@ -4573,12 +4909,20 @@ bool DataPrivate::DelSamples(const std::vector<::tf::SampleInfo>& samples)
     // 更新数据
     m_readWriteLock.lock();
     // 填写数据和行号的对应关系
+    std::set<int64_t> changedDbs;
     for (const auto& sample : samples)
     {
         // 能查到
         auto iterSample = m_sampInfoData.find(sample.id);
         if (iterSample != m_sampInfoData.end())
         {
+            // 按存储中的旧值清除索引（删除消息可能只带主键）
+            if (iterSample->second != Q_NULLPTR)
+            {
+                UnindexSample(*iterSample->second);
+            }
+            changedDbs.insert(sample.id);
+
             // 清除对应的地图中的位置信息
             int row = std::distance(m_sampInfoData.begin(), iterSample);
             if (row >= 0)
@@ -4639,6 +4983,7 @@ bool DataPrivate::DelSamples(const std::vector<::tf::SampleInfo>& samples)
 
     // [删除样本/项目]
 	ACTIONTYPE mode = ACTIONTYPE::DELETESAMPLE;
+    emit sampleStoreChanged(mode, changedDbs);
     // 若是按项目展示（当前模式）
     if (m_modeType == int(QSampleAssayModel::VIEWMOUDLE::ASSAYBROWSE))
     {
@@ -4682,14 +5027,22 @@ bool DataPrivate::ModifySamples(const std::vector<::tf::SampleInfo>& samples)
     std::vector<int> alterSampleRows;   // 需要改变的样本行
 
     // 更新数据
+    std::set<int64_t> changedDbs;
     m_readWriteLock.lock();
     for (const ::tf::SampleInfo& sample : samples)
     {
-        if (m_sampInfoData.count(sample.id) > 0)
+        auto iterOld = m_sampInfoData.find(sample.id);
+        if (iterOld != m_sampInfoData.end())
         {
-            // 修改样本数据
-            m_sampInfoData[sample.id] = std::make_shared<::tf::SampleInfo>(sample);
+            // 修改样本数据（先按旧值移除索引）
+            if (iterOld->second != Q_NULLPTR)
+            {
+                UnindexSample(*iterOld->second);
+            }
+            iterOld->second = std::make_shared<::tf::SampleInfo>(sample);
 			m_sampleShowMap[sample.id] = GetSampleShowDatas(sample);
+            IndexSample(sample);
+            changedDbs.insert(sample.id);
 
             // 1）要求有此样本数据，要求开启项目更新
             if (m_isAssayUpdate && m_sampleMap.count(sample.id) > 0)
@@ -4830,6 +5183,7 @@ bool DataPrivate::ModifySamples(const std::vector<::tf::SampleInfo>& samples)
         }
     }
 
+    emit sampleStoreChanged(ACTIONTYPE::MODIFYSAMPLE, changedDbs);
     return true;
 }
 
@@ -4940,11 +5294,20 @@ void DataPrivate::OnSampleUpdate(tf::UpdateType::type enUpdateType, std::vector<
     {
         case ::tf::UpdateType::type::UPDATE_TYPE_ADD:
         {
-            AddSamples(vSIs);
+            // 批量登记时DCS可能逐个推送新增，合并到本轮事件循环结束后一次处理
+            m_pendingAddSamples.insert(m_pendingAddSamples.end(), vSIs.begin(), vSIs.end());
+            if (!m_addFlushScheduled)
+            {
+                m_addFlushScheduled = true;
+                QTimer::singleShot(0, this, &DataPrivate::FlushPendingAddSamples);
+            }
         }
             break;
         case ::tf::UpdateType::type::UPDATE_TYPE_DELETE:
         {
+            // 保证消息顺序：先处理之前合并的新增
+            FlushPendingAddSamples();
+            LATENCY_SCOPE("workplace.sampleDelete");
             DelSamples(vSIs);
             return;
         }
@@ -4956,6 +5319,9 @@ void DataPrivate::OnSampleUpdate(tf::UpdateType::type enUpdateType, std::vector<
 				PrintSampleInfo(vSIs);
 			}
 
+            // 保证消息顺序：先处理之前合并的新增
+            FlushPendingAddSamples();
+            LATENCY_SCOPE("workplace.sampleModify");
             ModifySamples(vSIs);
         }
             break;
@@ -4983,6 +5349,9 @@ void DataPrivate::OnTestItemUpdate(tf::UpdateType::type enUpdateType, std::vecto
 		m_assayFuture.get();
 	}
 
+	// 项目可能属于尚未处理的新增样本，先处理合并的新增
+	FlushPendingAddSamples();
+
 	// 根据样本更新类型分别处理
 	switch (enUpdateType)
 	{
@@ -5000,6 +5369,7 @@ void DataPrivate::OnTestItemUpdate(tf::UpdateType::type enUpdateType, std::vecto
 		break;
 		case ::tf::UpdateType::type::UPDATE_TYPE_MODIFY:
 		{
+			LATENCY_SCOPE("workplace.testItemModify");
 			ModifyTestItem(vSIs);
 		}
 		break;
@@ -5008,6 +5378,25 @@ void DataPrivate::OnTestItemUpdate(tf::UpdateType::type enUpdateType, std::vecto
 	}
 }
 
+///
+/// @brief 样本显示设置变化后，按新的显示格式重建样本号（显示值）索引
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void DataPrivate::RebuildShowSeqNoIndex()
+{
+	std::lock_guard<std::recursive_mutex> lockRead(m_readWriteLock);
+	m_showSeqNoIndex.Clear();
+	for (const auto& sample : m_sampInfoData)
+	{
+		if (sample.second != Q_NULLPTR)
+		{
+			m_showSeqNoIndex.Set(sample.first, QDataItemInfo::GetSeqNo(*sample.second).toStdString());
+		}
+	}
+}
+
 ///
 /// @brief 当结果提示变化以后，需要同等更新按项目展示的结果信息的flag
 ///
@@ -49,16 +49,24 @@
 #include <thread>
 #include <QTimer>
 #include <QMap>
+#include <QHash>
+#include <QElapsedTimer>
 #include <QObject>
 #include <QReadWriteLock>
 #include <boost/optional.hpp>
 #include <functional>
+#include <set>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
 #include <QAbstractTableModel>
 #include "boost/optional.hpp"
 #include <boost/any.hpp>
 #include "src/thrift/gen-cpp/defs_types.h"
 #include "src/public/ConfigSerialize.h"
 #include "WorkpageCommon.h"
+#include "shared/PageUpdatePolicy.h"
+#include "SampleKeyIndex.h"
 
 class QSampleAssayModel;
 
@@ -67,50 +75,54 @@ using AssayVec = std::vector<AssayResult>;
 using AssayResults = std::shared_ptr<AssayVec>;
 using DataPara = std::pair<std::shared_ptr<tf::SampleInfo>, tf::TestItem>;
 
+///
+/// @brief 运行项目倒计时调度器
+///
+/// 按项目的绝对结束时间（单调时钟毫秒）登记到以秒为槽的时间轮中，
+/// 每秒只弹出已到期的槽，剩余时间在绘制时按截止时间惰性计算，不再逐项递减
+///
 class MyCountDown : public QObject {
     Q_OBJECT
 public:
     MyCountDown(QObject *parent = nullptr) : QObject(parent) {
+        m_clock.start();
         connect(timer, &QTimer::timeout, this, &MyCountDown::decrementCounter);
     }
 
-    QMap<int64_t,int> GetRuntimeMap() 
-    { 
-        readWriteLock.lockForRead();
-        auto keyMap = map; 
-        readWriteLock.unlock();
-        return keyMap;
-    };
-
-    // 添加函数对象参数，用于获取value
+    // 添加函数对象参数，用于获取value（反应时间，单位秒）
     void addElement(int64_t key, const tf::TestItem& testitem, std::function<int(const tf::TestItem& testItemInfo)> GetReactionTime) {
         // 在写入共享数据时加写锁
         readWriteLock.lockForWrite();
 
-        // 添加元素到map
-        if (!map.contains(key)) {
-            map.insert(key, GetReactionTime(testitem));
+        // 已登记的项目保持原截止时间
+        if (!deadlines.contains(key)) {
+            qint64 deadline = m_clock.elapsed() + qint64(GetReactionTime(testitem)) * 1000;
+            deadlines.insert(key, deadline);
+            wheel[SlotOf(deadline)].insert(key);
         }
 
-        // 如果map不为空并且计时器未启动，则启动计时器
-        if (!timer->isActive() && !map.isEmpty()) {
+        // 如果存在倒计时并且计时器未启动，则启动计时器
+        if (!timer->isActive() && !deadlines.isEmpty()) {
             timer->start(1000);
-            timer->setInterval(1000);
         }
 
         readWriteLock.unlock();
     }
 
-    // 添加函数，用于获取Key对应的value
+    // 添加函数，用于获取Key对应的剩余秒数（按截止时间计算）
     boost::optional<int> getValue(int64_t key) {
         // 在读取共享数据时加读锁
         readWriteLock.lockForRead();
 
         boost::optional<int> result = boost::none;
 
-        auto it = map.find(key);
-        if (it != map.end() && it.value() > 0) {
-            result = it.value();
+        auto it = deadlines.find(key);
+        if (it != deadlines.end()) {
+            qint64 remain = it.value() - m_clock.elapsed();
+            if (remain > 0) {
+                // 不足一秒按一秒显示
+                result = int((remain + 999) / 1000);
+            }
         }
 
         readWriteLock.unlock();
@@ -118,11 +130,20 @@ public:
         return result;
     }
 
+    // 当前正在倒计时的项目数目
+    int size() {
+        readWriteLock.lockForRead();
+        int count = deadlines.size();
+        readWriteLock.unlock();
+        return count;
+    }
+
     // 清除
     void clear()
     {
         readWriteLock.lockForWrite();
-        map.clear();
+        deadlines.clear();
+        wheel.clear();
         timer->stop();
         readWriteLock.unlock();
     }
@@ -132,18 +153,17 @@ public slots:
         // 在写入共享数据时加写锁
         readWriteLock.lockForWrite();
 
-        for (auto it = map.begin(); it != map.end();) {
-            it.value()--;  // 计数器减1
-
-            if (it.value() <= 0) {
-                it = map.erase(it);  // 删除计数器为0的元素
-            }
-            else {
-                ++it;
+        // 只弹出已到期的槽，未到期的项目不做任何修改
+        qint64 nowSlot = m_clock.elapsed() / 1000;
+        for (auto it = wheel.begin(); it != wheel.end() && it->first <= nowSlot;) {
+            for (auto key : it->second) {
+                deadlines.remove(key);
             }
+
+            it = wheel.erase(it);
         }
 
-        if (map.isEmpty()) {
+        if (deadlines.isEmpty()) {
             timer->stop();
         }
 
@@ -156,13 +176,22 @@ public slots:
         // 在写入共享数据时加写锁
         readWriteLock.lockForWrite();
 
-        // 从map中删除元素
-        if (map.contains(key)) {
-            map.remove(key);
+        // 从截止时间表和时间轮中删除元素
+        auto it = deadlines.find(key);
+        if (it != deadlines.end()) {
+            auto slot = wheel.find(SlotOf(it.value()));
+            if (slot != wheel.end()) {
+                slot->second.erase(key);
+                if (slot->second.empty()) {
+                    wheel.erase(slot);
+                }
+            }
+
+            deadlines.erase(it);
         }
 
-        // 如果map为空并且计时器已启动，则停止计时器
-        if (map.isEmpty() && timer->isActive()) {
+        // 如果没有倒计时并且计时器已启动，则停止计时器
+        if (deadlines.isEmpty() && timer->isActive()) {
             timer->stop();
         }
 
@@ -173,7 +202,12 @@ signals:
     void counterDecremented();  // 定义信号
 
 private:
-    QMap<int64_t, int> map;
+    // 截止时间所在的秒槽（向上取整，到期即可弹出）
+    static qint64 SlotOf(qint64 msecs) { return (msecs + 999) / 1000; }
+
+    QHash<int64_t, qint64> deadlines;                   // 项目id--截止时间（单调时钟毫秒）
+    std::map<qint64, std::set<int64_t>> wheel;          // 时间轮（秒槽--项目id）
+    QElapsedTimer m_clock;                              // 单调时钟
     QReadWriteLock readWriteLock;
     QTimer* timer = new QTimer(this);
 };
@@ -582,10 +616,54 @@ public:
         std::lock_guard<std::recursive_mutex> lock(m_rangelock);
         m_updateRange.first = first;
         m_updateRange.second = last;
+        m_runs.assign(1, m_updateRange);
+    }
+
+    ///
+    /// @brief 按行更新范围（视图排序后可见行在源模型中不连续）
+    ///
+    /// @param[in]  rows  可见行（源模型行号）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void SetRows(std::vector<int> rows)
+    {
+        std::sort(rows.begin(), rows.end());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+        // 相邻的行合并为连续段
+        std::vector<std::pair<int, int>> runs;
+        for (int row : rows)
+        {
+            if (!runs.empty() && runs.back().second + 1 == row)
+            {
+                runs.back().second = row;
+                continue;
+            }
+
+            runs.emplace_back(row, row);
+        }
+
+        std::lock_guard<std::recursive_mutex> lock(m_rangelock);
+        m_runs.swap(runs);
+        m_updateRange = m_runs.empty() ? std::make_pair(0, -1) : std::make_pair(m_runs.front().first, m_runs.back().second);
     }
 
     std::pair<int, int> GetRange() { return m_updateRange; };
 
+    ///
+    /// @brief 获取范围内的各连续段（闭区间）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::vector<std::pair<int, int>> GetRuns()
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_rangelock);
+        return m_runs;
+    }
+
     ///
     /// @brief 当前行在范围之内
     ///
@@ -599,12 +677,15 @@ public:
     bool IsRangIn(int row)
     {
         std::lock_guard<std::recursive_mutex> lock(m_rangelock);
-        if (row < m_updateRange.first || m_updateRange.second < row)
+        for (const auto& run : m_runs)
         {
-            return false;
+            if (run.first <= row && row <= run.second)
+            {
+                return true;
+            }
         }
 
-        return true;
+        return false;
     }
 
     RangeRowManage()
@@ -612,11 +693,13 @@ public:
         // 初始化，不更新
         m_updateRange.first = 0;
         m_updateRange.second = 0;
+        m_runs.assign(1, m_updateRange);
     }
 
 private:
     mutable std::recursive_mutex							m_rangelock;				// 刷新范围更新锁
-    std::pair<int, int>                                     m_updateRange;              // 行刷新范围
+    std::pair<int, int>                                     m_updateRange;              // 行刷新范围（各连续段的首尾）
+    std::vector<std::pair<int, int>>                        m_runs;                     // 行刷新范围的连续段
 };
 
 class DataPrivate : public QObject
@@ -640,6 +723,22 @@ public:
 	};
 	Q_ENUM(ACTIONTYPE);
 
+	// 样本检索的关键字类型
+	enum class SAMPLEKEY
+	{
+		BARCODE = 0,            /// 样本条码
+		SEQNO,                  /// 样本号（原始值）
+		SHOWSEQNO,              /// 样本号（界面显示值，含前缀）
+	};
+
+	// 样本检索的匹配方式
+	enum class MATCHMODE
+	{
+		EXACT = 0,              /// 精确匹配
+		PREFIX,                 /// 前缀匹配
+		CONTAINS,               /// 包含匹配
+	};
+
     static DataPrivate& Instance();
     ~DataPrivate();
 
@@ -684,6 +783,7 @@ public:
     ///
     AssayResults GetAssayResultByTestItem(const tf::TestItem& testItem);
     void SetRange(int first, int last) { m_rangVisble.SetRange(first, last); };
+    void SetVisibleRows(std::vector<int> rows) { m_rangVisble.SetRows(std::move(rows)); };
 
 	///
 	/// @brief 是否打印样本信息
@@ -801,6 +901,85 @@ public:
         return (iter == m_sampInfoData.end()) ? Q_NULLPTR : iter->second;
     };
 
+    ///
+    /// @brief 根据样本条码获取样本数据库主键（二级索引，精确匹配）
+    ///
+    /// @param[in]  barcode  样本条码
+    ///
+    /// @return 样本数据库主键列表（升序）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::vector<int64_t> GetSampleIdsByBarcode(const std::string& barcode) const;
+
+    ///
+    /// @brief 根据样本号获取样本数据库主键（二级索引，精确匹配）
+    ///
+    /// @param[in]  seqNo  样本号
+    ///
+    /// @return 样本数据库主键列表（升序）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::vector<int64_t> GetSampleIdsBySeqNo(const std::string& seqNo) const;
+
+    ///
+    /// @brief 根据架号和位置获取样本数据库主键（二级索引）
+    ///
+    /// @param[in]  rack  样本架号
+    /// @param[in]  pos   位置号
+    ///
+    /// @return 样本数据库主键列表（升序，架子复用时会有多个）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::vector<int64_t> GetSampleIdsByRackPos(const std::string& rack, int pos) const;
+
+    ///
+    /// @brief 通过二级索引检索样本
+    ///
+    /// @param[in]  keyType  关键字类型
+    /// @param[in]  mode     匹配方式
+    /// @param[in]  text     检索内容
+    ///
+    /// @return 样本数据库主键列表（升序）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::vector<int64_t> SearchSampleIds(SAMPLEKEY keyType, MATCHMODE mode, const std::string& text) const;
+
+    ///
+    /// @brief 根据当前展示模式的行号获取样本主键（不拷贝样本数据）
+    ///
+    /// @param[in]  row  行号（按项目展示时为项目行）
+    ///
+    /// @return 样本主键，无效时返回-1
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    int64_t GetSampleDbByRow(int row) const;
+
+    ///
+    /// @brief 批量登记前一次检查一组样本号/条码中是否已有对应的病人样本
+    ///
+    /// @param[in]  mode      样本所属模式
+    /// @param[in]  keyType   关键字类型（SEQNO或BARCODE）
+    /// @param[in]  keys      样本号/条码列表
+    /// @param[in]  isEmerge  是否急诊（只对样本号有效）
+    ///
+    /// @return 第一个已被使用的样本号/条码，没有时返回boost::none
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    boost::optional<std::string> FindFirstUsedKey(tf::TestMode::type mode, SAMPLEKEY keyType,
+        const std::vector<std::string>& keys, bool isEmerge) const;
+
     virtual std::shared_ptr<tf::TestItem> GetTestItemInfoByDb(int64_t db)
     {
         std::lock_guard<std::recursive_mutex> lockRead(m_readWriteLock);
@@ -833,12 +1012,24 @@ public:
     ///
     virtual std::shared_ptr<tf::SampleInfo> GetSampleByRackAndPsotion(tf::TestMode::type mode, std::string rack, int pos)
     {
-        for (const auto& sampleData :m_sampInfoData)
+        std::lock_guard<std::recursive_mutex> lockRead(m_readWriteLock);
+        // 通过架号位置索引查找（批量登记时会逐个位置调用）
+        auto iterIndex = m_rackPosIndex.find(std::make_pair(rack, pos));
+        if (iterIndex == m_rackPosIndex.end())
         {
-            auto sampleInfo = sampleData.second;
+            return Q_NULLPTR;
+        }
+
+        for (auto db : iterIndex->second)
+        {
+            auto iter = m_sampInfoData.find(db);
+            if (iter == m_sampInfoData.end() || iter->second == Q_NULLPTR)
+            {
+                continue;
+            }
+
+            auto sampleInfo = iter->second;
             if (sampleInfo->testMode == mode
-                && sampleInfo->rack == rack
-                && sampleInfo->pos == pos
 				// bug0013497
 				&& (sampleInfo->status == tf::SampleStatus::type::SAMPLE_STATUS_PENDING
 					|| sampleInfo->status == tf::SampleStatus::type::SAMPLE_STATUS_TESTING))
@@ -920,19 +1111,6 @@ public:
 	///  @li 7656/zhang.changjiang，2023年3月20日，新建函数
 	///
 	QVariant GetSampleDisplayData(SampleColumn::SAMPLEMODE mode, int row, int column);
-	
-	///
-	///  @brief 更新倒计时
-	///
-	///
-	///  @param[in]   itemId  项目id
-	///
-	///  @return	
-	///
-	///  @par History: 
-	///  @li 7656/zhang.changjiang，2023年3月20日，新建函数
-	///
-	void UpdateCountDown(int64_t itemId);
 
 	///
 	/// @brief 若项目正在运行，则开始推算项目测试完毕的倒计时
@@ -1172,10 +1350,51 @@ protected:
 	///
 	bool UpdateTestItemData(const ::tf::TestItem& srcData , std::shared_ptr<::tf::TestItem> dstData);
 
+    ///
+    /// @brief 将样本加入二级索引（调用者持有m_readWriteLock）
+    ///
+    /// @param[in]  sample  样本信息
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void IndexSample(const ::tf::SampleInfo& sample);
+
+    ///
+    /// @brief 将样本从二级索引中移除（调用者持有m_readWriteLock）
+    ///
+    /// @param[in]  sample  样本信息（需为建索引时的旧值）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void UnindexSample(const ::tf::SampleInfo& sample);
+
+    ///
+    /// @brief 清空二级索引（调用者持有m_readWriteLock）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void ClearSampleIndex();
+
+    ///
+    /// @brief 将行号按连续区间合并后发出变化通知（批量新增时整段插入）
+    ///
+    /// @param[in]  mode  变化类型
+    /// @param[in]  rows  行号列表
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void EmitRowRanges(ACTIONTYPE mode, std::vector<int> rows);
+
 Q_SIGNALS:
     void sampleChanged(ACTIONTYPE mode, int start, int end);
 	void testItemChanged(std::set<int64_t> datadbs);
 	void runAssayTimerChanged();
+	// 样本存储变化（增删改之后发出，携带受影响的样本主键，供架监控等视图订阅）
+	void sampleStoreChanged(ACTIONTYPE mode, std::set<int64_t> sampleDbs);
 private slots:
     ///
     /// @brief 样本信息更新
@@ -1209,6 +1428,22 @@ private slots:
 	/// @li 5774/WuHongTao，2023年9月15日，新建函数
 	///
 	void OnUpDateTestItemResultFlag();
+
+	///
+	/// @brief 样本显示设置变化后，按新的显示格式重建样本号（显示值）索引
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void RebuildShowSeqNoIndex();
+
+	///
+	/// @brief 处理合并后的新增样本（批量登记时同一轮事件循环内的多条新增消息只处理一次）
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	void FlushPendingAddSamples();
 private:
     std::map<int64_t, std::shared_ptr<tf::SampleInfo>>		m_sampInfoData;				// 样本数据
     std::vector<int64_t>					                m_samplePostionVec;			// 样本数据地图
@@ -1217,6 +1452,10 @@ private:
     mutable std::map<int64_t, AssayResults>					m_assayResults;				// 项目结果
     mutable std::recursive_mutex							m_readWriteLock;			// 模式的核心数据的读写锁
     std::map <int64_t, std::vector<int64_t>>				m_sampleMap;				// 样本地图（样本与项目关系--样本db--项目dbs）
+    SampleKeyIndex                                          m_barcodeIndex;             // 样本条码索引
+    SampleKeyIndex                                          m_seqNoIndex;               // 样本号索引（原始值）
+    SampleKeyIndex                                          m_showSeqNoIndex;           // 样本号索引（显示值）
+    std::map<std::pair<std::string, int>, std::set<int64_t>> m_rackPosIndex;            // 架号位置索引（架号+位置--样本dbs）
     std::set<int64_t>                                       m_selectedSampleMap;        // 数据浏览界面样本选中列表
     std::set<int64_t>                                       m_selectedItemMap;          // 数据浏览界面项目选中列表
 																       
@@ -1235,6 +1474,8 @@ private:
     friend class											QSampleAssayModel;
     friend class											QSampleDetailModel;
 	bool													m_needPrintSample;			///< 是否打印样本信息
+	std::vector<tf::SampleInfo>								m_pendingAddSamples;		///< 待合并处理的新增样本
+	bool													m_addFlushScheduled;		///< 是否已安排合并处理
 };
 
 class QSampleDetailModel : public QAbstractTableModel
@@ -1508,6 +1749,22 @@ public:
     bool ClearSelectedFlag(int mode);
     bool SetAllSelectedFlag(int mode);
     bool SetSelectFlag(int mode, int row, bool flag, bool isfromAll = false);
+
+    ///
+    /// @brief 登记使用本模型的页面（页面全部隐藏时延后修改类刷新）
+    ///
+    /// @param[in]  page  页面
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void WatchPage(QWidget* page) { m_updatePolicy.WatchPage(page); };
+
+    ///
+    /// @brief 获取页面更新策略（统计信息）
+    ///
+    const PageUpdatePolicy& GetUpdatePolicy() const { return m_updatePolicy; };
+
 protected:
 	QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
 	QSampleAssayModel();
@@ -1523,6 +1780,25 @@ private:
 
 	bool DoDataChanged(const QModelIndex& startIndex, const QModelIndex& endIndex);
 
+    ///
+    /// @brief 页面隐藏时记录修改的行（按数据库主键记录，行号可能因增删变化）
+    ///
+    /// @param[in]  start  起始行
+    /// @param[in]  end    结束行
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void DeferModifiedRows(int start, int end);
+
+    ///
+    /// @brief 页面显示时一次回放隐藏期间的修改
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnPageShown();
+
 	/// @brief 样本是否来着病人（其他则为校准品和质控品）
 	///
 	/// @param[in]  sample  样本信息
@@ -1558,4 +1834,6 @@ private:
 	mutable int64_t					m_currentRow;				///< 当前样本选择行
     mutable int                     m_sampleFilter;             ///< 样本过滤数
     std::atomic_bool				m_isDataChanged;			///< 是否发出了datchanged的消息，用于控制消息回环
+    PageUpdatePolicy                m_updatePolicy;             ///< 页面可见性更新策略
+    PendingChangeSet<int64_t, bool> m_pendingChanges;           ///< 页面隐藏期间修改的样本/项目主键
 };
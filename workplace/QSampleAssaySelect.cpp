@@ -44,6 +44,7 @@
 #include "shared/CReadOnlyDelegate.h"
 #include "shared/QComDelegate.h"
 #include "shared/QAssayTabWidgets.h"
+#include "shared/LatencyProfiler.h"
 #include "thrift/DcsControlProxy.h"
 
 #include "QSampleAssayModel.h"
@@ -78,6 +79,8 @@ QSampleAssaySelect::QSampleAssaySelect(QWidget *parent)
 {
     ui = new Ui::QSampleAssaySelect();
     ui->setupUi(this);
+    // 页面隐藏时延后表格刷新
+    QSampleAssayModel::Instance().WatchPage(this);
     // 初始化样本列表
     InitalSampleData();
     // 初始化样本属性
@@ -730,6 +733,48 @@ boost::optional<tf::SampleInfo> QSampleAssaySelect::GetCurrentSample()
     return boost::make_optional(sampQryResp.lstSampleInfos[0]);
 }
 
+///
+/// @brief 批量登记前一次检查整段样本号/条码是否已被使用，被使用时询问是否覆盖
+///
+/// @param[in]  startKey  起始样本号/条码
+/// @param[in]  count     样本数目
+/// @param[in]  tipText   覆盖提示
+///
+/// @return true:继续登记
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool QSampleAssaySelect::ConfirmBatchOverwrite(const cpp_int& startKey, int count, const QString& tipText)
+{
+    bool isBarcode = (m_sampleTestMode == tf::TestMode::type::BARCODE_MODE);
+    std::vector<std::string> keys;
+    keys.reserve(qMax(count, 0));
+    cpp_int key = startKey;
+    for (int i = 0; i < count; i++)
+    {
+        keys.push_back(key.str());
+        key++;
+
+        // 序号不能比最大编号大
+        if (!isBarcode && key >= cpp_int(MAXSEQNUM))
+        {
+            break;
+        }
+    }
+
+    auto keyType = isBarcode ? DataPrivate::SAMPLEKEY::BARCODE : DataPrivate::SAMPLEKEY::SEQNO;
+    auto usedKey = DataPrivate::Instance().FindFirstUsedKey(m_sampleTestMode, keyType, keys, ui->emerge_btn->isChecked());
+    if (!usedKey)
+    {
+        return true;
+    }
+
+    ULOG(LOG_INFO, "%s(used key: %s)", __FUNCTION__, usedKey.value());
+    std::shared_ptr<TipDlg> pTipDlg(new TipDlg(tipText, TipDlgType::TWO_BUTTON));
+    return (pTipDlg->exec() != QDialog::Rejected);
+}
+
 ///
 /// @brief 获取下一个合适的空序号（序号模式）
 ///
@@ -3239,32 +3284,9 @@ void QSampleAssaySelect::OnDealBatchInputSample()
         if (m_sampleTestMode == tf::TestMode::type::SEQNO_MODE || m_sampleTestMode == tf::TestMode::type::RACK_MODE)
         {
             // 判断是否存在被覆盖的样本
-            cpp_int startNo = startKey;
-            for (int i = 0; i < count; i++)
+            if (!ConfirmBatchOverwrite(startKey, count, tr("存在相同的样本号，会覆盖样本，同意?")))
             {
-                auto sampleData = DataPrivate::Instance().GetSampleBySeq(m_sampleTestMode, startNo.str(), tf::SampleType::SAMPLE_TYPE_PATIENT, ui->emerge_btn->isChecked());
-                if (sampleData.has_value())
-                {
-                    std::shared_ptr<TipDlg> pTipDlg(new TipDlg(tr("存在相同的样本号，会覆盖样本，同意?"), TipDlgType::TWO_BUTTON));
-                    if (pTipDlg->exec() == QDialog::Rejected)
-                    {
-                        return;
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
-
-                startNo++;
-
-                // 序号不能比最大编号大
-                if (startNo >= cpp_int(MAXSEQNUM))
-                {
-                    // 强制减小能够批量添加的样本数目
-                    // count = i;
-                    break;
-                }
+                return;
             }
 
             // 设置序号
@@ -3287,24 +3309,9 @@ void QSampleAssaySelect::OnDealBatchInputSample()
         if (m_sampleTestMode == tf::TestMode::type::BARCODE_MODE)
         {
             // 判断是否存在被覆盖的样本
-            cpp_int startBar = startKey;
-            for (int i = 0; i < count; i++)
+            if (!ConfirmBatchOverwrite(startKey, count, tr("存在相同的条码，会覆盖样本，同意?")))
             {
-                auto sampleData = DataPrivate::Instance().GetSampleByBarCode(m_sampleTestMode, startBar.str(), tf::SampleType::SAMPLE_TYPE_PATIENT);
-                if (sampleData.has_value())
-                {
-                    std::shared_ptr<TipDlg> pTipDlg(new TipDlg(tr("存在相同的条码，会覆盖样本，同意?"), TipDlgType::TWO_BUTTON));
-                    if (pTipDlg->exec() == QDialog::Rejected)
-                    {
-                        return;
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
-
-                startBar++;
+                return;
             }
 
             // 设置条码
@@ -3360,24 +3367,10 @@ void QSampleAssaySelect::OnDealBatchInputSample()
         // 序号模式/样本架模式
         if (m_sampleTestMode == tf::TestMode::type::SEQNO_MODE || m_sampleTestMode == tf::TestMode::type::RACK_MODE)
         {
-            cpp_int startNo = startKey;
-            while (startNo <= endKey)
+            // 判断是否存在被覆盖的样本
+            if (!ConfirmBatchOverwrite(startKey, count, tr("存在相同的样本号，会覆盖样本，同意?")))
             {
-                auto sampleData = DataPrivate::Instance().GetSampleBySeq(m_sampleTestMode, startNo.str(), tf::SampleType::SAMPLE_TYPE_PATIENT, ui->emerge_btn->isChecked());
-                if (sampleData.has_value())
-                {
-                    std::shared_ptr<TipDlg> pTipDlg(new TipDlg(tr("存在相同的样本号，会覆盖样本，同意?"), TipDlgType::TWO_BUTTON));
-                    if (pTipDlg->exec() == QDialog::Rejected)
-                    {
-                        return;
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
-
-                startNo++;
+                return;
             }
 
             sampleInfo.__set_seqNo(startKey.str());
@@ -3424,24 +3417,10 @@ void QSampleAssaySelect::OnDealBatchInputSample()
         // 条码模式
         if (m_sampleTestMode == tf::TestMode::type::BARCODE_MODE)
         {
-            cpp_int startBar = startKey;
-            while (startBar <= endKey)
+            // 判断是否存在被覆盖的样本
+            if (!ConfirmBatchOverwrite(startKey, count, tr("存在相同的样本条码，会覆盖样本，同意?")))
             {
-                auto sampleData = DataPrivate::Instance().GetSampleByBarCode(m_sampleTestMode, startBar.str(), tf::SampleType::SAMPLE_TYPE_PATIENT);
-                if (sampleData.has_value())
-                {
-                    std::shared_ptr<TipDlg> pTipDlg(new TipDlg(tr("存在相同的样本条码，会覆盖样本，同意?"), TipDlgType::TWO_BUTTON));
-                    if (pTipDlg->exec() == QDialog::Rejected)
-                    {
-                        return;
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
-
-                startBar++;
+                return;
             }
 
             sampleInfo.__set_barcode(startKey.str());
@@ -4186,6 +4165,7 @@ QSampleFilter::~QSampleFilter()
 
 bool QSampleFilter::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
 {
+    LATENCY_SCOPE_SAMPLED("workplace.filterRow", 16);
 
     auto sample = DataPrivate::Instance().GetSampleByRow(sourceRow);
     if (sample.has_value() && sample->sampleType == tf::SampleType::type::SAMPLE_TYPE_PATIENT)
@@ -4214,6 +4194,7 @@ boost::optional<tf::SampleInfo> QSampleFilter::GetSampleByIndex(const QModelInde
 
 bool QSampleFilter::lessThan(const QModelIndex & source_left, const QModelIndex & source_right) const
 {
+    LATENCY_SCOPE_SAMPLED("workplace.sortCompare", 16);
     // 获取源model
     QSampleAssayModel* pSouceModel = dynamic_cast<QSampleAssayModel*>(sourceModel());
     if (pSouceModel == nullptr)
@@ -189,6 +189,20 @@ protected:
     ///
     cpp_int GetRightSeqNo(cpp_int start);
 
+    ///
+    /// @brief 批量登记前一次检查整段样本号/条码是否已被使用，被使用时询问是否覆盖
+    ///
+    /// @param[in]  startKey  起始样本号/条码
+    /// @param[in]  count     样本数目
+    /// @param[in]  tipText   覆盖提示
+    ///
+    /// @return true:继续登记
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool ConfirmBatchOverwrite(const cpp_int& startKey, int count, const QString& tipText);
+
     ///
     /// @brief 鼠标点击事件
     ///
@@ -60,8 +60,10 @@
 #include <QCheckBox>
 #include <QProgressBar>
 #include <QScroller>
+#include <unordered_set>
 
 #include "shared/CommonInformationManager.h"
+#include "shared/LatencyProfiler.h"
 #include "shared/uicommon.h"
 #include "shared/uidef.h"
 #include "shared/tipdlg.h"
@@ -72,6 +74,7 @@
 #include "shared/ThriftEnumTransform.h"
 #include "shared/FileExporter.h"
 #include "shared/DataManagerQc.h"
+#include "shared/ResultDetailCache.h"
 
 #include "thrift/DcsControlProxy.h"
 #include "thrift/im/i6000/I6000LogicControlProxy.h"
@@ -107,6 +110,9 @@ if ((bErr))\
 	return;\
 }
 
+// 结果详情前后预取的行数
+#define DETAIL_PREFETCH_ROWS            (2)
+
 QSampleDataBrowse::QSampleDataBrowse(QWidget *parent)
     : QWorkShellPage(parent),
     m_sampleDetailDialog(Q_NULLPTR),
@@ -133,6 +139,8 @@ QSampleDataBrowse::QSampleDataBrowse(QWidget *parent)
     ui->setupUi(this);
     m_pPrintSetDlg = nullptr;
     Init();
+    // 页面隐藏时延后表格刷新
+    QSampleAssayModel::Instance().WatchPage(this);
 }
 
 QSampleDataBrowse::~QSampleDataBrowse()
@@ -167,6 +175,7 @@ void QSampleDataBrowse::RefreshCornerWidgets(int index)
     if (m_filterModule == nullptr)
     {
         m_filterModule = new QSampleFilterDataModule();
+        ConnectVisibleRowsRefresh();
     }
     m_filterModule->setSourceModel(&QSampleAssayModel::Instance());
     ui->sample_list->setModel(m_filterModule);
@@ -1313,6 +1322,7 @@ void QSampleDataBrowse::SetSampleBrowseModel()
     {
         QSampleAssayModel::Instance().SetSampleModuleType(QSampleAssayModel::VIEWMOUDLE::DATABROWSE);
         m_filterModule = new QSampleFilterDataModule(ui->sample_list);
+        ConnectVisibleRowsRefresh();
         m_filterModule->setSourceModel(&QSampleAssayModel::Instance());
     }
 
@@ -2039,6 +2049,7 @@ void QSampleDataBrowse::OnShowFilterSampleInfo()
     if (m_filterModule == nullptr)
     {
         m_filterModule = new QSampleFilterDataModule(/*ui->sample_list*/);
+        ConnectVisibleRowsRefresh();
         m_filterModule->setSourceModel(&QSampleAssayModel::Instance());
         ui->sample_list->setModel(m_filterModule);
     }
@@ -2466,6 +2477,9 @@ bool QSampleDataBrowse::ShowSampleDetail(ItemResultDetailDlg* dialog)
         {
             dialog->SetSampleId(stuSelSampleInfo->id, testItems, false, false);
         }
+
+        // 预取相邻样本的结果，翻页时不再等待查询
+        PrefetchDetailNeighbours(pSampleProxyModel, SelModIndex);
     }
     // 按项目展示
     else
@@ -2524,11 +2538,69 @@ bool QSampleDataBrowse::ShowSampleDetail(ItemResultDetailDlg* dialog)
         {
             dialog->SetSampleId(testItemInfo->sampleInfoId, testItems, false, false);
         }
+
+        // 预取相邻项目的结果，翻页时不再等待查询
+        PrefetchDetailNeighbours(pSampleProxyModel, SelModIndex);
     }
 
     return true;
 }
 
+///
+/// @brief 按当前的排序和筛选顺序，异步预取结果详情中相邻行的结果
+///
+/// @param[in]  proxyModel  当前显示的代理模型
+/// @param[in]  current     当前行
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QSampleDataBrowse::PrefetchDetailNeighbours(QSampleFilterDataModule* proxyModel, const QModelIndex& current)
+{
+    if (proxyModel == Q_NULLPTR || !current.isValid())
+    {
+        return;
+    }
+
+    bool bySample = (QSampleAssayModel::Instance().GetModule() == QSampleAssayModel::VIEWMOUDLE::DATABROWSE);
+    std::vector<std::shared_ptr<tf::TestItem>> testItems;
+    for (int offset = -DETAIL_PREFETCH_ROWS; offset <= DETAIL_PREFETCH_ROWS; offset++)
+    {
+        int row = current.row() + offset;
+        if (row < 0 || row >= proxyModel->rowCount())
+        {
+            continue;
+        }
+
+        auto index = proxyModel->index(row, current.column());
+        // 按样本展示，当前样本的其他项目也要预取（对话框中切换项目时使用）
+        if (bySample)
+        {
+            auto sample = proxyModel->GetSampleByIndex(index);
+            if (!sample)
+            {
+                continue;
+            }
+
+            auto sampleItems = DataPrivate::Instance().GetSampleTestItems(sample->id);
+            testItems.insert(testItems.end(), sampleItems.begin(), sampleItems.end());
+        }
+        // 按项目展示，当前项目已经同步查询过
+        else if (offset != 0)
+        {
+            auto testItem = proxyModel->GetTestItemByIndex(index);
+            if (!testItem)
+            {
+                continue;
+            }
+
+            testItems.push_back(std::make_shared<tf::TestItem>(testItem.value()));
+        }
+    }
+
+    ResultDetailCache::GetInstance().PrefetchTestItems(testItems);
+}
+
 ///
 /// @brief 获取当前选中的项目的索引
 ///
@@ -6663,6 +6735,7 @@ void QSampleDataBrowse::OnShowBySample()
     if (m_filterModule == nullptr)
     {
         m_filterModule = new QSampleFilterDataModule(/*ui->sample_list*/);
+        ConnectVisibleRowsRefresh();
     }
 
     m_pageChange = true;
@@ -6701,6 +6774,7 @@ void QSampleDataBrowse::OnShowByAssay()
     if (m_filterModule == nullptr)
     {
         m_filterModule = new QSampleFilterDataModule(/*ui->show_assay_list*/);
+        ConnectVisibleRowsRefresh();
     }
 
 	ui->show_assay_list->setFocus();
@@ -7494,15 +7568,41 @@ boost::optional<int> QSampleDataBrowse::GetIndexSearch(bool direction, int start
         column = barCodeColumn.value().first;
     }
 
+    // 先通过样本存储的包含匹配索引得到命中的样本，逐行时只需判断主键，不再格式化每行的显示内容
+    // 空关键字时每行都命中（与逐行判断一致，包括关键字为空的样本），不使用索引
+    bool useIndex = !keyWord.isEmpty();
+    std::unordered_set<int64_t> hitSet;
+    if (useIndex)
+    {
+        auto keyType = (type == 0) ? DataPrivate::SAMPLEKEY::SHOWSEQNO : DataPrivate::SAMPLEKEY::BARCODE;
+        auto hitDbs = DataPrivate::Instance().SearchSampleIds(keyType, DataPrivate::MATCHMODE::CONTAINS, keyWord.toStdString());
+        if (hitDbs.empty())
+        {
+            return boost::none;
+        }
+
+        hitSet.insert(hitDbs.begin(), hitDbs.end());
+    }
+
+    auto isHit = [&](int row)->bool
+    {
+        QModelIndex sourceIndex = m_filterModule->mapToSource(m_filterModule->index(row, column));
+        if (useIndex && hitSet.count(DataPrivate::Instance().GetSampleDbByRow(sourceIndex.row())) == 0)
+        {
+            return false;
+        }
+
+        QString data = QSampleAssayModel::Instance().data(sourceIndex, Qt::DisplayRole).toString();
+        return data.contains(keyWord);
+    };
+
     if (direction)
     {
         int findTime = 0;
 		// modify by wuht for bug3508
         for (int row = (start == -1)?0:(start + 1); row < m_filterModule->rowCount(); ++row)
         {
-            QModelIndex sourceIndex = m_filterModule->mapToSource(m_filterModule->index(row, column));
-            QString data = QSampleAssayModel::Instance().data(sourceIndex, Qt::DisplayRole).toString();
-            if (data.contains(keyWord))
+            if (isHit(row))
             {
                 QModelIndex proxyIndex = m_filterModule->index(row, 0);
                 return proxyIndex.row();
@@ -7515,9 +7615,7 @@ boost::optional<int> QSampleDataBrowse::GetIndexSearch(bool direction, int start
 			// modify by wuht for bug3508
         for (int row = (start < 1) ? 0 : (start - 1); row >= 0; --row)
         {
-            QModelIndex sourceIndex = m_filterModule->mapToSource(m_filterModule->index(row, column));
-            QString data = QSampleAssayModel::Instance().data(sourceIndex, Qt::DisplayRole).toString();
-            if (data.contains(keyWord))
+            if (isHit(row))
             {
                 QModelIndex proxyIndex = m_filterModule->index(row, 0);
                 return proxyIndex.row();
@@ -7576,7 +7674,57 @@ void QSampleDataBrowse::OnChangedRow(int value)
         lastVisibleRow = rowCount;
     }
 
-    DataPrivate::Instance().SetRange(firstVisibleRow, lastVisibleRow);
+    // 视图行经过排序过滤，逐行转换为源模型的行（倒计时按源模型行刷新，排序后不连续）
+    auto proxyModel = qobject_cast<QSortFilterProxyModel*>(model);
+    if (proxyModel == Q_NULLPTR)
+    {
+        DataPrivate::Instance().SetRange(firstVisibleRow, lastVisibleRow);
+        return;
+    }
+
+    std::vector<int> sourceRows;
+    for (int row = firstVisibleRow; row <= lastVisibleRow; row++)
+    {
+        auto sourceIndex = proxyModel->mapToSource(proxyModel->index(row, 0));
+        if (sourceIndex.isValid())
+        {
+            sourceRows.push_back(sourceIndex.row());
+        }
+    }
+
+    DataPrivate::Instance().SetVisibleRows(std::move(sourceRows));
+}
+
+///
+/// @brief 过滤模型重新排序、重置或增删行后，重新计算可见行
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QSampleDataBrowse::OnVisibleRowsInvalidated()
+{
+    OnChangedRow(0);
+}
+
+///
+/// @brief 关联过滤模型的行变化信号，可见行对应的源模型行随之更新
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void QSampleDataBrowse::ConnectVisibleRowsRefresh()
+{
+    if (m_filterModule == Q_NULLPTR)
+    {
+        return;
+    }
+
+    // 排队执行，等视图处理完模型变化后再取可见行
+    auto type = static_cast<Qt::ConnectionType>(Qt::QueuedConnection | Qt::UniqueConnection);
+    connect(m_filterModule, &QAbstractItemModel::layoutChanged, this, &QSampleDataBrowse::OnVisibleRowsInvalidated, type);
+    connect(m_filterModule, &QAbstractItemModel::modelReset, this, &QSampleDataBrowse::OnVisibleRowsInvalidated, type);
+    connect(m_filterModule, &QAbstractItemModel::rowsInserted, this, &QSampleDataBrowse::OnVisibleRowsInvalidated, type);
+    connect(m_filterModule, &QAbstractItemModel::rowsRemoved, this, &QSampleDataBrowse::OnVisibleRowsInvalidated, type);
 }
 
 ///
@@ -7955,6 +8103,8 @@ QSampleFilterDataModule::~QSampleFilterDataModule()
 
 bool QSampleFilterDataModule::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
 {
+	LATENCY_SCOPE_SAMPLED("workplace.filterRow", 16);
+
 	// 按项目展示
 	if (QSampleAssayModel::Instance().GetModule() == QSampleAssayModel::VIEWMOUDLE::ASSAYBROWSE)
 	{
@@ -8087,6 +8237,8 @@ boost::optional<tf::TestItem> QSampleFilterDataModule::GetTestItemByIndex(const
 ///
 bool QSampleFilterDataModule::lessThan(const QModelIndex & source_left, const QModelIndex & source_right) const
 {
+	LATENCY_SCOPE_SAMPLED("workplace.sortCompare", 16);
+
 	// 获取源model
 	QSampleAssayModel* pSouceModel = dynamic_cast<QSampleAssayModel*>(sourceModel());
 	if (pSouceModel == nullptr)
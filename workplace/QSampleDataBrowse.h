@@ -406,6 +406,17 @@ protected:
     ///
     bool ShowSampleDetail(ItemResultDetailDlg* dialog);
 
+    ///
+    /// @brief 按当前的排序和筛选顺序，异步预取结果详情中相邻行的结果
+    ///
+    /// @param[in]  proxyModel  当前显示的代理模型
+    /// @param[in]  current     当前行
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void PrefetchDetailNeighbours(QSampleFilterDataModule* proxyModel, const QModelIndex& current);
+
     ///
     /// @brief 获取当前选中的项目的索引
     ///
@@ -870,6 +881,14 @@ public slots:
     ///
     void OnChangedRow(int value);
 
+    ///
+    /// @brief 过滤模型重新排序、重置或增删行后，重新计算可见行
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void OnVisibleRowsInvalidated();
+
     ///
     /// @brief 处理样本审核状态改变消息
     ///
@@ -938,6 +957,14 @@ private:
     ///
     void ProcOnSelectAll(QCheckBox* pCheck, QTableView* tbView, int sFlag);
 
+    ///
+    /// @brief 关联过滤模型的行变化信号，可见行对应的源模型行随之更新
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void ConnectVisibleRowsRefresh();
+
     ///
     /// @bref
     ///		处理排序的响应函数
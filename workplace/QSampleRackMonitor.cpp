@@ -277,7 +277,8 @@ QRackMonitorModel::QRackMonitorModel(QObject *parent, int rowCount)
 
     m_rackData = FixedVector<CoreData>(m_rowCount, initFunc);
     m_headrData << "" << "5" << "4" << "3" << "2" << "1";
-	REGISTER_HANDLER(MSG_ID_SAMPLE_INFO_UPDATE, this, OnSampleInfoUpdate);
+	// 样本数据统一由DataPrivate维护，架监控只记录位置并订阅其变化
+	connect(&DataPrivate::Instance(), &DataPrivate::sampleStoreChanged, this, &QRackMonitorModel::OnSampleStoreChanged);
 }
 
 QRackMonitorModel::~QRackMonitorModel()
@@ -340,8 +341,6 @@ bool QRackMonitorModel::AddNewRackInfo(CoreData& coreData)
 		}
 
 		ULOG(LOG_INFO, "%s(add sample id: %d : status: %d)", __FUNCTION__, sampleInfo->id, sampleInfo->status);
-		// 执行添加
-		m_sampleMap[sampleInfo->id] = sampleInfo;
 	}
 
 	// 刷新样本位置信息
@@ -378,16 +377,9 @@ bool QRackMonitorModel::AddNewRackInfo(CoreData& coreData)
 		}
 
 		ULOG(LOG_INFO, "%s(popUp sample id: %d : status: %d)", __FUNCTION__, sampleInfo->id, sampleInfo->status);
-		// 执行删除
-		auto iter = m_sampleMap.find(sampleInfo->id);
-		if (iter != m_sampleMap.end())
-		{
-			m_sampleMap.erase(iter);
-		}
-
-		// 删除位置信息
+		// 删除位置信息（只删除仍指向被弹出行的记录，样本可能已出现在新架上）
 		auto iterPos = m_samplePostion.find(sampleInfo->id);
-		if (iterPos != m_samplePostion.end())
+		if (iterPos != m_samplePostion.end() && iterPos->second.first >= m_rowCount)
 		{
 			m_samplePostion.erase(iterPos);
 		}
@@ -404,14 +396,20 @@ const CoreData QRackMonitorModel::GetCurrentRackData(int row)
         return std::move(std::make_pair("", innerData));
     }
 
-    return m_rackData[row];
+    // 返回存储中的最新样本数据
+    auto rackData = m_rackData[row];
+    for (auto& sampleData : rackData.second)
+    {
+        sampleData = ResolveSample(sampleData);
+    }
+
+    return rackData;
 }
 
 bool QRackMonitorModel::Clear()
 {
     this->beginResetModel();
     m_rackData.Reset();
-	m_sampleMap.clear();
 	m_samplePostion.clear();
     this->endResetModel();
     return true;
@@ -433,67 +431,87 @@ boost::optional<QModelIndex> QRackMonitorModel::FindSample(const std::tuple<std:
 
 	ULOG(LOG_INFO, "%s(find sampleInfo rack:%s, barCode:%s, seqNO:%s)", __FUNCTION__, firstCond, secondCond, thirdCond);
 
-	int i = 0;
-	do 
+	// 有条码或样本号时，通过样本存储的二级索引定位，再映射到架上位置
+	if (!firstCond.empty() || !secondCond.empty())
 	{
-		// 获取每行的样本
-		auto datas = GetCurrentRackData(i);
-		// 当first为空的时候，代表此行为空
-		if (datas.first.empty())
-		{
-			i++;
-			continue;
-		}
+		auto candidates = !firstCond.empty() ? DataPrivate::Instance().GetSampleIdsByBarcode(firstCond)
+			: DataPrivate::Instance().GetSampleIdsBySeqNo(secondCond);
 
-		// 若有架号，必须首先判断架
-		if (!thirdCond.empty() && datas.first != thirdCond)
+		// 与逐行扫描保持一致：行号小的优先，同行内架内序号小的优先
+		boost::optional<std::pair<int, int>> foundPos = boost::none;
+		for (auto db : candidates)
 		{
-			i++;
-			continue;
-		}
-
-		// 若架号相同，并且其他两个条件都为空，则直接返回当前架号
-		if (firstCond.empty() && secondCond.empty())
-		{
-			m_selectedIndex = this->index(i, 0);
-			return m_selectedIndex;
-		}
-
-		int column = 5;
-		// 依次处理每个样本数据
-		for (auto& sampleData : datas.second)
-		{
-			if (column <= 0)
+			auto iterPos = m_samplePostion.find(db);
+			if (iterPos == m_samplePostion.end())
 			{
 				continue;
 			}
 
-			if (!sampleData)
+			const auto& postion = iterPos->second;
+			if (postion.first < 0 || postion.first >= m_rowCount)
 			{
-				column--;
 				continue;
 			}
 
-			// 样本条码
-			if (!firstCond.empty() && sampleData->barcode != firstCond)
+			// 若有架号，必须首先判断架
+			auto datas = m_rackData[postion.first];
+			if (!thirdCond.empty() && datas.first != thirdCond)
 			{
-				column--;
 				continue;
 			}
 
-			// 样本号
-			if (!secondCond.empty() && sampleData->seqNo != secondCond)
+			// 条码和样本号同时给出时，样本号也要满足
+			if (!firstCond.empty() && !secondCond.empty())
 			{
-				column--;
-				continue;
+				if (postion.second >= datas.second.size())
+				{
+					continue;
+				}
+
+				auto sampleData = ResolveSample(datas.second[postion.second]);
+				if (!sampleData || sampleData->seqNo != secondCond)
+				{
+					continue;
+				}
 			}
 
-			// 所有条件都满足，则返回
-			m_selectedIndex = this->index(i, column);
-			return m_selectedIndex;
+			if (!foundPos || postion < foundPos.value())
+			{
+				foundPos = postion;
+			}
+		}
+
+		if (!foundPos)
+		{
+			return boost::none;
+		}
+
+		m_selectedIndex = this->index(foundPos->first, COLUMN - 1 - foundPos->second);
+		return m_selectedIndex;
+	}
+
+	int i = 0;
+	do 
+	{
+		// 获取每行的样本
+		auto datas = m_rackData[i];
+		// 当first为空的时候，代表此行为空
+		if (datas.first.empty())
+		{
+			i++;
+			continue;
 		}
 
-		i++;
+		// 若有架号，必须首先判断架
+		if (!thirdCond.empty() && datas.first != thirdCond)
+		{
+			i++;
+			continue;
+		}
+
+		// 只按架号查找，直接返回当前架号
+		m_selectedIndex = this->index(i, 0);
+		return m_selectedIndex;
 	} while (i < m_rowCount);
 
 	return boost::none;
@@ -661,7 +679,7 @@ QVariant QRackMonitorModel::data(const QModelIndex &index, int role) const
 				{
 					return QVariant();
 				}
-				auto sampleData = m_rackData[row].second[5 - column];
+				auto sampleData = ResolveSample(m_rackData[row].second[5 - column]);
 
 				// 判断当前Item是否被选中
 				bool isSelected = false;
@@ -811,50 +829,62 @@ bool QRackMonitorModel::IsPipeLine() const
 }
 
 ///
-/// @brief 更新样本信息
+/// @brief 从共享样本存储中解析架位上样本的最新数据
+///
+/// @param[in]  slotSample  架位记录的样本（扫描失败或存储中已不存在时直接返回）
+///
+/// @return 样本的最新数据
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+SampleData QRackMonitorModel::ResolveSample(const SampleData& slotSample) const
+{
+	if (slotSample == Q_NULLPTR || slotSample->id <= 0)
+	{
+		return slotSample;
+	}
+
+	auto spSample = DataPrivate::Instance().GetSampleInfoByDb(slotSample->id);
+	return (spSample == Q_NULLPTR) ? slotSample : spSample;
+}
+
+///
+/// @brief 共享样本存储变化，只刷新架上受影响的样本格
 ///
-/// @param[in]  enUpdateType  更新类型（删除，增加）-只处理修改  
-/// @param[in]  vSIs  样本
+/// @param[in]  mode  变化类型
+/// @param[in]  sampleDbs  受影响的样本主键
 ///
 /// @par History:
 /// @li 5774/WuHongTao，2023年11月28日，新建函数
+/// @li 5774/WuHongTao，2026年10月19日，改为订阅DataPrivate的样本存储
 ///
-void QRackMonitorModel::OnSampleInfoUpdate(tf::UpdateType::type enUpdateType, std::vector<tf::SampleInfo, std::allocator<tf::SampleInfo>> vSIs)
+void QRackMonitorModel::OnSampleStoreChanged(DataPrivate::ACTIONTYPE mode, std::set<int64_t> sampleDbs)
 {
-	ULOG(LOG_INFO, "%s(operation type: %d content: %s)", __FUNCTION__, enUpdateType, ToString(vSIs));
-	if (enUpdateType != tf::UpdateType::type::UPDATE_TYPE_MODIFY)
+	// 新增的样本还未上架，无需处理
+	if (mode == DataPrivate::ACTIONTYPE::ADDSAMPLE || m_samplePostion.empty())
 	{
 		return;
 	}
 
-	for (const auto& sample : vSIs)
+	for (auto db : sampleDbs)
 	{
-		auto iter = m_sampleMap.find(sample.id);
-		if (iter == m_sampleMap.end())
+		auto iterPos = m_samplePostion.find(db);
+		if (iterPos == m_samplePostion.end())
 		{
 			continue;
 		}
 
-		// 状态改变
-		if (!sample.__isset.status)
+		int row = iterPos->second.first;
+		// 架内序号0~4对应列5~1
+		int column = COLUMN - 1 - iterPos->second.second;
+		if (row < 0 || row >= m_rowCount || column <= 0)
 		{
 			continue;
 		}
 
-		// 若状态有变化才更新
-		auto saveSample = iter->second;
-		ULOG(LOG_INFO, "%s(sample id: (old status: %d -- new status: %d))", __FUNCTION__, saveSample->id, saveSample->status, sample.status);
-		if (saveSample->status != sample.status)
-		{
-			iter->second->__set_status(sample.status);
-		}
-	}
-
-	for (int i = 0; i < m_rowCount; i++)
-	{
-		auto indexstart = this->index(i, 0);
-		auto indexend = this->index(i, this->columnCount(QModelIndex()) - 1);
-		emit dataChanged(indexstart, indexend, { Qt::DisplayRole });
+		auto index = this->index(row, column);
+		emit dataChanged(index, index, { Qt::DisplayRole });
 	}
 }
 
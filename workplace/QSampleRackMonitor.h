@@ -48,6 +48,7 @@
 #include <QWidget>
 #include <QAbstractTableModel>
 #include "QWorkShellPage.h"
+#include "QSampleAssayModel.h"
 #include "boost/optional.hpp"
 #include "thrift/DcsControlProxy.h"
 #include <QPixmap>
@@ -255,25 +256,37 @@ protected:
     QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
 	bool IsPipeLine() const;
 
+	///
+	/// @brief 从共享样本存储中解析架位上样本的最新数据
+	///
+	/// @param[in]  slotSample  架位记录的样本（扫描失败或存储中已不存在时直接返回）
+	///
+	/// @return 样本的最新数据
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	SampleData ResolveSample(const SampleData& slotSample) const;
+
 protected slots:
 	///
-	/// @brief 更新样本信息
+	/// @brief 共享样本存储变化，只刷新架上受影响的样本格
 	///
-	/// @param[in]  enUpdateType  更新类型（删除，增加）-只处理修改  
-	/// @param[in]  vSIs  样本
+	/// @param[in]  mode  变化类型
+	/// @param[in]  sampleDbs  受影响的样本主键
 	///
 	/// @par History:
 	/// @li 5774/WuHongTao，2023年11月28日，新建函数
+	/// @li 5774/WuHongTao，2026年10月19日，改为订阅DataPrivate的样本存储
 	///
-	void OnSampleInfoUpdate(tf::UpdateType::type enUpdateType, std::vector<tf::SampleInfo, std::allocator<tf::SampleInfo>> vSIs);
+	void OnSampleStoreChanged(DataPrivate::ACTIONTYPE mode, std::set<int64_t> sampleDbs);
 
 private:
     FixedVector<CoreData>           m_rackData;
     int                             m_rowCount;
     QStringList                     m_headrData;
 	boost::optional<QModelIndex>	m_selectedIndex;
-	std::map<int64_t, std::shared_ptr<tf::SampleInfo>> m_sampleMap;
-	std::map<int64_t, std::pair<int, int>> m_samplePostion;
+	std::map<int64_t, std::pair<int, int>> m_samplePostion;	///< 样本位置索引（样本db--行，架内序号）
 };
 
 class QSampleRackMonitorShell : public QWidget
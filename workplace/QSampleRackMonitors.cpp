@@ -507,8 +507,8 @@ void QSampleRackMonitors::OnUpdateRecyCleRackInfo(const int trayNo, std::vector<
 			}
 
 			ULOG(LOG_INFO, "%s(%d - %d)", __FUNCTION__, rackInfo.first, recycleSampleInfo.id);
-			// 更新架中样本数据
-			sampleDataVec[rackInfo.first - 1] = std::make_shared<tf::SampleInfo>(*spSample);
+			// 更新架中样本数据（直接引用样本存储中的数据，不再另行拷贝）
+			sampleDataVec[rackInfo.first - 1] = spSample;
 		}
 
 		data.second = sampleDataVec;
@@ -545,7 +545,7 @@ QSampleModel::QSampleModel(QObject *parent /*= Q_NULLPTR*/, int rowCount /*= 5*/
 {
     m_headrData << tr("位置") << tr("样本条码") << tr("样本号") << tr("样本类型") << tr("状态") /*<< tr("异常原因")*/;
     m_sampleData.assign(MAXPOSNUMER, Q_NULLPTR);
-	REGISTER_HANDLER(MSG_ID_SAMPLE_INFO_UPDATE, this, OnUpdateSample);
+	connect(&DataPrivate::Instance(), &DataPrivate::sampleStoreChanged, this, &QSampleModel::OnUpdateSample);
 }
 
 QVariant QSampleModel::GetDispaly(SampleData& sampleInfo, int column) const
@@ -664,16 +664,16 @@ QVariant QSampleModel::data(const QModelIndex &index, int role) const
     return QVariant();
 }
 
-void QSampleModel::OnUpdateSample(tf::UpdateType::type enUpdateType, std::vector<tf::SampleInfo, std::allocator<tf::SampleInfo>> vSIs)
+void QSampleModel::OnUpdateSample(DataPrivate::ACTIONTYPE mode, std::set<int64_t> sampleDbs)
 {
-	if (enUpdateType != tf::UpdateType::type::UPDATE_TYPE_MODIFY)
+	if (mode != DataPrivate::ACTIONTYPE::MODIFYSAMPLE)
 	{
 		return;
 	}
 
-	for (const auto& sample : vSIs)
+	for (auto db : sampleDbs)
 	{
-		auto iter = m_sampleMap.find(sample.id);
+		auto iter = m_sampleMap.find(db);
 		if (iter == m_sampleMap.end())
 		{
 			continue;
@@ -685,7 +685,14 @@ void QSampleModel::OnUpdateSample(tf::UpdateType::type enUpdateType, std::vector
 			continue;
 		}
 
-		m_sampleData[row] = std::make_shared<tf::SampleInfo>(sample);
+		// 直接引用样本存储中的最新数据
+		auto spSample = DataPrivate::Instance().GetSampleInfoByDb(db);
+		if (spSample == Q_NULLPTR)
+		{
+			continue;
+		}
+
+		m_sampleData[row] = spSample;
 		auto indexstart = this->index(row, 0);
 		auto indexend = this->index(row, this->columnCount(QModelIndex()) - 1);
 		emit dataChanged(indexstart, indexend, { Qt::DisplayRole });
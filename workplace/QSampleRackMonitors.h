@@ -51,6 +51,7 @@
 #include "src/thrift/track/gen-cpp/track_types.h"
 #include "src/public/ConfigSerialize.h"
 #include "QWorkShellPage.h"
+#include "QSampleAssayModel.h"
 
 class QSampleModel :public QAbstractTableModel
 {
@@ -119,14 +120,16 @@ public:
 
 protected slots:
 	///
-	/// @brief 更新显示样本的槽函数
+	/// @brief 更新显示样本的槽函数（订阅DataPrivate的样本存储）
 	///  
-	/// @param[in]  vSIs  样本改变列表的信息
+	/// @param[in]  mode       变化类型
+	/// @param[in]  sampleDbs  受影响的样本主键
 	///
 	/// @par History:
 	/// @li 5774/WuHongTao，2024年1月11日，新建函数
+	/// @li 5774/WuHongTao，2026年10月19日，改为订阅DataPrivate的样本存储
 	///
-	void OnUpdateSample(tf::UpdateType::type enUpdateType, std::vector<tf::SampleInfo, std::allocator<tf::SampleInfo>> vSIs);
+	void OnUpdateSample(DataPrivate::ACTIONTYPE mode, std::set<int64_t> sampleDbs);
 
 protected:
     int rowCount(const QModelIndex &parent) const override { return m_rowCount; };
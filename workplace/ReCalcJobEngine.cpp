@@ -0,0 +1,295 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     ReCalcJobEngine.cpp
+/// @brief    重新计算的后台任务（分块并行计算、保存，支持进度和取消）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#include "ReCalcJobEngine.h"
+#include <algorithm>
+#include <QCoreApplication>
+#include <QtConcurrent/QtConcurrent>
+#include "thrift/im/i6000/I6000LogicControlProxy.h"
+#include "thrift/im/ImLogicControlProxy.h"
+#include "src/common/Mlog/mlog.h"
+
+// 工作线程数
+#define RECALC_JOB_THREADS              (2)
+// 每块的结果数
+#define RECALC_JOB_CHUNK_SIZE           (100)
+
+ReCalcJobEngine::ReCalcJobEngine(QObject* parent)
+    : QObject(parent)
+{
+    qRegisterMetaType<std::vector<im::tf::AssayTestResult>>("std::vector<im::tf::AssayTestResult>");
+}
+
+ReCalcJobEngine::~ReCalcJobEngine()
+{
+    // 只取消、不等待，正在处理的块结束后不再发送信号
+    Cancel();
+    if (m_job != nullptr)
+    {
+        std::lock_guard<std::mutex> lock(m_job->mtx);
+        m_job->owner = nullptr;
+    }
+}
+
+///
+/// @brief 开始重新计算
+///
+/// @param[in]  results  待计算的结果
+/// @param[in]  reag     使用的试剂（校准曲线）
+///
+/// @return true:任务已开始，false:有任务正在执行或结果为空
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool ReCalcJobEngine::StartReCalc(const std::vector<im::tf::AssayTestResult>& results, const im::tf::ReagentInfoTable& reag)
+{
+    return Start(JOB_RECALC, results, reag);
+}
+
+///
+/// @brief 开始保存计算结果
+///
+/// @param[in]  results  已计算的结果
+///
+/// @return true:任务已开始，false:有任务正在执行或结果为空
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool ReCalcJobEngine::StartSave(const std::vector<im::tf::AssayTestResult>& results)
+{
+    return Start(JOB_SAVE, results, im::tf::ReagentInfoTable());
+}
+
+///
+/// @brief 取消当前任务（正在处理的块完成后停止）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ReCalcJobEngine::Cancel()
+{
+    if (IsRunning())
+    {
+        ULOG(LOG_INFO, "%s(type: %d)", __FUNCTION__, int(m_job->type));
+        m_job->cancel = true;
+    }
+}
+
+///
+/// @brief 开始任务，把结果分块放入线程池
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+bool ReCalcJobEngine::Start(JOBTYPE type, const std::vector<im::tf::AssayTestResult>& results, const im::tf::ReagentInfoTable& reag)
+{
+    if (IsRunning() || results.empty())
+    {
+        return false;
+    }
+
+    ULOG(LOG_INFO, "%s(type: %d, size: %d)", __FUNCTION__, int(type), int(results.size()));
+
+    // 每个任务使用新的状态，已取消任务中剩余的块不会影响新任务
+    auto job = std::make_shared<JobState>();
+    job->owner = this;
+    job->type = type;
+    job->total = int(results.size());
+    job->pendingChunks = (job->total + RECALC_JOB_CHUNK_SIZE - 1) / RECALC_JOB_CHUNK_SIZE;
+    job->running = true;
+    m_job = job;
+    emit progress(0, job->total);
+
+    for (int start = 0; start < job->total; start += RECALC_JOB_CHUNK_SIZE)
+    {
+        int end = std::min(start + RECALC_JOB_CHUNK_SIZE, job->total);
+        std::vector<im::tf::AssayTestResult> chunk(results.begin() + start, results.begin() + end);
+        QtConcurrent::run(JobPool(), [job, chunk, reag]()
+        {
+            // 已取消的块不再处理，但仍然要计数，保证任务能够结束
+            std::vector<im::tf::AssayTestResult> reCalced;
+            if (job->cancel)
+            {
+                ChunkDone(job, 0, 0, reCalced);
+                return;
+            }
+
+            int failed = (job->type == JOB_RECALC) ? ReCalcChunk(chunk, reag, reCalced) : SaveChunk(chunk);
+            ChunkDone(job, int(chunk.size()), failed, reCalced);
+        });
+    }
+
+    return true;
+}
+
+///
+/// @brief 所有引擎共用的工作线程池（随程序退出销毁）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+QThreadPool* ReCalcJobEngine::JobPool()
+{
+    static QThreadPool* pool = nullptr;
+    if (pool == nullptr)
+    {
+        pool = new QThreadPool(qApp);
+        pool->setMaxThreadCount(RECALC_JOB_THREADS);
+    }
+
+    return pool;
+}
+
+///
+/// @brief 重新计算一块结果
+///
+/// @param[out] reCalced  计算后的结果
+///
+/// @return 失败的结果数
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+int ReCalcJobEngine::ReCalcChunk(const std::vector<im::tf::AssayTestResult>& chunk, const im::tf::ReagentInfoTable& reag,
+    std::vector<im::tf::AssayTestResult>& reCalced)
+{
+    im::tf::AssayTestResultQueryResp resp;
+    if (!im::i6000::LogicControlProxy::ReCalcResult(resp, chunk, reag) ||
+        resp.result != ::tf::ThriftResult::THRIFT_RESULT_SUCCESS)
+    {
+        ULOG(LOG_ERROR, "ReCalcResult not success, size: %d.", int(chunk.size()));
+        return int(chunk.size());
+    }
+
+    int failed = std::max(0, int(chunk.size()) - int(resp.lstAssayTestResult.size()));
+    reCalced.swap(resp.lstAssayTestResult);
+    return failed;
+}
+
+///
+/// @brief 保存一块结果
+///
+/// @return 失败的结果数
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+int ReCalcJobEngine::SaveChunk(const std::vector<im::tf::AssayTestResult>& chunk)
+{
+    int failed = 0;
+    std::vector<int64_t> sItemId;
+    sItemId.reserve(chunk.size());
+    for (const auto& rt : chunk)
+    {
+        if (!im::i6000::LogicControlProxy::ModifyAssayTestResult(rt))
+        {
+            ULOG(LOG_ERROR, "save testresult err.");
+            ++failed;
+            continue;
+        }
+
+        sItemId.push_back(rt.testItemId);
+    }
+
+    if (sItemId.empty())
+    {
+        return failed;
+    }
+
+    // 删除重复itemid，整块只通知一次
+    std::sort(sItemId.begin(), sItemId.end());
+    sItemId.erase(std::unique(sItemId.begin(), sItemId.end()), sItemId.end());
+    ::tf::ResultLong rtl;
+    if (!im::LogicControlProxy::UpdateResultToItemHist(rtl, sItemId) || rtl.result != ::tf::ThriftResult::THRIFT_RESULT_SUCCESS)
+    {
+        ULOG(LOG_ERROR, "save item change err.");
+    }
+
+    return failed;
+}
+
+///
+/// @brief 一块处理完成（工作线程中调用）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void ReCalcJobEngine::ChunkDone(const std::shared_ptr<JobState>& job, int count, int failed, const std::vector<im::tf::AssayTestResult>& reCalced)
+{
+    job->failed += failed;
+
+    // 持锁发送信号，保证进度按顺序到达，引擎析构后不再发送
+    std::lock_guard<std::mutex> lock(job->mtx);
+    int done = (job->done += count);
+    bool last = (--job->pendingChunks == 0);
+    if (job->owner != nullptr)
+    {
+        if (!reCalced.empty())
+        {
+            emit job->owner->chunkReCalculated(reCalced);
+        }
+
+        // 两个工作线程完成的先后不定，只上报更大的进度
+        if (done > job->reported)
+        {
+            job->reported = done;
+            emit job->owner->progress(done, job->total);
+        }
+    }
+
+    if (!last)
+    {
+        return;
+    }
+
+    ULOG(LOG_INFO, "%s(type: %d, done: %d, failed: %d, canceled: %d)", __FUNCTION__, int(job->type), done, int(job->failed), bool(job->cancel));
+    job->running = false;
+    if (job->owner != nullptr)
+    {
+        emit job->owner->finished(int(job->type), job->cancel, int(job->failed));
+    }
+}
@@ -0,0 +1,199 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     ReCalcJobEngine.h
+/// @brief    重新计算的后台任务（分块并行计算、保存，支持进度和取消）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <QObject>
+#include <QThreadPool>
+#include "../thrift/im/gen-cpp/im_types.h"
+
+///
+/// @brief 重新计算的后台任务
+///     结果按块分配到线程池中处理，界面线程只接收每块的结果和进度；
+///     同一个任务的所有块使用同一份试剂（校准曲线）信息，
+///     保存时每块结束后只通知一次项目结果更新；
+///     工作线程只访问任务状态，引擎析构时只取消任务、不等待工作线程结束
+///
+class ReCalcJobEngine : public QObject
+{
+    Q_OBJECT
+
+public:
+    ///
+    /// @brief 任务类型
+    ///
+    enum JOBTYPE
+    {
+        JOB_RECALC = 0,         ///< 重新计算
+        JOB_SAVE                ///< 保存计算结果
+    };
+
+    explicit ReCalcJobEngine(QObject* parent = Q_NULLPTR);
+    ~ReCalcJobEngine();
+
+    ///
+    /// @brief 开始重新计算
+    ///
+    /// @param[in]  results  待计算的结果
+    /// @param[in]  reag     使用的试剂（校准曲线）
+    ///
+    /// @return true:任务已开始，false:有任务正在执行或结果为空
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool StartReCalc(const std::vector<im::tf::AssayTestResult>& results, const im::tf::ReagentInfoTable& reag);
+
+    ///
+    /// @brief 开始保存计算结果
+    ///
+    /// @param[in]  results  已计算的结果
+    ///
+    /// @return true:任务已开始，false:有任务正在执行或结果为空
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool StartSave(const std::vector<im::tf::AssayTestResult>& results);
+
+    ///
+    /// @brief 取消当前任务（正在处理的块完成后停止）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Cancel();
+
+    ///
+    /// @brief 是否有任务正在执行
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    bool IsRunning() const { return m_job != nullptr && m_job->running; }
+
+signals:
+    ///
+    /// @brief 一块结果计算完成
+    ///
+    /// @param[in]  results  计算后的结果
+    ///
+    void chunkReCalculated(std::vector<im::tf::AssayTestResult> results);
+
+    ///
+    /// @brief 进度更新（同一任务中只增不减）
+    ///
+    /// @param[in]  done   已处理的结果数
+    /// @param[in]  total  结果总数
+    ///
+    void progress(int done, int total);
+
+    ///
+    /// @brief 任务结束
+    ///
+    /// @param[in]  type      任务类型
+    /// @param[in]  canceled  是否被取消
+    /// @param[in]  failed    处理失败的结果数
+    ///
+    void finished(int type, bool canceled, int failed);
+
+private:
+    ///
+    /// @brief 一个任务的状态（工作线程和引擎共享，引擎析构后工作线程仍可安全访问）
+    ///
+    struct JobState
+    {
+        std::mutex                  mtx;                ///< 保护owner和reported，发送信号时持有
+        ReCalcJobEngine*            owner = nullptr;    ///< 所属引擎，引擎析构时置空
+        JOBTYPE                     type = JOB_RECALC;  ///< 任务类型
+        int                         total = 0;          ///< 结果总数
+        int                         reported = 0;       ///< 已上报的进度
+        std::atomic<bool>           running{ false };   ///< 是否正在执行
+        std::atomic<bool>           cancel{ false };    ///< 是否已取消
+        std::atomic<int>            pendingChunks{ 0 }; ///< 未完成的块数
+        std::atomic<int>            done{ 0 };          ///< 已处理的结果数
+        std::atomic<int>            failed{ 0 };        ///< 失败的结果数
+    };
+
+    ///
+    /// @brief 开始任务，把结果分块放入线程池
+    ///
+    bool Start(JOBTYPE type, const std::vector<im::tf::AssayTestResult>& results, const im::tf::ReagentInfoTable& reag);
+
+    ///
+    /// @brief 所有引擎共用的工作线程池（随程序退出销毁）
+    ///
+    static QThreadPool* JobPool();
+
+    ///
+    /// @brief 重新计算一块结果
+    ///
+    /// @param[out] reCalced  计算后的结果
+    ///
+    /// @return 失败的结果数
+    ///
+    static int ReCalcChunk(const std::vector<im::tf::AssayTestResult>& chunk, const im::tf::ReagentInfoTable& reag,
+        std::vector<im::tf::AssayTestResult>& reCalced);
+
+    ///
+    /// @brief 保存一块结果
+    ///
+    /// @return 失败的结果数
+    ///
+    static int SaveChunk(const std::vector<im::tf::AssayTestResult>& chunk);
+
+    ///
+    /// @brief 一块处理完成（工作线程中调用）
+    ///
+    static void ChunkDone(const std::shared_ptr<JobState>& job, int count, int failed, const std::vector<im::tf::AssayTestResult>& reCalced);
+
+private:
+    std::shared_ptr<JobState>       m_job;              ///< 当前（或最近一次）任务
+};
+
+Q_DECLARE_METATYPE(std::vector<im::tf::AssayTestResult>);
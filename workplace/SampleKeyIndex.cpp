@@ -0,0 +1,340 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     SampleKeyIndex.cpp
+/// @brief    样本关键字二级索引（精确、前缀、包含匹配）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#include "SampleKeyIndex.h"
+#include <algorithm>
+#include <iterator>
+
+namespace
+{
+    // 向升序列表中插入（样本主键多为递增，通常直接追加）
+    void InsertSorted(std::vector<int64_t>& dbs, int64_t db)
+    {
+        if (dbs.empty() || dbs.back() < db)
+        {
+            dbs.push_back(db);
+            return;
+        }
+
+        auto iter = std::lower_bound(dbs.begin(), dbs.end(), db);
+        if (iter == dbs.end() || *iter != db)
+        {
+            dbs.insert(iter, db);
+        }
+    }
+
+    // 从升序列表中删除，返回删除后是否为空
+    bool EraseSorted(std::vector<int64_t>& dbs, int64_t db)
+    {
+        auto iter = std::lower_bound(dbs.begin(), dbs.end(), db);
+        if (iter != dbs.end() && *iter == db)
+        {
+            dbs.erase(iter);
+        }
+
+        return dbs.empty();
+    }
+}
+
+///
+/// @brief 设置主键对应的关键字（空关键字等同于移除）
+///
+/// @param[in]  db   主键
+/// @param[in]  key  关键字
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void SampleKeyIndex::Set(int64_t db, const std::string& key)
+{
+    auto iter = m_dbKeys.find(db);
+    if (iter != m_dbKeys.end())
+    {
+        // 关键字未变化，无需更新
+        if (iter->second == key)
+        {
+            return;
+        }
+
+        RemoveKey(db, iter->second);
+        m_dbKeys.erase(iter);
+    }
+
+    if (key.empty())
+    {
+        return;
+    }
+
+    m_dbKeys[db] = key;
+    AddKey(db, key);
+}
+
+///
+/// @brief 移除主键
+///
+/// @param[in]  db  主键
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void SampleKeyIndex::Remove(int64_t db)
+{
+    auto iter = m_dbKeys.find(db);
+    if (iter == m_dbKeys.end())
+    {
+        return;
+    }
+
+    RemoveKey(db, iter->second);
+    m_dbKeys.erase(iter);
+}
+
+///
+/// @brief 清空索引
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+void SampleKeyIndex::Clear()
+{
+    m_dbKeys.clear();
+    m_keyDbs.clear();
+    m_gramDbs.clear();
+}
+
+///
+/// @brief 精确匹配
+///
+/// @param[in]  key  关键字
+///
+/// @return 主键列表（升序）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<int64_t> SampleKeyIndex::FindExact(const std::string& key) const
+{
+    auto iter = m_keyDbs.find(key);
+    if (iter == m_keyDbs.end())
+    {
+        return {};
+    }
+
+    return iter->second;
+}
+
+///
+/// @brief 前缀匹配
+///
+/// @param[in]  prefix  前缀（为空时返回全部）
+///
+/// @return 主键列表（升序）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<int64_t> SampleKeyIndex::FindPrefix(const std::string& prefix) const
+{
+    std::vector<int64_t> result;
+    for (auto iter = m_keyDbs.lower_bound(prefix); iter != m_keyDbs.end(); ++iter)
+    {
+        // 有序表中前缀相同的关键字是连续的
+        if (iter->first.compare(0, prefix.size(), prefix) != 0)
+        {
+            break;
+        }
+
+        result.insert(result.end(), iter->second.begin(), iter->second.end());
+    }
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+///
+/// @brief 包含匹配
+///
+/// @param[in]  part  子串（为空时返回全部）
+///
+/// @return 主键列表（升序）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<int64_t> SampleKeyIndex::FindContains(const std::string& part) const
+{
+    // 子串过短无法使用n-gram，退化为遍历不重复的关键字
+    if (part.size() < GRAM_SIZE)
+    {
+        std::vector<int64_t> result;
+        for (const auto& keyDbs : m_keyDbs)
+        {
+            if (keyDbs.first.find(part) != std::string::npos)
+            {
+                result.insert(result.end(), keyDbs.second.begin(), keyDbs.second.end());
+            }
+        }
+
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    // 取出每个n-gram的倒排表，任一不存在则必然无匹配
+    std::vector<const std::vector<int64_t>*> postings;
+    for (auto gram : ExtractGrams(part))
+    {
+        auto iter = m_gramDbs.find(gram);
+        if (iter == m_gramDbs.end())
+        {
+            return {};
+        }
+
+        postings.push_back(&iter->second);
+    }
+
+    // 从最短的倒排表开始求交
+    std::sort(postings.begin(), postings.end(), [](const std::vector<int64_t>* a, const std::vector<int64_t>* b)
+    {
+        return a->size() < b->size();
+    });
+
+    std::vector<int64_t> candidates = *postings.front();
+    for (size_t i = 1; i < postings.size() && !candidates.empty(); ++i)
+    {
+        std::vector<int64_t> merged;
+        std::set_intersection(candidates.begin(), candidates.end(),
+            postings[i]->begin(), postings[i]->end(), std::back_inserter(merged));
+        candidates.swap(merged);
+    }
+
+    // n-gram全部命中不代表连续出现，需要用原关键字校验
+    std::vector<int64_t> result;
+    result.reserve(candidates.size());
+    for (auto db : candidates)
+    {
+        auto iter = m_dbKeys.find(db);
+        if (iter != m_dbKeys.end() && iter->second.find(part) != std::string::npos)
+        {
+            result.push_back(db);
+        }
+    }
+
+    return result;
+}
+
+///
+/// @brief 获取主键当前的关键字
+///
+/// @param[in]  db  主键
+///
+/// @return 关键字（不存在时为空）
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::string SampleKeyIndex::GetKey(int64_t db) const
+{
+    auto iter = m_dbKeys.find(db);
+    return (iter == m_dbKeys.end()) ? std::string() : iter->second;
+}
+
+///
+/// @brief 提取关键字中去重后的n-gram
+///
+/// @param[in]  key  关键字（长度需不小于GRAM_SIZE）
+///
+/// @return n-gram列表
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+std::vector<uint32_t> SampleKeyIndex::ExtractGrams(const std::string& key)
+{
+    std::vector<uint32_t> grams;
+    if (key.size() < GRAM_SIZE)
+    {
+        return grams;
+    }
+
+    grams.reserve(key.size() - GRAM_SIZE + 1);
+    for (size_t i = 0; i + GRAM_SIZE <= key.size(); ++i)
+    {
+        uint32_t gram = (uint32_t(uint8_t(key[i])) << 16)
+            | (uint32_t(uint8_t(key[i + 1])) << 8)
+            | uint32_t(uint8_t(key[i + 2]));
+        grams.push_back(gram);
+    }
+
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+void SampleKeyIndex::AddKey(int64_t db, const std::string& key)
+{
+    InsertSorted(m_keyDbs[key], db);
+    for (auto gram : ExtractGrams(key))
+    {
+        InsertSorted(m_gramDbs[gram], db);
+    }
+}
+
+void SampleKeyIndex::RemoveKey(int64_t db, const std::string& key)
+{
+    auto iterKey = m_keyDbs.find(key);
+    if (iterKey != m_keyDbs.end() && EraseSorted(iterKey->second, db))
+    {
+        m_keyDbs.erase(iterKey);
+    }
+
+    for (auto gram : ExtractGrams(key))
+    {
+        auto iterGram = m_gramDbs.find(gram);
+        if (iterGram != m_gramDbs.end() && EraseSorted(iterGram->second, db))
+        {
+            m_gramDbs.erase(iterGram);
+        }
+    }
+}
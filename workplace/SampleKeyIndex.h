@@ -0,0 +1,170 @@
+﻿/***************************************************************************
+*   This file is part of the leonis project                               *
+*   Copyright (C) 2024 by Mike Medical Electronics Co., Ltd               *
+*   zhouguangming@maccura.com                                             *
+*                                                                         *
+**                   GNU General Public License Usage                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation, either version 3 of the License, or     *
+*   (at your option) any later version.                                   *
+*   You should have received a copy of the GNU General Public License     *
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>. *
+*                                                                         *
+**                  GNU Lesser General Public License                    **
+*                                                                         *
+*   This library is free software: you can redistribute it and/or modify  *
+*   it under the terms of the GNU Lesser General Public License as        *
+*   published by the Free Software Foundation, either version 3 of the    *
+*   License, or (at your option) any later version.                       *
+*   You should have received a copy of the GNU Lesser General Public      *
+*   License along with this library.                                      *
+*   If not, see <http://www.gnu.org/licenses/>.                           *
+*                                                                         *
+*   This library is distributed in the hope that it will be useful,       *
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+*   GNU General Public License for more details.                          *
+****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+/// @file     SampleKeyIndex.h
+/// @brief    样本关键字二级索引（精确、前缀、包含匹配）
+///
+/// @author   5774/WuHongTao
+/// @date     2026年10月19日
+/// @version  0.1
+///
+/// @par Copyright(c):
+///     2015 迈克医疗电子有限公司，All rights reserved.
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建文件
+///
+///////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+///
+/// @brief 样本关键字索引
+///
+/// 记录“样本主键--关键字”（条码、样本号等），支持：
+///     精确匹配：有序表查找
+///     前缀匹配：有序表lower_bound区间
+///     包含匹配：三字节n-gram倒排表求交后校验
+/// 每个主键只对应一个关键字，Set时自动移除旧关键字，便于增删改时增量维护。
+/// 非线程安全，由持有者加锁。
+///
+class SampleKeyIndex
+{
+public:
+    SampleKeyIndex() = default;
+
+    ///
+    /// @brief 设置主键对应的关键字（空关键字等同于移除）
+    ///
+    /// @param[in]  db   主键
+    /// @param[in]  key  关键字
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Set(int64_t db, const std::string& key);
+
+    ///
+    /// @brief 移除主键
+    ///
+    /// @param[in]  db  主键
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Remove(int64_t db);
+
+    ///
+    /// @brief 清空索引
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    void Clear();
+
+    ///
+    /// @brief 精确匹配
+    ///
+    /// @param[in]  key  关键字
+    ///
+    /// @return 主键列表（升序）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::vector<int64_t> FindExact(const std::string& key) const;
+
+    ///
+    /// @brief 前缀匹配
+    ///
+    /// @param[in]  prefix  前缀（为空时返回全部）
+    ///
+    /// @return 主键列表（升序）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::vector<int64_t> FindPrefix(const std::string& prefix) const;
+
+    ///
+    /// @brief 包含匹配
+    ///
+    /// @param[in]  part  子串（为空时返回全部）
+    ///
+    /// @return 主键列表（升序）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::vector<int64_t> FindContains(const std::string& part) const;
+
+    ///
+    /// @brief 获取主键当前的关键字
+    ///
+    /// @param[in]  db  主键
+    ///
+    /// @return 关键字（不存在时为空）
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    std::string GetKey(int64_t db) const;
+
+    size_t Size() const { return m_dbKeys.size(); };
+
+private:
+    // n-gram长度，条码多为数字，三字节时倒排表有足够的区分度
+    static const size_t GRAM_SIZE = 3;
+
+    ///
+    /// @brief 提取关键字中去重后的n-gram
+    ///
+    /// @param[in]  key  关键字（长度需不小于GRAM_SIZE）
+    ///
+    /// @return n-gram列表
+    ///
+    /// @par History:
+    /// @li 5774/WuHongTao，2026年10月19日，新建函数
+    ///
+    static std::vector<uint32_t> ExtractGrams(const std::string& key);
+
+    void AddKey(int64_t db, const std::string& key);
+    void RemoveKey(int64_t db, const std::string& key);
+
+    std::unordered_map<int64_t, std::string>                m_dbKeys;           ///< 主键--关键字
+    std::map<std::string, std::vector<int64_t>>             m_keyDbs;           ///< 关键字--主键（有序，用于精确和前缀匹配）
+    std::unordered_map<uint32_t, std::vector<int64_t>>      m_gramDbs;          ///< n-gram--主键（升序倒排表）
+};
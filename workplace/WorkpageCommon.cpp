@@ -29,10 +29,14 @@
 ****************************************************************************/
 
 #include "WorkpageCommon.h"
+#include <numeric>
+#include <functional>
 #include <QPixmap>
 #include <QString>
 #include <QPushButton>
 #include <QGridLayout>
+#include <QThreadPool>
+#include <QtConcurrent/QtConcurrent>
 #include "QSampleAssayModel.h"
 #include "QHistorySampleAssayModel.h"
 #include <boost/date_time/posix_time/ptime.hpp>
@@ -51,6 +55,8 @@
 #include "shared/messagebus.h"
 
 #define MAXWIDTH 500
+#define EXPORT_FETCH_CHUNK		(64)			// 批量查询结果时每个任务的项目数
+#define EXPORT_FETCH_THREADS	(4)				// 批量查询结果的最大并发数
 
 
 // 默认状态
@@ -232,7 +238,7 @@ bool ConstructHistoryExportItemInfo::BuildExportItemInfo(const std::shared_ptr<H
 		exportData.strItemName = QString::fromStdString(spCalcAssayInfo->name);
 		// 重复次数
 		exportData.strFirstTestCounts = " ";
-		auto resultVec = WorkpageCommon::GetCalcAssayTestResult(spHisTestIetm->m_itemId);
+		auto resultVec = (m_pPrefetch != nullptr) ? m_pPrefetch->calcResults : WorkpageCommon::GetCalcAssayTestResult(spHisTestIetm->m_itemId);
 		for (const auto result : resultVec)
 		{
 			if (!WorkpageCommon::GetCalcResultExport(result, exportData))
@@ -252,7 +258,7 @@ bool ConstructHistoryExportItemInfo::BuildExportItemInfo(const std::shared_ptr<H
 		}
 
 		// 校准次数
-		int caliTimes = WorkpageCommon::GetcaliTimes(m_caliSampleIdMap, spHisTestIetm->m_sampleId, assayCode);
+		int caliTimes = (m_pPrefetch != nullptr) ? m_pPrefetch->caliTimes : WorkpageCommon::GetcaliTimes(m_caliSampleIdMap, spHisTestIetm->m_sampleId, assayCode);
 		exportData.strCaliCount = QString::number(caliTimes);
 
 		// 项目名称
@@ -262,7 +268,7 @@ bool ConstructHistoryExportItemInfo::BuildExportItemInfo(const std::shared_ptr<H
 		if (CommonInformationManager::GetInstance()->IsAssayISE(assayCode))
 		{
 			// 导出ISE结果信息
-			auto resultVec = WorkpageCommon::GetIseAssayTestResult(spHisTestIetm->m_itemId);
+			auto resultVec = (m_pPrefetch != nullptr) ? m_pPrefetch->iseResults : WorkpageCommon::GetIseAssayTestResult(spHisTestIetm->m_itemId);
 			for (const auto result : resultVec)
 			{
 				if (!WorkpageCommon::GetIseResultExport(result, exportData))
@@ -277,7 +283,7 @@ bool ConstructHistoryExportItemInfo::BuildExportItemInfo(const std::shared_ptr<H
 		else
 		{
 			// 导出CH结果信息
-			auto resultVec = WorkpageCommon::GetChAssayTestResult(spHisTestIetm->m_itemId);
+			auto resultVec = (m_pPrefetch != nullptr) ? m_pPrefetch->chResults : WorkpageCommon::GetChAssayTestResult(spHisTestIetm->m_itemId);
 			for (const auto result : resultVec)
 			{
 				if (!WorkpageCommon::GetChResultExport(result, exportData))
@@ -308,7 +314,14 @@ bool ConstructHistoryExportItemInfo::BuildExportSampleInfo(const std::shared_ptr
 
 	// 获取样本信息
 	std::shared_ptr<HistoryBaseDataSample> spSample = nullptr;
-	QHistorySampleAssayModel::Instance().GetSamplesInSelectedItems(spHisTestIetm, spSample);
+	if (m_pPrefetch != nullptr)
+	{
+		spSample = m_pPrefetch->spSample;
+	}
+	else
+	{
+		QHistorySampleAssayModel::Instance().GetSamplesInSelectedItems(spHisTestIetm, spSample);
+	}
 	if (spSample != nullptr)
 	{
 		// 样本管类型
@@ -447,8 +460,20 @@ void ConstructHisExportInfo::ProcessData(std::vector<std::shared_ptr<HistoryBase
 	}
 
 	ConstructHistoryExportItemInfo::ClearCaliMap();
+
+	// 1.筛选需要导出的项目，并按类型收集项目id
+	std::vector<std::shared_ptr<HistoryBaseDataByItem>> exportItems;
+	std::vector<int64_t> chItemIds;
+	std::vector<int64_t> iseItemIds;
+	std::vector<int64_t> calcItemIds;
+	exportItems.reserve(dataItemVec.size());
 	for (const auto& dataItem : dataItemVec)
 	{
+		if (dataItem == nullptr)
+		{
+			continue;
+		}
+
         bool isCalc = CommonInformationManager::GetInstance()->IsCalcAssay(dataItem->m_assayCode);
 		// 是否含有生化项目，对于联机版生化页面导出，当含有生化项目的时候，才导出对应的计算项目
 		if (isCalc)
@@ -474,7 +499,99 @@ void ConstructHisExportInfo::ProcessData(std::vector<std::shared_ptr<HistoryBase
 			continue;
 		}
 
-		ProcessOnebyOne(dataItem);
+		exportItems.push_back(dataItem);
+		if (isCalc)
+		{
+			calcItemIds.push_back(dataItem->m_itemId);
+		}
+		else if (CommonInformationManager::GetInstance()->IsAssayISE(dataItem->m_assayCode))
+		{
+			iseItemIds.push_back(dataItem->m_itemId);
+		}
+		else
+		{
+			chItemIds.push_back(dataItem->m_itemId);
+		}
+	}
+
+	if (exportItems.empty())
+	{
+		return;
+	}
+
+	// 2.批量查询结果和样本信息
+	auto chResults = WorkpageCommon::GetChAssayTestResults(chItemIds);
+	auto iseResults = WorkpageCommon::GetIseAssayTestResults(iseItemIds);
+	auto calcResults = WorkpageCommon::GetCalcAssayTestResults(calcItemIds);
+	std::map<int64_t, std::shared_ptr<HistoryBaseDataSample>> samples;
+	QHistorySampleAssayModel::Instance().GetSamplesInSelectedItems(exportItems, samples);
+
+	// 校准次数与导出顺序相关，按原始顺序计算
+	// 查询时项目ID已去重，多个导出项目可能对应同一ID，结果须拷贝不能移走
+	std::vector<HisExportPrefetch> prefetchs(exportItems.size());
+	auto& caliMap = ConstructHistoryExportItemInfo::GetCaliMap();
+	for (size_t i = 0; i < exportItems.size(); i++)
+	{
+		const auto& dataItem = exportItems[i];
+		auto& prefetch = prefetchs[i];
+		auto iterSample = samples.find(dataItem->m_sampleId);
+		if (iterSample != samples.end())
+		{
+			prefetch.spSample = iterSample->second;
+		}
+
+		if (CommonInformationManager::GetInstance()->IsCalcAssay(dataItem->m_assayCode))
+		{
+			auto iterCalc = calcResults.find(dataItem->m_itemId);
+			if (iterCalc != calcResults.end())
+			{
+				prefetch.calcResults = iterCalc->second;
+			}
+			continue;
+		}
+
+		prefetch.caliTimes = WorkpageCommon::GetcaliTimes(caliMap, dataItem->m_sampleId, dataItem->m_assayCode);
+		if (CommonInformationManager::GetInstance()->IsAssayISE(dataItem->m_assayCode))
+		{
+			auto iterIse = iseResults.find(dataItem->m_itemId);
+			if (iterIse != iseResults.end())
+			{
+				prefetch.iseResults = iterIse->second;
+			}
+		}
+		else
+		{
+			auto iterCh = chResults.find(dataItem->m_itemId);
+			if (iterCh != chResults.end())
+			{
+				prefetch.chResults = iterCh->second;
+			}
+		}
+	}
+
+	// 3.并行生成每个项目的导出数据
+	std::vector<ConstructHistoryExportItemInfo> builders(exportItems.size());
+	std::vector<int> indexs(exportItems.size());
+	std::vector<char> buildOk(exportItems.size(), 0);
+	std::iota(indexs.begin(), indexs.end(), 0);
+	QtConcurrent::blockingMap(indexs, [&](const int& index)
+	{
+		auto& builder = builders[index];
+		builder.SetData(exportItems[index]);
+		builder.SetPrefetch(&prefetchs[index]);
+		SampleExportInfo sampleExportData;
+		buildOk[index] = builder.BuildExportDataInfo(sampleExportData) ? 1 : 0;
+	});
+
+	// 4.按原始顺序合并
+	for (size_t i = 0; i < exportItems.size(); i++)
+	{
+		if (buildOk[i] == 0)
+		{
+			continue;
+		}
+
+		MergeExportData(GetExportType(exportItems[i]), builders[i]);
 	}
 }
 
@@ -494,7 +611,11 @@ bool ConstructHisExportInfo::ProcessOnebyOne(const std::shared_ptr<HistoryBaseDa
 		return false;
 	}
 
-	auto exportType = GetExportType(spTestItemInfo);
+	return MergeExportData(GetExportType(spTestItemInfo), testItemDataExport);
+}
+
+bool ConstructHisExportInfo::MergeExportData(const ExportType exportType, ConstructHistoryExportItemInfo& testItemDataExport)
+{
 	auto& exportData = testItemDataExport.GetExportData();
 	if (exportData.empty())
 	{
@@ -1452,6 +1573,81 @@ std::vector<std::shared_ptr<tf::CalcAssayTestResult>> WorkpageCommon::GetCalcAss
 
 }
 
+///
+/// @brief 按测试项目id分块并行查询结果
+///
+/// @param[in]  itemIds  测试项目id列表
+/// @param[in]  fetch    单个项目的查询函数
+///
+/// @return 测试项目id->结果列表
+///
+/// @par History:
+/// @li 5774/WuHongTao，2026年10月19日，新建函数
+///
+template <typename T>
+std::map<int64_t, std::vector<std::shared_ptr<T>>> BatchFetchByItemId(const std::vector<int64_t>& itemIds,
+	std::function<std::vector<std::shared_ptr<T>>(int64_t)> fetch)
+{
+	std::map<int64_t, std::vector<std::shared_ptr<T>>> results;
+	std::vector<int64_t> ids(itemIds);
+	std::sort(ids.begin(), ids.end());
+	ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+	if (ids.empty())
+	{
+		return results;
+	}
+
+	// 分块，每块一个任务
+	std::vector<std::vector<int64_t>> chunks;
+	for (size_t i = 0; i < ids.size(); i += EXPORT_FETCH_CHUNK)
+	{
+		chunks.emplace_back(ids.begin() + i, ids.begin() + std::min(ids.size(), i + EXPORT_FETCH_CHUNK));
+	}
+
+	// 单独的线程池，限制对后台的并发查询数
+	QThreadPool pool;
+	pool.setMaxThreadCount(EXPORT_FETCH_THREADS);
+	std::vector<std::map<int64_t, std::vector<std::shared_ptr<T>>>> chunkResults(chunks.size());
+	QList<QFuture<void>> futures;
+	for (size_t i = 0; i < chunks.size(); i++)
+	{
+		futures.append(QtConcurrent::run(&pool, [&, i]()
+		{
+			for (int64_t id : chunks[i])
+			{
+				chunkResults[i][id] = fetch(id);
+			}
+		}));
+	}
+
+	for (auto& future : futures)
+	{
+		future.waitForFinished();
+	}
+
+	for (auto& chunkResult : chunkResults)
+	{
+		results.insert(std::make_move_iterator(chunkResult.begin()), std::make_move_iterator(chunkResult.end()));
+	}
+
+	return results;
+}
+
+std::map<int64_t, std::vector<std::shared_ptr<ch::tf::AssayTestResult>>> WorkpageCommon::GetChAssayTestResults(const std::vector<int64_t>& itemIds)
+{
+	return BatchFetchByItemId<ch::tf::AssayTestResult>(itemIds, &WorkpageCommon::GetChAssayTestResult);
+}
+
+std::map<int64_t, std::vector<std::shared_ptr<ise::tf::AssayTestResult>>> WorkpageCommon::GetIseAssayTestResults(const std::vector<int64_t>& itemIds)
+{
+	return BatchFetchByItemId<ise::tf::AssayTestResult>(itemIds, &WorkpageCommon::GetIseAssayTestResult);
+}
+
+std::map<int64_t, std::vector<std::shared_ptr<tf::CalcAssayTestResult>>> WorkpageCommon::GetCalcAssayTestResults(const std::vector<int64_t>& itemIds)
+{
+	return BatchFetchByItemId<tf::CalcAssayTestResult>(itemIds, &WorkpageCommon::GetCalcAssayTestResult);
+}
+
 std::shared_ptr<ch::tf::AssayTestResult> WorkpageCommon::GetAssayResultByid(int64_t id)
 {
 	ch::tf::AssayTestResultQueryCond queryAssaycond;
@@ -106,11 +106,25 @@ private:
 	int64_t					m_itemKey;
 };
 
+///
+/// @brief 历史数据导出的预取数据（批量查询的结果，避免逐条查询）
+///
+struct HisExportPrefetch
+{
+	std::shared_ptr<HistoryBaseDataSample>					spSample;		///< 样本信息
+	int														caliTimes = 0;	///< 校准次数
+	std::vector<std::shared_ptr<ch::tf::AssayTestResult>>	chResults;		///< 生化结果
+	std::vector<std::shared_ptr<ise::tf::AssayTestResult>>	iseResults;		///< ISE结果
+	std::vector<std::shared_ptr<tf::CalcAssayTestResult>>	calcResults;	///< 计算项目结果
+};
+
 class ConstructHistoryExportItemInfo : public ConstructExportDataInfo
 {
 public:
 	static void ClearCaliMap() { m_caliSampleIdMap.clear(); };
+	static std::map<int64_t, std::map<int, int>>& GetCaliMap() { return m_caliSampleIdMap; };
 	void SetData(const std::shared_ptr<HistoryBaseDataByItem>& spHisTestIetm);
+	void SetPrefetch(const HisExportPrefetch* pPrefetch) { m_pPrefetch = pPrefetch; };
 	std::vector<SampleExportInfo>& GetExportData() { return m_exportDatas; };
 	QVariantList& GetExtendTitle() { return m_titleExtend; };
 	virtual bool BuildExportDataInfo(SampleExportInfo& exportData);
@@ -121,6 +135,7 @@ private:
 	QVariantList									m_titleExtend;
 	std::vector<SampleExportInfo>					m_exportDatas;
 	std::shared_ptr<HistoryBaseDataByItem>			m_spHisTestIetm;
+	const HisExportPrefetch*						m_pPrefetch = nullptr;	///< 预取数据，为空时逐条查询
 	static std::map<int64_t, std::map<int, int>>	m_caliSampleIdMap;
 };
 
@@ -143,6 +158,7 @@ public:
 	std::map<ExportType, QVariantList>& GetExtendTitleMap() { return m_titleExtendMap; };
 private:
 	bool ProcessOnebyOne(const std::shared_ptr<HistoryBaseDataByItem>& hisTestItem);
+	bool MergeExportData(const ExportType exportType, ConstructHistoryExportItemInfo& testItemDataExport);
 	const ExportType GetExportType(const std::shared_ptr<HistoryBaseDataByItem>& hisTestItem);
 private:
 	std::map<ExportType, SampleExportVec> m_sampleExportDataVec;
@@ -322,6 +338,20 @@ namespace WorkpageCommon
 	std::vector<std::shared_ptr<ise::tf::AssayTestResult>> GetIseAssayTestResult(int64_t itemId);
 	std::vector<std::shared_ptr<tf::CalcAssayTestResult>> GetCalcAssayTestResult(int64_t itemId);
 
+	///
+	/// @brief 批量获取测试项目的结果（按项目id分块并行查询）
+	///
+	/// @param[in]  itemIds  测试项目id列表（可重复）
+	///
+	/// @return 测试项目id->结果列表
+	///
+	/// @par History:
+	/// @li 5774/WuHongTao，2026年10月19日，新建函数
+	///
+	std::map<int64_t, std::vector<std::shared_ptr<ch::tf::AssayTestResult>>> GetChAssayTestResults(const std::vector<int64_t>& itemIds);
+	std::map<int64_t, std::vector<std::shared_ptr<ise::tf::AssayTestResult>>> GetIseAssayTestResults(const std::vector<int64_t>& itemIds);
+	std::map<int64_t, std::vector<std::shared_ptr<tf::CalcAssayTestResult>>> GetCalcAssayTestResults(const std::vector<int64_t>& itemIds);
+
 	///
 	/// @brief 根据id获取结果详情
 	///
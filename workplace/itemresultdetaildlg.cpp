@@ -61,6 +61,7 @@
 #include "shared/tipdlg.h"
 #include "shared/ThriftEnumTransform.h"
 #include "shared/datetimefmttool.h"
+#include "shared/ResultDetailCache.h"
 
 #include "thrift/DcsControlProxy.h"
 #include "thrift/im/i6000/I6000LogicControlProxy.h"
@@ -585,22 +586,17 @@ QString ItemResultDetailDlg::GetItemResult(const tf::TestResultKeyInfo& stuResul
         ULOG(LOG_INFO, "%s(), stuResultKey.deviceType == tf::DeviceType::DEVICE_TYPE_C1000", __FUNCTION__);
         // 生化
         // 构造查询条件
-        ch::tf::AssayTestResultQueryCond queryAssaycond;
-        ch::tf::AssayTestResultQueryResp assayTestResult;
-        queryAssaycond.__set_id(stuResultKey.assayTestResultId);
-
-        if (!ch::c1005::LogicControlProxy::QueryAssayTestResult(assayTestResult, queryAssaycond)
-            || assayTestResult.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS
-            || assayTestResult.lstAssayTestResult.empty()
-            || !assayTestResult.lstAssayTestResult[0].__isset.conc)
+        // 从结果缓存中获取
+        auto spResult = ResultDetailCache::GetInstance().GetChResult(stuResultKey.assayTestResultId);
+        if (spResult == nullptr || !spResult->__isset.conc)
         {
             ULOG(LOG_ERROR, "Failed to query assaytestresult by id:%lld.", stuResultKey.assayTestResultId);
             return QString("");
         }
 
         // 保存结果信息
-        pVarRlt->setValue<ch::tf::AssayTestResult>(assayTestResult.lstAssayTestResult[0]);
-        auto result = assayTestResult.lstAssayTestResult[0];
+        pVarRlt->setValue<ch::tf::AssayTestResult>(*spResult);
+        auto result = *spResult;
         int left = 2;
 		// 单位倍率
 		double factor = 1.0;
@@ -895,21 +891,16 @@ void ItemResultDetailDlg::UpdateSelChItemDetailInfo(const QModelIndex& curIndex)
             return;
         }
 
-        ch::tf::AssayTestResultQueryCond queryAssaycond;
-        ch::tf::AssayTestResultQueryResp assayTestResult;
-        // 根据测试项目的ID来查询结果
-        queryAssaycond.__set_testItemId(stuTestItem.id);
-		queryAssaycond.__set_assayCode(stuTestItem.assayCode);
-
-        if (!ch::c1005::LogicControlProxy::QueryAssayTestResult(assayTestResult, queryAssaycond)
-            || assayTestResult.result != tf::ThriftResult::THRIFT_RESULT_SUCCESS)
+        // 根据测试项目的ID来查询结果（优先使用结果缓存）
+        std::vector<ch::tf::AssayTestResult> lstAssayTestResult;
+        if (!ResultDetailCache::GetInstance().GetChResultsByTestItem(stuTestItem.id, stuTestItem.assayCode, lstAssayTestResult))
         {
             ULOG(LOG_ERROR, "Failed to query ch testresult, by id:%lld, assayCode:%d.", stuTestItem.id, stuTestItem.assayCode);
             return;
         }
 
 		// 根据需求生成对应的样本bug12904
-		auto chResultVec = GennerateAssayResult(assayTestResult.lstAssayTestResult);
+		auto chResultVec = GennerateAssayResult(lstAssayTestResult);
 		pChTabWgt->Clear();
         // 依次显示结果
         int index = 1;
@@ -962,7 +953,7 @@ void ItemResultDetailDlg::UpdateSelChItemDetailInfo(const QModelIndex& curIndex)
         }
 
 		std::string endTimeStr;
-		std::for_each(assayTestResult.lstAssayTestResult.cbegin(), assayTestResult.lstAssayTestResult.cend(), [&endTimeStr](const ch::tf::AssayTestResult& result)
+		std::for_each(lstAssayTestResult.cbegin(), lstAssayTestResult.cend(), [&endTimeStr](const ch::tf::AssayTestResult& result)
 		{
 			if (endTimeStr < result.endTime)
 			{